@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) 2023-2025 The Lethe Authors
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
 
+#include <core/concurrent_tasks.h>
 #include <core/exceptions.h>
 #include <core/utilities.h>
 
@@ -13,7 +14,7 @@ main(int argc, char *argv[])
 {
   try
     {
-      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      ApplicationMPIInitFinalize mpi_initialization(argc, argv);
 
       ConditionalOStream pcout(
         std::cout, (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0));
@@ -3,6 +3,7 @@
 
 #include "fem-dem/fluid_dynamics_vans_matrix_free.h"
 
+#include <core/concurrent_tasks.h>
 #include <core/utilities.h>
 
 int
@@ -10,7 +11,7 @@ main(int argc, char *argv[])
 {
   try
     {
-      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      ApplicationMPIInitFinalize mpi_initialization(argc, argv);
 
       ConditionalOStream pcout(
         std::cout, (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0));
@@ -0,0 +1,40 @@
+#!/bin/bash
+# SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+# Strong scaling of the 3D flow around a cylinder with N MPI processes and one
+# thread per process, and with one MPI process and N threads.
+#
+# Usage: ./run_benchmark.sh <path to lethe-fluid> <N1> <N2> ...
+
+if [ "$#" -lt 2 ]; then
+  echo "Usage: $0 <path to lethe-fluid> <N1> <N2> ..."
+  exit 1
+fi
+
+lethe_fluid=$1
+shift
+
+prm=cylinder_hybrid_threads.prm
+results=benchmark_hybrid_threads.dat
+
+echo "n_cores mpi_processes threads_per_process wall_time_s" > $results
+
+for n in "$@"; do
+  # N MPI processes with one thread each
+  sed "s/set number of threads = .*/set number of threads = 1/" $prm > tmp.prm
+  start=$(date +%s.%N)
+  mpirun -np $n $lethe_fluid tmp.prm > log_mpi_$n.txt
+  end=$(date +%s.%N)
+  echo "$n $n 1 $(echo "$end - $start" | bc)" >> $results
+
+  # One MPI process with N threads
+  sed "s/set number of threads = .*/set number of threads = $n/" $prm > tmp.prm
+  start=$(date +%s.%N)
+  mpirun -np 1 $lethe_fluid tmp.prm > log_threads_$n.txt
+  end=$(date +%s.%N)
+  echo "$n 1 $n $(echo "$end - $start" | bc)" >> $results
+done
+
+rm -f tmp.prm
+cat $results
@@ -0,0 +1,100 @@
+#############################################################################
+"""
+Convert the particles of a text input file of the "file" insertion method,
+or the particles of the last output of a DEM simulation, to a binary input
+file. Binary input files are read in chunks with MPI-IO by all the processes
+("input file format = binary" in the "insertion info" subsection).
+
+Usage:
+    python3 convert-particles-to-binary.py -t particles.input -o particles.bin
+    python3 convert-particles-to-binary.py -p 01-01-00.prm -d out.pvd \
+        -o particles.bin
+"""
+#############################################################################
+'''Importing Libraries'''
+import argparse
+import numpy as np
+#############################################################################
+
+# Identifier at the beginning of the binary input files
+IDENTIFIER = b"LETHEDEM"
+
+# Columns of the binary input files, in the order in which they are stored
+COLUMNS = ["p_x", "p_y", "p_z", "v_x", "v_y", "v_z", "w_x", "w_y", "w_z",
+           "diameters", "T"]
+
+
+def read_text_file(file_name):
+    """Read a text input file of the "file" insertion method."""
+    with open(file_name, 'r') as file:
+        header = [name.strip() for name in file.readline().split(";")]
+        header = [name for name in header if name]
+        rows = []
+        for line in file:
+            values = [value.strip() for value in line.split(";")]
+            values = [float(value) for value in values if value]
+            if values:
+                rows.append(values)
+
+    data = np.array(rows, dtype=np.float64).reshape(-1, len(header))
+    return {name: data[:, i] for i, name in enumerate(header)}
+
+
+def read_simulation_output(prm_file_name, pvd_name):
+    """Read the particles of the last output of a DEM simulation."""
+    from lethe_pyvista_tools import lethe_pyvista_tools
+
+    particle = lethe_pyvista_tools("./", prm_file_name, pvd_name)
+    df = particle.get_df(-1)
+
+    data = {"p_x": df.points[:, 0], "p_y": df.points[:, 1],
+            "p_z": df.points[:, 2],
+            "v_x": df["velocity"][:, 0], "v_y": df["velocity"][:, 1],
+            "v_z": df["velocity"][:, 2],
+            "w_x": df["omega"][:, 0], "w_y": df["omega"][:, 1],
+            "w_z": df["omega"][:, 2],
+            "diameters": df["diameter"][:]}
+    if "temperature" in df.array_names:
+        data["T"] = df["temperature"][:]
+    return data
+
+
+def write_binary_file(data, file_name):
+    """Write the particles to a binary input file."""
+    n_columns = 11 if "T" in data else 10
+    n_particles = len(data["p_x"])
+
+    # Positions in 2D simulations have no z component
+    if "p_z" not in data:
+        data["p_z"] = np.zeros(n_particles)
+
+    rows = np.empty((n_particles, n_columns), dtype="<f8")
+    for i, name in enumerate(COLUMNS[:n_columns]):
+        rows[:, i] = data[name] if name in data else 0.
+
+    with open(file_name, 'wb') as file:
+        file.write(IDENTIFIER)
+        file.write(np.array([n_particles, n_columns], dtype="<u8").tobytes())
+        file.write(rows.tobytes())
+
+    print(f"{n_particles} particles written to {file_name}")
+
+
+parser = argparse.ArgumentParser(
+    description="Convert particles to a binary input file")
+parser.add_argument("-t", "--text", help="Text input file to convert")
+parser.add_argument("-p", "--prm", help="Parameter file of the simulation")
+parser.add_argument("-d", "--pvd", default="out.pvd",
+                    help="PVD file of the particles of the simulation")
+parser.add_argument("-o", "--output", default="particles.bin",
+                    help="Name of the binary input file")
+args = parser.parse_args()
+
+if args.text:
+    particles_data = read_text_file(args.text)
+elif args.prm:
+    particles_data = read_simulation_output(args.prm, args.pvd)
+else:
+    parser.error("A text input file (-t) or a parameter file (-p) is required")
+
+write_binary_file(particles_data, args.output)
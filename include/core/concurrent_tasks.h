@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_concurrent_tasks_h
+#define lethe_concurrent_tasks_h
+
+#include <deal.II/base/mpi.h>
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Check if independent tasks issuing MPI communications can be run
+ * concurrently on threads. This requires:
+ * - a single MPI process in the communicator, since the collective
+ * communications of the tasks could otherwise be ordered differently on each
+ * process,
+ * - an MPI library initialized with MPI_THREAD_MULTIPLE, since the tasks call
+ * MPI from several threads at the same time,
+ * - more than one thread available to deal.II (MultithreadInfo), otherwise
+ * the tasks are run one after the other anyway.
+ *
+ * @param[in] mpi_communicator Communicator used by the tasks.
+ *
+ * @return True if the tasks can be run concurrently.
+ */
+bool
+concurrent_tasks_are_supported(const MPI_Comm mpi_communicator);
+
+/**
+ * @brief Run tasks concurrently on threads and write what they print to the
+ * standard output in the order of the tasks once they are all finished.
+ *
+ * While the tasks run, the standard output is redirected to one buffer per
+ * task, such that the output of the tasks is not interleaved. The output
+ * written to the standard output by other threads while the tasks run is
+ * forwarded without buffering.
+ *
+ * @param[in] tasks Tasks to run.
+ * @param[out] output Stream to which the output of the tasks is written.
+ *
+ * @return Wall time spent in each task.
+ */
+std::vector<double>
+run_tasks_with_ordered_output(const std::vector<std::function<void()>> &tasks,
+                              std::ostream                             &output);
+
+/**
+ * @brief Check if the parameter file given on the command line of an
+ * application requests the concurrent execution of the auxiliary physics.
+ * The file is read before the initialization of MPI, hence it is not parsed
+ * with a ParameterHandler.
+ *
+ * @param[in] argc Number of arguments of the application.
+ * @param[in] argv Arguments of the application.
+ *
+ * @return True if the parameter file sets "auxiliary physics execution" to
+ * "concurrent".
+ */
+bool
+concurrent_auxiliary_physics_requested(int argc, char **argv);
+
+/**
+ * @brief Initialize MPI and the thread pool of a Lethe application, and
+ * finalize MPI at destruction.
+ *
+ * By default, the initialization is carried out by
+ * Utilities::MPI::MPI_InitFinalize with a single thread, which initializes
+ * MPI with MPI_THREAD_SERIALIZED. When the concurrent execution of the
+ * auxiliary physics is requested (see
+ * concurrent_auxiliary_physics_requested()), the physics solved on different
+ * threads call MPI at the same time. Since MPI_InitFinalize cannot request
+ * MPI_THREAD_MULTIPLE, MPI and the libraries initialized by MPI_InitFinalize
+ * (p4est, Zoltan and Kokkos) are then initialized by this class, and the
+ * thread pool of deal.II holds at least two threads.
+ */
+class ApplicationMPIInitFinalize
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in,out] argc Number of arguments of the application.
+   * @param[in,out] argv Arguments of the application.
+   */
+  ApplicationMPIInitFinalize(int &argc, char **&argv);
+
+  /**
+   * @brief Destructor. Releases the objects holding MPI resources and
+   * finalizes MPI.
+   */
+  ~ApplicationMPIInitFinalize();
+
+private:
+  /// Initialization of MPI with MPI_THREAD_SERIALIZED and a single thread,
+  /// null if the auxiliary physics are solved concurrently
+  std::unique_ptr<Utilities::MPI::MPI_InitFinalize> serialized_initialization;
+};
+
+#endif
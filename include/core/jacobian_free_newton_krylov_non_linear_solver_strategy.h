@@ -0,0 +1,426 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_jacobian_free_newton_krylov_non_linear_solver_strategy_h
+#define lethe_jacobian_free_newton_krylov_non_linear_solver_strategy_h
+
+#include <core/physics_solver_strategy.h>
+
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+
+#include <iomanip>
+
+/**
+ * @brief Non-linear solver for non-linear systems of equations which uses a
+ * Jacobian-free Newton-Krylov (JFNK) method with \f$\alpha\f$ relaxation.
+ *
+ * The Newton correction is obtained with a flexible GMRES solver in which the
+ * products of the Jacobian with the Krylov vectors are approximated by finite
+ * differences of the right-hand side:
+ * \f$ J v \approx \left( R(u + \epsilon v) - R(u) \right) / \epsilon \f$,
+ * where \f$ R \f$ is the residual assembled by the physics. The Krylov solver
+ * is right preconditioned by the preconditioner of the physics (e.g. ILU)
+ * built from a lagged Jacobian matrix. Since the Jacobian-vector products are
+ * consistent with the current state, the lagged matrix only affects the number
+ * of Krylov iterations. It is therefore only reassembled when the number of
+ * Krylov iterations exceeds a threshold, when the Krylov solver fails to
+ * converge, when the number of degrees of freedom changes or, if the matrix is
+ * not reused, at the beginning of every non-linear solution.
+ */
+template <typename VectorType>
+class JacobianFreeNewtonKrylovNonLinearSolverStrategy
+  : public PhysicsSolverStrategy<VectorType>
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] physics_solver A pointer to the physics solver to which the
+   * non-linear solver is attached.
+   *
+   * @param[in] param Non-linear solver parameters as specified in the
+   * simulation parameter file.
+   *
+   */
+  JacobianFreeNewtonKrylovNonLinearSolverStrategy(
+    PhysicsSolver<VectorType>         *physics_solver,
+    const Parameters::NonLinearSolver &param);
+
+
+  /**
+   * @brief Solve the non-linear system of equations.
+   *
+   */
+  void
+  solve() override;
+
+private:
+  /**
+   * @brief Finite difference approximation of the product of the Jacobian
+   * with a vector, used as the operator of the Krylov solver.
+   */
+  class JacobianVectorProduct
+  {
+  public:
+    JacobianVectorProduct(
+      JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType> &strategy)
+      : strategy(strategy)
+    {}
+
+    void
+    vmult(VectorType &dst, const VectorType &src) const
+    {
+      strategy.apply_jacobian(dst, src);
+    }
+
+  private:
+    JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType> &strategy;
+  };
+
+  /**
+   * @brief Preconditioner of the lagged Jacobian matrix, used as the
+   * preconditioner of the Krylov solver.
+   */
+  class LaggedJacobianPreconditioner
+  {
+  public:
+    LaggedJacobianPreconditioner(
+      JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType> &strategy)
+      : strategy(strategy)
+    {}
+
+    void
+    vmult(VectorType &dst, const VectorType &src) const
+    {
+      strategy.apply_lagged_preconditioner(dst, src);
+    }
+
+  private:
+    JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType> &strategy;
+  };
+
+  /**
+   * @brief Approximate the product of the Jacobian at the present solution
+   * with a vector by a first order finite difference of the right-hand side.
+   * The rows of the constrained degrees of freedom are replaced by the
+   * identity, as in the assembled matrices.
+   *
+   * @param[out] dst Approximation of the Jacobian-vector product.
+   *
+   * @param[in] src Vector multiplied by the Jacobian.
+   */
+  void
+  apply_jacobian(VectorType &dst, const VectorType &src);
+
+  /**
+   * @brief Apply the preconditioner of the lagged Jacobian matrix provided by
+   * the physics. Only the preconditioner is applied, the linear system of the
+   * lagged matrix is not solved.
+   *
+   * @param[out] dst Solution of the lagged linear system.
+   *
+   * @param[in] src Right-hand side of the lagged linear system.
+   */
+  void
+  apply_lagged_preconditioner(VectorType &dst, const VectorType &src);
+
+  /**
+   * @brief Solve the linearized system for the Newton correction with the
+   * Krylov solver and store it in the Newton update of the physics.
+   */
+  void
+  solve_jacobian_free_system();
+
+  /// Flag indicating that the lagged matrix must be reassembled at the
+  /// next Newton iteration
+  bool matrix_requires_assembly;
+
+  /// Number of degrees of freedom when the lagged matrix was assembled
+  types::global_dof_index lagged_matrix_size;
+
+  /// Right-hand side at the present solution
+  VectorType reference_rhs;
+
+  /// Newton correction computed by the Krylov solver
+  VectorType krylov_solution;
+
+  /// l2 norm of the present solution, used to scale the perturbation
+  double present_solution_norm;
+
+  /// Number of right-hand side assemblies of the last Krylov solution
+  unsigned int n_rhs_assemblies;
+};
+
+template <typename VectorType>
+JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType>::
+  JacobianFreeNewtonKrylovNonLinearSolverStrategy(
+    PhysicsSolver<VectorType>         *physics_solver,
+    const Parameters::NonLinearSolver &params)
+  : PhysicsSolverStrategy<VectorType>(physics_solver, params)
+  , matrix_requires_assembly(true)
+  , lagged_matrix_size(0)
+  , present_solution_norm(0.)
+  , n_rhs_assemblies(0)
+{}
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType>::apply_jacobian(
+  VectorType       &dst,
+  const VectorType &src)
+{
+  PhysicsSolver<VectorType> *solver = this->physics_solver;
+
+  const double src_norm = src.l2_norm();
+  if (src_norm == 0.)
+    {
+      dst = 0.;
+      return;
+    }
+
+  auto &evaluation_point       = solver->get_evaluation_point();
+  auto &local_evaluation_point = solver->get_local_evaluation_point();
+  auto &present_solution       = solver->get_present_solution();
+  auto &system_rhs             = solver->get_system_rhs();
+
+  // The perturbation is scaled such that the relative change of the solution
+  // is of the order of the square root of the machine precision
+  const double epsilon =
+    this->params.jfnk_perturbation * (1. + present_solution_norm) / src_norm;
+
+  local_evaluation_point = present_solution;
+  local_evaluation_point.add(epsilon, src);
+  solver->apply_constraints();
+  evaluation_point = local_evaluation_point;
+  solver->assemble_system_rhs();
+  ++n_rhs_assemblies;
+
+  // The right-hand side is the opposite of the residual
+  dst = reference_rhs;
+  dst -= system_rhs;
+  dst /= epsilon;
+
+  const auto &nonzero_constraints = solver->get_nonzero_constraints();
+  for (const auto i : dst.locally_owned_elements())
+    if (nonzero_constraints.is_constrained(i))
+      dst(i) = src(i);
+  dst.compress(VectorOperation::insert);
+
+  evaluation_point = present_solution;
+}
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylovNonLinearSolverStrategy<
+  VectorType>::apply_lagged_preconditioner(VectorType       &dst,
+                                           const VectorType &src)
+{
+  this->physics_solver->apply_lagged_preconditioner(dst, src);
+}
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylovNonLinearSolverStrategy<
+  VectorType>::solve_jacobian_free_system()
+{
+  PhysicsSolver<VectorType> *solver = this->physics_solver;
+
+  auto &system_rhs       = solver->get_system_rhs();
+  auto &newton_update    = solver->get_newton_update();
+  auto &present_solution = solver->get_present_solution();
+
+  reference_rhs.reinit(system_rhs, true);
+  reference_rhs = system_rhs;
+  krylov_solution.reinit(newton_update);
+
+  // The norm is computed on the locally owned copy of the solution since
+  // the present solution may hold ghost values
+  auto &local_evaluation_point = solver->get_local_evaluation_point();
+  local_evaluation_point       = present_solution;
+  present_solution_norm        = local_evaluation_point.l2_norm();
+  n_rhs_assemblies             = 0;
+
+  const JacobianVectorProduct        jacobian(*this);
+  const LaggedJacobianPreconditioner preconditioner(*this);
+
+  ReductionControl solver_control(this->params.jfnk_max_krylov_iterations,
+                                  0.,
+                                  this->params.jfnk_krylov_tolerance,
+                                  false,
+                                  false);
+
+  typename SolverFGMRES<VectorType>::AdditionalData solver_parameters(
+    this->params.jfnk_max_krylov_iterations);
+  SolverFGMRES<VectorType> krylov_solver(solver_control, solver_parameters);
+
+  try
+    {
+      krylov_solver.solve(jacobian,
+                          krylov_solution,
+                          reference_rhs,
+                          preconditioner);
+    }
+  catch (const SolverControl::NoConvergence &)
+    {
+      // The last iterate is kept as the Newton correction and the line search
+      // decides how much of it is applied. The lagged matrix is refreshed
+      // since it has become an insufficient preconditioner.
+      matrix_requires_assembly = true;
+    }
+
+  if (solver_control.last_step() >
+      this->params.jfnk_preconditioner_refresh_iterations)
+    matrix_requires_assembly = true;
+
+  if (this->params.verbosity != Parameters::Verbosity::quiet)
+    {
+      solver->pcout << "\tKrylov iterations: " << solver_control.last_step()
+                    << " - Residual assemblies: " << n_rhs_assemblies
+                    << std::endl;
+    }
+
+  newton_update = krylov_solution;
+}
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType>::solve()
+{
+  double global_res;
+  double current_res;
+  double last_res;
+  this->outer_iteration = 0;
+  last_res              = 1e6;
+  current_res           = 1e6;
+  global_res            = 1e6;
+
+  // current_res and global_res are different as one is defined based on the l2
+  // norm of the residual vector (current_res) and the other (global_res) is
+  // defined by the physical solver and may differ from the l2_norm of the
+  // residual vector. Only the global_res is compared to the tolerance in order
+  // to evaluate if the nonlinear system is solved. Only current_res is used for
+  // the alpha scheme as this scheme only monitors the convergence of the
+  // non-linear system of equation (the matrix problem).
+
+  PhysicsSolver<VectorType> *solver = this->physics_solver;
+
+  const double rescale_metric = solver->get_residual_rescale_metric();
+
+  auto &evaluation_point = solver->get_evaluation_point();
+  auto &present_solution = solver->get_present_solution();
+
+  // The lagged matrix must be reassembled if the degrees of freedom have
+  // changed since its assembly, for instance after a mesh adaptation
+  if (!this->params.reuse_matrix ||
+      present_solution.size() != lagged_matrix_size)
+    matrix_requires_assembly = true;
+
+  while ((global_res > this->params.tolerance) &&
+         this->outer_iteration < this->params.max_iterations)
+    {
+      evaluation_point = present_solution;
+
+      if (matrix_requires_assembly)
+        {
+          solver->assemble_system_matrix();
+          solver->setup_lagged_preconditioner();
+          matrix_requires_assembly = false;
+          lagged_matrix_size       = present_solution.size();
+        }
+
+      if (this->params.force_rhs_calculation || this->outer_iteration == 0)
+        solver->assemble_system_rhs();
+
+      if (this->outer_iteration == 0)
+        {
+          auto &system_rhs = solver->get_system_rhs();
+          current_res      = system_rhs.l2_norm() / rescale_metric;
+          last_res         = current_res;
+        }
+
+      if (this->params.verbosity != Parameters::Verbosity::quiet)
+        {
+          solver->pcout << "Newton iteration: " << this->outer_iteration
+                        << "  - Residual:  " << current_res << std::endl;
+        }
+
+      solve_jacobian_free_system();
+      double last_alpha_res = current_res;
+
+      unsigned int alpha_iter = 0;
+      for (double alpha = 1.0; alpha > 1e-1; alpha *= 0.5)
+        {
+          auto &local_evaluation_point = solver->get_local_evaluation_point();
+          auto &newton_update          = solver->get_newton_update();
+          local_evaluation_point       = present_solution;
+          local_evaluation_point.add(alpha, newton_update);
+          solver->apply_constraints();
+          evaluation_point = local_evaluation_point;
+          solver->assemble_system_rhs();
+
+          auto &system_rhs = solver->get_system_rhs();
+          current_res      = system_rhs.l2_norm() / rescale_metric;
+
+          if (this->params.verbosity != Parameters::Verbosity::quiet)
+            {
+              solver->pcout << "\talpha = " << std::setw(6) << alpha
+                            << std::setw(0) << " res = "
+                            << std::setprecision(this->params.display_precision)
+                            << std::setw(6) << current_res;
+
+              solver->output_newton_update_norms(
+                this->params.display_precision);
+            }
+
+          // If it's not the first iteration of alpha check if the residual is
+          // smaller than the last alpha iteration. If it's not smaller, we fall
+          // back to the last alpha iteration. The right-hand side is
+          // reassembled since it is the reference of the finite differences
+          // of the next Newton iteration.
+          if (current_res > last_alpha_res and alpha_iter != 0)
+            {
+              alpha                  = 2 * alpha;
+              local_evaluation_point = present_solution;
+              local_evaluation_point.add(alpha, newton_update);
+              solver->apply_constraints();
+              evaluation_point = local_evaluation_point;
+              solver->assemble_system_rhs();
+
+              if (this->params.verbosity != Parameters::Verbosity::quiet)
+                {
+                  solver->pcout
+                    << "\t\talpha value was kept at alpha = " << alpha
+                    << " since alpha = " << alpha / 2
+                    << " increased the residual" << std::endl;
+                }
+              current_res = last_alpha_res;
+              break;
+            }
+          if (current_res < this->params.step_tolerance * last_res ||
+              last_res < this->params.tolerance)
+            {
+              break;
+            }
+          last_alpha_res = current_res;
+          alpha_iter++;
+        }
+
+      global_res       = solver->get_current_residual() / rescale_metric;
+      present_solution = evaluation_point;
+      last_res         = current_res;
+      ++this->outer_iteration;
+    }
+
+  // If the non-linear solver has not converged abort simulation if
+  // abort_at_convergence_failure=true
+  if ((global_res > this->params.tolerance) &&
+      this->outer_iteration >= this->params.max_iterations &&
+      this->params.abort_at_convergence_failure)
+    {
+      throw(std::runtime_error(
+        "Stopping simulation because the non-linear solver has failed to converge"));
+    }
+}
+
+#endif
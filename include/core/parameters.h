@@ -103,13 +103,14 @@ namespace Parameters
 
     /**
      * Boolean indicating if adaptive time-stepping is enabled.
-     * To enable it, enable either SimulationControl::adapt_with_cfl or
-     * SimulationControl::adapt_with_capillary_time_step_ratio.
+     * To enable it, enable either SimulationControl::adapt_with_cfl,
+     * SimulationControl::adapt_with_capillary_time_step_ratio or
+     * SimulationControl::adapt_with_error.
      *
-     * @remark By default, this is set to @p false since both
-     * SimulationControl::adapt_with_cfl and
-     * SimulationControl::adapt_with_capillary_time_step_ratio are set to
-     * @p false by default.
+     * @remark By default, this is set to @p false since
+     * SimulationControl::adapt_with_cfl,
+     * SimulationControl::adapt_with_capillary_time_step_ratio and
+     * SimulationControl::adapt_with_error are set to @p false by default.
      */
     bool time_step_adaptation_required;
 
@@ -146,6 +147,22 @@ namespace Parameters
      */
     double max_capillary_time_step_ratio;
 
+    /**
+     * Boolean indicating if an estimate of the local truncation error should
+     * be controlling the simulation time step. Steps whose error exceeds the
+     * tolerance are rejected and carried out again with a smaller time step.
+     *
+     * @remark By default, this is set to @p false.
+     */
+    bool adapt_with_error;
+
+    // Absolute and relative tolerances on the local truncation error
+    double error_absolute_tolerance;
+    double error_relative_tolerance;
+
+    // Maximum number of successive rejections of a time step
+    unsigned int max_time_step_rejections;
+
     // Aimed tolerance at which simulation is stopped
     double stop_tolerance;
 
@@ -859,6 +876,22 @@ namespace Parameters
     parse_parameters(ParameterHandler &prm);
   };
 
+  /**
+   * @brief Threading - Defines the number of threads used by each MPI process
+   * for the hybrid MPI+threads execution.
+   */
+  struct Threading
+  {
+    // Number of threads of each MPI process, zero to share the cores of each
+    // node among its MPI processes
+    unsigned int number_of_threads;
+
+    static void
+    declare_parameters(ParameterHandler &prm);
+    void
+    parse_parameters(ParameterHandler &prm);
+  };
+
   /**
    * @brief Forces - Defines the parameters for the
    * force calculation on boundaries of the domain.
@@ -1032,6 +1065,16 @@ namespace Parameters
    */
   struct PostProcessing
   {
+    /// Scheme used to accumulate the time-averaged velocities and Reynolds
+    /// stresses. The cumulative scheme stores the time integrals of the
+    /// solution and of the fluctuations, whereas the Welford scheme updates
+    /// the averages and the Reynolds stresses in place in a single pass.
+    enum class AverageVelocitiesScheme : std::uint8_t
+    {
+      cumulative,
+      welford
+    };
+
     Verbosity verbosity;
 
     /// Enable total kinetic energy post-processing
@@ -1073,6 +1116,22 @@ namespace Parameters
     /// Set initial time to start calculations for velocities
     double initial_time_for_average_velocities;
 
+    /// Scheme used to accumulate the average velocities. Default values are
+    /// provided since the average velocities are also used without parsing
+    /// the parameters (e.g., in the unit tests).
+    AverageVelocitiesScheme average_velocities_scheme =
+      AverageVelocitiesScheme::cumulative;
+
+    /// Number of time steps between two updates of the average velocities
+    unsigned int average_velocities_frequency = 1;
+
+    /// Number of time steps between two binary outputs of the average
+    /// velocities and Reynolds stresses (0 disables the binary output)
+    unsigned int average_velocities_binary_output_frequency = 0;
+
+    /// Prefix for the binary output of the average velocities
+    std::string average_velocities_binary_output_name;
+
     /// Set initial time to start calculations for average temperature and
     /// average heat flux
     double initial_time_for_average_temp_and_hf;
@@ -1207,6 +1266,9 @@ namespace Parameters
     // Switch tracer to DG formulation instead of CG
     bool tracer_uses_dg;
 
+    // Solve the DG tracer with a matrix-free operator instead of a matrix
+    bool tracer_dg_uses_matrix_free;
+
     // Interpolation order vof model
     unsigned int VOF_order;
 
@@ -1217,6 +1279,9 @@ namespace Parameters
     unsigned int phase_cahn_hilliard_order;
     unsigned int potential_cahn_hilliard_order;
 
+    // Solve Cahn-Hilliard with a matrix-free operator instead of a matrix
+    bool cahn_hilliard_uses_matrix_free;
+
     // Option for bubble enrichment functions
     bool enable_bubble_function_velocity;
     bool enable_bubble_function_pressure;
@@ -1246,7 +1311,8 @@ namespace Parameters
     {
       newton,
       inexact_newton,
-      kinsol_newton
+      kinsol_newton,
+      jfnk
     };
 
     // Kinsol solver strategy
@@ -1301,6 +1367,30 @@ namespace Parameters
     // Abort solver if non-linear solution has not reached tolerance
     bool abort_at_convergence_failure;
 
+    // Reuse the cached local matrices of the cells whose solution has not
+    // changed since their last assembly (cell activity map)
+    bool enable_cell_activity_map;
+
+    // Maximal change of the cell degrees of freedom for which a cell is
+    // considered quiescent and its cached local matrix is reused
+    double cell_activity_tolerance;
+
+    // Relative perturbation of the finite differences that approximate the
+    // Jacobian-vector products of the Jacobian-free Newton-Krylov solver
+    double jfnk_perturbation;
+
+    // Relative tolerance of the Krylov solver of the Jacobian-free
+    // Newton-Krylov solver
+    double jfnk_krylov_tolerance;
+
+    // Maximal number of iterations of the Krylov solver of the Jacobian-free
+    // Newton-Krylov solver
+    unsigned int jfnk_max_krylov_iterations;
+
+    // Number of Krylov iterations above which the lagged matrix used as
+    // preconditioner by the Jacobian-free Newton-Krylov solver is reassembled
+    unsigned int jfnk_preconditioner_refresh_iterations;
+
     static void
     declare_parameters(ParameterHandler &prm, const std::string &physics_name);
     void
@@ -1359,6 +1449,23 @@ namespace Parameters
     };
     PreconditionerType preconditioner;
 
+    /// Policy for the setup of the preconditioner before a linear solve
+    ///  - always: the preconditioner is rebuilt every time it is set up,
+    ///  - adaptive: the preconditioner is kept across the linear solves (and
+    ///  time steps) and only refreshed or rebuilt when the number of
+    ///  iterations of the linear solver grows.
+    enum class PreconditionerRefreshType : std::int8_t
+    {
+      always,
+      adaptive
+    };
+    PreconditionerRefreshType preconditioner_refresh;
+
+    /// Ratio between the number of iterations of the last linear solve and of
+    /// the first solve with the current preconditioner beyond which the
+    /// adaptive policy refreshes or rebuilds the preconditioner
+    double preconditioner_refresh_iteration_ratio;
+
     /// ILU or ILUT fill
     unsigned int ilu_precond_fill;
 
@@ -1781,6 +1888,9 @@ namespace Parameters
     // imposed using nearest neighbors. the immersed boundary condition or not.
     // If it is set to false, all cut cells are fully imposed on the IB.
     bool enable_extrapolation;
+    // Boolean to determine whether the IB stencils are reused between the
+    // assemblies while the mesh and the particles do not change.
+    bool enable_stencil_cache;
 
     // Boolean for the calculation of the force at the IB
     bool calculate_force_ib;
@@ -1792,6 +1902,8 @@ namespace Parameters
     std::string ib_particles_pvd_file;
     // Boolean for printing DEM information
     bool print_dem;
+    // Boolean for printing the number of IB stencils reused at each assembly
+    bool print_stencil_reuse;
 
     // Number of initial refinements around each particle
     unsigned int initial_refinement;
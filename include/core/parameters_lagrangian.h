@@ -442,6 +442,21 @@ namespace Parameters
       /// List of input files for the file insertion method.
       std::vector<std::string> list_of_input_files;
 
+      /**
+       * @brief Format of the input files of the file insertion method.
+       */
+      enum class InsertionFileFormat
+      {
+        /// Text file with one column per particle property
+        text,
+        /// Binary file read in chunks with MPI-IO
+        binary
+      } insertion_file_format; ///< Format of the input files
+
+      /// Number of particles read at once by each process from a binary input
+      /// file.
+      unsigned int insertion_file_chunk_size;
+
       /// Normal vector of the insertion plane (plane method).
       Tensor<1, 3> insertion_plane_normal_vector;
 
@@ -483,6 +498,10 @@ namespace Parameters
       /// Minimum distance threshold between inserted particles.
       double distance_threshold;
 
+      /// Insert the particles of the volume method in the locally owned cells
+      /// of each process, without communication between the processes.
+      bool local_insertion;
+
       /// Maximum random offset applied to insertion positions.
       double insertion_maximum_offset;
 
@@ -535,7 +554,11 @@ namespace Parameters
         /// Perform load-balancing in a similar manner to
         /// LoadBalanceMethod::dynamic but considering also the mobility status
         /// of the cells.
-        dynamic_with_sparse_contacts
+        dynamic_with_sparse_contacts,
+        /// Perform load-balancing when the measured computational time of the
+        /// DEM among processes becomes too uneven. The cell weights are
+        /// derived from the measured cost of the particles (contacts).
+        dynamic_with_measured_cost
       } load_balance_method; ///< Load balancing strategy for parallel DEM
                              ///< simulations.
 
@@ -569,6 +592,19 @@ namespace Parameters
       /// (only used with adaptive sparse contacts).
       double inactive_load_balancing_factor;
 
+      /// Weight of a particle-particle contact pair used for load balancing
+      /// (only used with the measured cost load balancing).
+      unsigned int load_balance_contact_weight;
+
+      /// Weight of a particle-wall contact pair used for load balancing
+      /// (only used with the measured cost load balancing).
+      unsigned int load_balance_wall_contact_weight;
+
+      /// Relaxation factor of the exponential smoothing of the measured cell
+      /// costs between load balancing checks (only used with the measured cost
+      /// load balancing).
+      double load_balance_cost_smoothing_factor;
+
       /// Safety factor for dynamic contact search.
       double dynamic_contact_search_factor;
 
@@ -589,6 +625,38 @@ namespace Parameters
       /// particle diameter ratio).
       double neighborhood_threshold;
 
+      /**
+       * @brief Method used to find the particle-particle contact candidates
+       * during the broad search.
+       */
+      enum class BroadSearchMethod
+      {
+        /// Pair the particles located in neighbor cells of the background
+        /// triangulation.
+        cell_neighbors,
+        /// Pair the particles located in adjacent bins of a rank-local uniform
+        /// grid whose bins are sized from the neighborhood threshold and the
+        /// maximum particle diameter.
+        linked_cell,
+        /// Sort the particles into one uniform grid per diameter class and
+        /// pair them with a neighborhood sized by the diameters of the two
+        /// particles, both in the broad and the fine searches.
+        hierarchical_grid
+      } broad_search_method; ///< Method used to find the particle-particle
+                             ///< contact candidates.
+
+      /// Verbosity of the statistics (number of candidates and wall time) of
+      /// the particle-particle broad search.
+      Parameters::Verbosity broad_search_verbosity;
+
+      /// Overlap the update of the ghost particles with the calculation of the
+      /// local-local particle-particle contact forces.
+      bool overlap_ghost_update;
+
+      /// Only send the location and the properties used by the contact forces
+      /// of the ghost particles at the iterations without contact search.
+      bool reduced_ghost_update;
+
       /// Cut-off threshold beyond which Van der Waals forces are ignored.
       double dmt_cut_off_threshold;
 
@@ -618,6 +686,12 @@ namespace Parameters
       /// Solver type (DEM, CFD-DEM, or DEM multiphysics).
       DEM::SolverType solver_type;
 
+      /// Ratio between the time step of the temperature integration and the
+      /// DEM time step (DEM multiphysics). The heat transfer rate of the
+      /// contacts is calculated at the thermal iterations only and is
+      /// considered constant over the thermal time step.
+      unsigned int thermal_time_step_ratio;
+
       /// Enable sparse particle contacts to optimize performance.
       bool sparse_particle_contacts;
 
@@ -636,6 +710,16 @@ namespace Parameters
       /// Disable position integration for particles.
       bool disable_position_integration;
 
+      /// Enable the multiple time stepping of the pairs of coarse particles.
+      bool multiple_time_stepping;
+
+      /// Ratio between the time step of the pairs of coarse particles and the
+      /// DEM time step.
+      unsigned int coarse_time_step_ratio;
+
+      /// Diameter above which a particle is coarse.
+      double coarse_diameter_threshold;
+
       /**
        * @brief Declare the parameters in the parameter handler.
        *
@@ -955,6 +1039,20 @@ namespace Parameters
       /// File name for exporting collision statistics (CSV format).
       std::string collision_stats_file_name;
 
+      /// Enable the in-situ time averaging of the cell-based Eulerian fields.
+      bool time_averaging_enabled;
+
+      /// Number of DEM iterations between two samples of the time averages.
+      unsigned int time_averaging_sampling_frequency;
+
+      /// Time at which the sampling of the time averages starts.
+      double time_averaging_initial_time;
+
+      /// Number of DEM iterations between two outputs of the time averages. If
+      /// set to 0, the time averages are only written at the end of the
+      /// simulation.
+      unsigned int time_averaging_output_frequency;
+
       /**
        * @brief Declare the parameters in the parameter handler.
        *
@@ -46,6 +46,18 @@ namespace Parameters
     adaptive
   };
 
+  /**
+   * @brief Search methods of the adaptive sharpening threshold:
+   *  - bisection: the bracket of the threshold is halved at every step,
+   *  - illinois: the threshold is the root of the secant through the
+   * endpoints of the bracket (Illinois variant of the regula falsi method).
+   */
+  enum class SharpeningSearchMethod : std::int8_t
+  {
+    bisection,
+    illinois
+  };
+
   /**
    * @brief Different transformation function types for the signed distance:
    *  - tanh: hyperbolic tangent
@@ -150,8 +162,9 @@ namespace Parameters
     double threshold;
 
     // Parameters for adaptive sharpening
-    double threshold_max_deviation;
-    int    max_iterations;
+    double                 threshold_max_deviation;
+    int                    max_iterations;
+    SharpeningSearchMethod search_method;
 
     // Other sharpening parameters
     double interface_sharpness;
@@ -431,6 +444,16 @@ namespace Parameters
   };
 
 
+  /**
+   * @brief Execution of the auxiliary physics that are solved at the same
+   * stage of a time step (before or after the fluid dynamics).
+   */
+  enum class AuxiliaryPhysicsExecution : std::int8_t
+  {
+    sequential,
+    concurrent
+  };
+
   /**
    * @brief Multiphysics - the parameters for multiphysics simulations
    * and handles sub-physics parameters.
@@ -449,6 +472,9 @@ namespace Parameters
     bool viscous_dissipation;
     bool thermal_buoyancy_force;
 
+    // Execution of the mutually independent auxiliary physics
+    AuxiliaryPhysicsExecution auxiliary_physics_execution;
+
     Parameters::VOF                      vof_parameters;
     Parameters::CahnHilliard             cahn_hilliard_parameters;
     Parameters::TimeHarmonicMaxwell<dim> time_harmonic_maxwell_parameters;
@@ -6,6 +6,7 @@
 
 
 #include <core/inexact_newton_non_linear_solver_strategy.h>
+#include <core/jacobian_free_newton_krylov_non_linear_solver_strategy.h>
 #include <core/kinsol_newton_non_linear_solver_strategy.h>
 #include <core/linear_solver_strategy.h>
 #include <core/newton_non_linear_solver_strategy.h>
@@ -78,6 +79,38 @@ public:
   virtual void
   solve_linear_system() = 0;
 
+  /**
+   * @brief Set up the preconditioner of the system matrix that was last
+   * assembled, which is used as a lagged preconditioner by the Jacobian-free
+   * Newton-Krylov non-linear solver. By default, setup_preconditioner() is
+   * called.
+   */
+  virtual void
+  setup_lagged_preconditioner()
+  {
+    setup_preconditioner();
+  }
+
+  /**
+   * @brief Apply the preconditioner set up by setup_lagged_preconditioner()
+   * to a vector, without solving the linear system. The physics that can be
+   * solved with the Jacobian-free Newton-Krylov non-linear solver override
+   * this function.
+   *
+   * @param[out] dst Preconditioned vector.
+   *
+   * @param[in] src Vector to which the preconditioner is applied.
+   */
+  virtual void
+  apply_lagged_preconditioner(VectorType & /*dst*/,
+                              const VectorType & /*src*/)
+  {
+    AssertThrow(
+      false,
+      ExcMessage(
+        "This physics does not provide a lagged preconditioner and cannot be solved with the jfnk non-linear solver."));
+  }
+
   /**
    * @brief Solve the global system of equations according to a given strategy, either linear or not.
    */
@@ -183,6 +216,11 @@ PhysicsSolver<VectorType>::PhysicsSolver(
           new InexactNewtonNonLinearSolverStrategy<VectorType>(
             this, non_linear_solver_parameters);
         break;
+      case Parameters::NonLinearSolver::SolverType::jfnk:
+        physics_solving_strategy =
+          new JacobianFreeNewtonKrylovNonLinearSolverStrategy<VectorType>(
+            this, non_linear_solver_parameters);
+        break;
       default:
         break;
     }
@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_preconditioner_refresh_policy_h
+#define lethe_preconditioner_refresh_policy_h
+
+#include <core/parameters.h>
+
+#include <deal.II/base/conditional_ostream.h>
+
+using namespace dealii;
+
+/**
+ * @brief Decides whether the preconditioner of a linear system must be
+ * rebuilt, refreshed or reused before a linear solve.
+ *
+ * With the `always` policy, the preconditioner is rebuilt every time it is
+ * set up. With the `adaptive` policy, the preconditioner is kept across the
+ * linear solves and the time steps as long as the number of iterations of the
+ * linear solver remains below `iteration ratio` times the number of
+ * iterations of the first solve carried out with it. Beyond this ratio, the
+ * numerical values of the preconditioner are refreshed while keeping its
+ * structure (e.g. the aggregation of an AMG preconditioner) if the
+ * preconditioner supports it, and the preconditioner is rebuilt otherwise or
+ * if a refresh was not sufficient.
+ *
+ * The policy also accumulates the time spent in the setup of the
+ * preconditioner and in the linear solves, such that both can be reported
+ * for each physics.
+ */
+class PreconditionerRefreshPolicy
+{
+public:
+  /**
+   * @brief Actions that can be carried out on the preconditioner before a
+   * linear solve.
+   */
+  enum class Action : std::int8_t
+  {
+    rebuild,
+    refresh,
+    reuse
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] refresh_type Policy for the setup of the preconditioner.
+   * @param[in] iteration_ratio Ratio of the number of iterations beyond which
+   * the preconditioner is refreshed or rebuilt with the adaptive policy.
+   */
+  PreconditionerRefreshPolicy(
+    const Parameters::LinearSolver::PreconditionerRefreshType refresh_type,
+    const double                                              iteration_ratio);
+
+  /**
+   * @brief Constructor from the linear solver parameters of a physics.
+   *
+   * @param[in] linear_solver_parameters Linear solver parameters.
+   */
+  PreconditionerRefreshPolicy(
+    const Parameters::LinearSolver &linear_solver_parameters);
+
+  /**
+   * @brief Invalidate the preconditioner, for instance when the structure of
+   * the matrix changes. The next setup will rebuild it.
+   */
+  void
+  invalidate();
+
+  /**
+   * @brief Give the action to carry out on the preconditioner before the next
+   * linear solve.
+   *
+   * @param[in] numeric_refresh_supported Indicates if the preconditioner
+   * can recompute its numerical values while keeping its structure.
+   *
+   * @return The action to carry out.
+   */
+  Action
+  get_setup_action(const bool numeric_refresh_supported) const;
+
+  /**
+   * @brief Register the action carried out on the preconditioner.
+   *
+   * @param[in] action Action carried out.
+   * @param[in] setup_time Wall time spent in the setup of the preconditioner.
+   */
+  void
+  register_setup(const Action action, const double setup_time);
+
+  /**
+   * @brief Register a linear solve carried out with the current
+   * preconditioner.
+   *
+   * @param[in] n_iterations Number of iterations of the linear solver.
+   * @param[in] solve_time Wall time spent in the linear solver.
+   */
+  void
+  register_solve(const unsigned int n_iterations, const double solve_time);
+
+  /**
+   * @brief Print the number of setups of each kind. Nothing is printed with
+   * the `always` policy, for which the preconditioner is rebuilt at every
+   * setup. The cumulated times are not printed since they vary from one run
+   * to another, they are printed at the end of the simulation by
+   * print_total_times().
+   *
+   * @param[in] pcout Parallel output stream.
+   */
+  void
+  print_statistics(const ConditionalOStream &pcout) const;
+
+  /**
+   * @brief Print the cumulated wall times spent in the setup of the
+   * preconditioner and in the linear solves of a physics since the beginning
+   * of the simulation.
+   *
+   * @param[in] pcout Parallel output stream.
+   * @param[in] physics_name Name of the physics.
+   */
+  void
+  print_total_times(const ConditionalOStream &pcout,
+                    const std::string        &physics_name) const;
+
+  /**
+   * @brief Give the number of times the preconditioner was rebuilt.
+   */
+  inline unsigned int
+  get_n_rebuilds() const
+  {
+    return n_rebuilds;
+  }
+
+  /**
+   * @brief Give the number of times the preconditioner was refreshed.
+   */
+  inline unsigned int
+  get_n_refreshes() const
+  {
+    return n_refreshes;
+  }
+
+  /**
+   * @brief Give the number of times the preconditioner was reused.
+   */
+  inline unsigned int
+  get_n_reuses() const
+  {
+    return n_reuses;
+  }
+
+  /**
+   * @brief Give the cumulated wall time spent in the setup of the
+   * preconditioner.
+   */
+  inline double
+  get_total_setup_time() const
+  {
+    return total_setup_time;
+  }
+
+  /**
+   * @brief Give the cumulated wall time spent in the linear solves.
+   */
+  inline double
+  get_total_solve_time() const
+  {
+    return total_solve_time;
+  }
+
+private:
+  /// Policy for the setup of the preconditioner.
+  const Parameters::LinearSolver::PreconditionerRefreshType refresh_type;
+
+  /// Ratio of the number of iterations beyond which the preconditioner is
+  /// refreshed or rebuilt.
+  const double iteration_ratio;
+
+  /// Flag indicating that a preconditioner was built and is still valid.
+  bool preconditioner_is_valid;
+
+  /// Flag indicating that a linear solve was carried out since the last
+  /// rebuild or refresh of the preconditioner.
+  bool solved_since_setup;
+
+  /// Flag indicating that the preconditioner was refreshed since it was
+  /// rebuilt and that the refresh did not restore the number of iterations.
+  bool refresh_is_exhausted;
+
+  /// Number of iterations of the first linear solve after the last rebuild.
+  unsigned int reference_iterations;
+
+  /// Flag indicating that the reference number of iterations is set.
+  bool reference_is_set;
+
+  /// Number of iterations of the last linear solve.
+  unsigned int last_iterations;
+
+  /// Number of rebuilds, refreshes and reuses of the preconditioner.
+  unsigned int n_rebuilds;
+  unsigned int n_refreshes;
+  unsigned int n_reuses;
+
+  /// Cumulated wall time spent in the setup of the preconditioner.
+  double total_setup_time;
+
+  /// Cumulated wall time spent in the linear solves.
+  double total_solve_time;
+};
+
+#endif
@@ -16,6 +16,7 @@
 
 #include <core/bdf.h>
 #include <core/parameters.h>
+#include <core/time_step_error_controller.h>
 
 #include <deal.II/particles/particle_handler.h>
 
@@ -183,6 +184,39 @@ protected:
    */
   bool adapt_with_capillary_time_step_ratio;
 
+  /**
+   * @brief Enable adaptive time-stepping that respects a tolerance on the
+   * estimated local truncation error of the time steps.
+   *
+   * The time step is controlled with a PI controller from the error estimates
+   * provided by the solvers. A time step whose error exceeds the tolerance is
+   * rejected and recomputed with a smaller time step.
+   */
+  bool adapt_with_error;
+
+  /// Estimation of the error and PI control of the time step
+  TimeStepErrorController error_controller;
+
+  /**
+   * @brief Normalized error of the present time step
+   *
+   * Maximal normalized error provided by the solvers for the present time
+   * step. A time step is acceptable when this value is smaller than one.
+   */
+  double time_step_error;
+
+  /// Maximal number of successive rejections of a time step
+  unsigned int max_time_step_rejections;
+
+  /// Number of successive rejections of the present time step
+  unsigned int n_successive_rejections;
+
+  /// Total number of rejected time steps
+  unsigned int n_rejected_time_steps;
+
+  /// Time steps history before the present time step, used when rejecting it
+  std::vector<double> previous_time_step_vector;
+
   /// Current value of the norm of the right-hand side residual
   double residual;
 
@@ -543,6 +577,79 @@ public:
     capillary_time_step_constraint = p_capillary_time_step_constraint;
   }
 
+  /**
+   * @brief Indicate if the time step is adapted to respect a tolerance on the
+   * estimated error of the time steps.
+   *
+   * @return true if the time step is controlled by the error estimate.
+   */
+  bool
+  is_adapting_with_error() const
+  {
+    return adapt_with_error;
+  }
+
+  /**
+   * @brief Provide the normalized error estimated by a solver for the present
+   * time step. The largest error provided by the solvers is kept.
+   *
+   * @param[in] p_time_step_error Normalized error of the present time step.
+   */
+  void
+  provide_time_step_error(const double p_time_step_error)
+  {
+    time_step_error = std::max(time_step_error, p_time_step_error);
+  }
+
+  /**
+   * @brief Get the normalized error of the present time step
+   *
+   * @return The largest normalized error provided by the solvers.
+   */
+  double
+  get_time_step_error() const
+  {
+    return time_step_error;
+  }
+
+  /**
+   * @brief Get the controller used to estimate the error of the time steps
+   *
+   * @return Constant reference to the error controller.
+   */
+  const TimeStepErrorController &
+  get_time_step_error_controller() const
+  {
+    return error_controller;
+  }
+
+  /**
+   * @brief Reject the present time step if its error exceeds the tolerance.
+   *
+   * If the time step is rejected, the time and the time step history are
+   * brought back to the beginning of the time step and a smaller time step is
+   * set. The solvers must then solve the time step again.
+   *
+   * @return true if the time step was rejected, false otherwise.
+   */
+  virtual bool
+  reject_time_step()
+  {
+    return false;
+  }
+
+  /**
+   * @brief Get the total number of rejected time steps
+   *
+   * @return The number of time steps rejected since the start of the
+   * simulation.
+   */
+  unsigned int
+  get_number_of_rejected_time_steps() const
+  {
+    return n_rejected_time_steps;
+  }
+
   /**
    * @brief Manually force the value of the time step for the present iteration
    *
@@ -906,8 +1013,9 @@ class SimulationControlTransient : public SimulationControl
 protected:
   /**
    * Boolean indicating if adaptive time-stepping is enabled.
-   * To enable it, enable either SimulationControlTransient::adapt_with_cfl or
-   * SimulationControl::adapt_with_capillary_time_step_ratio.
+   * To enable it, enable either SimulationControlTransient::adapt_with_cfl,
+   * SimulationControl::adapt_with_capillary_time_step_ratio or
+   * SimulationControl::adapt_with_error.
    */
   bool time_step_adaptation_required;
 
@@ -1032,6 +1140,18 @@ public:
   virtual bool
   is_at_end() override;
 
+  /**
+   * @brief Reject the present time step if its normalized error exceeds one.
+   *
+   * The new time step is obtained from the error of the rejected time step.
+   * The time step is accepted regardless of its error once it has been
+   * rejected "max time step rejections" times in a row.
+   *
+   * @return true if the time step was rejected, false otherwise
+   */
+  virtual bool
+  reject_time_step() override;
+
   /**
    * @brief Check if the current iteration is an output iteration
    *
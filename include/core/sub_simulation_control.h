@@ -156,4 +156,76 @@ private:
   double time_step;
 };
 
+/**
+ * @brief Controls the multiple time stepping of polydisperse DEM simulations.
+ *
+ * The particles whose diameter is larger than a threshold are coarse. Since
+ * their Rayleigh time is larger than that of the small particles, the contacts
+ * between two coarse particles are only calculated every time_step_ratio DEM
+ * iterations, with a time step time_step_ratio times larger than the DEM time
+ * step. The contacts involving at least one small particle are calculated at
+ * every DEM iteration. The iteration counter is kept over the CFD time steps
+ * in CFD-DEM simulations, so the coarse time step does not need to divide the
+ * number of DEM iterations per CFD time step.
+ */
+class SubSimulationControlMultiRateDEM
+{
+public:
+  /**
+   * @brief Construct a SubSimulationControlMultiRateDEM object.
+   *
+   * @param[in] time_step_ratio Ratio between the time step of the pairs of
+   * coarse particles and the DEM time step. A ratio of one disables the
+   * multiple time stepping.
+   * @param[in] coarse_diameter_threshold Diameter above which a particle is
+   * coarse.
+   */
+  SubSimulationControlMultiRateDEM(const unsigned int time_step_ratio,
+                                   const double coarse_diameter_threshold);
+
+  /**
+   * @brief Advance the multiple time stepping by one DEM iteration.
+   */
+  void
+  iterate()
+  {
+    ++iteration_number;
+  }
+
+  /**
+   * @brief Get the ratio between the time step of the pairs of coarse particles
+   * and the DEM time step at the current DEM iteration.
+   *
+   * @return The time step ratio at the coarse iterations, which happen every
+   * time_step_ratio iterations, and zero otherwise, in which case the pairs of
+   * coarse particles are not calculated.
+   */
+  unsigned int
+  get_coarse_pair_time_step_ratio() const
+  {
+    return (iteration_number % time_step_ratio == 0) ? time_step_ratio : 0;
+  }
+
+  /**
+   * @brief Get the diameter above which a particle is coarse.
+   */
+  double
+  get_coarse_diameter_threshold() const
+  {
+    return coarse_diameter_threshold;
+  }
+
+private:
+  /// Ratio between the time step of the pairs of coarse particles and the DEM
+  /// time step
+  const unsigned int time_step_ratio;
+
+  /// Diameter above which a particle is coarse
+  const double coarse_diameter_threshold;
+
+  /// Number of DEM iterations carried out since the start of the simulation.
+  /// This is initialized to zero.
+  unsigned int iteration_number;
+};
+
 #endif
@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_time_step_error_controller_h
+#define lethe_time_step_error_controller_h
+
+#include <core/parameters.h>
+#include <core/sdirk_stage_data.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Estimation of the local truncation error of a time step and
+ * proportional-integral (PI) control of the time step from this estimate.
+ *
+ * The local truncation error of the SDIRK methods is estimated with an
+ * embedded method of lower order which shares the stages of the SDIRK method:
+ * \f$ \boldsymbol{e} = \Delta t \sum_i (b_i - \hat{b}_i)\boldsymbol{k}_i \f$.
+ * The local truncation error of the BDF methods of order \f$k\f$ is estimated
+ * with the difference between the solution and its extrapolation from the
+ * \f$k+1\f$ previous solutions (Milne's device):
+ * \f$ \boldsymbol{e} = \frac{1}{k+2}(\boldsymbol{u}^{n+1} -
+ * \boldsymbol{u}_p^{n+1}) \f$.
+ *
+ * The error is normalized by the tolerance
+ * \f$ \epsilon_a + \epsilon_r \|\boldsymbol{u}\| \f$, where the norms are root
+ * mean square norms, such that a time step is acceptable if its normalized
+ * error is smaller than one. The next time step is obtained with the PI
+ * controller of Gustafsson:
+ * \f$ \Delta t^{n+1} = \Delta t^{n} \, s \, E_n^{-0.7/q} E_{n-1}^{0.4/q} \f$,
+ * where \f$ q \f$ is the order of the error estimate and \f$ s \f$ is a safety
+ * factor.
+ */
+class TimeStepErrorController
+{
+public:
+  /**
+   * @brief Constructor from the simulation control parameters.
+   *
+   * @param[in] param Simulation control parameters. The maximal growth of the
+   * time step is given by the adaptative time step scaling.
+   */
+  TimeStepErrorController(const Parameters::SimulationControl &param);
+
+  /**
+   * @brief Give the weights of the embedded method used to estimate the error
+   * of a SDIRK method. The embedded method of the two-stage methods is of
+   * order one and the one of the three-stage methods is of order two, both
+   * only using the first two stages.
+   *
+   * @param[in] method SDIRK method.
+   *
+   * @return The weights of the embedded method.
+   */
+  static std::vector<double>
+  embedded_sdirk_weights(
+    const Parameters::SimulationControl::TimeSteppingMethod method);
+
+  /**
+   * @brief Give the order of the leading term of the error estimate, that is
+   * the exponent of the time step in the estimate.
+   *
+   * @param[in] method Time-stepping method used for the assembly.
+   *
+   * @return The order of the error estimate, zero if the method does not
+   * support the error estimation.
+   */
+  static unsigned int
+  get_error_estimate_order(
+    const Parameters::SimulationControl::TimeSteppingMethod method);
+
+  /**
+   * @brief Give the coefficients of the polynomial extrapolation of the
+   * solutions \f$\boldsymbol{u}^{n}, \ldots, \boldsymbol{u}^{n-k}\f$ at the
+   * time \f$t^{n+1}\f$.
+   *
+   * @param[in] time_steps Time steps of the previous iterations, the first
+   * one being the present time step \f$t^{n+1}-t^{n}\f$.
+   * @param[in] n_solutions Number of solutions used in the extrapolation.
+   *
+   * @return The extrapolation coefficients of each solution.
+   */
+  static std::vector<double>
+  extrapolation_coefficients(const std::vector<double> &time_steps,
+                             const unsigned int         n_solutions);
+
+  /**
+   * @brief Normalize the norm of an error by the tolerance.
+   *
+   * @param[in] error_norm l2 norm of the error.
+   * @param[in] solution_norm l2 norm of the solution.
+   * @param[in] n_dofs Number of degrees of freedom.
+   *
+   * @return The normalized error, a time step being acceptable if it is
+   * smaller than one.
+   */
+  double
+  normalize_error(const double error_norm,
+                  const double solution_norm,
+                  const double n_dofs) const;
+
+  /**
+   * @brief Estimate the normalized error of a BDF time step.
+   *
+   * @tparam VectorType Type of the solution vectors.
+   *
+   * @param[in] present_solution Solution at the end of the time step.
+   * @param[in] previous_solutions Solutions \f$\boldsymbol{u}^{n}, \ldots,
+   * \boldsymbol{u}^{n-k}\f$, where k is the order of the BDF method.
+   * @param[in] time_steps Time steps of the previous iterations.
+   * @param[in,out] error Vector without ghost entries used to compute the
+   * error.
+   * @param[in,out] tmp Vector without ghost entries used to copy the possibly
+   * ghosted solutions.
+   *
+   * @return The normalized error.
+   */
+  template <typename VectorType>
+  double
+  estimate_bdf_error(const VectorType                     &present_solution,
+                     const std::vector<const VectorType *> &previous_solutions,
+                     const std::vector<double>             &time_steps,
+                     VectorType                            &error,
+                     VectorType                            &tmp) const
+  {
+    const unsigned int  bdf_order = previous_solutions.size() - 1;
+    std::vector<double> coefficients =
+      extrapolation_coefficients(time_steps, previous_solutions.size());
+
+    error                      = present_solution;
+    const double solution_norm = error.l2_norm();
+    for (unsigned int i = 0; i < previous_solutions.size(); ++i)
+      {
+        tmp = *previous_solutions[i];
+        error.add(-coefficients[i], tmp);
+      }
+
+    return normalize_error(error.l2_norm() / (bdf_order + 2.),
+                           solution_norm,
+                           present_solution.size());
+  }
+
+  /**
+   * @brief Estimate the normalized error of a SDIRK time step with its
+   * embedded method.
+   *
+   * @tparam VectorType Type of the solution vectors.
+   *
+   * @param[in] method SDIRK method.
+   * @param[in] time_step Time step.
+   * @param[in] present_solution Solution at the end of the time step.
+   * @param[in] stage_derivatives Derivatives \f$\boldsymbol{k}_i\f$ of the
+   * stages.
+   * @param[in,out] error Vector without ghost entries used to compute the
+   * error.
+   * @param[in,out] tmp Vector without ghost entries used to copy the possibly
+   * ghosted stage derivatives.
+   *
+   * @return The normalized error.
+   */
+  template <typename VectorType>
+  double
+  estimate_sdirk_error(
+    const Parameters::SimulationControl::TimeSteppingMethod method,
+    const double                                            time_step,
+    const VectorType                                       &present_solution,
+    const std::vector<VectorType>                          &stage_derivatives,
+    VectorType                                             &error,
+    VectorType                                             &tmp) const
+  {
+    const std::vector<double> weights = sdirk_table(method).b;
+    const std::vector<double> embedded_weights =
+      embedded_sdirk_weights(method);
+
+    error                      = present_solution;
+    const double solution_norm = error.l2_norm();
+    error                      = 0;
+    for (unsigned int i = 0; i < weights.size(); ++i)
+      {
+        tmp = stage_derivatives[i];
+        error.add(time_step * (weights[i] - embedded_weights[i]), tmp);
+      }
+
+    return normalize_error(error.l2_norm(),
+                           solution_norm,
+                           present_solution.size());
+  }
+
+  /**
+   * @brief Compute the ratio between the next and the present time steps
+   * with the PI controller, from the errors of the last accepted time steps.
+   *
+   * @param[in] order Order of the error estimate.
+   *
+   * @return The ratio between the next and the present time steps.
+   */
+  double
+  compute_time_step_factor(const unsigned int order) const;
+
+  /**
+   * @brief Compute the ratio between the new and the rejected time steps.
+   *
+   * @param[in] normalized_error Normalized error of the rejected time step.
+   * @param[in] order Order of the error estimate.
+   *
+   * @return The ratio between the new and the rejected time steps.
+   */
+  double
+  compute_rejection_factor(const double       normalized_error,
+                           const unsigned int order) const;
+
+  /**
+   * @brief Register the normalized error of an accepted time step.
+   *
+   * @param[in] normalized_error Normalized error of the time step, zero if it
+   * was not estimated.
+   */
+  void
+  register_accepted_error(const double normalized_error);
+
+private:
+  /// Absolute tolerance on the root mean square of the error
+  const double absolute_tolerance;
+
+  /// Tolerance on the error relative to the root mean square of the solution
+  const double relative_tolerance;
+
+  /// Maximal ratio between two successive time steps
+  const double max_factor;
+
+  /// Minimal ratio between two successive time steps
+  static constexpr double min_factor = 0.2;
+
+  /// Safety factor applied to the optimal time step
+  static constexpr double safety_factor = 0.9;
+
+  /// Normalized errors of the last two accepted time steps
+  double last_error;
+  double second_to_last_error;
+};
+
+#endif
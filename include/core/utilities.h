@@ -7,6 +7,7 @@
 #include <core/output_struct.h>
 
 #include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/table_handler.h>
@@ -926,6 +927,21 @@ concatenate_strings(const int argc, char **argv);
 void
 print_version_info(const ConditionalOStream &pcout);
 
+/**
+ * @brief Set the number of threads used by each MPI process, which enables
+ * the hybrid MPI+threads execution of the thread-parallel parts of Lethe
+ * (WorkStream assembly, postprocessing and deal.II vector operations).
+ *
+ * @param[in] n_threads Number of threads of each MPI process. If zero, the
+ * cores of each node are shared evenly among the MPI processes of the node.
+ * @param[in] mpi_communicator Communicator of the MPI processes.
+ *
+ * @return The number of threads used by each MPI process.
+ */
+unsigned int
+set_number_of_threads(const unsigned int n_threads,
+                      const MPI_Comm     mpi_communicator);
+
 /**
  * @brief Parse the arguments given to the application
  *
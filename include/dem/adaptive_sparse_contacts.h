@@ -5,6 +5,8 @@
 #define lethe_adaptive_sparse_contacts_h
 
 
+#include <core/utilities.h>
+
 #include <dem/data_containers.h>
 #include <dem/dem_action_manager.h>
 
@@ -13,20 +15,16 @@
 #include <deal.II/dofs/dof_handler.h>
 
 #include <deal.II/lac/affine_constraints.h>
-#include <deal.II/lac/la_parallel_vector.h>
-#include <deal.II/lac/la_parallel_vector.templates.h>
 
 #include <deal.II/particles/particle_handler.h>
 
+#include <cstdint>
+#include <string>
+#include <utility>
 #include <vector>
 
 using namespace dealii;
 
-// Special template instance for this class.
-// Unsigned integer would have been a better choice, but is not working
-// with the Vector class (error because of calling of abs() function)
-template class LinearAlgebra::distributed::Vector<int>;
-
 /**
  * @brief Mechanism that disables contacts computation through mobility status
  * of cells based on granular temperature.
@@ -93,8 +91,12 @@ template class LinearAlgebra::distributed::Vector<int>;
  * motion propagation, but only the particles in contact with particles
  * from the mobile cells are considered for the contact force calculation but
  * their position is not computed at the integration step. Those cells are
- * flagged as active cells. It works with the assignment and verification of the
- * mobility status at nodes to check the status of the neighboring cells.
+ * flagged as active cells.
+ *
+ * The neighbors of a cell are the cells sharing at least one of its nodes,
+ * including the periodic nodes. The mobility is propagated with per-cell
+ * flags, the flags of the ghost cells being received from the processes
+ * owning them.
  *
  * @tparam dim An integer that denotes the number of spatial dimensions.
  * @tparam PropertiesIndex Index of the properties used within the ParticleHandler.
@@ -144,21 +146,20 @@ public:
    * usual (force calculation and integration)
    *
    * empty (5)
-   * This status is only used for the node-based mobility status identification,
-   * no cells are flagged as empty, only node can be identified as empty.
-   * Without this identification of the empty cells, we cannot identify the cell
-   * that have an empty neighbor cell, which is critical for simulations using
-   * floating walls or mesh.
+   * This status is not assigned to cells, empty cells are flagged as inactive.
+   * Empty cells are however identified to find the cells that have an empty
+   * neighbor cell, which is critical for simulations using floating walls or
+   * mesh.
    */
 
   enum mobility_status : unsigned int
   {
-    inactive        = 0, // used for cells
-    static_active   = 1, // used for cells and nodes
-    advected        = 2, // used for cells and nodes
-    advected_active = 3, // used for cells and nodes
-    mobile          = 4, // used for cells and nodes
-    empty           = 5  // used for nodes only
+    inactive        = 0,
+    static_active   = 1,
+    advected        = 2,
+    advected_active = 3,
+    mobile          = 4,
+    empty           = 5
   };
 
 
@@ -187,16 +188,19 @@ public:
     granular_temperature_threshold = granular_temperature;
     solid_fraction_threshold       = solid_fraction;
     advect_particles_enabled       = advect_particles;
+    mobility_status_is_up_to_date  = false;
   }
 
   /**
-   * @brief Create or update a set of the active and ghost cells so that
+   * @brief Create or update a vector of the active and ghost cells so that
    * there is no loop over all the cells of the triangulation for the granular
    * temperature and solid fraction calculation, and during the identification
-   * of the mobility status. This set prevents 4 iteration steps over all the
+   * of the mobility status. This vector prevents iteration steps over all the
    * cells and the verification if the cell is locally owned, ghost or not.
-   * This set is updated at every load balance step since cells are
-   * redistributed among processors.
+   * This vector is updated at every load balance step since cells are
+   * redistributed among processors. The neighbor lists of the cells and the
+   * mobility status are then identified from scratch at the next call of
+   * identify_mobility_status().
    *
    * @param[in] background_dh The DoFHandler of the background grid.
    */
@@ -230,42 +234,52 @@ public:
     const double                     dt);
 
   /**
-   * @brief Identify of the mobility status of each cell through a node-based
-   * identification and check. Only the active and ghost cells are processed.
+   * @brief Identify the mobility status of each locally owned and ghost cell
+   * with per-cell flags propagated to the neighbor cells.
    *
-   * The following 4 checks (search loops) are done:
+   * The following steps are done:
    *
-   * 1. Check if the cell is empty (n_particle = 0), if so, nodes and cells are
-   * flagged as empty mobility status (5)
+   * 1. Evaluate the criterion of each cell: empty (n_particle = 0), agitated
+   * (average granular temperature > threshold or solid fraction < threshold)
+   * or settled. The criteria are only evaluated on the locally owned cells,
+   * only whether the ghost cells are empty is required. If the criterion of
+   * no cell changed on any process since the last identification, the
+   * mobility status are unchanged and the identification stops here.
    *
-   * 2. Check if the cell is mobile by criteria (average granular temperature >
-   * threshold, solid fraction < threshold or has at least one empty node from
-   * previous check), if so, nodes are flagged and cells are stored with mobile
-   * mobility status (4)
+   * 2. Flag the cells mobile by criteria (agitated or next to an empty cell)
+   * and exchange the flags of the ghost cells
    *
-   * 3. Check if the cell is mobile by neighbor (at least a node is flagged as
-   * mobile from previous check), if so, cells are stored in map as mobile
-   * status (4) and nodes that are not mobile are flagged as active (1/3)
+   * 3. Flag the cells mobile by neighbor (at least one neighbor mobile by
+   * criteria), which are mobile (4), and exchange the flags of the ghost cells
    *
-   * 4. Check if the cell is active (at least a node is flagged as active from
-   * previous check), if so, cells are stored with active status in the map
-   * (1/3)
+   * 4. Flag the cells next to a mobile cell as active (1/3)
    *
-   * The remaining cells are inactive (0)
+   * The remaining cells are inactive (0/2), the empty cells being inactive (0).
    *
    * @param[in] background_dh The dof handler of the background grid.
    * @param[in] particle_handler The particle handler that contains all the
    * particles.
-   * @param[in] n_active_cells The number of active cells in triangulation.
    * @param[in] mpi_communicator The MPI communicator.
    */
   void
   identify_mobility_status(
     const DoFHandler<dim>                 &background_dh,
     const Particles::ParticleHandler<dim> &particle_handler,
-    const unsigned int                     n_active_cells,
     MPI_Comm                               mpi_communicator);
 
+  /**
+   * @brief Calculate the statistics over the processes of the wall time spent
+   * in each step of the identification of the mobility status since the
+   * beginning of the simulation.
+   *
+   * @param[in] mpi_communicator The MPI communicator.
+   *
+   * @return Pairs of the name of the step and of the statistics of its wall
+   * time.
+   */
+  std::vector<std::pair<std::string, statistics>>
+  calculate_mobility_timing_statistics(MPI_Comm mpi_communicator) const;
+
   /**
    * @brief Map the periodic nodes pairs of the triangulation using the
    * constraints. It allows to compare the mobility status of the nodes with the
@@ -279,6 +293,7 @@ public:
   map_periodic_nodes(const AffineConstraints<double> &constraints)
   {
     periodic_node_ids.clear();
+    cell_neighbors_are_up_to_date = false;
 
     IndexSet local_lines = constraints.get_local_lines();
     for (auto i : local_lines)
@@ -352,101 +367,101 @@ public:
   }
 
 private:
+  /**
+   * Criterion of the mobility of a cell evaluated from its particles.
+   */
+  enum cell_criterion : std::uint8_t
+  {
+    settled      = 0,
+    agitated     = 1,
+    no_particles = 2
+  };
+
   /**
    * @brief Calculate the granular temperature and solid fraction approximation
-   * (pcm method). Those values are criteria for cell mobility.
+   * (pcm method) of a cell containing particles. Those values are criteria for
+   * cell mobility.
    *
    * @param[in] particle_handler The particle handler that contains all the
    * particles.
-   * @param[in] local_and_ghost_cells_with_particles The set of locally owned
-   * and ghost cells that empty cells were removed from.
-   * @param[out] cell_granular_temperature The empty vector of granular
-   * temperature.
-   * @param[out] cell_solid_fraction The empty vector of solid fraction.
+   * @param[in] cell The cell, which contains at least one particle.
+   *
+   * @return The granular temperature and the solid fraction of the cell.
    */
-  void
+  std::pair<double, double>
   calculate_granular_temperature_and_solid_fraction(
-    const Particles::ParticleHandler<dim> &particle_handler,
-    const std::set<typename DoFHandler<dim>::active_cell_iterator>
-                   &local_and_ghost_cells_with_particles,
-    Vector<double> &cell_granular_temperature,
-    Vector<double> &cell_solid_fraction);
+    const Particles::ParticleHandler<dim>                 &particle_handler,
+    const typename DoFHandler<dim>::active_cell_iterator &cell) const;
 
   /**
-   * @brief Assign the mobility status to the cell, its nodes, and its periodic
-   * coinciding nodes from the periodic nodes map. If required, this will
-   * prevent overwriting a node status prevailing over the initial one.
-   * For instance, empty status must not be overwritten by mobile status because
-   * all cells with this node will be part of the additional mobile layer and
-   * will wrongly propagate mobility status to the next cells.
+   * @brief Build the lists of the neighbors of the locally owned and ghost
+   * cells, which are the cells sharing at least one node with the cell or with
+   * its periodic nodes. The lists are stored contiguously by position of the
+   * cells in local_and_ghost_cells.
    *
-   * @param[in] cell_id The current cell index.
-   * @param[in] dof_indices The vector of the DoF indices of the cell.
-   * @param[in] cell_status The mobility status of cell to assign.
-   * @param[in] node_status The current mobility status of the node.
+   * @param[in] background_dh The dof handler of the background grid.
    */
-  inline void
-  assign_mobility_status(
-    unsigned int                                cell_id,
-    const std::vector<types::global_dof_index> &dof_indices,
-    const int                                   cell_status,
-    const int                                   node_status)
-  {
-    cell_mobility_status.insert({cell_id, cell_status});
-
-    // Assign mobility status to nodes without overwriting empty or mobile nodes
-    // in regard to the case
-    for (auto node_id : dof_indices)
-      {
-        // Prevailing mobility status of the node and assignation
-        int status_assigned = std::max(node_status, mobility_at_nodes(node_id));
-        mobility_at_nodes(node_id) = status_assigned;
-
-        // Check if node has a periodic node and assign the same mobility status
-        // if prevailing on the one on the periodic node
-        auto it = periodic_node_ids.find(node_id);
-        if (it != periodic_node_ids.end())
-          {
-            mobility_at_nodes(it->second) =
-              std::max(status_assigned, mobility_at_nodes(it->second));
-          }
-      }
-  }
+  void
+  find_cell_neighbors(const DoFHandler<dim> &background_dh);
 
   /**
-   * @brief Assign the mobility status to the cell. No need to update the node
-   * status. Only use for active status assignment since nodes are not evaluated
-   * after this step.
+   * @brief Send the flags of the locally owned cells to the processes on which
+   * they are ghost cells, and receive the flags of the ghost cells.
    *
-   * @param[in] cell_id The current cell index.
-   * @param[in] cell_status The mobility status of cell to assign.
+   * @param[in] background_dh The dof handler of the background grid.
+   * @param[in,out] flags The flags of the cells, by position of the cells in
+   * local_and_ghost_cells.
    */
-  inline void
-  assign_mobility_status(unsigned int cell_id, const int cell_status)
-  {
-    cell_mobility_status.insert({cell_id, cell_status});
-  }
+  void
+  exchange_ghost_cell_flags(const DoFHandler<dim>     &background_dh,
+                            std::vector<std::uint8_t> &flags) const;
 
   /**
-   * @brief Set of locally owned and ghost cells: <local/ghost cells>
+   * @brief Vector of locally owned and ghost cells: [local/ghost cells]
    * Used to loop over only the locally owned and ghost cells without looping
    * over all the cells in the triangulation numerous times.
    */
-  std::set<typename DoFHandler<dim>::active_cell_iterator>
+  std::vector<typename DoFHandler<dim>::active_cell_iterator>
     local_and_ghost_cells;
 
   /**
-   * @brief Map of cell mobility status: <cell index: mobility status>
+   * @brief Position of the cells in local_and_ghost_cells, by active cell
+   * index. The artificial cells have an invalid position.
    */
-  typename DEM::dem_data_structures<dim>::cell_index_int_map
-    cell_mobility_status;
+  std::vector<unsigned int> cell_positions;
 
   /**
-   * @brief Vector of mobility status at nodes: [mobility status]
-   * Used to check the value at node to determine the mobility status of the
-   * cell, this type of vector is used to allow update values in parallel.
+   * @brief Neighbors of the locally owned and ghost cells, given by their
+   * position in local_and_ghost_cells. The neighbors of the cell at position i
+   * range from cell_neighbor_offsets[i] to cell_neighbor_offsets[i + 1].
    */
-  LinearAlgebra::distributed::Vector<int> mobility_at_nodes;
+  std::vector<unsigned int> cell_neighbor_offsets;
+  std::vector<unsigned int> cell_neighbors;
+
+  /**
+   * @brief Flag for the neighbor lists, which are built again after the load
+   * balancing or the mapping of the periodic nodes.
+   */
+  bool cell_neighbors_are_up_to_date;
+
+  /**
+   * @brief Criteria of the locally owned and ghost cells at the last
+   * identification of the mobility status, by position in
+   * local_and_ghost_cells.
+   */
+  std::vector<std::uint8_t> cell_criteria;
+
+  /**
+   * @brief Flag for the mobility status map, which is not up to date after the
+   * load balancing or after the reset of all the status to mobile.
+   */
+  bool mobility_status_is_up_to_date;
+
+  /**
+   * @brief Map of cell mobility status: <cell index: mobility status>
+   */
+  typename DEM::dem_data_structures<dim>::cell_index_int_map
+    cell_mobility_status;
 
   /**
    * @brief Map of periodic nodes: <periodic node index: coinciding node index>
@@ -480,6 +495,15 @@ private:
    * @brief Threshold value for solid fraction.
    */
   double solid_fraction_threshold;
+
+  /**
+   * @brief Wall times spent in the steps of the identification of the mobility
+   * status since the beginning of the simulation.
+   */
+  double neighbor_lists_wall_time;
+  double criteria_wall_time;
+  double ghost_exchange_wall_time;
+  double propagation_wall_time;
 };
 
 #endif // lethe_adaptive_sparse_contacts_h
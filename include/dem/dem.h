@@ -8,6 +8,7 @@
 #include <core/dem_properties.h>
 #include <core/pvd_handler.h>
 #include <core/serial_solid.h>
+#include <core/sub_simulation_control.h>
 
 #include <dem/adaptive_sparse_contacts.h>
 #include <dem/data_containers.h>
@@ -19,12 +20,14 @@
 #include <dem/grid_motion.h>
 #include <dem/insertion.h>
 #include <dem/integrator.h>
+#include <dem/lagrangian_time_averaging.h>
 #include <dem/load_balancing.h>
 #include <dem/log_collision_data.h>
 #include <dem/particle_particle_contact_force.h>
 #include <dem/particle_point_line_contact_force.h>
 #include <dem/particle_wall_contact_force.h>
 #include <dem/periodic_boundaries_manipulator.h>
+#include <dem/reduced_ghost_update.h>
 #include <dem/visualization.h>
 
 #include <deal.II/base/tensor.h>
@@ -502,6 +505,19 @@ private:
    */
   AdaptiveSparseContacts<dim, PropertiesIndex> sparse_contacts_object;
 
+  /**
+   * @brief The object handling the in-situ time averaging of the cell-based
+   * fields. Only used if the time averaging is enabled.
+   */
+  LagrangianTimeAveraging<dim, PropertiesIndex> time_averaging_object;
+
+  /**
+   * @brief The object sending the reduced payload of the ghost particles
+   * between two contact searches. Only used if the reduced ghost update is
+   * enabled.
+   */
+  ReducedGhostUpdate<dim, PropertiesIndex> reduced_ghost_update;
+
   /**
    * @brief The constraints for the background grid needed for the adaptive sparse.
    */
@@ -524,6 +540,12 @@ private:
    * with a packed bed, loaded with another prm.
    */
   bool disable_position_integration;
+
+  /**
+   * @brief Multiple time stepping of the contacts between coarse particles.
+   * The time step ratio is one if the multiple time stepping is disabled.
+   */
+  SubSimulationControlMultiRateDEM multi_rate_control;
 };
 
 #endif
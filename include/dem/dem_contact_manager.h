@@ -11,6 +11,8 @@
 #include <dem/particle_particle_broad_search.h>
 #include <dem/particle_wall_broad_search.h>
 
+#include <core/parameters_lagrangian.h>
+
 
 using namespace DEM;
 
@@ -162,7 +164,10 @@ public:
    * @brief Execute the particle-particles fine searches.
    *
    * Executes functions that update the particle contacts pairs containers and
-   * compute the contact information of the collision pairs.
+   * compute the contact information of the collision pairs. With the
+   * hierarchical grid broad search, the threshold of each pair is computed from
+   * the diameters of its particles and the neighborhood_threshold argument is
+   * not used.
    *
    * @param[in] neighborhood_threshold Threshold value of contact detection.
    */
@@ -198,6 +203,38 @@ public:
     this->periodic_offset = offset;
   }
 
+  /**
+   * @brief Set the parameters of the particle-particle broad search.
+   *
+   * @param[in] method Method used to find the particle-particle contact
+   * candidates.
+   * @param[in] neighborhood_threshold Ratio between the neighborhood diameter
+   * and the particle diameter.
+   * @param[in] maximum_particle_diameter Diameter of the largest particle. The
+   * linked-cell search pairs the particles closer than the neighborhood
+   * threshold times this diameter.
+   * @param[in] verbosity Whether the number of candidates and the wall time of
+   * the broad search are printed.
+   * @param[in] communicator MPI communicator used to reduce the statistics of
+   * the broad search.
+   */
+  inline void
+  set_broad_search_parameters(
+    const typename Parameters::Lagrangian::ModelParameters<
+      dim>::BroadSearchMethod   method,
+    const double                neighborhood_threshold,
+    const double                maximum_particle_diameter,
+    const Parameters::Verbosity verbosity,
+    const MPI_Comm             &communicator)
+  {
+    this->broad_search_method    = method;
+    this->neighborhood_threshold = neighborhood_threshold;
+    this->neighborhood_diameter =
+      neighborhood_threshold * maximum_particle_diameter;
+    this->broad_search_verbosity = verbosity;
+    this->mpi_communicator       = communicator;
+  }
+
   /**
    * @brief Return the particle-floating mesh contact container.
    */
@@ -383,7 +420,30 @@ private:
   typename DEM::dem_data_structures<dim>::cell_vector periodic_cells_container;
 
 private:
+  /**
+   * @brief Print the number of particle-particle contact candidates found by
+   * the broad search and its wall time, maximal over the processes.
+   *
+   * @param[in] wall_time Wall time of the broad search on this process.
+   */
+  void
+  print_particle_particle_broad_search_statistics(const double wall_time) const;
+
   Tensor<1, dim> periodic_offset = Tensor<1, dim>();
+
+  // Particle-particle broad search parameters
+  typename Parameters::Lagrangian::ModelParameters<dim>::BroadSearchMethod
+    broad_search_method = Parameters::Lagrangian::ModelParameters<
+      dim>::BroadSearchMethod::cell_neighbors;
+  double                neighborhood_threshold = 0.;
+  double                neighborhood_diameter  = 0.;
+  Parameters::Verbosity broad_search_verbosity = Parameters::Verbosity::quiet;
+  MPI_Comm              mpi_communicator       = MPI_COMM_WORLD;
+
+  // Bins of the linked-cell and hierarchical grid broad searches, kept to
+  // reuse their memory
+  LinkedCellGrid<dim>              linked_cell_grid;
+  std::vector<LinkedCellGrid<dim>> hierarchical_grid;
 };
 
 #endif
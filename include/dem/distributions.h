@@ -6,6 +6,7 @@
 
 #include <core/parameters_lagrangian.h>
 
+#include <limits>
 #include <random>
 
 class Distribution
@@ -42,6 +43,20 @@ public:
   virtual void
   particle_size_sampling(const unsigned int &number_of_particles) = 0;
 
+  /**
+   * @brief Carries out the size sampling of particles with one random number
+   * generator per particle, seeded with the seed and the id of the particle.
+   * The diameter of a particle thus only depends on its id, regardless of the
+   * process which samples it and of the other sampled particles.
+   *
+   * @param[in] prn_seed Seed of the pseudo-random number generators.
+   * @param[in] particle_ids Ids of the particles whose diameter is sampled.
+   */
+  void
+  particle_size_sampling_from_ids(
+    const unsigned int                        prn_seed,
+    const std::vector<types::particle_index> &particle_ids);
+
   /**
    * @brief Return the minimum diameter for a certain distribution.
    *
@@ -69,6 +84,19 @@ public:
   virtual void
   print_psd_declaration_string(const unsigned int        particle_type,
                                const ConditionalOStream &pcout) = 0;
+
+protected:
+  /**
+   * @brief Sample the diameter of a single particle within the cutoff
+   * diameters.
+   *
+   * @param[in,out] generator Pseudo-random number generator used for the
+   * sampling.
+   *
+   * @return The sampled diameter.
+   */
+  virtual double
+  sample_diameter(std::mt19937 &generator) = 0;
 };
 
 class NormalDistribution : public Distribution
@@ -132,6 +160,19 @@ public:
   print_psd_declaration_string(const unsigned int        particle_type,
                                const ConditionalOStream &pcout) override;
 
+protected:
+  /**
+   * @brief Sample the diameter of a single particle from the normal
+   * distribution.
+   *
+   * @param[in,out] generator Pseudo-random number generator used for the
+   * sampling.
+   *
+   * @return The sampled diameter.
+   */
+  double
+  sample_diameter(std::mt19937 &generator) override;
+
 private:
   /**
    * @brief Average diameter of the normal distribution.
@@ -211,6 +252,19 @@ public:
   print_psd_declaration_string(const unsigned int        particle_type,
                                const ConditionalOStream &pcout) override;
 
+protected:
+  /**
+   * @brief Sample the diameter of a single particle from the lognormal
+   * distribution.
+   *
+   * @param[in,out] generator Pseudo-random number generator used for the
+   * sampling.
+   *
+   * @return The sampled diameter.
+   */
+  double
+  sample_diameter(std::mt19937 &generator) override;
+
 private:
   /**
    * @brief Standard deviation of distribution of the normal distribution.
@@ -277,6 +331,19 @@ public:
   print_psd_declaration_string(const unsigned int        particle_type,
                                const ConditionalOStream &pcout) override;
 
+protected:
+  /**
+   * @brief Sample the diameter of a single particle. All the particles
+   * have the same diameter.
+   *
+   * @param[in,out] generator Pseudo-random number generator used for the
+   * sampling.
+   *
+   * @return The sampled diameter.
+   */
+  double
+  sample_diameter(std::mt19937 &generator) override;
+
 private:
   /**
    * @brief The diameter value of the distribution.
@@ -352,6 +419,19 @@ public:
   print_psd_declaration_string(const unsigned int        particle_type,
                                const ConditionalOStream &pcout) override;
 
+protected:
+  /**
+   * @brief Sample the diameter of a single particle from the custom
+   * distribution.
+   *
+   * @param[in,out] generator Pseudo-random number generator used for the
+   * sampling.
+   *
+   * @return The sampled diameter.
+   */
+  double
+  sample_diameter(std::mt19937 &generator) override;
+
 private:
   /**
    * Vector containing all the diameters values.
@@ -442,4 +522,26 @@ setup_distributions(const LagrangianPhysicalProperties &lpp,
     }
 }
 
+/**
+ * @brief Return the smallest diameter that can be drawn from the size
+ * distributions of all the particle types.
+ *
+ * @param[in] size_distribution_object_container Size distribution of each
+ * particle type.
+ *
+ * @return The minimum particle diameter.
+ */
+inline double
+find_minimum_particle_diameter(
+  const std::vector<std::shared_ptr<Distribution>>
+    &size_distribution_object_container)
+{
+  double minimum_particle_diameter = std::numeric_limits<double>::max();
+  for (const auto &size_distribution : size_distribution_object_container)
+    minimum_particle_diameter =
+      std::min(minimum_particle_diameter,
+               size_distribution->find_min_diameter());
+  return minimum_particle_diameter;
+}
+
 #endif
@@ -130,14 +130,19 @@ protected:
    * insertion step.
    * @param particle_properties Properties of all inserted particles at this
    * insertion step.
+   * @param particle_ids Ids of the inserted particles. If they are given, the
+   * diameter of each particle is sampled with a generator seeded with the
+   * insertion seed and its id, such that it does not depend on the partition.
+   * Otherwise, the diameters are sampled from the distribution of the process.
    */
   void
   assign_particle_properties(
-    const DEMSolverParameters<dim>   &dem_parameters,
-    const unsigned int               &inserted_this_step_this_proc,
-    const unsigned int               &current_inserting_particle_type,
-    const std::vector<Point<dim>>    &insertion_points,
-    std::vector<std::vector<double>> &particle_properties);
+    const DEMSolverParameters<dim>           &dem_parameters,
+    const unsigned int                       &inserted_this_step_this_proc,
+    const unsigned int                       &current_inserting_particle_type,
+    const std::vector<Point<dim>>            &insertion_points,
+    std::vector<std::vector<double>>         &particle_properties,
+    const std::vector<types::particle_index> &particle_ids = {});
 
   /**
    * @brief Carries out finding the maximum number of inserted particles based on the
@@ -45,6 +45,55 @@ public:
          const DEMSolverParameters<dim> &dem_parameters) override;
 
 
+  /**
+   * @brief Insert the particles of a text input file. The file is read by all
+   * the processes and the particles are inserted by the process 0.
+   *
+   * @param[in,out] particle_handler The particle handler of particles which
+   * are being inserted.
+   * @param[in] file_name Name of the input file.
+   * @param[in] global_bounding_boxes Bounding boxes of the locally owned cells
+   * of every process.
+   * @param[in] dem_parameters DEM parameters declared in the .prm file.
+   * @param[in] communicator MPI communicator of the triangulation.
+   *
+   * @return Number of particles inserted from the file.
+   */
+  unsigned int
+  insert_from_text_file(
+    Particles::ParticleHandler<dim>                  &particle_handler,
+    const std::string                                &file_name,
+    const std::vector<std::vector<BoundingBox<dim>>> &global_bounding_boxes,
+    const DEMSolverParameters<dim>                   &dem_parameters,
+    const MPI_Comm                                    communicator);
+
+  /**
+   * @brief Insert the particles of a binary input file. The file starts with
+   * the identifier "LETHEDEM", the number of particles and the number of
+   * columns (unsigned 64-bit integers), followed by one row of doubles per
+   * particle (p_x, p_y, p_z, v_x, v_y, v_z, w_x, w_y, w_z, diameters and T for
+   * multiphysic DEM). The rows are read in chunks with MPI-IO, each process
+   * reading a different chunk, and the particles of each chunk are sent to the
+   * processes owning them. Thus, no process stores the whole file.
+   *
+   * @param[in,out] particle_handler The particle handler of particles which
+   * are being inserted.
+   * @param[in] file_name Name of the input file.
+   * @param[in] global_bounding_boxes Bounding boxes of the locally owned cells
+   * of every process.
+   * @param[in] dem_parameters DEM parameters declared in the .prm file.
+   * @param[in] communicator MPI communicator of the triangulation.
+   *
+   * @return Number of particles inserted from the file.
+   */
+  unsigned int
+  insert_from_binary_file(
+    Particles::ParticleHandler<dim>                  &particle_handler,
+    const std::string                                &file_name,
+    const std::vector<std::vector<BoundingBox<dim>>> &global_bounding_boxes,
+    const DEMSolverParameters<dim>                   &dem_parameters,
+    const MPI_Comm                                    communicator);
+
   /**
    * @brief Carries out assigning the properties of inserted particles specifically
    * for the file insertion method. In this method, the initial translation
@@ -95,10 +95,58 @@ private:
     const double                                      random_number2,
     const Parameters::Lagrangian::InsertionInfo<dim> &insertion_information);
 
+  /**
+   * @brief Find the locally owned cells that intersect the insertion box,
+   * enlarged by the maximum offset of the insertion points.
+   *
+   * @param[in] triangulation Triangulation to access the cells in which the
+   * particles are inserted.
+   * @param[in] insertion_information DEM insertion parameters declared in the
+   * .prm file.
+   */
+  void
+  find_cells_in_insertion_box(
+    const parallel::distributed::Triangulation<dim>  &triangulation,
+    const Parameters::Lagrangian::InsertionInfo<dim> &insertion_information);
+
+  /**
+   * @brief Insert the particles whose insertion points are located in the
+   * locally owned cells, without any communication between the processes. The
+   * insertion points and the ids of the particles do not depend on the
+   * partition of the triangulation.
+   *
+   * @param[in,out] particle_handler The particle handler of particles which
+   * are being inserted.
+   * @param[in] dem_parameters DEM parameters declared in the .prm file.
+   */
+  void
+  insert_in_locally_owned_cells(
+    Particles::ParticleHandler<dim> &particle_handler,
+    const DEMSolverParameters<dim>  &dem_parameters);
+
+  /**
+   * @brief Check if an insertion point located in a cell is inserted in this
+   * cell. A point located on a face shared by two cells is only inserted in
+   * the cell with the lowest id.
+   *
+   * @param[in] cell Cell containing the insertion point.
+   * @param[in] insertion_location Insertion point.
+   *
+   * @return Whether the particle is inserted in the cell.
+   */
+  static bool
+  is_insertion_cell(
+    const typename Triangulation<dim>::active_cell_iterator &cell,
+    const Point<dim> &insertion_location);
+
   unsigned int current_inserting_particle_type;
 
   // Number of particles of each type that remain to be inserted in the
   // upcoming insertion steps
   unsigned int particles_of_each_type_remaining;
+
+  // Locally owned cells intersecting the insertion box (local insertion)
+  std::vector<typename Triangulation<dim>::active_cell_iterator>
+    cells_in_insertion_box;
 };
 #endif
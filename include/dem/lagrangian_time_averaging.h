@@ -0,0 +1,299 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_lagrangian_time_averaging_h
+#define lethe_lagrangian_time_averaging_h
+
+#include <core/parameters_lagrangian.h>
+#include <core/pvd_handler.h>
+
+#include <dem/data_containers.h>
+
+#include <deal.II/distributed/solution_transfer.h>
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+using namespace dealii;
+
+/**
+ * @brief In-situ time averaging of the cell-based Eulerian fields obtained
+ * from the particles.
+ *
+ * Every `sampling frequency` DEM iterations, the instantaneous cell averages
+ * of the particle velocity, the granular temperature, the solid fraction, the
+ * coordination number and the kinetic (streaming) stress tensor are computed
+ * on the background mesh and accumulated in running means and variances using
+ * Welford's single-pass algorithm. This avoids writing the particles at a high
+ * frequency to obtain statistically converged fields through offline
+ * post-processing.
+ *
+ * The velocity, granular temperature and coordination number are only
+ * defined in cells containing particles, thus they are averaged over the
+ * samples for which the cell was occupied. The solid fraction and the kinetic
+ * stress are averaged over all samples, an empty cell contributing a zero
+ * value.
+ *
+ * The accumulators are stored in a FE_DGQ(0) field on the background
+ * triangulation so that they follow the cells through load balancing and are
+ * written in the checkpoints with the solution transfer mechanism.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam PropertiesIndex Index of the properties used within the ParticleHandler.
+ */
+template <int dim, typename PropertiesIndex>
+class LagrangianTimeAveraging
+{
+public:
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  /**
+   * @brief Constructor of the time averaging object.
+   *
+   * @param[in] triangulation Background triangulation on which the fields are
+   * averaged.
+   */
+  LagrangianTimeAveraging(
+    const parallel::distributed::Triangulation<dim> &triangulation);
+
+  /**
+   * @brief Set the time averaging parameters. If the time averaging is not
+   * enabled, all the other functions of the class return immediately.
+   *
+   * @param[in] post_processing Lagrangian post-processing parameters.
+   */
+  void
+  set_parameters(
+    const Parameters::Lagrangian::LagrangianPostProcessing &post_processing);
+
+  /**
+   * @brief Distribute the degrees of freedom of the averaged fields and
+   * initialize the accumulators to zero.
+   */
+  void
+  setup_dofs();
+
+  /**
+   * @brief Check if the current iteration is a sampling iteration.
+   *
+   * @param[in] step_number Current DEM iteration.
+   * @param[in] current_time Current simulation time.
+   */
+  inline bool
+  is_sampling_iteration(const unsigned int step_number,
+                        const double       current_time) const
+  {
+    return time_averaging_enabled &&
+           (step_number % sampling_frequency == 0) &&
+           (current_time >= initial_time - 1e-12);
+  }
+
+  /**
+   * @brief Check if the current iteration is an output iteration of the
+   * time averages.
+   *
+   * @param[in] step_number Current DEM iteration.
+   */
+  inline bool
+  is_output_iteration(const unsigned int step_number) const
+  {
+    return time_averaging_enabled && output_frequency > 0 &&
+           (step_number % output_frequency == 0) && n_samples > 0;
+  }
+
+  /**
+   * @brief Compute the instantaneous cell averages from the particles and
+   * update the running means and variances of the locally owned cells.
+   *
+   * @param[in] particle_handler Particle handler.
+   * @param[in] local_adjacent_particles Local-local particle pairs in the
+   * neighborhood of each other.
+   * @param[in] ghost_adjacent_particles Local-ghost particle pairs in the
+   * neighborhood of each other.
+   */
+  void
+  sample(const Particles::ParticleHandler<dim> &particle_handler,
+         const typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+           &local_adjacent_particles,
+         const typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+           &ghost_adjacent_particles);
+
+  /**
+   * @brief Write the time-averaged fields and their variances.
+   *
+   * @param[in] folder Output folder.
+   * @param[in] output_name Prefix of the output files.
+   * @param[in] current_time Current simulation time.
+   * @param[in] step_number Current DEM iteration.
+   * @param[in] group_files Number of vtu files per output.
+   * @param[in] mpi_communicator MPI communicator.
+   */
+  void
+  write_output_results(const std::string &folder,
+                       const std::string &output_name,
+                       const double       current_time,
+                       const unsigned int step_number,
+                       const unsigned int group_files,
+                       const MPI_Comm    &mpi_communicator);
+
+  /**
+   * @brief Prepare the accumulators for the repartitioning of the
+   * triangulation (load balancing).
+   */
+  void
+  prepare_for_mesh_repartitioning();
+
+  /**
+   * @brief Redistribute the degrees of freedom and recover the accumulators
+   * after the repartitioning of the triangulation.
+   */
+  void
+  post_mesh_repartitioning();
+
+  /**
+   * @brief Prepare the accumulators for serialization and write the sampling
+   * information. Must be called before the triangulation is saved.
+   *
+   * @param[in] prefix Prefix of the checkpoint files.
+   */
+  void
+  write_checkpoint(const std::string &prefix);
+
+  /**
+   * @brief Read the sampling information and deserialize the accumulators.
+   * Must be called after the triangulation has been loaded.
+   *
+   * @param[in] prefix Prefix of the checkpoint files.
+   */
+  void
+  read_checkpoint(const std::string &prefix);
+
+  /**
+   * @brief Give the number of samples accumulated since the beginning of the
+   * averaging.
+   */
+  inline unsigned int
+  get_n_samples() const
+  {
+    return n_samples;
+  }
+
+  /**
+   * @brief Give the DoFHandler of the averaged fields. Each cell holds one
+   * DoF per component, the components being the velocity, the granular
+   * temperature, the solid fraction, the coordination number, the kinetic
+   * stress tensor (xx, yy, (zz), xy, (yz, xz)) and the number of samples for
+   * which the cell was occupied.
+   */
+  inline const DoFHandler<dim> &
+  get_dof_handler() const
+  {
+    return dof_handler;
+  }
+
+  /**
+   * @brief Give the running means of the fields of the locally owned cells.
+   */
+  inline const VectorType &
+  get_running_means() const
+  {
+    return running_means;
+  }
+
+  /**
+   * @brief Compute the variances of the fields of the locally owned cells.
+   * The component of the occupied samples holds the total number of samples.
+   *
+   * @return The variances, without ghost entries.
+   */
+  VectorType
+  get_variances() const;
+
+private:
+  /**
+   * @brief Gather the accumulators in vectors with ghost entries, as expected
+   * by the solution transfer.
+   *
+   * @return The pointers to the vectors to transfer.
+   */
+  std::vector<const VectorType *>
+  gather_vectors_to_transfer();
+
+  /**
+   * @brief Reinitialize the accumulators and the vectors with ghost entries
+   * according to the current distribution of the degrees of freedom.
+   */
+  void
+  reinit_vectors();
+
+  /// Flag indicating that the time averaging is enabled.
+  bool time_averaging_enabled;
+
+  /// Number of DEM iterations between two samples.
+  unsigned int sampling_frequency;
+
+  /// Number of DEM iterations between two outputs (0 = end only).
+  unsigned int output_frequency;
+
+  /// Time at which the sampling starts.
+  double initial_time;
+
+  /// Number of samples accumulated in the running means.
+  unsigned int n_samples;
+
+  /// Number of averaged fields (the occupied sample counter excluded).
+  static constexpr unsigned int n_fields = dim + 3 + dim * (dim + 1) / 2;
+
+  /// Component of the granular temperature.
+  static constexpr unsigned int granular_temperature_component = dim;
+
+  /// Component of the solid fraction.
+  static constexpr unsigned int solid_fraction_component = dim + 1;
+
+  /// Component of the coordination number.
+  static constexpr unsigned int coordination_number_component = dim + 2;
+
+  /// First component of the kinetic stress tensor (xx, yy, (zz), xy, (yz,
+  /// xz)).
+  static constexpr unsigned int kinetic_stress_component = dim + 3;
+
+  /// Component counting the samples for which the cell was occupied. It is
+  /// only used in the means vector.
+  static constexpr unsigned int occupied_samples_component = n_fields;
+
+  /// Background triangulation.
+  const parallel::distributed::Triangulation<dim> &triangulation;
+
+  /// Piecewise constant finite element holding one component per field.
+  FESystem<dim> fe;
+
+  /// DoFHandler of the averaged fields.
+  DoFHandler<dim> dof_handler;
+
+  /// Running means of the fields (and the occupied sample counter).
+  VectorType running_means;
+
+  /// Running sums of the squared deviations from the means.
+  VectorType running_squared_deviations;
+
+  /// Running means with ghost entries used for the solution transfer.
+  VectorType running_means_with_ghost_cells;
+
+  /// Running sums of squared deviations with ghost entries used for the
+  /// solution transfer.
+  VectorType running_squared_deviations_with_ghost_cells;
+
+  /// Solution transfer used for the load balancing and the checkpoints.
+  std::shared_ptr<SolutionTransfer<dim, VectorType>> solution_transfer;
+
+  /// PVD handler of the time-averaged fields.
+  PVDHandler pvdhandler;
+};
+
+#endif
@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_linked_cell_grid_h
+#define lethe_linked_cell_grid_h
+
+#include <deal.II/base/point.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Rank-local uniform grid of bins (linked cells) used to find the
+ * points located close to each other independently of the background
+ * triangulation.
+ *
+ * The grid covers the bounding box of the points it is built with and its
+ * bins are at least as wide as a prescribed size. Consequently, all the points
+ * located at a distance smaller than this size of a given point lie in the bin
+ * of the point or in one of its adjacent bins. The points are sorted by bin
+ * with a counting sort and stored contiguously, the indices of the points of a
+ * bin being given by the offsets of the bins.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ */
+template <int dim>
+class LinkedCellGrid
+{
+public:
+  /**
+   * @brief Build the grid and sort the points into its bins.
+   *
+   * The bins are enlarged if the number of bins required by the minimal bin
+   * size would exceed twice the number of points, in order to bound the memory
+   * footprint of the grid when the points are scattered. The grid is empty if
+   * there are no points, in which case the bin size is not used.
+   *
+   * @param[in] points Locations of the points.
+   * @param[in] minimal_bin_size Minimal width of the bins.
+   */
+  void
+  build(const std::vector<Point<dim>> &points, const double minimal_bin_size);
+
+  /**
+   * @brief Return the index of the bin containing a point. Points located
+   * outside of the grid are attributed to the closest bin.
+   *
+   * @param[in] point Location of the point.
+   *
+   * @return Index of the bin.
+   */
+  std::array<unsigned int, dim>
+  get_bin(const Point<dim> &point) const;
+
+  /**
+   * @brief Call a function for every point located in the bin of a point or
+   * in one of its adjacent bins.
+   *
+   * @param[in] point Location around which the points are searched.
+   * @param[in] function Function called with the index of each point, as
+   * given by its position in the vector used to build the grid.
+   */
+  template <typename FunctionType>
+  void
+  for_each_point_in_neighbor_bins(const Point<dim> &point,
+                                  FunctionType    &&function) const;
+
+  /**
+   * @brief Call a function for every point located in the bins intersecting
+   * the box of half-width radius centered on a point. Contrary to
+   * for_each_point_in_neighbor_bins, the radius may be larger than the width of
+   * the bins.
+   *
+   * @param[in] point Location around which the points are searched.
+   * @param[in] radius Half-width of the box in which the points are searched.
+   * @param[in] function Function called with the index of each point, as
+   * given by its position in the vector used to build the grid.
+   */
+  template <typename FunctionType>
+  void
+  for_each_point_in_radius(const Point<dim> &point,
+                           const double      radius,
+                           FunctionType    &&function) const;
+
+  /**
+   * @brief Return the total number of bins of the grid.
+   */
+  inline unsigned int
+  n_bins() const
+  {
+    return bin_offsets.empty() ? 0 : bin_offsets.size() - 1;
+  }
+
+private:
+  /**
+   * @brief Return the linear index of a bin from its index in each direction.
+   */
+  inline unsigned int
+  linear_index(const std::array<unsigned int, dim> &bin) const
+  {
+    unsigned int index = bin[dim - 1];
+    for (int d = dim - 2; d >= 0; --d)
+      index = index * n_bins_per_direction[d] + bin[d];
+    return index;
+  }
+
+  /**
+   * @brief Call a function for every point located in the bins ranging from
+   * first_bin to last_bin (included) in each direction.
+   */
+  template <typename FunctionType>
+  void
+  for_each_point_in_bin_range(const std::array<unsigned int, dim> &first_bin,
+                              const std::array<unsigned int, dim> &last_bin,
+                              FunctionType &&function) const;
+
+  /// Lower corner of the bounding box of the points
+  Point<dim> lower_corner;
+
+  /// Inverse of the width of the bins in each direction
+  std::array<double, dim> inverse_bin_size;
+
+  /// Number of bins in each direction
+  std::array<unsigned int, dim> n_bins_per_direction;
+
+  /// Offsets of the first point of each bin in sorted_points, with a last
+  /// entry equal to the number of points
+  std::vector<unsigned int> bin_offsets;
+
+  /// Indices of the points sorted by bin
+  std::vector<unsigned int> sorted_points;
+};
+
+template <int dim>
+template <typename FunctionType>
+void
+LinkedCellGrid<dim>::for_each_point_in_neighbor_bins(
+  const Point<dim> &point,
+  FunctionType    &&function) const
+{
+  if (sorted_points.empty())
+    return;
+
+  const std::array<unsigned int, dim> bin = get_bin(point);
+
+  // Range of the adjacent bins in each direction, truncated at the boundaries
+  // of the grid
+  std::array<unsigned int, dim> first_bin, last_bin;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      first_bin[d] = (bin[d] > 0) ? bin[d] - 1 : 0;
+      last_bin[d]  = std::min(bin[d] + 1, n_bins_per_direction[d] - 1);
+    }
+
+  for_each_point_in_bin_range(first_bin,
+                              last_bin,
+                              std::forward<FunctionType>(function));
+}
+
+template <int dim>
+template <typename FunctionType>
+void
+LinkedCellGrid<dim>::for_each_point_in_radius(const Point<dim> &point,
+                                              const double      radius,
+                                              FunctionType    &&function) const
+{
+  if (sorted_points.empty())
+    return;
+
+  Point<dim> lower_point(point), upper_point(point);
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      lower_point[d] -= radius;
+      upper_point[d] += radius;
+    }
+
+  for_each_point_in_bin_range(get_bin(lower_point),
+                              get_bin(upper_point),
+                              std::forward<FunctionType>(function));
+}
+
+template <int dim>
+template <typename FunctionType>
+void
+LinkedCellGrid<dim>::for_each_point_in_bin_range(
+  const std::array<unsigned int, dim> &first_bin,
+  const std::array<unsigned int, dim> &last_bin,
+  FunctionType                       &&function) const
+{
+  std::array<unsigned int, dim> neighbor_bin = first_bin;
+  while (true)
+    {
+      const unsigned int neighbor_index = linear_index(neighbor_bin);
+      for (unsigned int i = bin_offsets[neighbor_index];
+           i < bin_offsets[neighbor_index + 1];
+           ++i)
+        function(sorted_points[i]);
+
+      // Move to the next bin of the range, the first direction varying fastest
+      unsigned int d = 0;
+      for (; d < dim; ++d)
+        {
+          if (neighbor_bin[d] < last_bin[d])
+            {
+              ++neighbor_bin[d];
+              break;
+            }
+          neighbor_bin[d] = first_bin[d];
+        }
+      if (d == dim)
+        break;
+    }
+}
+
+#endif
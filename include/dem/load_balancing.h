@@ -8,9 +8,12 @@
 #include <core/simulation_control.h>
 
 #include <dem/adaptive_sparse_contacts.h>
+#include <dem/dem_contact_manager.h>
 
 #include <deal.II/distributed/tria.h>
 
+#include <chrono>
+
 using namespace dealii;
 
 /**
@@ -42,12 +45,20 @@ public:
     // Load balancing method and the setup of the check iteration function
     load_balance_method      = model_parameters.load_balance_method;
     iteration_check_function = set_iteration_check_function();
+    measured_cost_enabled =
+      (load_balance_method ==
+       Parameters::Lagrangian::ModelParameters<
+         dim>::LoadBalanceMethod::dynamic_with_measured_cost);
 
     // Parameters related to the total cell weight
     cell_weight_function   = model_parameters.cell_weight_function;
     particle_weight        = model_parameters.load_balance_particle_weight;
     inactive_status_factor = model_parameters.inactive_load_balancing_factor;
     active_status_factor   = model_parameters.active_load_balancing_factor;
+    contact_weight         = model_parameters.load_balance_contact_weight;
+    wall_contact_weight    = model_parameters.load_balance_wall_contact_weight;
+    cost_smoothing_factor =
+      model_parameters.load_balance_cost_smoothing_factor;
 
     // Parameters related to the frequency of the load balance execution
     dynamic_check_frequency =
@@ -59,7 +70,8 @@ public:
 
   /**
    * @brief Copies the references to the simulation control, triangulation,
-   * particle handler and adaptive sparse contacts (enabled or disabled).
+   * particle handler, adaptive sparse contacts (enabled or disabled) and
+   * contact manager.
    * This is necessary to access the data structures and functions of these
    * during the load balancing check
    *
@@ -71,6 +83,38 @@ public:
    * particles in cells)
    * @param[in] adaptive_sparse_contacts The adaptive sparse contacts object
    * (accesses to the mobility status of the cells)
+   * @param[in] contact_manager The contact manager object (accesses to the
+   * contact pairs of the particles)
+   */
+  inline void
+  copy_references(
+    std::shared_ptr<SimulationControl>           &simulation_control,
+    parallel::distributed::Triangulation<dim>    &triangulation,
+    Particles::ParticleHandler<dim>              &particle_handler,
+    AdaptiveSparseContacts<dim, PropertiesIndex> &adaptive_sparse_contacts,
+    DEMContactManager<dim, PropertiesIndex>      &contact_manager)
+  {
+    copy_references(simulation_control,
+                    triangulation,
+                    particle_handler,
+                    adaptive_sparse_contacts);
+    this->contact_manager = &contact_manager;
+  }
+
+  /**
+   * @brief Copies the references to the simulation control, triangulation,
+   * particle handler and adaptive sparse contacts (enabled or disabled) for
+   * the solvers without contact manager (e.g. ray tracing). The
+   * dynamic_with_measured_cost method cannot be used by these solvers.
+   *
+   * @param[in] simulation_control The simulation control object (accesses to
+   * the time step)
+   * @param[in] triangulation The triangulation object (for dynamics connexion
+   * of signals with ASC)
+   * @param[in] particle_handler The particle handler object (accesses to the
+   * particles in cells)
+   * @param[in] adaptive_sparse_contacts The adaptive sparse contacts object
+   * (accesses to the mobility status of the cells)
    */
   inline void
   copy_references(
@@ -83,6 +127,42 @@ public:
     this->triangulation            = &triangulation;
     this->particle_handler         = &particle_handler;
     this->adaptive_sparse_contacts = &adaptive_sparse_contacts;
+    this->contact_manager          = nullptr;
+
+    // The measured cell costs are indexed by the active cell index, thus they
+    // are cleared whenever the triangulation changes
+    triangulation.signals.any_change.connect([&]() { cell_costs.clear(); });
+  }
+
+  /**
+   * @brief Starts the measurement of the computational time of a DEM kernel
+   * (force calculation or integration) on this process. Only used with the
+   * `dynamic_with_measured_cost` method.
+   */
+  inline void
+  start_cost_measurement()
+  {
+    if (!measured_cost_enabled)
+      return;
+
+    measurement_start_time = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * @brief Stops the measurement of the computational time of a DEM kernel
+   * and adds the elapsed time to the time measured on this process since the
+   * last load balancing check. Only used with the
+   * `dynamic_with_measured_cost` method.
+   */
+  inline void
+  stop_cost_measurement()
+  {
+    if (!measured_cost_enabled)
+      return;
+
+    const std::chrono::duration<double> elapsed_time =
+      std::chrono::steady_clock::now() - measurement_start_time;
+    measured_time += elapsed_time.count();
   }
 
   /**
@@ -121,6 +201,9 @@ public:
         case ModelParameters<
           dim>::LoadBalanceMethod::dynamic_with_sparse_contacts:
           return [&] { check_load_balance_with_sparse_contacts(); };
+        case ModelParameters<
+          dim>::LoadBalanceMethod::dynamic_with_measured_cost:
+          return [&] { check_load_balance_with_measured_cost(); };
         default: // Default is no load balance (none)
           return [&]() { return; };
       }
@@ -170,6 +253,20 @@ public:
   void
   check_load_balance_with_sparse_contacts();
 
+  /**
+   * @brief Determines whether the present iteration is the load balance step
+   * when load balance method is `dynamic_with_measured_cost`.
+   *
+   * At every `dynamic check frequency` iterations, the cost of each cell is
+   * estimated from the particles it contains and from their particle-particle
+   * and particle-wall contact pairs, and it is smoothed with the costs of the
+   * previous checks. The load balancing is executed if the computational time
+   * of the DEM kernels measured on each process since the last check is too
+   * uneven, i.e., if T_{max} - T_{min} > \beta \bar{T}.
+   */
+  void
+  check_load_balance_with_measured_cost();
+
   /**
    * @brief Connects the weight signals of the cells to the triangulation.
    *
@@ -194,6 +291,18 @@ public:
         return static_cast<int>(cell_weight_function->value(cell->center()));
       });
 
+    if (measured_cost_enabled)
+      {
+        triangulation->signals.weight.connect(
+          [&](const typename parallel::distributed::Triangulation<
+                dim>::cell_iterator &cell,
+              const CellStatus       status) -> unsigned int {
+            return this->calculate_total_cell_weight_with_measured_cost(
+              cell, status);
+          });
+        return;
+      }
+
     triangulation->signals.weight.connect(
       [&](const typename parallel::distributed::Triangulation<
             dim>::cell_iterator &cell,
@@ -289,6 +398,40 @@ private:
                     &cell,
     const CellStatus status) const;
 
+  /**
+   * @brief Indicates to the triangulation how much computational work is
+   * expected to happen on this cell according to the smoothed measured cost
+   * of the cell. Only used with the `dynamic_with_measured_cost` method.
+   *
+   * If the costs were not computed on the current triangulation, the weight
+   * falls back to the number of particles times the particle weight.
+   *
+   * @param[in] cell The cell for which the load is calculated
+   * @param[in] status The status of the cell related to the coarsening level
+   *
+   * @return The total weight of the cell
+   */
+  unsigned int
+  calculate_total_cell_weight_with_measured_cost(
+    const typename parallel::distributed::Triangulation<dim>::cell_iterator
+                    &cell,
+    const CellStatus status) const;
+
+  /**
+   * @brief Computes the cost of the locally owned cells from the number of
+   * particles and the number of particle-particle and particle-wall contact
+   * pairs of these particles, and smooths it with the costs of the previous
+   * checks.
+   *
+   * A local-local contact pair is shared between the cells of its two
+   * particles, while a local-ghost pair is assigned to the cell of the local
+   * particle since the force is computed once on this process. Only the
+   * particle ids are used, so the contact containers may refer to particles
+   * that have been inserted or removed since the last contact search.
+   */
+  void
+  update_measured_cell_costs();
+
   /**
    * @brief The load balancing method chosen by the user.
    */
@@ -325,6 +468,47 @@ private:
    */
   double active_status_factor;
 
+  /**
+   * @brief Load weight of a particle-particle contact pair (only with the
+   * measured cost method).
+   */
+  unsigned int contact_weight;
+
+  /**
+   * @brief Load weight of a particle-wall contact pair (only with the
+   * measured cost method).
+   */
+  unsigned int wall_contact_weight;
+
+  /**
+   * @brief Relaxation factor of the exponential smoothing of the cell costs
+   * between two checks (only with the measured cost method).
+   */
+  double cost_smoothing_factor;
+
+  /**
+   * @brief Flag indicating that the method is `dynamic_with_measured_cost`.
+   */
+  bool measured_cost_enabled;
+
+  /**
+   * @brief Smoothed cost of the locally owned cells indexed by the active cell
+   * index (only with the measured cost method). It is cleared when the
+   * triangulation is repartitioned.
+   */
+  std::vector<double> cell_costs;
+
+  /**
+   * @brief Computational time of the DEM kernels measured on this process
+   * since the last check (only with the measured cost method).
+   */
+  double measured_time;
+
+  /**
+   * @brief Start time of the current measurement.
+   */
+  std::chrono::steady_clock::time_point measurement_start_time;
+
   /**
    * @brief Iteration number for load balancing execution, only when method
    * is `once`.
@@ -388,6 +572,12 @@ private:
    * @brief Pointer to the adaptive sparse contacts object.
    */
   AdaptiveSparseContacts<dim, PropertiesIndex> *adaptive_sparse_contacts;
+
+  /**
+   * @brief Pointer to the contact manager object. It is a null pointer for the
+   * solvers without contact manager.
+   */
+  DEMContactManager<dim, PropertiesIndex> *contact_manager;
 };
 
 #endif
@@ -6,6 +6,7 @@
 
 #include <dem/adaptive_sparse_contacts.h>
 #include <dem/data_containers.h>
+#include <dem/linked_cell_grid.h>
 
 #include <deal.II/particles/particle.h>
 #include <deal.II/particles/particle_handler.h>
@@ -194,6 +195,139 @@ find_particle_particle_periodic_contact_pairs(
     &ghost_local_contact_pair_periodic_candidates,
   const AdaptiveSparseContacts<dim, PropertiesIndex> &sparse_contacts_object);
 
+/**
+ * @brief Finds the candidate local-local and local-ghost particle-particle
+ * collision pairs with a rank-local linked-cell grid instead of the cells of
+ * the background triangulation. The local and ghost particles are sorted into
+ * the bins of the grid, which are at least as wide as the neighborhood
+ * diameter, and each local particle is only paired with the particles of its
+ * bin and of the adjacent bins that are located within the neighborhood
+ * diameter. The number of candidates is thus independent of the size of the
+ * cells of the triangulation, which are often several particle diameters wide
+ * in CFD-DEM simulations.
+ *
+ * @param[in] particle_handler The particle handler of particles in the broad
+ * search.
+ * @param[in] neighborhood_diameter Distance between the centers of two
+ * particles below which they are contact candidates (neighborhood threshold
+ * times the maximum particle diameter). It is also the minimal size of the
+ * bins.
+ * @param[in,out] linked_cell_grid Grid of bins, rebuilt at every call and
+ * kept to reuse its memory.
+ * @param[out] local_contact_pair_candidates Ankerl unordered dense map. Stores
+ * potential pairs of local-local particle in contact without redundancy.
+ * Keys are particle ids and mapped types are vectors of particle ids.
+ * @param[out] ghost_contact_pair_candidates Ankerl unordered dense map. Stores
+ * potential pairs of local-ghost particle in contact. Keys are particle ids and
+ * mapped types are vectors of particle ids.
+ */
+template <int dim>
+void
+find_particle_particle_linked_cell_contact_pairs(
+  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const double                             neighborhood_diameter,
+  LinkedCellGrid<dim>                     &linked_cell_grid,
+  typename DEM::dem_data_structures<dim>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename DEM::dem_data_structures<dim>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+/**
+ * @brief Finds the candidate periodic particle-particle collision pairs with a
+ * rank-local linked-cell grid. The particles located in the periodic cells on
+ * the periodic boundary 1 are sorted into the bins of the grid after being
+ * translated by the periodic offset, and each particle located in the periodic
+ * cells on the periodic boundary 0 is paired with the particles of the
+ * adjacent bins that are located within the neighborhood diameter.
+ *
+ * @param[in] particle_handler The particle handler of particles in the broad
+ * search.
+ * @param[in] cells_local_periodic_neighbor_list Local periodic cells at
+ * boundary 0 and their local periodic neighbor cells at boundary 1.
+ * @param[in] cells_ghost_periodic_neighbor_list Local periodic cells at
+ * boundary 0 and their ghost periodic neighbor cells at boundary 1.
+ * @param[in] cells_ghost_local_periodic_neighbor_list Ghost periodic cells at
+ * boundary 0 and their local periodic neighbor cells at boundary 1.
+ * @param[in] periodic_offset Offset between the periodic boundaries, which is
+ * subtracted from the location of the particles on the periodic boundary 1.
+ * @param[in] neighborhood_diameter Distance between the centers of two
+ * particles below which they are contact candidates. It is also the minimal
+ * size of the bins.
+ * @param[in,out] linked_cell_grid Grid of bins, rebuilt at every call and
+ * kept to reuse its memory.
+ * @param[out] local_contact_pair_periodic_candidates Ankerl unordered dense
+ * map. Stores potential pairs of local-local periodic particles in contact.
+ * Keys are local particle ids at boundary 0 and mapped types are vectors of
+ * local particle ids at boundary 1.
+ * @param[out] ghost_contact_pair_periodic_candidates Ankerl unordered dense
+ * map. Stores potential pairs of local-ghost periodic particles in contact.
+ * Keys are local particle ids at boundary 0 and mapped types are vectors of
+ * ghost particle ids at boundary 1.
+ * @param[out] ghost_local_contact_pair_periodic_candidates Ankerl unordered
+ * dense map. Stores potential pairs of local-ghost periodic particles in
+ * contact. Keys are ghost at boundary 0 particle ids and mapped types are
+ * vectors of local particle ids at boundary 1.
+ */
+template <int dim>
+void
+find_particle_particle_linked_cell_periodic_contact_pairs(
+  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const typename DEM::dem_data_structures<dim>::cells_neighbor_list
+    &cells_local_periodic_neighbor_list,
+  const typename DEM::dem_data_structures<dim>::cells_neighbor_list
+    &cells_ghost_periodic_neighbor_list,
+  const typename DEM::dem_data_structures<dim>::cells_neighbor_list
+                       &cells_ghost_local_periodic_neighbor_list,
+  const Tensor<1, dim> &periodic_offset,
+  const double          neighborhood_diameter,
+  LinkedCellGrid<dim>  &linked_cell_grid,
+  typename DEM::dem_data_structures<dim>::particle_particle_candidates
+    &local_contact_pair_periodic_candidates,
+  typename DEM::dem_data_structures<dim>::particle_particle_candidates
+    &ghost_contact_pair_periodic_candidates,
+  typename DEM::dem_data_structures<dim>::particle_particle_candidates
+    &ghost_local_contact_pair_periodic_candidates);
+
+/**
+ * @brief Finds the candidate local-local and local-ghost particle-particle
+ * collision pairs with a rank-local hierarchical grid, which is suited to
+ * strongly polydisperse simulations. The particles are split into diameter
+ * classes, the diameters of two consecutive classes differing by a factor of
+ * two, and the particles of each class are sorted into their own linked-cell
+ * grid whose bins are sized from the largest diameter of the class. Each
+ * particle is then paired with the particles of its own class and of the
+ * classes of smaller particles located closer than the neighborhood threshold
+ * times the mean diameter of the two particles. Contrary to the other broad
+ * searches, the neighborhood of small particles is therefore not sized by the
+ * largest particle of the simulation.
+ *
+ * @param[in] particle_handler The particle handler of particles in the broad
+ * search.
+ * @param[in] neighborhood_threshold Ratio between the distance below which
+ * two particles are contact candidates and their mean diameter.
+ * @param[in,out] hierarchical_grid Grids of bins of each diameter class,
+ * rebuilt at every call and kept to reuse their memory.
+ * @param[out] local_contact_pair_candidates Ankerl unordered dense map. Stores
+ * potential pairs of local-local particle in contact without redundancy.
+ * Keys are particle ids and mapped types are vectors of particle ids.
+ * @param[out] ghost_contact_pair_candidates Ankerl unordered dense map. Stores
+ * potential pairs of local-ghost particle in contact. Keys are local particle
+ * ids and mapped types are vectors of ghost particle ids.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam PropertiesIndex Index of the properties used within the ParticleHandler.
+ */
+template <int dim, typename PropertiesIndex>
+void
+find_particle_particle_hierarchical_grid_contact_pairs(
+  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const double                             neighborhood_threshold,
+  std::vector<LinkedCellGrid<dim>>        &hierarchical_grid,
+  typename DEM::dem_data_structures<dim>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename DEM::dem_data_structures<dim>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
 /**
  * @brief Stores the candidate particle-particle collision pairs with a given
  * particle iterator. particle_begin iterator is useful to skip storage of the
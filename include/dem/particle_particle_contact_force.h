@@ -16,6 +16,7 @@
 
 #include <boost/range/adaptor/map.hpp>
 
+#include <limits>
 #include <vector>
 
 using namespace dealii;
@@ -70,14 +71,117 @@ public:
     const double dt,
     ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome) = 0;
 
+  /**
+   * @brief Calculate the contact outcomes of the pairs of local particles.
+   * These pairs do not involve ghost particles, so their calculation can be
+   * overlapped with the update of the ghost particles.
+   *
+   * @param local_adjacent_particles Container of the contact pair candidates
+   * information for calculation of the local particle-particle contact forces.
+   * @param local_local_periodic_adjacent_particles Container of the contact pair
+   * candidates information for calculation of the local periodic
+   * particle-particle contact forces.
+   * @param dt DEM time step.
+   * @param contact_outcome Interaction outcomes.
+   */
+  virtual void
+  calculate_local_particle_particle_contact(
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      &local_adjacent_particles,
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+                &local_local_periodic_adjacent_particles,
+    const double dt,
+    ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome) = 0;
+
+  /**
+   * @brief Calculate the contact outcomes of the pairs involving a ghost
+   * particle. The properties of the ghost particles must be up to date.
+   *
+   * @param ghost_adjacent_particles Container of the contact pair candidates
+   * information for calculation of the local-ghost particle-particle contact
+   * forces.
+   * @param local_ghost_periodic_adjacent_particles Container of the contact pair
+   * candidates information for calculation of the local-ghost periodic
+   * particle-particle contact forces.
+   * @param ghost_local_periodic_adjacent_particles Container of the contact pair
+   * candidates information for calculation of the ghost-local periodic
+   * particle-particle contact forces.
+   * @param dt DEM time step.
+   * @param contact_outcome Interaction outcomes.
+   */
+  virtual void
+  calculate_ghost_particle_particle_contact(
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      &ghost_adjacent_particles,
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      &local_ghost_periodic_adjacent_particles,
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+                &ghost_local_periodic_adjacent_particles,
+    const double dt,
+    ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome) = 0;
+
   void
   set_periodic_offset(const Tensor<1, dim> &periodic_offset)
   {
     this->periodic_offset = periodic_offset;
   }
 
+  /**
+   * @brief Enable the multiple time stepping of the pairs of coarse particles,
+   * whose diameters are both larger than a threshold.
+   *
+   * @param[in] coarse_diameter_threshold Diameter above which a particle is
+   * coarse.
+   */
+  void
+  set_coarse_diameter_threshold(const double coarse_diameter_threshold)
+  {
+    this->coarse_diameter_threshold = coarse_diameter_threshold;
+  }
+
+  /**
+   * @brief Set the time step of the pairs of coarse particles for the next
+   * contact calculation, as a multiple of the DEM time step. The force of these
+   * pairs is weighted by this ratio, since it is applied over the coarse time
+   * step. These pairs are not calculated if the ratio is zero.
+   *
+   * @param[in] coarse_pair_time_step_ratio Ratio between the time step of the
+   * pairs of coarse particles and the DEM time step.
+   */
+  void
+  set_coarse_pair_time_step_ratio(
+    const unsigned int coarse_pair_time_step_ratio)
+  {
+    this->coarse_pair_time_step_ratio = coarse_pair_time_step_ratio;
+  }
+
+  /**
+   * @brief Set if the heat transfer of the pairs in contact is calculated at
+   * the next contact calculation. The heat transfer is only calculated at the
+   * iterations where the temperature is integrated (DEM multiphysics).
+   *
+   * @param[in] calculate_heat_transfer Whether the heat transfer is calculated.
+   */
+  void
+  set_heat_transfer_calculation(const bool calculate_heat_transfer)
+  {
+    this->calculate_heat_transfer = calculate_heat_transfer;
+  }
+
 protected:
   Tensor<1, dim> periodic_offset;
+
+  /// Diameter above which a particle is coarse (multiple time stepping). No
+  /// particle is coarse by default.
+  double coarse_diameter_threshold = std::numeric_limits<double>::max();
+
+  /// Ratio between the time step of the pairs of coarse particles and the DEM
+  /// time step for the next contact calculation.
+  unsigned int coarse_pair_time_step_ratio = 1;
+
+  /// Whether the heat transfer of the pairs in contact is calculated at the
+  /// next contact calculation.
+  bool calculate_heat_transfer = true;
 };
 
 /**
@@ -143,6 +247,53 @@ public:
     const double dt,
     ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome) override;
 
+  /**
+   * @brief Calculate the contact outcomes of the pairs of local particles.
+   *
+   * @param local_adjacent_particles Container of the contact pair candidates
+   * information for calculation of the local particle-particle contact forces.
+   * @param local_local_periodic_adjacent_particles Container of the contact pair
+   * candidates information for calculation of the local periodic
+   * particle-particle contact forces.
+   * @param dt DEM time step.
+   * @param[out] contact_outcome Interaction outcomes.
+   */
+  virtual void
+  calculate_local_particle_particle_contact(
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      &local_adjacent_particles,
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+                &local_local_periodic_adjacent_particles,
+    const double dt,
+    ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome) override;
+
+  /**
+   * @brief Calculate the contact outcomes of the pairs involving a ghost
+   * particle.
+   *
+   * @param ghost_adjacent_particles Container of the contact pair candidates
+   * information for calculation of the local-ghost particle-particle contact
+   * forces.
+   * @param local_ghost_periodic_adjacent_particles Container of the contact pair
+   * candidates information for calculation of the local-ghost periodic
+   * particle-particle contact forces.
+   * @param ghost_local_periodic_adjacent_particles Container of the contact pair
+   * candidates information for calculation of the ghost-local periodic
+   * particle-particle contact forces.
+   * @param dt DEM time step.
+   * @param[out] contact_outcome Interaction outcomes.
+   */
+  virtual void
+  calculate_ghost_particle_particle_contact(
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      &ghost_adjacent_particles,
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      &local_ghost_periodic_adjacent_particles,
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+                &ghost_local_periodic_adjacent_particles,
+    const double dt,
+    ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome) override;
+
 protected:
   /**
    * @brief Update the contact pair information for all contact force
@@ -1700,6 +1851,8 @@ private:
     Tensor<1, 3> rolling_resistance_torque;
     double       normal_relative_velocity_value;
     Tensor<1, 3> tangential_relative_velocity;
+    Tensor<1, 3> previous_tangential_displacement;
+    Tensor<1, 3> previous_rolling_resistance_spring_torque;
 
     // Gather information about particle 1 and set it up.
     auto first_contact_info      = adjacent_particles_list.begin();
@@ -1721,6 +1874,38 @@ private:
         auto particle_two            = contact_info.particle_two;
         auto particle_two_properties = particle_two->get_properties();
 
+        // With multiple time stepping, the force of the pairs of coarse
+        // particles is only applied every few iterations with the coarse time
+        // step, and it is weighted by the ratio of the time steps. Between
+        // these iterations, the pairs are only calculated for their heat
+        // transfer, their force is weighted by zero and their contact history
+        // is left unchanged.
+        double pair_dt     = dt;
+        double pair_weight = 1.;
+        if (particle_one_properties[PropertiesIndex::dp] >
+              this->coarse_diameter_threshold &&
+            particle_two_properties[PropertiesIndex::dp] >
+              this->coarse_diameter_threshold)
+          {
+            if (this->coarse_pair_time_step_ratio == 0)
+              {
+                if (!std::is_same_v<PropertiesIndex,
+                                    DEM::DEMMPProperties::PropertiesIndex> ||
+                    !this->calculate_heat_transfer)
+                  continue;
+                pair_weight = 0.;
+                previous_tangential_displacement =
+                  contact_info.tangential_displacement;
+                previous_rolling_resistance_spring_torque =
+                  contact_info.rolling_resistance_spring_torque;
+              }
+            else
+              {
+                pair_weight = this->coarse_pair_time_step_ratio;
+                pair_dt     = pair_weight * dt;
+              }
+          }
+
         // Get particle 2 location
         Point<3> particle_two_location;
         if constexpr (contact_type == ContactType::local_particle_particle ||
@@ -1751,6 +1936,10 @@ private:
         const double force_calculation_threshold_distance =
           get_force_calculation_threshold_distance();
 
+        // Magnitude of the normal force before its weighting by the multiple
+        // time stepping, used for the heat transfer
+        double normal_force_norm = 0.;
+
         if (normal_overlap > force_calculation_threshold_distance)
           {
             // Update of contact information and calculation of contact force
@@ -1776,7 +1965,7 @@ private:
                                                  particle_two_properties,
                                                  particle_one_location,
                                                  particle_two_location,
-                                                 dt);
+                                                 pair_dt);
 
                 // Calculation the contact force
                 this->calculate_contact(contact_info,
@@ -1784,7 +1973,7 @@ private:
                                         normal_relative_velocity_value,
                                         normal_unit_vector,
                                         normal_overlap,
-                                        dt,
+                                        pair_dt,
                                         particle_one_properties,
                                         particle_two_properties,
                                         normal_force,
@@ -1813,7 +2002,7 @@ private:
                                                  particle_one_properties,
                                                  particle_two_location,
                                                  particle_one_location,
-                                                 dt);
+                                                 pair_dt);
 
                 // Calculation the contact force
                 this->calculate_contact(contact_info,
@@ -1821,7 +2010,7 @@ private:
                                         normal_relative_velocity_value,
                                         normal_unit_vector,
                                         normal_overlap,
-                                        dt,
+                                        pair_dt,
                                         particle_two_properties,
                                         particle_one_properties,
                                         normal_force,
@@ -1831,6 +2020,17 @@ private:
                                         rolling_resistance_torque);
               }
 
+            normal_force_norm = normal_force.norm();
+
+            if (pair_weight != 1.)
+              {
+                normal_force *= pair_weight;
+                tangential_force *= pair_weight;
+                particle_one_tangential_torque *= pair_weight;
+                particle_two_tangential_torque *= pair_weight;
+                rolling_resistance_torque *= pair_weight;
+              }
+
             // Apply the calculated forces and torques on both particles
             // of the pair for local-local contacts
             if constexpr (contact_type ==
@@ -1903,10 +2103,20 @@ private:
             contact_info.rolling_resistance_spring_torque.clear();
           }
 
+        // The contact history of a pair of coarse particles only advances at
+        // the iterations where its force is applied
+        if (pair_weight == 0.)
+          {
+            contact_info.tangential_displacement =
+              previous_tangential_displacement;
+            contact_info.rolling_resistance_spring_torque =
+              previous_rolling_resistance_spring_torque;
+          }
+
         if constexpr (std::is_same_v<PropertiesIndex,
                                      DEM::DEMMPProperties::PropertiesIndex>)
           {
-            if (normal_overlap > 0)
+            if (normal_overlap > 0 && this->calculate_heat_transfer)
               {
                 const unsigned int particle_one_type =
                   static_cast<unsigned int>(
@@ -1941,7 +2151,7 @@ private:
                   this->thermal_conductivity_gas,
                   this->gas_parameter_m[pair_index],
                   normal_overlap,
-                  normal_force.norm(),
+                  normal_force_norm,
                   thermal_conductance);
 
                 // Apply the heat transfer to both particles
@@ -46,4 +46,38 @@ particle_particle_fine_search(
   const double         neighborhood_threshold,
   const Tensor<1, dim> periodic_offset = Tensor<1, dim>());
 
+/**
+ * @brief Same as particle_particle_fine_search, except that the neighborhood
+ * of each pair is sized by the diameters of its two particles instead of the
+ * largest particle diameter. Two particles remain adjacent while the distance
+ * between their centers is smaller than the neighborhood threshold times
+ * their mean diameter, which avoids storing many distant pairs of small
+ * particles in polydisperse simulations.
+ *
+ * @param particle_container A container that is used to obtain iterators to
+ * particles using their ids
+ * @param adjacent_particles A map of maps which stores all the required
+ * information for calculation of the contact force of particle pairs
+ * @param contact_pair_candidates The output of broad search which shows
+ * contact pair candidates
+ * @param neighborhood_threshold Ratio between the neighborhood diameter of a
+ * pair and the mean diameter of its particles
+ * @param periodic_offset A tensor of the periodic offset to change the
+ * particle location of the particles on the periodic boundary 1 side,
+ * the tensor as 0.0 values by default
+ *
+ * @tparam PropertiesIndex Index of the properties used within the ParticleHandler.
+ */
+template <int dim, typename PropertiesIndex>
+void
+particle_particle_polydisperse_fine_search(
+  typename DEM::dem_data_structures<dim>::particle_index_iterator_map const
+    &particle_container,
+  typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<dim>::particle_particle_candidates
+                      &contact_pair_candidates,
+  const double         neighborhood_threshold,
+  const Tensor<1, dim> periodic_offset = Tensor<1, dim>());
+
 #endif
@@ -69,6 +69,25 @@ public:
     const double dt,
     const std::vector<std::shared_ptr<SerialSolid<dim - 1, dim>>> &solids,
     ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome) = 0;
+
+  /**
+   * @brief Set if the heat transfer of the particle-solid object pairs in
+   * contact is calculated at the next contact calculation. The heat transfer
+   * is only calculated at the iterations where the temperature is integrated
+   * (DEM multiphysics).
+   *
+   * @param[in] calculate_heat_transfer Whether the heat transfer is calculated.
+   */
+  void
+  set_heat_transfer_calculation(const bool calculate_heat_transfer)
+  {
+    this->calculate_heat_transfer = calculate_heat_transfer;
+  }
+
+protected:
+  /// Whether the heat transfer of the pairs in contact is calculated at the
+  /// next contact calculation.
+  bool calculate_heat_transfer = true;
 };
 
 /**
@@ -9,6 +9,7 @@
 
 #include <dem/dem_solver_parameters.h>
 #include <dem/insertion.h>
+#include <dem/lagrangian_time_averaging.h>
 
 #include <deal.II/base/timer.h>
 
@@ -27,6 +28,7 @@
  * @param particle_handler Particle handler
  * @param insertion_object Shared pointer of Insertion type.
  * @param solid_surfaces Vector of solids surfaces used in DEM simulations
+ * @param time_averaging Time averaging of the cell-based fields
  * @param checkpoint_controller Checkpoint controller
  */
 template <int dim, typename PropertiesIndex>
@@ -41,6 +43,7 @@ read_checkpoint(
   Particles::ParticleHandler<dim>                         &particle_handler,
   std::shared_ptr<Insertion<dim, PropertiesIndex>>        &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<dim - 1, dim>>> &solid_surfaces,
+  LagrangianTimeAveraging<dim, PropertiesIndex>           &time_averaging,
   CheckpointControl &checkpoint_controller);
 
 #endif
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_reduced_ghost_update_h
+#define lethe_reduced_ghost_update_h
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Update of the ghost particles which only sends the properties used
+ * by the contact force calculations, outside of the ParticleHandler.
+ *
+ * ParticleHandler::update_ghost_particles() sends the id, the location, the
+ * reference location and all the properties of every ghost particle. Between
+ * two contact searches, the ghost particles remain in the same cells and only
+ * their location and a few of their properties change. When the ghost
+ * particles are exchanged, each process sends to the owner of its ghost
+ * particles the ids of the ghost particles it holds. At the following
+ * iterations, the owners send, in the same order, the location and the
+ * dynamic properties (velocity, angular velocity and temperature) of these
+ * particles in double precision and their static properties (type, diameter,
+ * mass and specific heat) in single precision.
+ *
+ * A static property received in single precision only overwrites the value of
+ * the ghost particle if it differs from it once rounded to single precision.
+ * Thus, the static properties keep the full precision of the last exchange of
+ * the ghost particles as long as they do not change.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam PropertiesIndex Index of the properties used within the ParticleHandler.
+ */
+template <int dim, typename PropertiesIndex>
+class ReducedGhostUpdate
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] mpi_communicator MPI communicator of the particle handler.
+   */
+  ReducedGhostUpdate(const MPI_Comm mpi_communicator);
+
+  /**
+   * @brief Destructor. Waits for the completion of an update which was
+   * started but not finished.
+   */
+  ~ReducedGhostUpdate();
+
+  /**
+   * @brief Build the lists of the particles sent to and received from each
+   * process. This function must be called by all the processes after each
+   * exchange of the ghost particles, since the exchange invalidates the
+   * iterators to the particles.
+   *
+   * @param[in,out] particle_handler Particle handler whose ghost particles
+   * are updated.
+   */
+  void
+  setup(Particles::ParticleHandler<dim> &particle_handler);
+
+  /**
+   * @brief Start the update of the ghost particles by posting the
+   * non-blocking sends of the properties of the locally owned particles and
+   * the non-blocking receives of the properties of the ghost particles.
+   */
+  void
+  update_start();
+
+  /**
+   * @brief Complete the update of the ghost particles started by
+   * update_start() and write the received properties in the ghost particles.
+   */
+  void
+  update_finish();
+
+  /**
+   * @brief Update the ghost particles with blocking communications.
+   */
+  void
+  update()
+  {
+    update_start();
+    update_finish();
+  }
+
+private:
+  /**
+   * @brief Pack the location and the properties of a particle in a buffer.
+   *
+   * @param[in] particle Particle whose data is packed.
+   * @param[in,out] buffer Position in the buffer, moved past the packed data.
+   */
+  void
+  pack_particle(const Particles::ParticleIterator<dim> &particle,
+                char                                  *&buffer) const;
+
+  /**
+   * @brief Unpack the location and the properties of a ghost particle from a
+   * buffer.
+   *
+   * @param[in,out] particle Ghost particle whose data is unpacked.
+   * @param[in,out] buffer Position in the buffer, moved past the unpacked
+   * data.
+   */
+  void
+  unpack_particle(Particles::ParticleIterator<dim> &particle,
+                  const char                      *&buffer) const;
+
+  /// MPI communicator of the particle handler.
+  const MPI_Comm mpi_communicator;
+
+  /// Properties sent in double precision, which change between two contact
+  /// searches.
+  const std::vector<unsigned int> dynamic_properties;
+
+  /// Properties sent in single precision, which do not change between two
+  /// contact searches.
+  const std::vector<unsigned int> static_properties;
+
+  /// Number of bytes sent for each particle.
+  const std::size_t bytes_per_particle;
+
+  /// Processes to which properties are sent.
+  std::vector<unsigned int> send_processes;
+
+  /// Locally owned particles sent to each process of send_processes, in the
+  /// order of the ids requested by the process.
+  std::vector<std::vector<Particles::ParticleIterator<dim>>> particles_to_send;
+
+  /// Processes from which properties are received.
+  std::vector<unsigned int> receive_processes;
+
+  /// Ghost particles received from each process of receive_processes, in the
+  /// order of the ids sent to the process.
+  std::vector<std::vector<Particles::ParticleIterator<dim>>>
+    ghost_particles_to_receive;
+
+  /// Buffers of the properties sent to each process.
+  std::vector<std::vector<char>> send_buffers;
+
+  /// Buffers of the properties received from each process.
+  std::vector<std::vector<char>> receive_buffers;
+
+  /// Requests of the non-blocking sends and receives.
+  std::vector<MPI_Request> requests;
+
+  /// Flag indicating that an update was started and is not finished.
+  bool update_in_progress;
+};
+
+#endif
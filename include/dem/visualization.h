@@ -45,9 +45,13 @@ public:
                 const std::vector<std::pair<std::string, int>> &properties);
 
   /**
-   * @brief Print the data of particles in the xyz format.
+   * @brief Print the data of particles in the xyz format, sorted by particle
+   * id. The particles are distributed among the processes with a parallel
+   * sample sort on their id, formatted locally and gathered on the first
+   * process which writes them in a single pass.
    *
    * @param particle_handler The particle handler of active particles.
+   * @param mpi_communicator The MPI communicator.
    * @param pcout Printing in parallel.
    */
   void
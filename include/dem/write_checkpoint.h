@@ -9,6 +9,7 @@
 
 #include <dem/dem_solver_parameters.h>
 #include <dem/insertion.h>
+#include <dem/lagrangian_time_averaging.h>
 
 #include <deal.II/base/timer.h>
 
@@ -27,6 +28,7 @@
  * @param particle_handler Particle handler
  * @param insertion_object Insertion object
  * @param solid_objects Vector of solids objects used in DEM simulations
+ * @param time_averaging Time averaging of the cell-based fields
  * @param pcout Printing in parallel
  * @param mpi_communicator
  * @param checkpoint_controller Checkpoint controller
@@ -43,6 +45,7 @@ write_checkpoint(
   Particles::ParticleHandler<dim>                         &particle_handler,
   std::shared_ptr<Insertion<dim, PropertiesIndex>>        &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<dim - 1, dim>>> &solid_objects,
+  LagrangianTimeAveraging<dim, PropertiesIndex>           &time_averaging,
   const ConditionalOStream                                &pcout,
   MPI_Comm                                                &mpi_communicator,
   const CheckpointControl &checkpoint_controller);
@@ -4,6 +4,8 @@
 #ifndef lethe_cfd_dem_coupling_h
 #define lethe_cfd_dem_coupling_h
 
+#include <core/sub_simulation_control.h>
+
 #include <solvers/navier_stokes_scratch_data.h>
 
 #include <dem/adaptive_sparse_contacts.h>
@@ -433,6 +435,10 @@ private:
                                      DEM::CFDDEMProperties::PropertiesIndex>>
     particle_particle_contact_force_object;
 
+  /// Multiple time stepping of the contacts between coarse particles. The time
+  /// step ratio is one if the multiple time stepping is disabled.
+  std::shared_ptr<SubSimulationControlMultiRateDEM> multi_rate_control;
+
   /// Contact force model for particle-wall interactions
   std::shared_ptr<
     ParticleWallContactForceBase<dim, DEM::CFDDEMProperties::PropertiesIndex>>
@@ -12,8 +12,11 @@
 #include <solvers/fluid_dynamics_matrix_based.h>
 
 #include <fem-dem/cfd_dem_simulation_parameters.h>
+#include <fem-dem/ib_stencil_cache.h>
 #include <fem-dem/ib_particles_dem.h>
 
+#include <deal.II/base/bounding_box.h>
+
 using namespace dealii;
 
 /**
@@ -228,6 +231,25 @@ private:
   void
   sharp_edge();
 
+  /**
+   * @brief Calculate the geometric data of the sharp-edge stencil of a DOF of
+   * a cut cell.
+   *
+   * @param[in] cell_cut Cell cut by the particle.
+   * @param[in] ib_particle_id Id of the particle used to define the stencil.
+   * @param[in] support_point Support point of the DOF.
+   * @param[in] dof_index Global index of the DOF.
+   *
+   * @return Geometric data of the stencil. If the DOF is on a boundary where
+   * a boundary condition is applied, only the stencil cell is defined.
+   */
+  IBStencilCacheEntry<dim>
+  compute_ib_stencil(
+    const typename DoFHandler<dim>::active_cell_iterator &cell_cut,
+    const unsigned int                                    ib_particle_id,
+    const Point<dim>                                     &support_point,
+    const types::global_dof_index                         dof_index);
+
   /**
    * @brief
    * Write in a specifique file for each of the paticles its forces, velocity,
@@ -318,24 +340,15 @@ private:
   /**
    * @brief
    * This function is only applied if all particles are spheres.
-   * It creates two maps (cut_cells_map and cells_inside_map) to access the
-   * cells cut by particles and inside the particles, respectively. The map keys
-   * are the particle's IDs. The algorithm was optimized to reduce the cost of
-   * this step.
+   * It fills two vectors indexed by the active cell index (cut_cells_map and
+   * cells_inside_map) to access the cells cut by particles and inside the
+   * particles, respectively, with SharpCutCellsMapping::map_sphere_cut_cells.
+   * If the triangulation did not change since the last call, only the cells
+   * close to the particles that moved are updated.
    */
   void
   optimized_generate_cut_cells_map();
 
-  /**
-   * @brief
-   *This function abstracts the generation of cell candidates that possibly are
-   *cut
-   */
-  std::pair<bool, bool>
-  generate_cut_cell_candidates(
-    const typename DoFHandler<dim>::cell_iterator &cell,
-    const unsigned int                             p_id);
-
   /**
    * @brief
    * Return a bool to define if a cell is cut by an IB particle and the local
@@ -569,14 +582,13 @@ private:
            std::set<typename DoFHandler<dim>::active_cell_iterator>>
     vertices_to_cell;
   /*
-   * This map uses the cell as the key, and stores the following information:
-   * if that cell is cut (bool), what particle cut this cell (unsigned int), and
-   * the number of particles that cut this cell(unsigned int). The id of the
-   * particle that cut the cell is the id of the particle with the lowest
-   * particle index.
+   * This vector is indexed by the active cell index, and stores the following
+   * information: if that cell is cut (bool), what particle cut this cell
+   * (unsigned int), and the number of particles that cut this cell(unsigned
+   * int). The id of the particle that cut the cell is the id of the particle
+   * with the lowest particle index.
    */
-  std::map<typename DoFHandler<dim>::active_cell_iterator,
-           std::tuple<bool, unsigned int, std::vector<unsigned int>>>
+  std::vector<std::tuple<bool, unsigned int, std::vector<unsigned int>>>
     cut_cells_map;
 
   /*
@@ -599,9 +611,24 @@ private:
   std::map<unsigned int, bool> dof_with_more_then_one_particle;
 
 
-  std::map<typename DoFHandler<dim>::active_cell_iterator,
-           std::tuple<bool, unsigned int>>
-    cells_inside_map;
+  /*
+   * This vector is indexed by the active cell index, and stores if the cell is
+   * inside a particle (bool) and the id of this particle (unsigned int).
+   */
+  std::vector<std::tuple<bool, unsigned int>> cells_inside_map;
+
+  /*
+   * Positions and radii of the particles when the cut cells mapping of the
+   * spheres was last generated. They are used to only update the mapping of
+   * the cells located close to the particles that moved since then.
+   */
+  std::vector<Point<dim>> cut_cells_mapping_positions;
+  std::vector<double>     cut_cells_mapping_radii;
+
+  // Whether the cut cells mapping of the spheres can be updated incrementally.
+  // It is reset when the triangulation changes.
+  bool cut_cells_mapping_is_up_to_date;
+
   /*
    * This map is used to keep in memory which DOFs already have an IB equation
    * imposed on them in order to avoid writing multiple time the same equation.
@@ -610,6 +637,9 @@ private:
            std::pair<bool, typename DoFHandler<dim>::active_cell_iterator>>
     ib_done;
 
+  // Stencils of the DOFs of the cut cells reused between the assemblies
+  IBStencilCache<dim> ib_stencil_cache;
+
   // Special assembler of the cells inside an IB particle
   std::vector<std::shared_ptr<NavierStokesAssemblerBase<dim>>>
     assemblers_inside_ib;
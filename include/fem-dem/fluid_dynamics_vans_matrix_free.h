@@ -70,9 +70,28 @@ public:
              const ParticleProjector<dim> &particle_projector);
 
 private:
+  /**
+   * @brief Build the DoF handlers and the transfer operators of the void
+   * fraction and of the particle-fluid coupling fields on every level. These
+   * only depend on the triangulation and are thus built once per preconditioner
+   * instead of at every initialization. The preconditioner is kept across the
+   * time steps and is only recreated when the degrees of freedom are
+   * distributed again, i.e., once per mesh.
+   *
+   * @param[in] particle_projector Manager of the void fraction and of the
+   * particle fields on the fine level.
+   */
+  void
+  setup_particle_fluid_transfers(
+    const ParticleProjector<dim> &particle_projector);
+
   /// Reference to the simulation parameters
   const CFDDEMSimulationParameters<dim> &cfd_dem_simulation_parameters;
 
+  /// Flag indicating that the level DoF handlers and transfers of the
+  /// particle-fluid coupling fields have been built
+  bool particle_fluid_transfers_are_built;
+
   /// Void Fraction DoF handlers for each of the levels of the global coarsening
   /// algorithm
   MGLevelObject<DoFHandler<dim>> void_fraction_dof_handlers;
@@ -84,50 +103,31 @@ private:
   /// Transfer operator for global coarsening for the void fraction
   std::shared_ptr<GCTransferType> mg_transfer_gc_void_fraction;
 
-  /// Particle-fluid force DoF handlers for each of the levels of the global
-  /// coarsening algorithm
-  MGLevelObject<DoFHandler<dim>> pf_force_dof_handlers;
-
-  /// Particle-fluid force transfers for each of the levels of the global
-  /// coarsening algorithm
-  MGLevelObject<MGTwoLevelTransfer<dim, MGVectorType>> transfers_pf_force;
+  /// Particle field DoF handlers for each of the levels of the global
+  /// coarsening algorithm. The particle-fluid force, the particle-fluid drag
+  /// and the particle velocity share the same finite element and triangulation
+  /// and thus the same DoF numbering, so a single hierarchy is used for the
+  /// three of them.
+  MGLevelObject<DoFHandler<dim>> particle_field_dof_handlers;
 
-  /// Transfer operator for global coarsening for the particle-fluid forces
-  std::shared_ptr<GCTransferType> mg_transfer_gc_pf_force;
-
-  /// Particle-fluid drag DoF handlers for each of the levels of the global
-  /// coarsening algorithm
-  MGLevelObject<DoFHandler<dim>> pf_drag_dof_handlers;
-
-  /// Particle-fluid drag transfers for each of the levels of the global
-  /// coarsening algorithm
-  MGLevelObject<MGTwoLevelTransfer<dim, MGVectorType>> transfers_pf_drag;
-
-  /// Transfer operator for global coarsening for the particle-fluid drag
-  std::shared_ptr<GCTransferType> mg_transfer_gc_pf_drag;
-
-  /// Particle velocity DoF handlers for each of the levels of the global
-  /// coarsening algorithm
-  MGLevelObject<DoFHandler<dim>> particle_velocity_dof_handlers;
-
-  /// Particle velocity for each of the levels of the global
-  /// coarsening algorithm
-  MGLevelObject<MGTwoLevelTransfer<dim, MGVectorType>>
-    transfers_particle_velocity;
+  /// Particle field transfers for each of the levels of the global coarsening
+  /// algorithm
+  MGLevelObject<MGTwoLevelTransfer<dim, MGVectorType>> transfers_particle_field;
 
-  /// Transfer operator for global coarsening for the particle velocity
-  std::shared_ptr<GCTransferType> mg_transfer_gc_particle_velocity;
+  /// Transfer operator for global coarsening for the particle fields
+  std::shared_ptr<GCTransferType> mg_transfer_gc_particle_field;
 
   /// Particle momentum transfer coefficient DoF handlers for each of the levels
   /// of the global coarsening algorithm
   MGLevelObject<DoFHandler<dim>> momentum_transfer_coefficient_dof_handlers;
 
-  /// Particle-fluid drag transfers for each of the levels of the global
-  /// coarsening algorithm
+  /// Particle momentum transfer coefficient transfers for each of the levels of
+  /// the global coarsening algorithm
   MGLevelObject<MGTwoLevelTransfer<dim, MGVectorType>>
     transfers_momentum_transfer_coefficient;
 
-  /// Transfer operator for global coarsening for the particle-fluid drag
+  /// Transfer operator for global coarsening for the momentum transfer
+  /// coefficient
   std::shared_ptr<GCTransferType> mg_transfer_gc_momentum_transfer_coefficient;
 };
 
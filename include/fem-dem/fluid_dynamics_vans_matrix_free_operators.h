@@ -99,6 +99,32 @@ public:
       &momentum_transfer_coefficient_solution);
 
 protected:
+  /**
+   * @brief Evaluate a finite element field, defined on the same triangulation
+   * as the operator, at the quadrature points of the matrix-free cell batches.
+   * The shape functions are tabulated once on the reference cell and the
+   * gradients are mapped with the inverse Jacobians already stored by the
+   * matrix-free object, which avoids reinitializing a FEValues object on every
+   * cell.
+   *
+   * @tparam StoreFunction Callable with the signature (cell batch index, lane,
+   * values, gradients), where values(q, c) and gradients(q, c) are the value
+   * and the gradient of component c at quadrature point q.
+   *
+   * @param[in] field_dof_handler The dof handler associated with the field.
+   * @param[in] field_solution The solution vector of the field with ghost
+   * values.
+   * @param[in] evaluate_gradients Flag to evaluate the gradients of the field.
+   * @param[in] store_values Function storing the values of a cell.
+   */
+  template <typename StoreFunction>
+  void
+  evaluate_field_at_quadrature_points(
+    const DoFHandler<dim>                            &field_dof_handler,
+    const LinearAlgebra::distributed::Vector<double> &field_solution,
+    const bool                                        evaluate_gradients,
+    const StoreFunction                              &store_values) const;
+
   /**
    * @brief Store relevant values of the vector of the last newton step to use it
    * in the Jacobian and pre-calculate the stabilization parameters tau and
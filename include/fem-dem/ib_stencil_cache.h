@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_ib_stencil_cache_h
+#define lethe_ib_stencil_cache_h
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <boost/signals2/connection.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Geometric data of the sharp-edge stencil of a DOF of a cut cell. It
+ * only depends on the mesh, on the particle which cuts the cell and on the
+ * stencil parameters, and is therefore reused between the assemblies as long
+ * as the mesh does not change and the particle does not move.
+ */
+template <int dim>
+struct IBStencilCacheEntry
+{
+  // Id of the particle used to define the stencil
+  unsigned int particle_id;
+  // Cell containing the points used in the stencil
+  typename DoFHandler<dim>::active_cell_iterator stencil_cell;
+  // Whether the stencil cell could not be found because the DOF is on a
+  // boundary, in which case the stencil cell is the cut cell itself
+  bool particle_close_to_wall;
+  // Whether the last point of the stencil lies inside the cut cell
+  bool point_in_cell = false;
+  // Values of the shape functions of the stencil cell at the points of the
+  // stencil. The value of the shape function j at the point k is stored at
+  // the index j * n_stencil_points + k.
+  std::vector<double> shape_values;
+};
+
+/**
+ * @brief Cache of the sharp-edge stencils of the DOFs of the cut cells, the
+ * key being the active cell index of the cut cell and the local index of the
+ * DOF in this cell.
+ *
+ * The stencils refer to the cells of the triangulation and are all discarded
+ * when the triangulation changes. The stencils of a particle are discarded
+ * when the particle moves or rotates, which is detected by comparing the
+ * positions and orientations of the particles with the ones of the last
+ * update of the cache.
+ */
+template <int dim>
+class IBStencilCache
+{
+public:
+  IBStencilCache() = default;
+
+  ~IBStencilCache();
+
+  /**
+   * @brief Discard all the stencils whenever the triangulation changes or is
+   * repartitioned.
+   *
+   * @param[in] triangulation Triangulation of the cut cells.
+   */
+  void
+  connect_to_triangulation(const Triangulation<dim> &triangulation);
+
+  /**
+   * @brief Remove the stencils of the particles which moved or rotated since
+   * the last call. All the stencils are removed if the number of particles
+   * changed.
+   *
+   * @param[in] positions Current positions of the particles.
+   * @param[in] orientations Current orientations of the particles.
+   */
+  void
+  remove_outdated_stencils(const std::vector<Point<dim>>   &positions,
+                           const std::vector<Tensor<1, 3>> &orientations);
+
+  /**
+   * @brief Return the stencil of a DOF of a cut cell, or a null pointer if
+   * it is not cached or if it was computed for another particle.
+   *
+   * @param[in] cell_index Active cell index of the cut cell.
+   * @param[in] local_dof_index Local index of the DOF in the cut cell.
+   * @param[in] particle_id Id of the particle which cuts the cell.
+   */
+  const IBStencilCacheEntry<dim> *
+  find(const unsigned int cell_index,
+       const unsigned int local_dof_index,
+       const unsigned int particle_id) const;
+
+  /**
+   * @brief Store the stencil of a DOF of a cut cell, replacing the previous
+   * one if any.
+   *
+   * @param[in] cell_index Active cell index of the cut cell.
+   * @param[in] local_dof_index Local index of the DOF in the cut cell.
+   * @param[in] stencil Stencil of the DOF.
+   *
+   * @return Reference to the stored stencil.
+   */
+  const IBStencilCacheEntry<dim> &
+  store(const unsigned int         cell_index,
+        const unsigned int         local_dof_index,
+        IBStencilCacheEntry<dim> &&stencil);
+
+  /**
+   * @brief Remove all the stencils.
+   */
+  void
+  clear()
+  {
+    stencils.clear();
+  }
+
+  /**
+   * @brief Return the number of cached stencils.
+   */
+  unsigned int
+  size() const
+  {
+    return stencils.size();
+  }
+
+private:
+  std::map<std::pair<unsigned int, unsigned int>, IBStencilCacheEntry<dim>>
+    stencils;
+
+  // Positions and orientations of the particles at the last update
+  std::vector<Point<dim>>   positions;
+  std::vector<Tensor<1, 3>> orientations;
+
+  std::vector<boost::signals2::connection> triangulation_connections;
+};
+
+#endif
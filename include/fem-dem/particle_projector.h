@@ -7,6 +7,8 @@
 #include <core/parameters_cfd_dem.h>
 #include <core/vector.h>
 
+#include <fem-dem/void_fraction_projection_operator.h>
+
 #include <solvers/navier_stokes_scratch_data.h>
 #include <solvers/physics_subequations_solver.h>
 #include <solvers/simulation_parameters.h>
@@ -24,6 +26,7 @@
 #include <deal.II/fe/mapping_fe.h>
 
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
@@ -234,6 +237,7 @@ public:
    * @param fe_degree The finite element degree used to interpolate the void fraction.
    * @param simplex A flag to indicate if the simulations are being done with simplex elements.
    * @param pcout The ConditionalOStream used to print the information.
+   * @param matrix_free_projection A flag to indicate if the smoothed L2 projection of the void fraction is solved with a matrix-free operator on deal.II vectors instead of a Trilinos matrix. In this case, the Trilinos vectors of the void fraction are not allocated.
    */
   ParticleProjector(
     parallel::DistributedTriangulationBase<dim>             *triangulation,
@@ -242,13 +246,15 @@ public:
     Particles::ParticleHandler<dim> *particle_handler,
     const unsigned int               fe_degree,
     const bool                       simplex,
-    const ConditionalOStream        &pcout)
+    const ConditionalOStream        &pcout,
+    const bool                       matrix_free_projection = false)
     : PhysicsLinearSubequationsSolver(pcout)
     , dof_handler(*triangulation)
     , triangulation(triangulation)
     , void_fraction_parameters(input_parameters)
     , linear_solver_parameters(linear_solver_parameters)
     , particle_handler(particle_handler)
+    , matrix_free_projection(matrix_free_projection)
     , particle_have_been_projected(false)
     , particle_velocity(triangulation, fe_degree, simplex, true, false)
     , fluid_force_on_particles_two_way_coupling(triangulation,
@@ -316,6 +322,11 @@ public:
          void_fraction_parameters->mode == Parameters::VoidFractionMode::qcm),
       ExcMessage(
         "The projection of the particle velocity currently requires that the QCM method be used for the calculation of the void fraction."));
+
+    AssertThrow(
+      !matrix_free_projection || !simplex,
+      ExcMessage(
+        "The matrix-free projection of the void fraction is not supported for simplex elements."));
   }
 
   /**
@@ -371,7 +382,7 @@ public:
   {}
 
   /**
-   * @brief Percolate the time vector for the void fraction. This operation is called at the end of a time step. It percolates both the deal.II and the Trilinos vectors.
+   * @brief Percolate the time vector for the void fraction. This operation is called at the end of a time step. It percolates both the deal.II and the Trilinos vectors, the latter only if the projection is matrix-based.
    *
    * TODO - Refactor the ParticleProjector class to use deal.II vectors for
    * everything instead of a blend of Trilinos and deal.II vector.
@@ -380,14 +391,18 @@ public:
   void
   percolate_void_fraction()
   {
-    for (unsigned int i = previous_void_fraction.size() - 1; i > 0; --i)
-      {
-        previous_void_fraction[i] = previous_void_fraction[i - 1];
-        void_fraction_previous_solution[i] =
-          void_fraction_previous_solution[i - 1];
-      }
-    previous_void_fraction[0]          = void_fraction_locally_relevant;
+    for (unsigned int i = void_fraction_previous_solution.size() - 1; i > 0;
+         --i)
+      void_fraction_previous_solution[i] =
+        void_fraction_previous_solution[i - 1];
     void_fraction_previous_solution[0] = void_fraction_solution;
+
+    if (matrix_free_projection)
+      return;
+
+    for (unsigned int i = previous_void_fraction.size() - 1; i > 0; --i)
+      previous_void_fraction[i] = previous_void_fraction[i - 1];
+    previous_void_fraction[0] = void_fraction_locally_relevant;
   }
 
   /**
@@ -453,7 +468,8 @@ public:
   std::shared_ptr<Quadrature<dim>> quadrature;
 
   /// The solutions are made public instead of using getters
-  /// Solution of the void fraction at previous time steps
+  /// Solution of the void fraction at previous time steps. The Trilinos
+  /// vectors are empty if the projection is matrix-free.
   std::vector<GlobalVectorType> previous_void_fraction;
 
   /// Fully distributed (including locally relevant) solution
@@ -602,6 +618,34 @@ private:
   void
   calculate_void_fraction_quadrature_centered_method();
 
+  /**
+   * @brief Set the right-hand side of the smoothed L2 projection, and its
+   * matrix if the projection is matrix-based, to zero before an assembly.
+   */
+  void
+  zero_void_fraction_system();
+
+  /**
+   * @brief Add the contribution of a cell to the smoothed L2 projection. The
+   * local matrix is discarded if the projection is matrix-free.
+   *
+   * @param[in] local_matrix Local matrix of the cell.
+   * @param[in] local_rhs Local right-hand side of the cell.
+   * @param[in] local_dof_indices Degrees of freedom of the cell.
+   */
+  void
+  distribute_local_void_fraction_system(
+    const FullMatrix<double>                   &local_matrix,
+    const Vector<double>                       &local_rhs,
+    const std::vector<types::global_dof_index> &local_dof_indices);
+
+  /**
+   * @brief Exchange the contributions of the cells to the smoothed L2
+   * projection between the processes after an assembly.
+   */
+  void
+  compress_void_fraction_system();
+
   /**
    * @brief Solve the linear system resulting from the assemblies.
    *
@@ -609,6 +653,17 @@ private:
   virtual void
   solve_linear_system_and_update_solution() override;
 
+  /**
+   * @brief Solve the smoothed L2 projection with the matrix-free operator and
+   * a conjugate gradient preconditioned by the inverse of its diagonal.
+   *
+   * @param[in] linear_solver_tolerance Absolute tolerance of the solver.
+   *
+   * @return Number of iterations of the solver.
+   */
+  unsigned int
+  solve_matrix_free_linear_system(const double linear_solver_tolerance);
+
   /**
    * @brief Calculate and return the periodic offset distance vector of the domain which is needed
    * for the periodic boundary conditions using the QCM or SPM for void fraction
@@ -683,6 +738,17 @@ private:
   /// Particle handler used when the void fraction depends on particles
   Particles::ParticleHandler<dim> *particle_handler;
 
+  /// Boolean that indicates if the smoothed L2 projection of the void fraction
+  /// is solved with a matrix-free operator on deal.II vectors
+  const bool matrix_free_projection;
+
+  /// Matrix-free operator of the smoothed L2 projection of the void fraction
+  VoidFractionProjectionOperator<dim> projection_operator;
+
+  /// Right-hand side of the smoothed L2 projection of the void fraction when
+  /// the projection is matrix-free
+  LinearAlgebra::distributed::Vector<double>
+    system_rhs_void_fraction_matrix_free;
 
   /// Preconditioner used for the solution of the smoothed L2 projection of the
   /// void fraction
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_sharp_cut_cells_mapping_h
+#define lethe_sharp_cut_cells_mapping_h
+
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/point.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Mapping of the cells cut by spherical particles, or inside of them,
+ * used by the sharp-edge immersed boundary solver (FluidDynamicsSharp).
+ */
+namespace SharpCutCellsMapping
+{
+  /**
+   * @brief Check if a cell is inside a sphere or cut by it. The cell is inside
+   * the sphere if all its vertices are inside of it and cut if only some of
+   * them are. If no vertex is inside the sphere but its center lies in the
+   * cell, the cell is considered both inside the sphere and cut by it.
+   *
+   * @param[in] cell Cell of the DoFHandler, active or not.
+   * @param[in] position Center of the sphere.
+   * @param[in] radius Radius of the sphere.
+   *
+   * @return Whether the cell is inside the sphere and whether it is cut by it.
+   */
+  template <int dim>
+  std::pair<bool, bool>
+  sphere_cut_cell_candidates(
+    const typename DoFHandler<dim>::cell_iterator &cell,
+    const Point<dim>                              &position,
+    const double                                   radius);
+
+  /**
+   * @brief Return the bounding box of a sphere, slightly enlarged so that it
+   * contains all the cells that are cut by the sphere or inside of it
+   * according to sphere_cut_cell_candidates.
+   *
+   * @param[in] position Center of the sphere.
+   * @param[in] radius Radius of the sphere.
+   */
+  template <int dim>
+  BoundingBox<dim>
+  sphere_bounding_box(const Point<dim> &position, const double radius);
+
+  /**
+   * @brief Map the active cells cut by spheres or inside of them. The cell
+   * hierarchy is traversed once from the coarse cells and all the spheres are
+   * tested at once, the spheres tested on a cell being the ones whose
+   * bounding box intersects the cell. When a cell is cut by, or inside,
+   * several spheres, the sphere with the lowest id is associated to it.
+   *
+   * Only the cells intersecting one of the updated boxes are mapped, the
+   * others keep their state. All the cells are mapped if the updated boxes
+   * are the bounding boxes of all the spheres and the maps are initialized
+   * to false.
+   *
+   * @param[in] dof_handler DoFHandler of the triangulation.
+   * @param[in] positions Centers of the spheres.
+   * @param[in] radii Radii of the spheres.
+   * @param[in] updated_boxes Boxes of the regions in which the mapping is
+   * updated.
+   * @param[in,out] cut_cells_map Vector indexed by the active cell index
+   * storing if the cell is cut, the id of the sphere that cuts it and a list
+   * of particle ids which is left empty.
+   * @param[in,out] cells_inside_map Vector indexed by the active cell index
+   * storing if the cell is inside a sphere and the id of this sphere.
+   */
+  template <int dim>
+  void
+  map_sphere_cut_cells(
+    const DoFHandler<dim>               &dof_handler,
+    const std::vector<Point<dim>>       &positions,
+    const std::vector<double>           &radii,
+    const std::vector<BoundingBox<dim>> &updated_boxes,
+    std::vector<std::tuple<bool, unsigned int, std::vector<unsigned int>>>
+                                                &cut_cells_map,
+    std::vector<std::tuple<bool, unsigned int>> &cells_inside_map);
+} // namespace SharpCutCellsMapping
+
+#endif
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_void_fraction_projection_operator_h
+#define lethe_void_fraction_projection_operator_h
+
+#include <deal.II/base/quadrature.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+using namespace dealii;
+
+/**
+ * @brief Matrix-free operator of the smoothed L2 projection of the void
+ * fraction.
+ *
+ * The operator applies \f$ M + l^2 K \f$, where \f$ M \f$ is the mass matrix,
+ * \f$ K \f$ the Laplace matrix and \f$ l \f$ the L2 smoothing length. This is
+ * the matrix assembled by the ParticleProjector for the particle centered,
+ * satellite point and quadrature centered methods. The hanging node and
+ * periodic constraints of the void fraction are resolved by the MatrixFree
+ * object, hence the operator is zero on the rows of the constrained degrees
+ * of freedom.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ */
+template <int dim>
+class VoidFractionProjectionOperator
+{
+public:
+  using FECellIntegrator = FEEvaluation<dim, -1, 0, 1, double>;
+  using VectorType       = LinearAlgebra::distributed::Vector<double>;
+  using value_type       = double;
+
+  /**
+   * @brief Initialize the MatrixFree object of the operator.
+   *
+   * @param[in] mapping Mapping of the void fraction.
+   * @param[in] dof_handler DoFHandler of the void fraction.
+   * @param[in] constraints Constraints of the void fraction.
+   * @param[in] quadrature Quadrature of the void fraction, which must be a
+   * tensor product quadrature.
+   * @param[in] l2_smoothing_factor Square of the L2 smoothing length.
+   */
+  void
+  reinit(const Mapping<dim>              &mapping,
+         const DoFHandler<dim>           &dof_handler,
+         const AffineConstraints<double> &constraints,
+         const Quadrature<dim>           &quadrature,
+         const double                     l2_smoothing_factor);
+
+  /**
+   * @brief Apply the operator.
+   *
+   * @param[out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Compute the inverse of the diagonal of the operator.
+   *
+   * @param[out] inverse_diagonal Inverse of the diagonal, which is one on the
+   * constrained degrees of freedom.
+   */
+  void
+  compute_inverse_diagonal(VectorType &inverse_diagonal) const;
+
+  /**
+   * @brief Initialize a vector with the partitioning of the MatrixFree
+   * object.
+   *
+   * @param[out] vec Vector to initialize.
+   */
+  void
+  initialize_dof_vector(VectorType &vec) const;
+
+private:
+  /**
+   * @brief Integrate the operator on a cell batch whose degrees of freedom
+   * have been set in the integrator.
+   *
+   * @param[in,out] integrator Cell integrator.
+   */
+  void
+  do_cell_integral_local(FECellIntegrator &integrator) const;
+
+  /**
+   * @brief Apply the operator on a range of cell batches.
+   */
+  void
+  local_apply(const MatrixFree<dim, double>               &matrix_free,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &range) const;
+
+  /// MatrixFree object of the void fraction
+  MatrixFree<dim, double> matrix_free;
+
+  /// Square of the L2 smoothing length, which weights the Laplace matrix
+  double l2_smoothing_factor;
+};
+
+#endif
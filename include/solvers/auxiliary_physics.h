@@ -4,6 +4,7 @@
 #ifndef lethe_auxiliary_physics_h
 #define lethe_auxiliary_physics_h
 
+#include <core/multiphysics.h>
 #include <core/output_struct.h>
 #include <core/parameters.h>
 #include <core/physics_solver.h>
@@ -108,6 +109,19 @@ public:
   virtual void
   modify_solution(){};
 
+  /**
+   * @brief Give the physics whose solution is used during the solution of
+   * this auxiliary physics. The multiphysics interface can solve concurrently
+   * the auxiliary physics that do not depend on each other.
+   *
+   * @return Identifiers of the physics this auxiliary physics depends on.
+   */
+  virtual std::vector<PhysicsID>
+  get_dependencies() const
+  {
+    return {PhysicsID::fluid_dynamics};
+  }
+
   /**
    * @brief Update non zero constraints if the boundary is time-dependent
    */
@@ -199,6 +213,30 @@ public:
    */
   void
   setup_preconditioner() override{};
+
+protected:
+  /**
+   * @brief Give the communicator of the timer of the auxiliary physics. The
+   * timers synchronize the processes of their communicator at each section,
+   * which cannot be done from the threads of the concurrent execution of the
+   * auxiliary physics. Since this execution is restricted to a single
+   * process, the timers then measure the time of this process only.
+   *
+   * @param[in] simulation_parameters Parameters of the simulation.
+   * @param[in] mpi_communicator Communicator of the triangulation.
+   *
+   * @return Communicator with which the timer is constructed.
+   */
+  static MPI_Comm
+  get_timer_communicator(const SimulationParameters<dim> &simulation_parameters,
+                         const MPI_Comm                   mpi_communicator)
+  {
+    if (simulation_parameters.multiphysics.auxiliary_physics_execution ==
+          Parameters::AuxiliaryPhysicsExecution::concurrent &&
+        Utilities::MPI::n_mpi_processes(mpi_communicator) == 1)
+      return MPI_COMM_SELF;
+    return mpi_communicator;
+  }
 };
 
 
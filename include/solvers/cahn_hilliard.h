@@ -17,12 +17,15 @@
 #define lethe_cahn_hilliard_h
 
 #include <core/bdf.h>
+#include <core/preconditioner_refresh_policy.h>
 #include <core/simulation_control.h>
+#include <core/time_integration_utilities.h>
 #include <core/vector.h>
 
 #include <solvers/auxiliary_physics.h>
 #include <solvers/cahn_hilliard_assemblers.h>
 #include <solvers/cahn_hilliard_filter.h>
+#include <solvers/cahn_hilliard_matrix_free_operators.h>
 #include <solvers/cahn_hilliard_scratch_data.h>
 #include <solvers/multiphysics_interface.h>
 
@@ -40,6 +43,7 @@
 
 #include <deal.II/grid/grid_tools.h>
 
+#include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
 
@@ -64,7 +68,9 @@ public:
         p_simulation_parameters.physics_solving_strategy.at(
           PhysicsID::cahn_hilliard))
     , multiphysics(multiphysics_interface)
-    , computing_timer(p_triangulation->get_mpi_communicator(),
+    , computing_timer(this->get_timer_communicator(
+                            p_simulation_parameters,
+                            p_triangulation->get_mpi_communicator()),
                       this->pcout,
                       TimerOutput::summary,
                       TimerOutput::wall_times)
@@ -72,6 +78,8 @@ public:
     , triangulation(p_triangulation)
     , simulation_control(p_simulation_control)
     , dof_handler(std::make_shared<DoFHandler<dim>>(*triangulation))
+    , preconditioner_refresh_policy(
+        p_simulation_parameters.linear_solver.at(PhysicsID::cahn_hilliard))
   {
     if (simulation_parameters.mesh.simplex)
       {
@@ -125,6 +133,38 @@ public:
           1);
       }
 
+    if (simulation_parameters.fem_parameters.cahn_hilliard_uses_matrix_free)
+      {
+        AssertThrow(
+          !simulation_parameters.mesh.simplex &&
+            simulation_parameters.fem_parameters.phase_cahn_hilliard_order ==
+              simulation_parameters.fem_parameters
+                .potential_cahn_hilliard_order,
+          ExcMessage(
+            "The matrix-free Cahn-Hilliard operator requires a quad/hex mesh and equal phase and potential orders."));
+
+        AssertThrow(
+          time_stepping_is_bdf(simulation_parameters.simulation_control.method),
+          ExcMessage(
+            "The matrix-free Cahn-Hilliard operator only supports the BDF time-stepping methods."));
+
+        for (auto const &[id, type] :
+             simulation_parameters.boundary_conditions_cahn_hilliard.type)
+          AssertThrow(
+            type !=
+                BoundaryConditions::BoundaryType::
+                  cahn_hilliard_angle_of_contact &&
+              type !=
+                BoundaryConditions::BoundaryType::cahn_hilliard_free_angle,
+            ExcMessage(
+              "The matrix-free Cahn-Hilliard operator does not support angle of contact boundary conditions."));
+
+        matrix_free_operator =
+          std::make_shared<CahnHilliardMatrixFreeOperator<dim, double>>();
+        matrix_free_preconditioner =
+          std::make_shared<CahnHilliardBlockPreconditioner<dim, double>>();
+      }
+
     // Allocate solution transfer
     solution_transfer =
       std::make_shared<SolutionTransfer<dim, GlobalVectorType>>(*dof_handler);
@@ -369,6 +409,23 @@ private:
   void
   assemble_system_matrix() override;
 
+  /**
+   * @brief Update the matrix-free operator with the previous Newton iterate
+   * and the velocity of the fluid, which replaces the assembly of the system
+   * matrix when the matrix-free operator is used.
+   */
+  void
+  update_matrix_free_operator();
+
+  /**
+   * @brief Solve the linear system with the matrix-free operator, using GMRES
+   * preconditioned by the block preconditioner.
+   *
+   * @param[in] tolerance Absolute tolerance of the linear solver.
+   */
+  void
+  solve_linear_system_matrix_free(const double tolerance);
+
   /**
    * @brief Assemble the rhs associated with the solver
    */
@@ -543,6 +600,17 @@ private:
 
   // Phase fraction filter
   std::shared_ptr<CahnHilliardFilterBase> filter;
+  // ILU preconditioner kept across the linear solves and policy deciding when
+  // it is rebuilt
+  std::shared_ptr<TrilinosWrappers::PreconditionILU> system_ilu_preconditioner;
+  PreconditionerRefreshPolicy preconditioner_refresh_policy;
+
+  // Matrix-free operator and block preconditioner, replacing the system
+  // matrix and the ILU preconditioner when the Cahn-Hilliard uses matrix free
+  std::shared_ptr<CahnHilliardMatrixFreeOperator<dim, double>>
+    matrix_free_operator;
+  std::shared_ptr<CahnHilliardBlockPreconditioner<dim, double>>
+    matrix_free_preconditioner;
 };
 
 
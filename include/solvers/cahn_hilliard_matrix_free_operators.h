@@ -0,0 +1,482 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_cahn_hilliard_matrix_free_operators_h
+#define lethe_cahn_hilliard_matrix_free_operators_h
+
+#include <core/ale.h>
+#include <core/parameters_multiphysics.h>
+#include <core/simulation_control.h>
+
+#include <solvers/physical_properties_manager.h>
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+using namespace dealii;
+
+/**
+ * @brief Matrix-free operator of the Jacobian of the Cahn-Hilliard equations.
+ *
+ * The operator applies the Jacobian assembled by the CahnHilliardAssemblerBDF
+ * and CahnHilliardAssemblerCore assemblers to the two components (phase order
+ * and chemical potential) of the solution with a single two-component
+ * FEEvaluation. The quantities that depend on the previous Newton iterate
+ * (velocity, mobility and its derivative, double-well derivative and surface
+ * tension) are evaluated once per Newton iteration at the quadrature points
+ * with the mobility and surface tension models of the physical properties
+ * manager.
+ *
+ * The MatrixFree object is built on the Cahn-Hilliard DoFHandler (index 0)
+ * and on the fluid dynamics DoFHandler (index 1), from which the advective
+ * velocity is read.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam number Abstract type for number across the class (i.e., double).
+ */
+template <int dim, typename number>
+class CahnHilliardMatrixFreeOperator : public EnableObserverPointer
+{
+public:
+  using FECellIntegrator         = FEEvaluation<dim, -1, 0, 2, number>;
+  using FEVelocityCellIntegrator = FEEvaluation<dim, -1, 0, dim, number>;
+  using VectorType               = LinearAlgebra::distributed::Vector<number>;
+  using value_type               = number;
+
+  /**
+   * @brief Default constructor.
+   */
+  CahnHilliardMatrixFreeOperator();
+
+  /**
+   * @brief Initialize the MatrixFree object on the Cahn-Hilliard and fluid
+   * dynamics DoFHandlers.
+   *
+   * @param[in] mapping Mapping of the Cahn-Hilliard physics.
+   * @param[in] dof_handler DoFHandler of the Cahn-Hilliard physics.
+   * @param[in] dof_handler_fluid DoFHandler of the fluid dynamics.
+   * @param[in] constraints Homogeneous constraints of the Newton update.
+   * @param[in] quadrature One-dimensional quadrature of the cells.
+   * @param[in] simulation_control Simulation control providing the BDF
+   * coefficients.
+   */
+  void
+  reinit(const Mapping<dim>                       &mapping,
+         const DoFHandler<dim>                    &dof_handler,
+         const DoFHandler<dim>                    &dof_handler_fluid,
+         const AffineConstraints<number>          &constraints,
+         const Quadrature<1>                      &quadrature,
+         const std::shared_ptr<SimulationControl> &simulation_control);
+
+  /**
+   * @brief Evaluate the terms of the Jacobian that depend on the previous
+   * Newton iterate and on the velocity of the fluid.
+   *
+   * @param[in] evaluation_point Previous Newton iterate, with ghost values,
+   * initialized with initialize_dof_vector().
+   * @param[in] fluid_solution Solution of the fluid dynamics, with ghost
+   * values, initialized with initialize_fluid_dof_vector().
+   * @param[in] ale ALE parameters. If enabled, the ALE velocity is
+   * subtracted from the fluid velocity.
+   * @param[in] properties_manager Physical properties manager providing the
+   * mobility and surface tension models.
+   * @param[in] cahn_hilliard_parameters Parameters of the Cahn-Hilliard
+   * physics.
+   * @param[in] epsilon Interface thickness.
+   */
+  void
+  evaluate_non_linear_terms(
+    const VectorType                &evaluation_point,
+    const VectorType                &fluid_solution,
+    const Parameters::ALE<dim>      &ale,
+    const PhysicalPropertiesManager &properties_manager,
+    const Parameters::CahnHilliard  &cahn_hilliard_parameters,
+    const double                     epsilon);
+
+  /**
+   * @brief Apply the operator.
+   *
+   * @param[out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Apply the block of the Jacobian coupling the phase order to the
+   * chemical potential equation, i.e., the derivative of the chemical
+   * potential equation with respect to the phase order.
+   *
+   * @param[out] dst Destination vector, whose phase order entries are zero.
+   * @param[in] src Input source vector, whose chemical potential entries are
+   * ignored.
+   */
+  void
+  vmult_potential_phase_coupling(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Get the total number of degrees of freedom.
+   *
+   * @return Number of degrees of freedom.
+   */
+  types::global_dof_index
+  m() const;
+
+  /**
+   * @brief Initialize a vector with the partitioning of the Cahn-Hilliard
+   * physics.
+   *
+   * @param[out] vec Vector to initialize.
+   */
+  void
+  initialize_dof_vector(VectorType &vec) const;
+
+  /**
+   * @brief Initialize a vector with the partitioning of the fluid dynamics.
+   *
+   * @param[out] vec Vector to initialize.
+   */
+  void
+  initialize_fluid_dof_vector(VectorType &vec) const;
+
+  /**
+   * @brief Get the underlying MatrixFree object.
+   *
+   * @return MatrixFree object.
+   */
+  const MatrixFree<dim, number> &
+  get_matrix_free() const
+  {
+    return matrix_free;
+  }
+
+  /**
+   * @brief Get the locally owned constrained degrees of freedom, as local
+   * indices.
+   *
+   * @return Constrained degrees of freedom.
+   */
+  const std::vector<unsigned int> &
+  get_constrained_indices() const
+  {
+    return constrained_indices;
+  }
+
+  /**
+   * @brief Get the coefficient of the present solution in the time
+   * derivative.
+   *
+   * @return BDF coefficient.
+   */
+  number
+  get_bdf_coefficient() const;
+
+  /**
+   * @brief Get the mobility at the cell quadrature points.
+   *
+   * @return Table of the mobility indexed by cell batch and quadrature point.
+   */
+  const Table<2, VectorizedArray<number>> &
+  get_mobility() const
+  {
+    return mobility;
+  }
+
+  /**
+   * @brief Get the mixing energy density \f$\lambda =
+   * 3\epsilon\sigma/(2\sqrt{2})\f$ at the cell quadrature points.
+   *
+   * @return Table of the mixing energy density indexed by cell batch and
+   * quadrature point.
+   */
+  const Table<2, VectorizedArray<number>> &
+  get_lambda() const
+  {
+    return lambda;
+  }
+
+  /**
+   * @brief Get the smoothing coefficient of the chemical potential \f$\xi
+   * h^2\f$ at the cell quadrature points.
+   *
+   * @return Table of the smoothing coefficient indexed by cell batch and
+   * quadrature point.
+   */
+  const Table<2, VectorizedArray<number>> &
+  get_potential_smoothing() const
+  {
+    return potential_smoothing;
+  }
+
+private:
+  /**
+   * @brief Apply the operator on a range of cell batches.
+   */
+  void
+  local_apply(const MatrixFree<dim, number>               &matrix_free,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &range) const;
+
+  /**
+   * @brief Apply the phase order to chemical potential coupling block on a
+   * range of cell batches.
+   */
+  void
+  local_apply_potential_phase_coupling(
+    const MatrixFree<dim, number>               &matrix_free,
+    VectorType                                  &dst,
+    const VectorType                            &src,
+    const std::pair<unsigned int, unsigned int> &range) const;
+
+  /// Matrix-free object, the Cahn-Hilliard physics being the DoFHandler 0
+  /// and the fluid dynamics the DoFHandler 1
+  MatrixFree<dim, number> matrix_free;
+
+  /// Empty constraints of the fluid dynamics DoFHandler, which is only read
+  AffineConstraints<number> fluid_constraints;
+
+  /// Simulation control providing the BDF coefficients
+  std::shared_ptr<SimulationControl> simulation_control;
+
+  /// Locally owned constrained degrees of freedom, as local indices
+  std::vector<unsigned int> constrained_indices;
+
+  /// Advective velocity at the cell quadrature points
+  Table<2, Tensor<1, dim, VectorizedArray<number>>> velocity;
+
+  /// Mobility, mixing energy density and smoothing coefficient of the
+  /// chemical potential at the cell quadrature points
+  Table<2, VectorizedArray<number>> mobility;
+  Table<2, VectorizedArray<number>> lambda;
+  Table<2, VectorizedArray<number>> potential_smoothing;
+
+  /// Derivative of the mobility with respect to the phase order, multiplied
+  /// by the gradient of the chemical potential, at the cell quadrature points
+  Table<2, Tensor<1, dim, VectorizedArray<number>>>
+    mobility_derivative_potential_gradient;
+
+  /// Derivative of the double-well term of the chemical potential equation
+  /// with respect to the phase order \f$\lambda(3\phi^2-1)/\epsilon^2\f$ at
+  /// the cell quadrature points
+  Table<2, VectorizedArray<number>> double_well_derivative;
+};
+
+/**
+ * @brief Matrix-free operator \f$ a M + b K \f$ acting on a single component
+ * of the Cahn-Hilliard solution, where \f$ M \f$ is the mass matrix, \f$ K
+ * \f$ the Laplace matrix and the coefficients \f$ a \f$ and \f$ b \f$ vary at
+ * the quadrature points. The entries of the other component are left at zero.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam number Abstract type for number across the class (i.e., double).
+ */
+template <int dim, typename number>
+class CahnHilliardMassLaplaceOperator : public EnableObserverPointer
+{
+public:
+  using FECellIntegrator = FEEvaluation<dim, -1, 0, 1, number>;
+  using VectorType       = LinearAlgebra::distributed::Vector<number>;
+  using value_type       = number;
+
+  /**
+   * @brief Initialize the operator.
+   *
+   * @param[in] cahn_hilliard_operator Operator providing the MatrixFree
+   * object and the constraints.
+   * @param[in] component Component on which the operator acts, 0 for the
+   * phase order and 1 for the chemical potential.
+   * @param[in] mass_coefficient Coefficient of the mass matrix at the cell
+   * quadrature points.
+   * @param[in] laplace_coefficient Coefficient of the Laplace matrix at the
+   * cell quadrature points.
+   */
+  void
+  reinit(
+    const CahnHilliardMatrixFreeOperator<dim, number> &cahn_hilliard_operator,
+    const unsigned int                                 component,
+    const Table<2, VectorizedArray<number>>           &mass_coefficient,
+    const Table<2, VectorizedArray<number>>           &laplace_coefficient);
+
+  /**
+   * @brief Apply the operator.
+   *
+   * @param[out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Compute the inverse of the diagonal of the operator, which is
+   * zero on the entries of the other component.
+   *
+   * @param[out] inverse_diagonal Inverse of the diagonal.
+   */
+  void
+  compute_inverse_diagonal(VectorType &inverse_diagonal) const;
+
+  /**
+   * @brief Set the entries of the other component of a vector to zero.
+   *
+   * @param[in,out] vec Vector to restrict to the component of the operator.
+   */
+  void
+  restrict_to_component(VectorType &vec) const;
+
+  /**
+   * @brief Get the total number of degrees of freedom.
+   *
+   * @return Number of degrees of freedom.
+   */
+  types::global_dof_index
+  m() const;
+
+  /**
+   * @brief Initialize a vector with the partitioning of the Cahn-Hilliard
+   * physics.
+   *
+   * @param[out] vec Vector to initialize.
+   */
+  void
+  initialize_dof_vector(VectorType &vec) const;
+
+private:
+  /**
+   * @brief Integrate the operator on a cell batch whose degrees of freedom
+   * have been set in the integrator.
+   *
+   * @param[in,out] integrator Cell integrator.
+   */
+  void
+  do_cell_integral_local(FECellIntegrator &integrator) const;
+
+  /**
+   * @brief Apply the operator on a range of cell batches.
+   */
+  void
+  local_apply(const MatrixFree<dim, number>               &matrix_free,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &range) const;
+
+  /// Operator providing the MatrixFree object and the constraints
+  ObserverPointer<const CahnHilliardMatrixFreeOperator<dim, number>>
+    cahn_hilliard_operator;
+
+  /// Component on which the operator acts
+  unsigned int component;
+
+  /// Coefficients of the mass and Laplace matrices
+  ObserverPointer<const Table<2, VectorizedArray<number>>> mass_coefficient;
+  ObserverPointer<const Table<2, VectorizedArray<number>>> laplace_coefficient;
+
+  /// Local indices of the locally owned degrees of freedom of the other
+  /// component and of the constrained degrees of freedom of this component
+  std::vector<unsigned int> other_component_indices;
+  std::vector<unsigned int> constrained_component_indices;
+};
+
+/**
+ * @brief Block preconditioner of the matrix-free Cahn-Hilliard Jacobian.
+ *
+ * Writing the Jacobian as
+ * \f$ \begin{bmatrix} A & B \\ C & D \end{bmatrix} \f$, where the first row
+ * is the phase order equation and the second row the chemical potential
+ * equation, the preconditioner is the block lower-triangular matrix
+ * \f$ \begin{bmatrix} S & 0 \\ C & D \end{bmatrix} \f$, where
+ * \f$ S = A - B D^{-1} C \f$ is the Schur complement. With
+ * \f$ A \approx \alpha_0 M \f$, \f$ B \approx m K \f$,
+ * \f$ C \approx -\lambda K \f$ and \f$ D \approx M \f$, the Schur complement
+ * is approximated by the factorization
+ * \f$ \hat{S} = (\sqrt{\alpha_0} M + \sqrt{m\lambda} K) M^{-1}
+ * (\sqrt{\alpha_0} M + \sqrt{m\lambda} K) \f$.
+ *
+ * The inverses of the mass-Laplace operators \f$ \sqrt{\alpha_0} M +
+ * \sqrt{m\lambda} K \f$ and \f$ D = M + \xi h^2 K \f$ are approximated by
+ * Chebyshev iterations preconditioned by their diagonal, so that the
+ * preconditioner only requires matrix-free operator evaluations.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam number Abstract type for number across the class (i.e., double).
+ */
+template <int dim, typename number>
+class CahnHilliardBlockPreconditioner
+{
+public:
+  using VectorType     = LinearAlgebra::distributed::Vector<number>;
+  using ScalarOperator = CahnHilliardMassLaplaceOperator<dim, number>;
+  using ChebyshevType  = PreconditionChebyshev<ScalarOperator,
+                                              VectorType,
+                                              DiagonalMatrix<VectorType>>;
+
+  /**
+   * @brief Build the preconditioner: the coefficients of the mass-Laplace
+   * operators are computed from the present state of the Jacobian operator,
+   * then the diagonals and eigenvalue estimates of the Chebyshev iterations
+   * are computed.
+   *
+   * @param[in] cahn_hilliard_operator Matrix-free Jacobian operator.
+   * @param[in] tolerance Relative tolerance of the Chebyshev iterations
+   * approximating the inverse of the mass-Laplace operators.
+   */
+  void
+  initialize(
+    const CahnHilliardMatrixFreeOperator<dim, number> &cahn_hilliard_operator,
+    const double                                       tolerance);
+
+  /**
+   * @brief Apply the preconditioner.
+   *
+   * @param[out] dst Destination vector.
+   * @param[in] src Source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+private:
+  /**
+   * @brief Initialize a Chebyshev iteration used as an approximate inverse of
+   * a mass-Laplace operator.
+   */
+  void
+  initialize_chebyshev(const ScalarOperator &scalar_operator,
+                       ChebyshevType        &chebyshev,
+                       const double          tolerance) const;
+
+  /// Matrix-free Jacobian operator
+  ObserverPointer<const CahnHilliardMatrixFreeOperator<dim, number>>
+    cahn_hilliard_operator;
+
+  /// Coefficients of the factor of the approximate Schur complement, of the
+  /// mass matrix and of the chemical potential block
+  Table<2, VectorizedArray<number>> schur_mass_coefficient;
+  Table<2, VectorizedArray<number>> schur_laplace_coefficient;
+  Table<2, VectorizedArray<number>> unit_coefficient;
+  Table<2, VectorizedArray<number>> zero_coefficient;
+
+  /// Factor of the approximate Schur complement, mass matrix of the phase
+  /// order and chemical potential block
+  ScalarOperator schur_factor_operator;
+  ScalarOperator phase_mass_operator;
+  ScalarOperator potential_operator;
+
+  /// Approximate inverses of the factor of the Schur complement and of the
+  /// chemical potential block
+  ChebyshevType schur_factor_inverse;
+  ChebyshevType potential_inverse;
+
+  /// Temporary vectors
+  mutable VectorType tmp_phase;
+  mutable VectorType tmp_potential;
+};
+
+#endif
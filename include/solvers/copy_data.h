@@ -179,7 +179,8 @@ public:
     , local_rhs(n_dofs)
     , local_dof_indices(n_dofs)
     , strong_residual(n_q_points)
-    , strong_jacobian(n_q_points, std::vector<Tensor<1, dim>>(n_dofs)){};
+    , strong_jacobian(n_q_points, std::vector<Tensor<1, dim>>(n_dofs))
+    , cell_assembly_skipped(false){};
 
   /**
    * @brief Resets the cell_matrix, cell_rhs, strong_residual
@@ -212,6 +213,11 @@ public:
   // if it should indeed copy or not.
   bool cell_is_local;
   bool cell_is_cut;
+
+  // Boolean used to indicate that the local matrix was not assembled but
+  // recovered from the cache of a quiescent cell. This information is used
+  // by the copy_local_to_global function to gather assembly statistics.
+  bool cell_assembly_skipped;
 };
 
 
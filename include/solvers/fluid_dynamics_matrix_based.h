@@ -5,17 +5,20 @@
 #define lethe_fluid_dynamics_matrix_based_h
 
 #include <core/exceptions.h>
+#include <core/preconditioner_refresh_policy.h>
 #include <core/vector.h>
 
 #include <solvers/copy_data.h>
 #include <solvers/navier_stokes_base.h>
 #include <solvers/navier_stokes_scratch_data.h>
 
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_solver.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
+#include <deal.II/lac/vector.h>
 
 using namespace dealii;
 
@@ -128,6 +131,25 @@ protected:
   void
   setup_preconditioner() override;
 
+  /**
+   * @brief Build the ILU or AMG preconditioner of the system matrix that was
+   * last assembled, which is used as a lagged preconditioner by the jfnk
+   * non-linear solver.
+   */
+  void
+  setup_lagged_preconditioner() override;
+
+  /**
+   * @brief Apply the lagged ILU or AMG preconditioner to a vector.
+   *
+   * @param[out] dst Preconditioned vector.
+   *
+   * @param[in] src Vector to which the preconditioner is applied.
+   */
+  void
+  apply_lagged_preconditioner(GlobalVectorType       &dst,
+                              const GlobalVectorType &src) override;
+
   /**
    * @brief Define the zero constraints used to solved the problem that change
    * with other physics' solutions.
@@ -230,6 +252,30 @@ protected:
   solve_linear_system() override;
 
 private:
+  /**
+   * @brief Prepare the cell activity map for a new assembly of the system
+   * matrix. The cached local matrices are invalidated if the time-stepping
+   * coefficients have changed since they were assembled.
+   */
+  void
+  prepare_cell_activity_map();
+
+  /**
+   * @brief Check if a cell is quiescent, that is if its cached local matrix
+   * is valid and the degrees of freedom of the cell in the evaluation point
+   * and in the previous solutions have not changed by more than the cell
+   * activity tolerance since the local matrix was cached.
+   *
+   * @param[in] cell_index Active cell index of the cell.
+   * @param[in] local_dof_indices Degrees of freedom of the cell.
+   *
+   * @return True if the cached local matrix of the cell can be reused.
+   */
+  bool
+  is_cell_quiescent(
+    const unsigned int                          cell_index,
+    const std::vector<types::global_dof_index> &local_dof_indices) const;
+
   /**
    * @brief Assembles an L2_projection matrix for the velocity and the pressure.
    * This L2 projection matrix can be used to set the initial condition for
@@ -307,6 +353,33 @@ private:
   std::shared_ptr<TrilinosWrappers::PreconditionAMG> amg_preconditioner;
   int current_preconditioner_fill_level;
   int initial_preconditioner_fill_level;
+
+  /// Policy deciding whether the preconditioner is rebuilt, refreshed or
+  /// reused when it is set up.
+  PreconditionerRefreshPolicy preconditioner_refresh_policy;
+
+  /// Local matrices cached by the cell activity map, indexed by the active
+  /// cell index.
+  std::vector<FullMatrix<double>> cached_local_matrices;
+
+  /// Degrees of freedom of the evaluation point at which the local matrices
+  /// were cached, indexed by the active cell index.
+  std::vector<Vector<double>> cached_cell_states;
+
+  /// Flags indicating if the cached local matrix of a cell is valid. A char is
+  /// used instead of a bool to allow concurrent writes from the assembly
+  /// threads.
+  std::vector<char> cached_local_matrix_is_valid;
+
+  /// Time steps with which the cached local matrices were assembled.
+  std::vector<double> cached_time_steps;
+
+  /// Number of locally owned cells assembled during the last assembly.
+  unsigned int n_assembled_cells;
+
+  /// Number of locally owned cells whose cached local matrix was reused
+  /// during the last assembly.
+  unsigned int n_skipped_cells;
 };
 
 
@@ -5,6 +5,7 @@
 #define lethe_heat_transfer_h
 
 #include <core/bdf.h>
+#include <core/preconditioner_refresh_policy.h>
 #include <core/simulation_control.h>
 #include <core/vector.h>
 
@@ -29,6 +30,7 @@
 
 #include <deal.II/grid/grid_tools.h>
 
+#include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
 
@@ -79,7 +81,9 @@ public:
         p_simulation_parameters.physics_solving_strategy.at(
           PhysicsID::heat_transfer))
     , multiphysics(multiphysics_interface)
-    , computing_timer(p_triangulation->get_mpi_communicator(),
+    , computing_timer(this->get_timer_communicator(
+                            p_simulation_parameters,
+                            p_triangulation->get_mpi_communicator()),
                       this->pcout,
                       TimerOutput::summary,
                       TimerOutput::wall_times)
@@ -90,7 +94,8 @@ public:
     , thermal_conductivity_models(
         p_simulation_parameters.physical_properties_manager
           .get_thermal_conductivity_vector())
-
+    , preconditioner_refresh_policy(
+        p_simulation_parameters.linear_solver.at(PhysicsID::heat_transfer))
   {
     if (simulation_parameters.mesh.simplex)
       {
@@ -210,6 +215,19 @@ public:
   void
   percolate_time_vectors() override;
 
+  /**
+   * @brief Give the physics whose solution is used during the solution of the
+   * heat transfer. The phase fraction of the VOF is used to compute the
+   * physical properties of multiphase flows.
+   *
+   * @return Identifiers of the fluid dynamics and VOF physics.
+   */
+  std::vector<PhysicsID>
+  get_dependencies() const override
+  {
+    return {PhysicsID::fluid_dynamics, PhysicsID::VOF};
+  }
+
   /**
    * @brief Postprocess the auxiliary physics results. Post-processing this case implies
    * the calculation of all derived quantities using the solution vector of the
@@ -296,6 +314,25 @@ public:
   void
   solve_linear_system() override;
 
+  /**
+   * @brief Build the ILU preconditioner of the system matrix that was last
+   * assembled, which is used as a lagged preconditioner by the jfnk
+   * non-linear solver.
+   */
+  void
+  setup_lagged_preconditioner() override;
+
+  /**
+   * @brief Apply the lagged ILU preconditioner to a vector.
+   *
+   * @param[out] dst Preconditioned vector.
+   *
+   * @param[in] src Vector to which the preconditioner is applied.
+   */
+  void
+  apply_lagged_preconditioner(GlobalVectorType       &dst,
+                              const GlobalVectorType &src) override;
+
   /**
    * @brief Getter method to access the private attribute dof_handler for the
    * physic currently solved. NB : dof_handler is now passed to the
@@ -419,6 +456,13 @@ public:
   }
 
 private:
+  /**
+   * @brief Build the ILU preconditioner of the system matrix with the
+   * parameters of the linear solver of the heat transfer physics.
+   */
+  void
+  setup_ilu_preconditioner();
+
   /**
    * @brief Verify consistency of the input parameters for boundary
    * conditions to ensure that for every boundary condition within the
@@ -855,6 +899,17 @@ private:
    * @brief Liquid fraction in the domain.
    */
   TableHandler liquid_fraction_table;
+
+  /**
+   * @brief ILU preconditioner of the linear system, kept across the linear
+   * solves when the adaptive preconditioner refresh policy is used.
+   */
+  std::shared_ptr<TrilinosWrappers::PreconditionILU> system_ilu_preconditioner;
+
+  /**
+   * @brief Policy deciding when the preconditioner is rebuilt.
+   */
+  PreconditionerRefreshPolicy preconditioner_refresh_policy;
 };
 
 
@@ -110,22 +110,42 @@ public:
         const Parameters::SimulationControl::TimeSteppingMethod
           time_stepping_method)
   {
-    // Loop through all the elements in the physics map. Consequently, iphys is
-    // an std::pair where iphys.first is the PhysicsID and iphys.second is the
-    // AuxiliaryPhysics pointer. This is how the map can be traversed
-    // sequentially.
-    for (auto &iphys : physics)
+    if (multiphysics_parameters.auxiliary_physics_execution ==
+        Parameters::AuxiliaryPhysicsExecution::concurrent)
       {
-        // If iphys.first should be solved BEFORE fluid dynamics
-        if (!fluid_dynamics_has_been_solved && solve_pre_fluid[iphys.first])
-          solve_physics(iphys.first, time_stepping_method);
-
-        // If iphys.first should be solved AFTER fluid dynamics OR if is not
-        // present in solve_pre_fluid map
-        else if (fluid_dynamics_has_been_solved &&
-                 (!solve_pre_fluid[iphys.first] ||
-                  solve_pre_fluid.count(iphys.first) == 0))
-          solve_physics(iphys.first, time_stepping_method);
+        // Gather the physics solved at this stage of the time step and let
+        // the independent ones be solved concurrently
+        std::vector<PhysicsID> physics_to_solve;
+        for (const auto &iphys : physics)
+          {
+            const bool is_solved_pre_fluid =
+              solve_pre_fluid.contains(iphys.first) &&
+              solve_pre_fluid.at(iphys.first);
+            if (is_solved_pre_fluid != fluid_dynamics_has_been_solved)
+              physics_to_solve.push_back(iphys.first);
+          }
+        solve_concurrently(physics_to_solve, time_stepping_method);
+      }
+    else
+      {
+        // Loop through all the elements in the physics map. Consequently,
+        // iphys is an std::pair where iphys.first is the PhysicsID and
+        // iphys.second is the AuxiliaryPhysics pointer. This is how the map
+        // can be traversed sequentially.
+        for (auto &iphys : physics)
+          {
+            // If iphys.first should be solved BEFORE fluid dynamics
+            if (!fluid_dynamics_has_been_solved &&
+                solve_pre_fluid[iphys.first])
+              solve_physics(iphys.first, time_stepping_method);
+
+            // If iphys.first should be solved AFTER fluid dynamics OR if is
+            // not present in solve_pre_fluid map
+            else if (fluid_dynamics_has_been_solved &&
+                     (!solve_pre_fluid[iphys.first] ||
+                      solve_pre_fluid.count(iphys.first) == 0))
+              solve_physics(iphys.first, time_stepping_method);
+          }
       }
 
     for (auto &iphys : block_physics)
@@ -247,6 +267,20 @@ public:
       {
         iphys.second->finish_simulation();
       }
+
+    // As the timing of each level, the cumulated timing is only printed if
+    // one of the auxiliary physics is verbose
+    bool is_verbose = false;
+    for (const auto &[physics_id, physics_verbosity] : verbosity)
+      is_verbose =
+        is_verbose || physics_verbosity != Parameters::Verbosity::quiet;
+
+    if (cumulated_concurrent_wall_time > 0. && is_verbose)
+      pcout << "Concurrent auxiliary physics: cumulated solve time "
+            << cumulated_physics_solve_time << " s, wall time "
+            << cumulated_concurrent_wall_time << " s, overlap ratio "
+            << cumulated_physics_solve_time / cumulated_concurrent_wall_time
+            << std::endl;
   }
 
   /**
@@ -268,14 +302,20 @@ public:
       {
         // If iphys.first should be percolated BEFORE fluid dynamics is solved
         if (!fluid_dynamics_has_been_solved && solve_pre_fluid[iphys.first])
-          iphys.second->percolate_time_vectors();
+          {
+            estimate_time_step_error(iphys.first);
+            iphys.second->percolate_time_vectors();
+          }
 
         // If iphys.first should be percolated AFTER fluid dynamics is solved OR
         // if is not present in solve_pre_fluid map
         else if (fluid_dynamics_has_been_solved &&
                  (!solve_pre_fluid[iphys.first] ||
                   solve_pre_fluid.count(iphys.first) == 0))
-          iphys.second->percolate_time_vectors();
+          {
+            estimate_time_step_error(iphys.first);
+            iphys.second->percolate_time_vectors();
+          }
       }
     for (auto &iphys : block_physics)
       {
@@ -292,6 +332,33 @@ public:
       }
   }
 
+  /**
+   * @brief Keep a copy of the present and previous solutions of the auxiliary
+   * physics at the beginning of the time step, such that the time step can be
+   * solved again if it is rejected by the error control of the time step.
+   */
+  void
+  save_time_step_state();
+
+  /**
+   * @brief Bring the present and previous solutions of the auxiliary physics
+   * back to the beginning of the time step after its rejection.
+   */
+  void
+  restore_time_step_state();
+
+  /**
+   * @brief Get the largest normalized error of the present time step
+   * estimated for the auxiliary physics.
+   *
+   * @return The normalized error, zero if it was not estimated.
+   */
+  double
+  get_time_step_error() const
+  {
+    return time_step_error;
+  }
+
   /**
    * @param Update the boundary conditions of the auxiliary physics if they are time-dependent
    */
@@ -377,6 +444,10 @@ public:
       {
         iphys.second->setup_dofs();
       }
+
+    // The solutions kept for the error control of the time step do not match
+    // the new degrees of freedom
+    oldest_previous_solutions.clear();
   };
 
 
@@ -974,6 +1045,72 @@ private:
   void
   inspect_multiphysics_models_dependencies(
     const SimulationParameters<dim> &nsparam);
+
+  /**
+   * @brief Solve the auxiliary physics of a stage of the time step, the
+   * physics that do not depend on each other being solved concurrently on
+   * threads. The physics are sorted into successive levels such that the
+   * physics of a level only depend on physics of the previous levels.
+   *
+   * Since the auxiliary physics share the MPI communicator of the
+   * triangulation, their collective communications could be interleaved
+   * differently on each process if they were solved concurrently. The
+   * physics are thus only solved concurrently when a single MPI process is
+   * used, MPI supports MPI_THREAD_MULTIPLE and more than one thread is
+   * available (see concurrent_tasks_are_supported()). Otherwise, they are
+   * solved sequentially in the order of their levels. The output of the
+   * physics solved concurrently is printed in the order of the physics once
+   * they are all solved.
+   *
+   * @param[in] physics_to_solve Auxiliary physics solved at this stage of the
+   * time step.
+   * @param[in] time_stepping_method Time-stepping method with which the
+   * assembly is called.
+   */
+  void
+  solve_concurrently(const std::vector<PhysicsID> &physics_to_solve,
+                     const Parameters::SimulationControl::TimeSteppingMethod
+                       time_stepping_method);
+
+  /**
+   * @brief Estimate the error of the present time step of an auxiliary
+   * physics before its time vectors are percolated, if the time step is
+   * adapted with the error estimate of the BDF methods.
+   *
+   * @param[in] physics_id Auxiliary physics whose error is estimated.
+   */
+  void
+  estimate_time_step_error(const PhysicsID physics_id);
+
+  /// Simulation control shared with the fluid dynamics and the physics
+  std::shared_ptr<SimulationControl> simulation_control;
+
+  /// Largest normalized error of the present time step of the physics
+  double time_step_error;
+
+  /// Solutions of the physics at the beginning of the time step
+  std::map<PhysicsID, GlobalVectorType> saved_solutions;
+
+  /// Previous solutions of the physics at the beginning of the time step
+  std::map<PhysicsID, std::vector<GlobalVectorType>> saved_previous_solutions;
+
+  /// Solutions preceding the oldest previous solutions of the physics, which
+  /// are required by the error estimate of BDF3
+  std::map<PhysicsID, GlobalVectorType> oldest_previous_solutions;
+  std::map<PhysicsID, GlobalVectorType> saved_oldest_previous_solutions;
+
+  /// Communicator of the triangulation
+  MPI_Comm mpi_communicator;
+
+  /// Flag indicating that the physics cannot be solved concurrently and that
+  /// the user was warned
+  bool sequential_fallback_is_announced;
+
+  /// Cumulated wall time spent in each of the concurrently solved physics
+  double cumulated_physics_solve_time;
+
+  /// Cumulated wall time spent in the concurrent solution of the physics
+  double cumulated_concurrent_wall_time;
 };
 
 
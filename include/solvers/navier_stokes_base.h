@@ -227,6 +227,7 @@ protected:
   {
     verify_consistency_of_boundary_conditions();
     setup_dofs_fd();
+    oldest_previous_solution_is_valid = false;
     multiphysics->setup_dofs();
   };
 
@@ -346,19 +347,33 @@ protected:
    * End of key physics components for fluid dynamics
    **/
 
+  /**
+   * @brief Calculate the forces and/or the torques acting on each boundary
+   * condition, as requested by the forces parameters. When both are requested,
+   * they are calculated in a single pass over the boundary faces.
+   *
+   * @param[in] evaluation_point Solution at which the forces and torques are
+   * calculated.
+   */
+  void
+  calculate_forces_and_torques_on_boundaries(
+    const VectorType &evaluation_point);
+
   /**
    * @brief Post-processing function
-   * Outputs the forces acting on each boundary condition
+   * Outputs the forces acting on each boundary condition, which are calculated
+   * by calculate_forces_and_torques_on_boundaries()
    */
   void
-  postprocessing_forces(const VectorType &evaluation_point);
+  postprocessing_forces();
 
   /**
    * @brief Post-processing function
-   * Outputs the torque acting on each boundary condition
+   * Outputs the torque acting on each boundary condition, which are calculated
+   * by calculate_forces_and_torques_on_boundaries()
    */
   void
-  postprocessing_torques(const VectorType &evaluation_point);
+  postprocessing_torques();
 
   /**
    * @brief If set to enable, dynamic_flow_control allows to control the flow by executing space-average velocity and beta coefficient force calculation at each time step.
@@ -405,6 +420,31 @@ protected:
   virtual void
   iterate();
 
+  /**
+   * @brief Estimate the normalized local truncation error of the present time
+   * step of the fluid dynamics.
+   *
+   * The error of the BDF methods is estimated from the extrapolation of the
+   * previous solutions and the error of the SDIRK methods is estimated with
+   * their embedded method.
+   *
+   * @return The normalized error, zero if it cannot be estimated (e.g. during
+   * the startup of the BDF methods).
+   */
+  double
+  estimate_time_step_error_fd();
+
+  /**
+   * @brief Provide the error of the present time step to the simulation
+   * control and bring the solutions back to the beginning of the time step if
+   * the simulation control rejects it.
+   *
+   * @return true if the time step was rejected and must be solved again with
+   * the new time step.
+   */
+  bool
+  reject_time_step();
+
   /**
    * @brief Enable the use of dynamic zero constraints by initializing required
    * FEValues objects.
@@ -1008,6 +1048,11 @@ protected:
   // Previous solutions vectors
   std::shared_ptr<std::vector<VectorType>> previous_solutions;
 
+  // Solution preceding the oldest previous solution, which is only kept when
+  // the time step is adapted with the error estimate of the BDF methods
+  VectorType oldest_previous_solution;
+  bool       oldest_previous_solution_is_valid;
+
   /**
    * @brief Structure that stores all SDIRK-related vectors used during the time integration process.
    */
@@ -1083,6 +1128,7 @@ protected:
   // Force analysis
   std::vector<std::map<types::boundary_id, Tensor<1, dim>>>
                                              forces_on_boundaries;
+  std::map<types::boundary_id, Tensor<1, 3>> torques_on_boundaries;
   std::map<types::boundary_id, TableHandler> forces_tables;
   std::map<types::boundary_id, TableHandler> torques_tables;
 
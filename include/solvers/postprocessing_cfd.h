@@ -5,6 +5,7 @@
 #define lethe_postprocessing_cfd_h
 
 #include <core/boundary_conditions.h>
+#include <core/parameters.h>
 
 #include <solvers/physical_properties_manager.h>
 
@@ -65,77 +66,35 @@ calculate_CFL(const DoFHandler<dim> &dof_handler,
               const Mapping<dim>    &mapping);
 
 /**
- * @brief Calculate the average enstrophy in the simulation domain
- * @return average kinetic energy in the domain
- * Post-processing function
- * This function calculates the average enstrophy in the simulation domain
- *
- * @param dof_handler The dof_handler used for the calculation
- *
- * @param evaluation_point The solution at which the force is calculated
- *
- * @param quadrature_formula The quadrature formula for the calculation
- *
- * @param mapping The mapping of the simulation
+ * @brief Volume-averaged quantities computed by the fused postprocessing pass.
+ * The quantities that are not requested are left to zero.
  */
-template <int dim, typename VectorType>
-double
-calculate_enstrophy(const DoFHandler<dim> &dof_handler,
-                    const VectorType      &evaluation_point,
-                    const Quadrature<dim> &quadrature_formula,
-                    const Mapping<dim>    &mapping);
+struct VolumePostprocessingQuantities
+{
+  /// Enstrophy of the flow
+  double enstrophy = 0.;
 
-/**
- * @brief Calculate the average kinetic energy in the simulation domain
- * @return average kinetic energy in the domain
- * Post-processing function
- * This function calculates the average kinetic energy in the simulation domain
- *
- * @param[in] dof_handler The dof_handler used for the calculation
- *
- * @param[in] evaluation_point The solution for the calculation
- *
- * @param[in] quadrature_formula The quadrature formula for the calculation
- *
- * @param[in] mapping The mapping of the simulation
- */
-template <int dim, typename VectorType>
-double
-calculate_kinetic_energy(const DoFHandler<dim> &dof_handler,
-                         const VectorType      &evaluation_point,
-                         const Quadrature<dim> &quadrature_formula,
-                         const Mapping<dim>    &mapping);
+  /// Kinetic energy of the flow
+  double kinetic_energy = 0.;
 
-/**
- * @brief Calculate the average power done by pressure in the simulation
- * domain. The average power is defined as ∫u.∇pdΩ/∫1dΩ
- * @return Average power done by pressure in the simulation domain
- * Post-processing function
- *
- * @param[in] dof_handler The dof_handler used for the calculation
- *
- * @param[in] evaluation_point The solution for the calculation
- *
- * @param[in] quadrature_formula The quadrature formula for the calculation
- *
- * @param[in] mapping The mapping of the simulation
- */
-template <int dim, typename VectorType>
-double
-calculate_pressure_power(const DoFHandler<dim> &dof_handler,
-                         const VectorType      &evaluation_point,
-                         const Quadrature<dim> &quadrature_formula,
-                         const Mapping<dim>    &mapping);
+  /// Power of the pressure forces
+  double pressure_power = 0.;
+
+  /// Viscous dissipation of the flow
+  double viscous_dissipation = 0.;
+};
 
 /**
- * @brief Calculate the viscous dissipation of kinetic energy which is defined as
- *  ∫∇u.τdΩ/∫1dΩ
- * @return Viscous dissipation of kinetic energy
- * Post-processing function
+ * @brief Calculate all the requested volume-averaged quantities (enstrophy,
+ * kinetic energy, pressure power and viscous dissipation) in a single
+ * thread-parallel loop over the locally owned cells. The FEValues are
+ * reinitialized once per cell with the union of the update flags required by
+ * the requested quantities, instead of once per quantity.
  *
  * @param[in] dof_handler The dof_handler used for the calculation
  *
- * @param[in] evaluation_point The solution for the calculation
+ * @param[in] evaluation_point The solution at which the quantities are
+ * calculated
  *
  * @param[in] quadrature_formula The quadrature formula for the calculation
  *
@@ -143,15 +102,21 @@ calculate_pressure_power(const DoFHandler<dim> &dof_handler,
  *
  * @param[in] properties_manager Manager for the physical properties used to
  * calculate the kinematic viscosity
+ *
+ * @param[in] post_processing Postprocessing parameters indicating which
+ * quantities are calculated
+ *
+ * @return Volume-averaged quantities
  */
 template <int dim, typename VectorType>
-double
-calculate_viscous_dissipation(
-  const DoFHandler<dim>           &dof_handler,
-  const VectorType                &evaluation_point,
-  const Quadrature<dim>           &quadrature_formula,
-  const Mapping<dim>              &mapping,
-  const PhysicalPropertiesManager &properties_manager);
+VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities(
+  const DoFHandler<dim>            &dof_handler,
+  const VectorType                 &evaluation_point,
+  const Quadrature<dim>            &quadrature_formula,
+  const Mapping<dim>               &mapping,
+  const PhysicalPropertiesManager  &properties_manager,
+  const Parameters::PostProcessing &post_processing);
 
 /**
  * @brief Calculates the apparent viscosity of the fluid for non Newtonian flows.
@@ -238,6 +203,42 @@ calculate_torques(
   const Quadrature<dim - 1>                           &face_quadrature_formula,
   const Mapping<dim>                                  &mapping);
 
+/**
+ * @brief Calculate the forces and the torques due to the fluid on every
+ * boundary condition in a single thread-parallel loop over the boundary faces.
+ * The stress tensor is evaluated once per quadrature point and shared by the
+ * force and torque calculations.
+ *
+ * @param[in] dof_handler The dof_handler used for the calculation
+ *
+ * @param[in] evaluation_point The solution at which the forces and torques are
+ * calculated
+ *
+ * @param[in] properties_manager Manager for the physical properties used to
+ * calculate the kinematic viscosity
+ *
+ * @param[in] boundary_conditions The boundary conditions object
+ *
+ * @param[in] face_quadrature_formula The face quadrature formula for the
+ * calculation
+ *
+ * @param[in] mapping The mapping of the simulation
+ *
+ * @return Pair containing the forces, in the same format as
+ * calculate_forces(), and the torques, in the same format as
+ * calculate_torques()
+ */
+template <int dim, typename VectorType>
+std::pair<std::vector<std::map<types::boundary_id, Tensor<1, dim>>>,
+          std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques(
+  const DoFHandler<dim>                               &dof_handler,
+  const VectorType                                    &evaluation_point,
+  const PhysicalPropertiesManager                     &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<dim> &boundary_conditions,
+  const Quadrature<dim - 1>                           &face_quadrature_formula,
+  const Mapping<dim>                                  &mapping);
+
 
 /**
  * @brief Calculates the L2 norm of the error on velocity and pressure
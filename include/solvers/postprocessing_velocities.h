@@ -17,6 +17,13 @@ using namespace dealii;
  * \rangle, \langle v'v' \rangle, \langle w'w' \rangle, \langle u'v' \rangle,
  * \langle v'w' \rangle, \langle w'u' \rangle)\f$.
  *
+ * Two schemes are available. The cumulative scheme stores the time integrals
+ * of the solution and of the products of the fluctuations and divides them by
+ * the averaging time. The Welford scheme updates the averages and the
+ * Reynolds stresses in place with the weighted variant of Welford's
+ * algorithm, which only requires the averaged vectors and halves the number
+ * of stored vectors.
+ *
  * @tparam dim An integer that denotes the dimension of the space in which
  * the flow is solved.
  *
@@ -37,8 +44,13 @@ public:
    *
    * @param[in] dof_handler Used to initialize the solution transfer objects.
    *
+   * @param[in] scheme Scheme used to accumulate the averages.
+   *
    */
-  AverageVelocities(DoFHandler<dim> &dof_handler);
+  AverageVelocities(DoFHandler<dim> &dof_handler,
+                    const Parameters::PostProcessing::AverageVelocitiesScheme
+                      scheme = Parameters::PostProcessing::
+                        AverageVelocitiesScheme::cumulative);
 
   /**
    * @brief Calculate time-averaged velocities and pressure using vector with no ghost
@@ -53,6 +65,10 @@ public:
    *
    * @param[in] time_step The current time step.
    *
+   * @note The averages are only updated every
+   * post_processing.average_velocities_frequency time steps, each update
+   * being weighted by the time elapsed since the previous one.
+   *
    */
   void
   calculate_average_velocities(
@@ -76,6 +92,21 @@ public:
   void
   calculate_reynolds_stresses(const VectorType &local_evaluation_point);
 
+  /**
+   * @brief Write the average velocities and the Reynolds stresses of the
+   * locally owned degrees of freedom to a binary file, without going through
+   * the VTU output. Each MPI process writes its own file, named
+   * prefix.<rank>.bin, which contains the dimension (32-bit integer), the
+   * number n of locally owned degrees of freedom (64-bit integer), their n
+   * global indices (64-bit integers) and the n values of the average
+   * velocities, of the Reynolds normal stresses and of the Reynolds shear
+   * stresses (doubles).
+   *
+   * @param[in] prefix Prefix of the file name.
+   */
+  void
+  write_binary_statistics(const std::string &prefix) const;
+
   /**
    * @brief Give the average of solutions with ghost cells.
    *
@@ -178,6 +209,13 @@ public:
   void
   sanitize_after_restart()
   {
+    if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+      {
+        average_velocities       = *get_av;
+        reynolds_normal_stresses = get_rns;
+        reynolds_shear_stresses  = get_rss;
+        return;
+      }
     sum_velocity_dt               = sum_velocity_dt_with_ghost_cells;
     sum_reynolds_normal_stress_dt = sum_rns_dt_with_ghost_cells;
     sum_reynolds_shear_stress_dt  = sum_rss_dt_with_ghost_cells;
@@ -190,6 +228,23 @@ public:
   zero_average_after_restart();
 
 private:
+  /**
+   * @brief Update the average velocities and the Reynolds stresses in place
+   * with the present solution using the weighted Welford algorithm. The
+   * weight of the present solution is dt and the total weight is the
+   * total time for averaging.
+   *
+   * @param[in] local_evaluation_point The solution vector with no ghost cells.
+   */
+  void
+  update_welford_statistics(const VectorType &local_evaluation_point);
+
+  /**
+   * @brief Scheme used to accumulate the averages.
+   *
+   */
+  const Parameters::PostProcessing::AverageVelocitiesScheme scheme;
+
   /**
    * @brief Inverse for total time for averaging.
    *
@@ -321,11 +376,31 @@ private:
     solution_transfer_sum_reynolds_shear_stress_dt;
 
   /**
-   * @brief Time step.
+   * @brief Weight of the present update of the averages, which is the time
+   * elapsed since the previous update (the time step when the averages are
+   * updated at every time step).
    *
    */
   double dt;
 
+  /**
+   * @brief Number of time steps since the last update of the averages.
+   *
+   */
+  unsigned int n_steps_since_last_update;
+
+  /**
+   * @brief Time elapsed since the last update of the averages.
+   *
+   */
+  double time_since_last_update;
+
+  /**
+   * @brief MPI communicator of the vectors.
+   *
+   */
+  MPI_Comm mpi_communicator;
+
   /**
    * @brief Initial time of the simulation.
    *
@@ -37,6 +37,7 @@ public:
   std::shared_ptr<Parameters::Nitsche<dim>>         nitsche;
   Parameters::SimulationControl                     simulation_control;
   Parameters::Timer                                 timer;
+  Parameters::Threading                             threading;
   Parameters::FEM                                   fem_parameters;
   Parameters::Forces                                forces_parameters;
   std::shared_ptr<Parameters::Laser<dim>>           laser_parameters;
@@ -108,6 +109,7 @@ public:
 
     Parameters::FEM::declare_parameters(prm);
     Parameters::Timer::declare_parameters(prm);
+    Parameters::Threading::declare_parameters(prm);
     Parameters::Forces::declare_parameters(prm);
     laser_parameters = std::make_shared<Parameters::Laser<dim>>();
     laser_parameters->declare_parameters(prm);
@@ -193,6 +195,7 @@ public:
     physical_properties.parse_parameters(prm, dimensionality);
     multiphysics.parse_parameters(prm, dimensionality);
     timer.parse_parameters(prm);
+    threading.parse_parameters(prm);
     fem_parameters.parse_parameters(prm);
     laser_parameters->parse_parameters(prm);
     forces_parameters.parse_parameters(prm);
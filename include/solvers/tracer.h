@@ -4,13 +4,16 @@
 #define lethe_tracer_h
 
 #include <core/bdf.h>
+#include <core/preconditioner_refresh_policy.h>
 #include <core/simulation_control.h>
+#include <core/time_integration_utilities.h>
 #include <core/vector.h>
 
 #include <solvers/auxiliary_physics.h>
 #include <solvers/multiphysics_interface.h>
 #include <solvers/stabilization.h>
 #include <solvers/tracer_assemblers.h>
+#include <solvers/tracer_dg_matrix_free_operator.h>
 #include <solvers/tracer_scratch_data.h>
 
 #include <deal.II/base/convergence_table.h>
@@ -27,6 +30,7 @@
 
 #include <deal.II/grid/grid_tools.h>
 
+#include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
 
@@ -58,7 +62,9 @@ public:
     : AuxiliaryPhysics<dim, GlobalVectorType>(
         p_simulation_parameters.physics_solving_strategy.at(PhysicsID::tracer))
     , multiphysics(multiphysics_interface)
-    , computing_timer(p_triangulation->get_mpi_communicator(),
+    , computing_timer(this->get_timer_communicator(
+                            p_simulation_parameters,
+                            p_triangulation->get_mpi_communicator()),
                       this->pcout,
                       TimerOutput::summary,
                       TimerOutput::wall_times)
@@ -66,6 +72,8 @@ public:
     , triangulation(p_triangulation)
     , simulation_control(p_simulation_control)
     , dof_handler(std::make_shared<DoFHandler<dim>>(*triangulation))
+    , preconditioner_refresh_policy(
+        p_simulation_parameters.linear_solver.at(PhysicsID::tracer))
   {
     if (simulation_parameters.mesh.simplex)
       {
@@ -99,6 +107,44 @@ public:
         face_quadrature = std::make_shared<QGauss<dim - 1>>(fe->degree + 1);
       }
 
+    if (simulation_parameters.fem_parameters.tracer_dg_uses_matrix_free)
+      {
+        AssertThrow(
+          simulation_parameters.fem_parameters.tracer_uses_dg &&
+            !simulation_parameters.mesh.simplex,
+          ExcMessage(
+            "The matrix-free tracer operator requires the Discontinuous Galerkin formulation on a quad/hex mesh."));
+
+        const auto &properties_manager =
+          simulation_parameters.physical_properties_manager;
+        AssertThrow(
+          properties_manager.get_number_of_fluids() == 1 &&
+            std::dynamic_pointer_cast<ConstantTracerDiffusivity>(
+              properties_manager.get_tracer_diffusivity()) &&
+            std::dynamic_pointer_cast<NoneTracerReactionPrefactor>(
+              properties_manager.get_tracer_reaction_prefactor()),
+          ExcMessage(
+            "The matrix-free tracer operator only supports a single fluid with a constant tracer diffusivity and no tracer reaction."));
+
+        const auto time_stepping_method =
+          simulation_parameters.simulation_control.method;
+        AssertThrow(
+          is_steady(time_stepping_method) ||
+            time_stepping_is_bdf(time_stepping_method),
+          ExcMessage(
+            "The matrix-free tracer operator only supports the steady and BDF time-stepping methods."));
+
+        for (auto const &[id, type] :
+             simulation_parameters.boundary_conditions_tracer.type)
+          AssertThrow(
+            type != BoundaryConditions::BoundaryType::periodic,
+            ExcMessage(
+              "The matrix-free tracer operator does not support periodic boundary conditions."));
+
+        matrix_free_operator =
+          std::make_shared<TracerDGMatrixFreeOperator<dim, double>>();
+      }
+
     // Initialize solution shared_ptr
     present_solution = std::make_shared<GlobalVectorType>();
 
@@ -248,6 +294,26 @@ public:
   void
   solve_linear_system() override;
 
+  /**
+   * @brief Build the preconditioner of the system matrix that was last
+   * assembled (ILU, or the inverse of the diagonal blocks of the cells with
+   * the matrix-free DG operator), which is used as a lagged preconditioner by
+   * the jfnk non-linear solver.
+   */
+  void
+  setup_lagged_preconditioner() override;
+
+  /**
+   * @brief Apply the lagged preconditioner to a vector.
+   *
+   * @param[out] dst Preconditioned vector.
+   *
+   * @param[in] src Vector to which the preconditioner is applied.
+   */
+  void
+  apply_lagged_preconditioner(GlobalVectorType       &dst,
+                              const GlobalVectorType &src) override;
+
   /**
    * @brief Getter methods to get the private attributes for the physic currently solved
    * NB : dof_handler and present_solution are passed to the multiphysics
@@ -361,6 +427,30 @@ private:
   void
   assemble_system_matrix_dg();
 
+  /**
+   * @brief Update the matrix-free DG operator with the velocity of the fluid,
+   * which replaces the assembly of the DG matrix when the matrix-free
+   * operator is used.
+   */
+  void
+  update_matrix_free_operator();
+
+  /**
+   * @brief Build the ILU preconditioner of the system matrix with the
+   * parameters of the linear solver of the tracer physics.
+   */
+  void
+  setup_ilu_preconditioner();
+
+  /**
+   * @brief Solve the linear system with the matrix-free DG operator, using
+   * GMRES preconditioned by the inverse of the diagonal blocks of the cells.
+   *
+   * @param[in] tolerance Absolute tolerance of the linear solver.
+   */
+  void
+  solve_linear_system_matrix_free(const double tolerance);
+
   /**
    * @brief Assemble the rhs associated with the solver
    */
@@ -641,6 +731,14 @@ private:
   // Tracer post-processing tables
   TableHandler statistics_table;
   TableHandler tracer_flow_rate_table;
+  // ILU preconditioner kept across the linear solves and policy deciding when
+  // it is rebuilt
+  std::shared_ptr<TrilinosWrappers::PreconditionILU> system_ilu_preconditioner;
+  PreconditionerRefreshPolicy preconditioner_refresh_policy;
+
+  // Matrix-free operator of the DG formulation, replacing the system matrix
+  // when the tracer DG uses matrix free
+  std::shared_ptr<TracerDGMatrixFreeOperator<dim, double>> matrix_free_operator;
 };
 
 
@@ -0,0 +1,304 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef lethe_tracer_dg_matrix_free_operator_h
+#define lethe_tracer_dg_matrix_free_operator_h
+
+#include <core/ale.h>
+#include <core/boundary_conditions.h>
+#include <core/simulation_control.h>
+
+#include <deal.II/base/parsed_function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+using namespace dealii;
+
+/**
+ * @brief Matrix-free operator of the discontinuous Galerkin (DG) formulation
+ * of the tracer advection-diffusion equation.
+ *
+ * The operator applies the Jacobian of the DG residual assembled by the
+ * TracerAssemblerBDF, TracerAssemblerDGCore, TracerAssemblerSIPG and
+ * TracerAssemblerBoundaryNitsche assemblers without storing a sparse matrix:
+ * the cell integrals contain the time derivative, the weak advection and the
+ * diffusion terms, the interior faces contain the upwind advective flux and
+ * the symmetric interior penalty (SIPG) diffusive flux, and the boundary
+ * faces contain the outflow and the Nitsche Dirichlet terms.
+ *
+ * The velocity of the fluid is evaluated once per assembly at the cell and
+ * face quadrature points, the MatrixFree object being built on both the
+ * tracer and the fluid dynamics DoFHandlers. The operator also provides a
+ * block-Jacobi preconditioner made of the inverse of the diagonal block of
+ * each cell, which is computed by applying the cell and face integrals to
+ * the unit vectors of the cell.
+ *
+ * @note Only constant diffusivities are supported, since the diffusivity is
+ * stored as a single value.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam number Abstract type for number across the class (i.e., double).
+ */
+template <int dim, typename number>
+class TracerDGMatrixFreeOperator : public EnableObserverPointer
+{
+public:
+  using FECellIntegrator         = FEEvaluation<dim, -1, 0, 1, number>;
+  using FEFaceIntegrator         = FEFaceEvaluation<dim, -1, 0, 1, number>;
+  using FEVelocityCellIntegrator = FEEvaluation<dim, -1, 0, dim, number>;
+  using FEVelocityFaceIntegrator = FEFaceEvaluation<dim, -1, 0, dim, number>;
+  using VectorType               = LinearAlgebra::distributed::Vector<number>;
+  using value_type               = number;
+
+  /**
+   * @brief Default constructor.
+   */
+  TracerDGMatrixFreeOperator();
+
+  /**
+   * @brief Initialize the MatrixFree object on the tracer and fluid dynamics
+   * DoFHandlers and compute the penalty factors of the faces.
+   *
+   * @param[in] mapping Mapping of the tracer.
+   * @param[in] dof_handler_tracer DoFHandler of the DG tracer.
+   * @param[in] dof_handler_fluid DoFHandler of the fluid dynamics.
+   * @param[in] quadrature One-dimensional quadrature of the cells and faces.
+   * @param[in] diffusivity Constant diffusivity of the tracer.
+   * @param[in] boundary_conditions Boundary conditions of the tracer.
+   * @param[in] simulation_control Simulation control providing the BDF
+   * coefficients.
+   */
+  void
+  reinit(const Mapping<dim>    &mapping,
+         const DoFHandler<dim> &dof_handler_tracer,
+         const DoFHandler<dim> &dof_handler_fluid,
+         const Quadrature<1>   &quadrature,
+         const double           diffusivity,
+         const BoundaryConditions::TracerBoundaryConditions<dim>
+                                                  &boundary_conditions,
+         const std::shared_ptr<SimulationControl> &simulation_control);
+
+  /**
+   * @brief Evaluate the advective velocity at the quadrature points of the
+   * cells and faces.
+   *
+   * @param[in] fluid_solution Solution of the fluid dynamics, with ghost
+   * values, initialized with initialize_fluid_dof_vector().
+   * @param[in] drift_velocity Drift velocity added to the fluid velocity.
+   * @param[in] ale ALE parameters. If enabled, the ALE velocity is
+   * subtracted from the fluid velocity.
+   */
+  void
+  evaluate_velocity(
+    const VectorType                                      &fluid_solution,
+    const std::shared_ptr<Functions::ParsedFunction<dim>> &drift_velocity,
+    const Parameters::ALE<dim>                            &ale);
+
+  /**
+   * @brief Compute the inverse of the diagonal block of each locally owned
+   * cell, used by the block-Jacobi preconditioner.
+   */
+  void
+  compute_inverse_block_diagonal();
+
+  /**
+   * @brief Apply the block-Jacobi preconditioner.
+   *
+   * @param[out] dst Destination vector.
+   * @param[in] src Source vector.
+   */
+  void
+  apply_inverse_block_diagonal(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Apply the operator.
+   *
+   * @param[out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Get the total number of degrees of freedom of the tracer.
+   *
+   * @return Number of degrees of freedom.
+   */
+  types::global_dof_index
+  m() const;
+
+  /**
+   * @brief Initialize a vector with the partitioning of the tracer.
+   *
+   * @param[out] vec Vector to initialize.
+   */
+  void
+  initialize_dof_vector(VectorType &vec) const;
+
+  /**
+   * @brief Initialize a vector with the partitioning of the fluid dynamics.
+   *
+   * @param[out] vec Vector to initialize.
+   */
+  void
+  initialize_fluid_dof_vector(VectorType &vec) const;
+
+private:
+  /**
+   * @brief Integrate the cell terms of the operator on a cell batch whose
+   * degrees of freedom have been set in the integrator.
+   *
+   * @param[in,out] integrator Cell integrator.
+   * @param[in] cell Index of the cell batch.
+   * @param[in] bdf_coefficient Coefficient of the present solution in the
+   * time derivative.
+   */
+  void
+  do_cell_integral_local(FECellIntegrator  &integrator,
+                         const unsigned int cell,
+                         const number       bdf_coefficient) const;
+
+  /**
+   * @brief Integrate the terms of the operator on a batch of interior faces
+   * whose degrees of freedom have been set in both integrators.
+   *
+   * @param[in,out] integrator_m Integrator of the interior side.
+   * @param[in,out] integrator_p Integrator of the exterior side.
+   * @param[in] face Index of the face batch.
+   */
+  void
+  do_face_integral_local(FEFaceIntegrator  &integrator_m,
+                         FEFaceIntegrator  &integrator_p,
+                         const unsigned int face) const;
+
+  /**
+   * @brief Integrate the terms of the operator on a batch of boundary faces
+   * whose degrees of freedom have been set in the integrator.
+   *
+   * @param[in,out] integrator Face integrator.
+   * @param[in] face Index of the face batch.
+   */
+  void
+  do_boundary_face_integral_local(FEFaceIntegrator  &integrator,
+                                  const unsigned int face) const;
+
+  /**
+   * @brief Apply the cell terms of the operator on a range of cell batches.
+   */
+  void
+  local_apply_cell(const MatrixFree<dim, number>               &matrix_free,
+                   VectorType                                  &dst,
+                   const VectorType                            &src,
+                   const std::pair<unsigned int, unsigned int> &range) const;
+
+  /**
+   * @brief Apply the interior face terms of the operator on a range of face
+   * batches.
+   */
+  void
+  local_apply_face(const MatrixFree<dim, number>               &matrix_free,
+                   VectorType                                  &dst,
+                   const VectorType                            &src,
+                   const std::pair<unsigned int, unsigned int> &range) const;
+
+  /**
+   * @brief Apply the boundary face terms of the operator on a range of face
+   * batches.
+   */
+  void
+  local_apply_boundary(
+    const MatrixFree<dim, number>               &matrix_free,
+    VectorType                                  &dst,
+    const VectorType                            &src,
+    const std::pair<unsigned int, unsigned int> &range) const;
+
+  /**
+   * @brief Get the coefficient of the present solution in the time
+   * derivative, zero for steady simulations. Only the steady and BDF
+   * time-stepping methods are supported.
+   */
+  number
+  get_bdf_coefficient() const;
+
+  /// Matrix-free object, the tracer being the DoFHandler 0 and the fluid
+  /// dynamics the DoFHandler 1
+  MatrixFree<dim, number> matrix_free;
+
+  /// Empty constraints, the DG formulation imposing the boundary conditions
+  /// weakly
+  AffineConstraints<number> constraints;
+
+  /// Degree of the tracer finite element
+  unsigned int fe_degree;
+
+  /// Constant diffusivity of the tracer
+  number diffusivity;
+
+  /// Boundary conditions of the tracer
+  BoundaryConditions::TracerBoundaryConditions<dim> boundary_conditions;
+
+  /// Simulation control providing the BDF coefficients
+  std::shared_ptr<SimulationControl> simulation_control;
+
+  /// Advective velocity and its divergence at the cell quadrature points
+  Table<2, Tensor<1, dim, VectorizedArray<number>>> cell_velocity;
+  Table<2, VectorizedArray<number>>                 cell_velocity_divergence;
+
+  /// Normal advective velocity at the quadrature points of the interior and
+  /// boundary faces, the normal pointing outside of the interior cell
+  Table<2, VectorizedArray<number>> face_normal_velocity;
+
+  /// SIPG and Nitsche penalty factors of the interior and boundary faces
+  AlignedVector<VectorizedArray<number>> face_penalty;
+
+  /// Inverse of the diagonal block of each locally owned cell, indexed by
+  /// the cell index of the MatrixFree object
+  std::vector<FullMatrix<number>> inverse_block_diagonal;
+};
+
+/**
+ * @brief Block-Jacobi preconditioner of the matrix-free DG tracer operator.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam number Abstract type for number across the class (i.e., double).
+ */
+template <int dim, typename number>
+class TracerDGBlockJacobiPreconditioner
+{
+public:
+  using VectorType = LinearAlgebra::distributed::Vector<number>;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] tracer_operator Operator whose inverse diagonal blocks are
+   * applied.
+   */
+  TracerDGBlockJacobiPreconditioner(
+    const TracerDGMatrixFreeOperator<dim, number> &tracer_operator)
+    : tracer_operator(tracer_operator)
+  {}
+
+  /**
+   * @brief Apply the preconditioner.
+   *
+   * @param[out] dst Destination vector.
+   * @param[in] src Source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    tracer_operator.apply_inverse_block_diagonal(dst, src);
+  }
+
+private:
+  const TracerDGMatrixFreeOperator<dim, number> &tracer_operator;
+};
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <core/bdf.h>
 #include <core/interface_tools.h>
+#include <core/preconditioner_refresh_policy.h>
 #include <core/simulation_control.h>
 #include <core/vector.h>
 
@@ -196,6 +197,19 @@ public:
   void
   modify_solution() override;
 
+  /**
+   * @brief Give the physics whose solution is used during the solution of the
+   * VOF. The temperature is used by the temperature-dependent physical
+   * properties.
+   *
+   * @return Identifiers of the fluid dynamics and heat transfer physics.
+   */
+  std::vector<PhysicsID>
+  get_dependencies() const override
+  {
+    return {PhysicsID::fluid_dynamics, PhysicsID::heat_transfer};
+  }
+
   /**
    * @brief Postprocess the auxiliary physics results. Post-processing this case implies
    * the calculation of all derived quantities using the solution vector of the
@@ -298,6 +312,25 @@ public:
   void
   solve_linear_system() override;
 
+  /**
+   * @brief Build the ILU preconditioner of the system matrix that was last
+   * assembled, which is used as a lagged preconditioner by the jfnk
+   * non-linear solver.
+   */
+  void
+  setup_lagged_preconditioner() override;
+
+  /**
+   * @brief Apply the lagged ILU preconditioner to a vector.
+   *
+   * @param[out] dst Preconditioned vector.
+   *
+   * @param[in] src Vector to which the preconditioner is applied.
+   */
+  void
+  apply_lagged_preconditioner(GlobalVectorType       &dst,
+                              const GlobalVectorType &src) override;
+
   /**
    * @brief Getter methods to get the private attributes for the physic currently solved
    * NB : dof_handler and present_solution are passed to the multiphysics
@@ -406,6 +439,13 @@ public:
   }
 
 private:
+  /**
+   * @brief Build the ILU preconditioner of the system matrix with the
+   * parameters of the linear solver of the VOF physics.
+   */
+  void
+  setup_ilu_preconditioner();
+
   /**
    * @brief Verify consistency of the input parameters for boundary
    * conditions to ensure that for every boundary condition within the
@@ -535,7 +575,9 @@ private:
   update_solution_and_constraints(GlobalVectorType &solution);
 
   /**
-   * @brief Assemble the system for interface sharpening
+   * @brief Assemble the right-hand side of the system for interface
+   * sharpening. The matrix is assembled by
+   * assemble_interface_sharpening_matrix.
    *  * This function assembles the weak form of:
    * \f$ \Phi = c ^ {(1 - \alpha)} * (\phi ^ \alpha)\f$  if \f$ 0 <=
    * \phi <= c  \ \f$
@@ -555,9 +597,19 @@ private:
     GlobalVectorType &solution,
     const double      sharpening_threshold);
 
+  /**
+   * @brief Assembles the mass matrix of the L2 projection used for the
+   * interface sharpening and initializes its ILU preconditioner. Since they do
+   * not depend on the sharpening threshold, they are built once per sharpening
+   * step and shared by all the projections of this step.
+   */
+  void
+  assemble_interface_sharpening_matrix();
+
   /**
    * @brief Solves the assembled system to sharpen the interface. The linear_solver_tolerance
-   * is hardcoded = 1e-15, and an ILU Preconditioner is used. After solving the
+   * is hardcoded = 1e-15, and the ILU preconditioner built by
+   * assemble_interface_sharpening_matrix is used. After solving the
    * system, this function overwrites the solution with the sharpened solution
    *
    * @param solution VOF solution (phase fraction)
@@ -588,7 +640,7 @@ private:
   /**
    * @brief Find the sharpening threshold to ensure mass conservation of the fluid
    * monitored, as given in the prm (VOF, subsection monitoring), by binary
-   * search.
+   * search or with the Illinois (modified regula falsi) method.
    */
   double
   find_sharpening_threshold();
@@ -800,6 +852,10 @@ private:
 
   std::shared_ptr<TrilinosWrappers::PreconditionILU> ilu_preconditioner;
 
+  // Preconditioner of the L2 projection matrix for interface sharpening
+  std::shared_ptr<TrilinosWrappers::PreconditionILU>
+    interface_sharpening_preconditioner;
+
   // Lower and upper bounds of phase fraction
   const double phase_upper_bound = 1.0;
   const double phase_lower_bound = 0.0;
@@ -830,6 +886,11 @@ private:
   // Signed distance transformation function to a phase fraction
   std::shared_ptr<SignedDistanceTransformationBase>
     signed_distance_transformation;
+
+  // ILU preconditioner kept across the linear solves and policy deciding when
+  // it is rebuilt
+  std::shared_ptr<TrilinosWrappers::PreconditionILU> system_ilu_preconditioner;
+  PreconditionerRefreshPolicy preconditioner_refresh_policy;
 };
 
 
@@ -0,0 +1,264 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <core/concurrent_tasks.h>
+#include <core/utilities.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/kokkos.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/thread_management.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/p4est_wrappers.h>
+
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/trilinos_parallel_block_vector.h>
+#include <deal.II/lac/trilinos_vector.h>
+#include <deal.II/lac/vector_memory.h>
+
+#ifdef DEAL_II_WITH_ZOLTAN
+#  include <zoltan_cpp.h>
+#endif
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <string>
+
+namespace
+{
+  /**
+   * @brief Stream buffer that stores the characters written by a task in the
+   * buffer of the task, and forwards the characters written outside of the
+   * tasks to another stream buffer. The buffer of the task running on a
+   * thread is given by a thread-local pointer.
+   */
+  class TaskOutputBuffer : public std::streambuf
+  {
+  public:
+    TaskOutputBuffer(std::streambuf *forward_buffer)
+      : forward_buffer(forward_buffer)
+    {}
+
+    /// Buffer of the task running on this thread, null outside of the tasks
+    static thread_local std::string *task_output;
+
+  protected:
+    int
+    overflow(int c) override
+    {
+      if (traits_type::eq_int_type(c, traits_type::eof()))
+        return traits_type::not_eof(c);
+
+      if (task_output != nullptr)
+        {
+          task_output->push_back(traits_type::to_char_type(c));
+          return c;
+        }
+
+      std::lock_guard<std::mutex> lock(forward_mutex);
+      return forward_buffer->sputc(traits_type::to_char_type(c));
+    }
+
+    std::streamsize
+    xsputn(const char *s, std::streamsize n) override
+    {
+      if (task_output != nullptr)
+        {
+          task_output->append(s, n);
+          return n;
+        }
+
+      std::lock_guard<std::mutex> lock(forward_mutex);
+      return forward_buffer->sputn(s, n);
+    }
+
+    int
+    sync() override
+    {
+      if (task_output != nullptr)
+        return 0;
+
+      std::lock_guard<std::mutex> lock(forward_mutex);
+      return forward_buffer->pubsync();
+    }
+
+  private:
+    std::streambuf *forward_buffer;
+    std::mutex      forward_mutex;
+  };
+
+  thread_local std::string *TaskOutputBuffer::task_output = nullptr;
+
+  /**
+   * @brief Restore the stream buffer of the standard output when it goes out
+   * of scope, including when a task throws an exception.
+   */
+  struct StandardOutputRedirection
+  {
+    StandardOutputRedirection(std::streambuf *buffer)
+      : original_buffer(std::cout.rdbuf(buffer))
+    {}
+
+    ~StandardOutputRedirection()
+    {
+      std::cout.rdbuf(original_buffer);
+    }
+
+    std::streambuf *original_buffer;
+  };
+} // namespace
+
+bool
+concurrent_tasks_are_supported(const MPI_Comm mpi_communicator)
+{
+  if (MultithreadInfo::n_threads() < 2)
+    return false;
+
+  if (!Utilities::MPI::job_supports_mpi())
+    return true;
+
+  if (Utilities::MPI::n_mpi_processes(mpi_communicator) > 1)
+    return false;
+
+  int       provided = MPI_THREAD_SINGLE;
+  const int ierr     = MPI_Query_thread(&provided);
+  AssertThrowMPI(ierr);
+
+  return provided == MPI_THREAD_MULTIPLE;
+}
+
+std::vector<double>
+run_tasks_with_ordered_output(const std::vector<std::function<void()>> &tasks,
+                              std::ostream                             &output)
+{
+  std::vector<std::string> task_outputs(tasks.size());
+  std::vector<double>      wall_times(tasks.size(), 0.);
+
+  {
+    TaskOutputBuffer          buffer(std::cout.rdbuf());
+    StandardOutputRedirection redirection(&buffer);
+
+    Threads::TaskGroup<void> task_group;
+    for (unsigned int i = 0; i < tasks.size(); ++i)
+      task_group += Threads::new_task([&, i]() {
+        // A thread waiting for a task can run another one, so the buffer of
+        // the interrupted task is restored at the end
+        std::string *previous_output     = TaskOutputBuffer::task_output;
+        TaskOutputBuffer::task_output    = &task_outputs[i];
+        const auto restore_output_buffer = [&]() {
+          TaskOutputBuffer::task_output = previous_output;
+        };
+
+        Timer timer;
+        try
+          {
+            tasks[i]();
+          }
+        catch (...)
+          {
+            restore_output_buffer();
+            throw;
+          }
+        wall_times[i] = timer.wall_time();
+        restore_output_buffer();
+      });
+    task_group.join_all();
+  }
+
+  for (const auto &task_output : task_outputs)
+    output << task_output;
+  output.flush();
+
+  return wall_times;
+}
+
+bool
+concurrent_auxiliary_physics_requested(int argc, char **argv)
+{
+  const auto [options, args] = parse_args(argc, argv);
+  if (args.empty() || !std::ifstream(args[0]).good())
+    return false;
+
+  return get_last_value_of_parameter(args[0],
+                                     "auxiliary physics execution") ==
+         "concurrent";
+}
+
+ApplicationMPIInitFinalize::ApplicationMPIInitFinalize(int &argc, char **&argv)
+{
+  if (!concurrent_auxiliary_physics_requested(argc, argv))
+    {
+      serialized_initialization =
+        std::make_unique<Utilities::MPI::MPI_InitFinalize>(argc, argv, 1);
+      return;
+    }
+
+  // The support of MPI_THREAD_MULTIPLE is checked by
+  // concurrent_tasks_are_supported(), which falls back to the sequential
+  // execution if the MPI library provides a lower level
+  int       provided = MPI_THREAD_SINGLE;
+  const int ierr =
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+  AssertThrowMPI(ierr);
+
+#ifdef DEAL_II_WITH_P4EST
+  sc_init(MPI_COMM_WORLD, 0, 0, nullptr, SC_LP_SILENT);
+  p4est_init(nullptr, SC_LP_SILENT);
+#endif
+
+#ifdef DEAL_II_WITH_ZOLTAN
+  float zoltan_version;
+  Zoltan_Initialize(argc, argv, &zoltan_version);
+#endif
+
+  // At least two threads, such that two physics can be solved concurrently
+  // on a single core. The DEAL_II_NUM_THREADS environment variable can still
+  // lower this number.
+  MultithreadInfo::set_thread_limit(std::max(MultithreadInfo::n_cores(), 2U));
+
+  dealii::internal::ensure_kokkos_initialized();
+}
+
+ApplicationMPIInitFinalize::~ApplicationMPIInitFinalize()
+{
+  if (serialized_initialization)
+    return;
+
+  // The vectors kept by the memory pools hold MPI objects, which must be
+  // released before MPI is finalized
+  GrowingVectorMemory<
+    LinearAlgebra::distributed::Vector<double>>::release_unused_memory();
+  GrowingVectorMemory<
+    LinearAlgebra::distributed::Vector<float>>::release_unused_memory();
+  GrowingVectorMemory<
+    LinearAlgebra::distributed::BlockVector<double>>::release_unused_memory();
+  GrowingVectorMemory<
+    LinearAlgebra::distributed::BlockVector<float>>::release_unused_memory();
+  GrowingVectorMemory<TrilinosWrappers::MPI::Vector>::release_unused_memory();
+  GrowingVectorMemory<
+    TrilinosWrappers::MPI::BlockVector>::release_unused_memory();
+
+#ifdef DEAL_II_WITH_P4EST
+  sc_finalize();
+#endif
+
+  // As in Utilities::MPI::MPI_InitFinalize, MPI is not finalized while an
+  // exception is propagated, since the other processes may not reach this
+  // point
+  if (std::uncaught_exceptions() > 0)
+    {
+      std::cerr << "An exception was thrown, MPI_Finalize() is not called."
+                << std::endl;
+      return;
+    }
+
+  const int ierr = MPI_Finalize();
+  (void)ierr;
+  AssertNothrow(ierr == MPI_SUCCESS, ExcMessage("MPI_Finalize failed."));
+}
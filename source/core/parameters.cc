@@ -7,6 +7,7 @@
 #include <deal.II/base/exceptions.h>
 
 #include <algorithm>
+#include <limits>
 
 DeclException2(
   PhaseChangeIntervalError,
@@ -143,6 +144,26 @@ namespace Parameters
         "1.0",
         Patterns::Double(0),
         "The capillary time-step ratio (CTR) corresponds to the ratio of the time step over capillary time-step constraint (Δt/Δt_σ)");
+      prm.declare_entry(
+        "adapt time step to respect error",
+        "false",
+        Patterns::Bool(),
+        "Adapt the time step to respect a tolerance on the estimated local truncation error. The error is estimated with an embedded method for SDIRK schemes and with the difference between the solution and its extrapolation from the previous time steps for BDF schemes. Time steps whose error exceeds the tolerance are rejected and carried out again with a smaller time step. <true|false>");
+      prm.declare_entry(
+        "error absolute tolerance",
+        "1e-4",
+        Patterns::Double(0),
+        "Absolute tolerance on the root mean square of the local truncation error");
+      prm.declare_entry(
+        "error relative tolerance",
+        "1e-3",
+        Patterns::Double(0),
+        "Tolerance on the local truncation error relative to the root mean square of the solution");
+      prm.declare_entry(
+        "max time step rejections",
+        "5",
+        Patterns::Integer(0),
+        "Maximum number of successive rejections of a time step. Beyond this number, the time step is accepted regardless of its error");
       prm.declare_entry("stop tolerance",
                         "1e-10",
                         Patterns::Double(),
@@ -276,7 +297,11 @@ namespace Parameters
         prm.get_bool("adapt time step to respect CTR");
       max_capillary_time_step_ratio =
         prm.get_double("max capillary time-step ratio");
-      stop_tolerance = prm.get_double("stop tolerance");
+      adapt_with_error = prm.get_bool("adapt time step to respect error");
+      error_absolute_tolerance = prm.get_double("error absolute tolerance");
+      error_relative_tolerance = prm.get_double("error relative tolerance");
+      max_time_step_rejections = prm.get_integer("max time step rejections");
+      stop_tolerance           = prm.get_double("stop tolerance");
       adaptative_time_step_scaling =
         prm.get_double("adaptative time step scaling");
       startup_timestep_scaling = prm.get_double("startup time scaling");
@@ -300,7 +325,8 @@ namespace Parameters
       log_frequency = prm.get_integer("log frequency");
       log_precision = prm.get_integer("log precision");
       time_step_adaptation_required =
-        adapt_with_cfl || adapt_with_capillary_time_step_ratio;
+        adapt_with_cfl || adapt_with_capillary_time_step_ratio ||
+        adapt_with_error;
     }
     prm.leave_subsection();
   } // namespace Parameters
@@ -341,6 +367,31 @@ namespace Parameters
     prm.leave_subsection();
   }
 
+  void
+  Threading::declare_parameters(ParameterHandler &prm)
+  {
+    prm.enter_subsection("threading");
+    {
+      prm.declare_entry(
+        "number of threads",
+        "1",
+        Patterns::Integer(0),
+        "Number of threads used by each MPI process. With 0, the cores of "
+        "each node are shared evenly among the MPI processes of the node.");
+    }
+    prm.leave_subsection();
+  }
+
+  void
+  Threading::parse_parameters(ParameterHandler &prm)
+  {
+    prm.enter_subsection("threading");
+    {
+      number_of_threads = prm.get_integer("number of threads");
+    }
+    prm.leave_subsection();
+  }
+
   void
   PowerLawParameters::declare_parameters(ParameterHandler &prm)
   {
@@ -1752,6 +1803,11 @@ namespace Parameters
         "1",
         Patterns::Integer(),
         "interpolation order chemical potential in the Cahn-Hilliard equations");
+      prm.declare_entry(
+        "cahn hilliard uses matrix free",
+        "false",
+        Patterns::Bool(),
+        "Solve the Cahn-Hilliard linear systems with a matrix-free operator instead of an assembled matrix");
       prm.declare_entry(
         "electromagnetics trial order",
         "1",
@@ -1769,6 +1825,12 @@ namespace Parameters
         Patterns::Bool(),
         "Switch tracer to Discontinuous Galerkin (DG) formulation");
 
+      prm.declare_entry(
+        "tracer dg uses matrix free",
+        "false",
+        Patterns::Bool(),
+        "Solve the Discontinuous Galerkin (DG) tracer linear systems with a matrix-free operator instead of an assembled matrix");
+
       prm.declare_entry(
         "VOF uses dg",
         "false",
@@ -1799,11 +1861,15 @@ namespace Parameters
       temperature_order         = prm.get_integer("temperature order");
       tracer_order              = prm.get_integer("tracer order");
       tracer_uses_dg            = prm.get_bool("tracer uses dg");
+      tracer_dg_uses_matrix_free =
+        prm.get_bool("tracer dg uses matrix free");
       VOF_order                 = prm.get_integer("VOF order");
       VOF_uses_dg               = prm.get_bool("VOF uses dg");
       phase_cahn_hilliard_order = prm.get_integer("phase cahn hilliard order");
       potential_cahn_hilliard_order =
         prm.get_integer("potential cahn hilliard order");
+      cahn_hilliard_uses_matrix_free =
+        prm.get_bool("cahn hilliard uses matrix free");
       electromagnetics_trial_order =
         prm.get_integer("electromagnetics trial order");
       electromagnetics_test_order =
@@ -2234,6 +2300,38 @@ namespace Parameters
         Patterns::Double(),
         "Initial time to start calculations for average temperature");
 
+      prm.declare_entry(
+        "average velocities scheme",
+        "cumulative",
+        Patterns::Selection("cumulative|welford"),
+        "Scheme used to accumulate the average velocities and the Reynolds "
+        "stresses. <cumulative|welford>. The cumulative scheme stores the time "
+        "integrals of the velocities and of the fluctuations. The welford "
+        "scheme updates the averages and the Reynolds stresses in a single "
+        "pass and stores half as many vectors.");
+
+      prm.declare_entry(
+        "average velocities frequency",
+        "1",
+        Patterns::Integer(1),
+        "Number of time steps between two updates of the average velocities "
+        "and Reynolds stresses. Each update is weighted by the time elapsed "
+        "since the previous update.");
+
+      prm.declare_entry(
+        "average velocities binary output frequency",
+        "0",
+        Patterns::Integer(0),
+        "Number of time steps between two binary outputs of the average "
+        "velocities and Reynolds stresses. 0 disables the binary output.");
+
+      prm.declare_entry(
+        "average velocities binary name",
+        "average_velocities",
+        Patterns::FileName(),
+        "File output prefix of the binary average velocities and Reynolds "
+        "stresses");
+
       prm.declare_entry("kinetic energy name",
                         "kinetic_energy",
                         Patterns::FileName(),
@@ -2446,6 +2544,22 @@ namespace Parameters
         prm.get_double("initial time for average velocity");
       initial_time_for_average_temp_and_hf =
         prm.get_double("initial time for average temperature and heat flux");
+
+      const std::string average_scheme = prm.get("average velocities scheme");
+      if (average_scheme == "cumulative")
+        average_velocities_scheme = AverageVelocitiesScheme::cumulative;
+      else if (average_scheme == "welford")
+        average_velocities_scheme = AverageVelocitiesScheme::welford;
+      else
+        throw(std::logic_error(
+          "Error, invalid average velocities scheme. Choices are cumulative or welford."));
+      average_velocities_frequency =
+        prm.get_integer("average velocities frequency");
+      average_velocities_binary_output_frequency =
+        prm.get_integer("average velocities binary output frequency");
+      average_velocities_binary_output_name =
+        prm.get("average velocities binary name");
+
       kinetic_energy_output_name      = prm.get("kinetic energy name");
       pressure_drop_output_name       = prm.get("pressure drop name");
       flow_rate_output_name           = prm.get("flow rate name");
@@ -2512,14 +2626,17 @@ namespace Parameters
         prm.declare_entry(
           "solver",
           "newton",
-          Patterns::Selection("newton|kinsol_newton|inexact_newton"),
+          Patterns::Selection("newton|kinsol_newton|inexact_newton|jfnk"),
           "Non-linear solver that will be used "
-          "Choices are <newton|kinsol_newton|inexact_newton>."
+          "Choices are <newton|kinsol_newton|inexact_newton|jfnk>."
           " The newton solver is a traditional newton solver with"
           "an analytical jacobian formulation. The jacobian matrix and the preconditioner"
           "are assembled every iteration. In the kinsol_newton method, the nonlinear solver"
           "Kinsol from the SUNDIALS library is used. This solver has an internal algorithm"
-          "that decides whether to reassemble the Jacobian matrix or not.");
+          "that decides whether to reassemble the Jacobian matrix or not."
+          " The jfnk solver is a Jacobian-free Newton-Krylov solver which approximates"
+          " the Jacobian-vector products with finite differences of the residual and"
+          " uses a lagged jacobian matrix as preconditioner.");
 
         prm.declare_entry(
           "kinsol strategy",
@@ -2583,6 +2700,50 @@ namespace Parameters
           "false",
           Patterns::Bool(),
           "Aborts Lethe by throwing an exception if non-linear solver convergence has failed");
+
+        prm.declare_entry(
+          "enable cell activity map",
+          "false",
+          Patterns::Bool(),
+          "Cache the local matrix of every cell and reuse it during the next "
+          "assemblies as long as the degrees of freedom of the cell have not "
+          "changed by more than the cell activity tolerance");
+
+        prm.declare_entry(
+          "cell activity tolerance",
+          "1e-10",
+          Patterns::Double(0.),
+          "Maximal change of the degrees of freedom of a cell, with respect to "
+          "the state at which its local matrix was cached, for which the cell "
+          "is considered quiescent");
+
+        prm.declare_entry(
+          "jfnk perturbation",
+          "1e-8",
+          Patterns::Double(std::numeric_limits<double>::min()),
+          "Relative perturbation of the finite differences that approximate "
+          "the Jacobian-vector products of the jfnk solver");
+
+        prm.declare_entry(
+          "jfnk krylov tolerance",
+          "1e-4",
+          Patterns::Double(0.),
+          "Relative tolerance of the Krylov solver of the jfnk solver");
+
+        prm.declare_entry(
+          "jfnk max krylov iterations",
+          "50",
+          Patterns::Integer(1),
+          "Maximum number of iterations of the Krylov solver of the jfnk "
+          "solver");
+
+        prm.declare_entry(
+          "jfnk preconditioner refresh iterations",
+          "10",
+          Patterns::Integer(0),
+          "Number of Krylov iterations above which the lagged jacobian matrix "
+          "used as preconditioner by the jfnk solver is reassembled at the "
+          "next Newton iteration");
       }
       prm.leave_subsection();
     }
@@ -2612,6 +2773,8 @@ namespace Parameters
           solver = SolverType::kinsol_newton;
         else if (str_solver == "inexact_newton")
           solver = SolverType::inexact_newton;
+        else if (str_solver == "jfnk")
+          solver = SolverType::jfnk;
         else
           throw(std::runtime_error("Invalid non-linear solver "));
 
@@ -2636,6 +2799,14 @@ namespace Parameters
         reuse_preconditioner  = prm.get_bool("reuse preconditioner");
         abort_at_convergence_failure =
           prm.get_bool("abort at convergence failure");
+        enable_cell_activity_map = prm.get_bool("enable cell activity map");
+        cell_activity_tolerance  = prm.get_double("cell activity tolerance");
+        jfnk_perturbation        = prm.get_double("jfnk perturbation");
+        jfnk_krylov_tolerance    = prm.get_double("jfnk krylov tolerance");
+        jfnk_max_krylov_iterations =
+          prm.get_integer("jfnk max krylov iterations");
+        jfnk_preconditioner_refresh_iterations =
+          prm.get_integer("jfnk preconditioner refresh iterations");
       }
       prm.leave_subsection();
     }
@@ -2912,6 +3083,24 @@ namespace Parameters
                           "The preconditioner for the linear solver."
                           "Choices are <amg|ilu|lsmg|gcmg>.");
 
+        prm.declare_entry(
+          "preconditioner refresh",
+          "always",
+          Patterns::Selection("always|adaptive"),
+          "Policy for the setup of the preconditioner. With always, the "
+          "preconditioner is rebuilt every time it is set up. With adaptive, "
+          "the preconditioner is kept across linear solves and time steps and "
+          "is only refreshed or rebuilt when the number of iterations of the "
+          "linear solver grows. Choices are <always|adaptive>.");
+
+        prm.declare_entry(
+          "preconditioner refresh iteration ratio",
+          "1.5",
+          Patterns::Double(1.),
+          "Ratio between the number of iterations of the last linear solve and "
+          "of the first linear solve with the current preconditioner beyond "
+          "which the adaptive policy refreshes or rebuilds the preconditioner");
+
 
         prm.declare_entry("ilu preconditioner fill",
                           "0",
@@ -3152,6 +3341,17 @@ namespace Parameters
           throw std::logic_error(
             "Error, invalid preconditioner type. Choices are amg, ilu, lsmg or gcmg.");
 
+        const std::string refresh = prm.get("preconditioner refresh");
+        if (refresh == "always")
+          preconditioner_refresh = PreconditionerRefreshType::always;
+        else if (refresh == "adaptive")
+          preconditioner_refresh = PreconditionerRefreshType::adaptive;
+        else
+          throw std::logic_error(
+            "Error, invalid preconditioner refresh policy. Choices are always or adaptive.");
+        preconditioner_refresh_iteration_ratio =
+          prm.get_double("preconditioner refresh iteration ratio");
+
 
         ilu_precond_fill = prm.get_integer("ilu preconditioner fill");
         ilu_precond_atol =
@@ -3798,6 +3998,12 @@ namespace Parameters
           "Bool to define if extrapolation should be enabled (default). If disabled, all velocity degrees of freedom "
           "in a cell will be set to the particle velocity if that cell is cut. Setting to false is intended for "
           "debugging purposes.");
+        prm.declare_entry(
+          "enable stencil cache",
+          "true",
+          Patterns::Bool(),
+          "Bool to define if the stencils of the immersed boundary are reused between assemblies as long as the "
+          "mesh does not change and the particle which cuts the cell does not move.");
 
         prm.leave_subsection();
       }
@@ -3863,6 +4069,11 @@ namespace Parameters
           "true",
           Patterns::Bool(),
           "Bool to define if particles' information are printed on the terminal when particles' time step is finished");
+        prm.declare_entry(
+          "print stencil reuse",
+          "false",
+          Patterns::Bool(),
+          "Bool to define if the number of immersed boundary stencils reused from the previous assemblies is printed on the terminal at every assembly");
         prm.declare_entry(
           "enable extra sharp interface vtu output field",
           "false",
@@ -4000,6 +4211,7 @@ namespace Parameters
         order                = prm.get_integer("stencil order");
         length_ratio         = prm.get_double("length ratio");
         enable_extrapolation = prm.get_bool("enable extrapolation");
+        enable_stencil_cache = prm.get_bool("enable stencil cache");
         prm.leave_subsection();
       }
 
@@ -4025,6 +4237,7 @@ namespace Parameters
         calculate_force_ib   = prm.get_bool("calculate force");
         ib_force_output_file = prm.get("ib force output file");
         print_dem            = prm.get_bool("print DEM");
+        print_stencil_reuse  = prm.get_bool("print stencil reuse");
         enable_extra_sharp_interface_vtu_output_field =
           prm.get_bool("enable extra sharp interface vtu output field");
         ib_particles_pvd_file = prm.get("ib particles pvd file");
@@ -586,6 +586,18 @@ namespace Parameters
                           "particles.input",
                           Patterns::List(Patterns::FileName()),
                           "The file name from which we load the particles");
+        prm.declare_entry(
+          "input file format",
+          "text",
+          Patterns::Selection("text|binary"),
+          "Format of the input files. Binary files are read in chunks with "
+          "MPI-IO by all the processes. Choices are <text|binary>.");
+        prm.declare_entry(
+          "input file chunk size",
+          "1000000",
+          Patterns::Integer(1),
+          "Number of particles read at once by each process from a binary "
+          "input file");
 
         // Plane:
         prm.declare_entry("insertion plane point",
@@ -663,6 +675,13 @@ namespace Parameters
                           "1.",
                           Patterns::Double(),
                           "Distance threshold");
+        prm.declare_entry(
+          "local insertion",
+          "false",
+          Patterns::Bool(),
+          "Insert the particles in the locally owned cells of each process "
+          "without communication. The insertion points do not depend on the "
+          "partition of the triangulation");
 
         // Volume or plane:
         prm.declare_entry(
@@ -748,6 +767,16 @@ namespace Parameters
         // File for the insertion
         list_of_input_files =
           convert_string_to_vector<std::string>(prm, "list of input files");
+        const std::string input_file_format = prm.get("input file format");
+        if (input_file_format == "text")
+          insertion_file_format = InsertionFileFormat::text;
+        else if (input_file_format == "binary")
+          insertion_file_format = InsertionFileFormat::binary;
+        else
+          {
+            throw(std::runtime_error("Invalid input file format "));
+          }
+        insertion_file_chunk_size = prm.get_integer("input file chunk size");
 
         // Plane:
         // Insertion plane normal vector
@@ -837,6 +866,7 @@ namespace Parameters
           }
 
         distance_threshold = prm.get_double("insertion distance threshold");
+        local_insertion    = prm.get_bool("local insertion");
         insertion_maximum_offset = prm.get_double("insertion maximum offset");
         seed_for_insertion       = prm.get_integer("insertion prn seed");
 
@@ -868,9 +898,11 @@ namespace Parameters
             "load balance method",
             "none",
             Patterns::Selection(
-              "none|once|frequent|dynamic|dynamic_with_sparse_contacts"),
+              "none|once|frequent|dynamic|dynamic_with_sparse_contacts|"
+              "dynamic_with_measured_cost"),
             "Choosing load-balance method"
-            "Choices are <none|once|frequent|dynamic|dynamic_with_sparse_contacts>.");
+            "Choices are <none|once|frequent|dynamic|dynamic_with_sparse_contacts|"
+            "dynamic_with_measured_cost>.");
 
           prm.declare_entry(
             "step",
@@ -922,6 +954,26 @@ namespace Parameters
             "1.0",
             Patterns::Double(),
             "Factor applied on the particle weight in load balancing if the cell is inactive");
+
+          prm.declare_entry(
+            "contact weight",
+            "250",
+            Patterns::Integer(0),
+            "The weight of a particle-particle contact pair based on a default cell weight of 1000");
+
+          prm.declare_entry(
+            "wall contact weight",
+            "250",
+            Patterns::Integer(0),
+            "The weight of a particle-wall contact pair based on a default cell weight of 1000");
+
+          prm.declare_entry(
+            "cost smoothing factor",
+            "0.5",
+            Patterns::Double(0., 1.),
+            "Relaxation factor of the exponential smoothing of the measured "
+            "cell costs between two load balancing checks. A value of 1 only "
+            "uses the last measurement");
         }
         prm.leave_subsection();
 
@@ -949,6 +1001,45 @@ namespace Parameters
             "1.3",
             Patterns::Double(),
             "Contact search zone diameter to particle diameter ratio");
+
+          prm.declare_entry(
+            "broad search method",
+            "cell_neighbors",
+            Patterns::Selection("cell_neighbors|linked_cell|hierarchical_grid"),
+            "Method used to find the particle-particle contact candidates. "
+            "Choices are <cell_neighbors|linked_cell|hierarchical_grid>. The "
+            "linked_cell method sorts the particles into a rank-local uniform "
+            "grid whose bins are sized from the neighborhood threshold and the "
+            "maximum particle diameter, independently of the background mesh. "
+            "The hierarchical_grid method uses one grid per diameter class and "
+            "a neighborhood sized by the diameters of each pair of particles, "
+            "which is suited to strongly polydisperse simulations");
+
+          prm.declare_entry(
+            "broad search verbosity",
+            "quiet",
+            Patterns::Selection("quiet|verbose"),
+            "State whether the number of particle-particle contact candidates "
+            "and the wall time of the broad search should be printed. "
+            "Choices are <quiet|verbose>.");
+
+          prm.declare_entry(
+            "overlap ghost update",
+            "false",
+            Patterns::Bool(),
+            "Update the properties of the ghost particles with non-blocking "
+            "communications overlapped with the calculation of the local-local "
+            "particle-particle contact forces at the iterations without "
+            "contact search");
+
+          prm.declare_entry(
+            "reduced ghost update",
+            "false",
+            Patterns::Bool(),
+            "Only send the location, the velocities, the angular velocities "
+            "and the temperature of the ghost particles in double precision "
+            "and their type, diameter, mass and specific heat in single "
+            "precision at the iterations without contact search");
         }
         prm.leave_subsection();
 
@@ -999,6 +1090,15 @@ namespace Parameters
                           "Choosing solver type"
                           "Choices are <dem|cfd_dem|dem_mp>.");
 
+        prm.declare_entry(
+          "thermal time step ratio",
+          "1",
+          Patterns::Integer(1),
+          "Ratio between the time step of the temperature integration and the "
+          "DEM time step. The heat transfer of the contacts is only calculated "
+          "every <thermal time step ratio> DEM iterations and is considered "
+          "constant over the thermal time step (DEM multiphysics)");
+
         prm.enter_subsection("adaptive sparse contacts");
         {
           prm.declare_entry(
@@ -1030,6 +1130,30 @@ namespace Parameters
         }
         prm.leave_subsection();
 
+        prm.enter_subsection("multiple time stepping");
+        {
+          prm.declare_entry(
+            "enable",
+            "false",
+            Patterns::Bool(),
+            "Enable the multiple time stepping of the contacts between coarse "
+            "particles. Choices are <true|false>.");
+
+          prm.declare_entry(
+            "time step ratio",
+            "4",
+            Patterns::Integer(1),
+            "Ratio between the time step of the contacts between coarse "
+            "particles and the DEM time step");
+
+          prm.declare_entry(
+            "coarse diameter threshold",
+            "0",
+            Patterns::Double(0.),
+            "Diameter above which a particle is coarse");
+        }
+        prm.leave_subsection();
+
         prm.declare_entry("disable position integration",
                           "false",
                           Patterns::Selection("true|false"),
@@ -1058,6 +1182,15 @@ namespace Parameters
         }
         prm.leave_subsection();
 
+        prm.enter_subsection("multiple time stepping");
+        {
+          multiple_time_stepping = prm.get_bool("enable");
+          coarse_time_step_ratio = prm.get_integer("time step ratio");
+          coarse_diameter_threshold =
+            prm.get_double("coarse diameter threshold");
+        }
+        prm.leave_subsection();
+
         prm.enter_subsection("load balancing");
         {
           const std::string load_balance = prm.get("load balance method");
@@ -1106,6 +1239,14 @@ namespace Parameters
                     "while dynamic_with_sparse_contacts is selected, use dynamic instead"));
                 }
             }
+          else if (load_balance == "dynamic_with_measured_cost")
+            {
+              load_balance_method =
+                LoadBalanceMethod::dynamic_with_measured_cost;
+              load_balance_threshold = prm.get_double("threshold");
+              dynamic_load_balance_check_frequency =
+                prm.get_integer("dynamic check frequency");
+            }
           else if (load_balance == "none")
             {
               load_balance_method = LoadBalanceMethod::none;
@@ -1125,6 +1266,17 @@ namespace Parameters
           }
           prm.leave_subsection();
           load_balance_particle_weight = prm.get_integer("particle weight");
+
+          // Weights of the contacts and smoothing of the measured costs
+          load_balance_contact_weight = prm.get_integer("contact weight");
+          load_balance_wall_contact_weight =
+            prm.get_integer("wall contact weight");
+          load_balance_cost_smoothing_factor =
+            prm.get_double("cost smoothing factor");
+
+          AssertThrow(load_balance_cost_smoothing_factor > 0.,
+                      ExcMessage("The cost smoothing factor of the load "
+                                 "balancing must be larger than 0."));
         }
         prm.leave_subsection();
 
@@ -1144,6 +1296,28 @@ namespace Parameters
             contact_detection_method = ContactDetectionMethod::dynamic;
           else
             throw(std::runtime_error("Invalid contact detection method "));
+
+          const std::string broad_search = prm.get("broad search method");
+          if (broad_search == "cell_neighbors")
+            broad_search_method = BroadSearchMethod::cell_neighbors;
+          else if (broad_search == "linked_cell")
+            broad_search_method = BroadSearchMethod::linked_cell;
+          else if (broad_search == "hierarchical_grid")
+            broad_search_method = BroadSearchMethod::hierarchical_grid;
+          else
+            throw(std::runtime_error("Invalid broad search method "));
+
+          const std::string broad_search_output =
+            prm.get("broad search verbosity");
+          if (broad_search_output == "quiet")
+            broad_search_verbosity = Parameters::Verbosity::quiet;
+          else if (broad_search_output == "verbose")
+            broad_search_verbosity = Parameters::Verbosity::verbose;
+          else
+            throw(std::runtime_error("Invalid broad search verbosity "));
+
+          overlap_ghost_update = prm.get_bool("overlap ghost update");
+          reduced_ghost_update = prm.get_bool("reduced ghost update");
         }
         prm.leave_subsection();
 
@@ -1273,6 +1447,8 @@ namespace Parameters
             throw(std::runtime_error("Invalid solver type"));
           }
 
+        thermal_time_step_ratio = prm.get_integer("thermal time step ratio");
+
         disable_position_integration =
           prm.get_bool("disable position integration");
       }
@@ -1831,6 +2007,35 @@ namespace Parameters
             "Choices are <quiet|verbose>.");
         }
         prm.leave_subsection();
+        prm.enter_subsection("time averaging");
+        {
+          prm.declare_entry(
+            "enable time averaging",
+            "false",
+            Patterns::Bool(),
+            "Enable the in-situ time averaging of the cell-based fields "
+            "(velocity, granular temperature, solid fraction, coordination "
+            "number and kinetic stress).");
+          prm.declare_entry(
+            "sampling frequency",
+            "100",
+            Patterns::Integer(1),
+            "Number of DEM iterations between two samples of the time "
+            "averages.");
+          prm.declare_entry("initial time",
+                            "0.",
+                            Patterns::Double(),
+                            "Time at which the sampling of the time averages "
+                            "starts.");
+          prm.declare_entry(
+            "output frequency",
+            "0",
+            Patterns::Integer(0),
+            "Number of DEM iterations between two outputs of the time "
+            "averages. If set to 0, the time averages are only written at "
+            "the end of the simulation.");
+        }
+        prm.leave_subsection();
       }
       prm.leave_subsection();
     }
@@ -1863,6 +2068,16 @@ namespace Parameters
             }
         }
         prm.leave_subsection();
+        prm.enter_subsection("time averaging");
+        {
+          time_averaging_enabled = prm.get_bool("enable time averaging");
+          time_averaging_sampling_frequency =
+            prm.get_integer("sampling frequency");
+          time_averaging_initial_time = prm.get_double("initial time");
+          time_averaging_output_frequency =
+            prm.get_integer("output frequency");
+        }
+        prm.leave_subsection();
       }
       prm.leave_subsection();
     }
@@ -78,6 +78,13 @@ Parameters::Multiphysics<dim>::declare_parameters(ParameterHandler &prm) const
     prm.declare_alias("thermal buoyancy force",
                       "buoyancy force",
                       true); // temporary alias for backward compatibility
+
+    prm.declare_entry(
+      "auxiliary physics execution",
+      "sequential",
+      Patterns::Selection("sequential|concurrent"),
+      "Execution of the auxiliary physics that do not depend on each other "
+      "<sequential|concurrent>");
   }
   prm.leave_subsection();
 
@@ -104,6 +111,15 @@ Parameters::Multiphysics<dim>::parse_parameters(
     // subparameters for heat_transfer
     viscous_dissipation    = prm.get_bool("viscous dissipation");
     thermal_buoyancy_force = prm.get_bool("thermal buoyancy force");
+
+    const std::string execution = prm.get("auxiliary physics execution");
+    if (execution == "sequential")
+      auxiliary_physics_execution = AuxiliaryPhysicsExecution::sequential;
+    else if (execution == "concurrent")
+      auxiliary_physics_execution = AuxiliaryPhysicsExecution::concurrent;
+    else
+      throw(std::logic_error(
+        "Error, invalid auxiliary physics execution. Choices are sequential or concurrent."));
   }
   prm.leave_subsection();
   vof_parameters.parse_parameters(prm);
@@ -297,6 +313,14 @@ Parameters::VOF_InterfaceSharpening::declare_parameters(ParameterHandler &prm)
       Patterns::Integer(),
       "Maximum number of iteration in the bissection algorithm that ensures mass conservation");
 
+    prm.declare_entry(
+      "search method",
+      "bisection",
+      Patterns::Selection("bisection|illinois"),
+      "Search method of the adaptive sharpening threshold <bisection|illinois>. "
+      "The illinois method uses the root of the secant through the endpoints "
+      "of the search interval and usually requires fewer steps");
+
     prm.declare_entry(
       "monitoring",
       "false",
@@ -346,6 +370,16 @@ Parameters::VOF_InterfaceSharpening::parse_parameters(ParameterHandler &prm)
     // Parameters for adaptive sharpening
     threshold_max_deviation = prm.get_double("threshold max deviation");
     max_iterations          = prm.get_integer("max iterations");
+
+    const std::string sm = prm.get("search method");
+    if (sm == "bisection")
+      search_method = Parameters::SharpeningSearchMethod::bisection;
+    else if (sm == "illinois")
+      search_method = Parameters::SharpeningSearchMethod::illinois;
+    else
+      throw(std::runtime_error("Invalid sharpening threshold search method. "
+                               "Options are 'bisection' or 'illinois'."));
+
     monitoring              = prm.get_bool("monitoring");
     tolerance               = prm.get_double("tolerance");
 
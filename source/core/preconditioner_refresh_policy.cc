@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <core/preconditioner_refresh_policy.h>
+
+#include <algorithm>
+
+PreconditionerRefreshPolicy::PreconditionerRefreshPolicy(
+  const Parameters::LinearSolver::PreconditionerRefreshType refresh_type,
+  const double                                              iteration_ratio)
+  : refresh_type(refresh_type)
+  , iteration_ratio(iteration_ratio)
+  , preconditioner_is_valid(false)
+  , solved_since_setup(false)
+  , refresh_is_exhausted(false)
+  , reference_iterations(0)
+  , reference_is_set(false)
+  , last_iterations(0)
+  , n_rebuilds(0)
+  , n_refreshes(0)
+  , n_reuses(0)
+  , total_setup_time(0.)
+  , total_solve_time(0.)
+{}
+
+PreconditionerRefreshPolicy::PreconditionerRefreshPolicy(
+  const Parameters::LinearSolver &linear_solver_parameters)
+  : PreconditionerRefreshPolicy(
+      linear_solver_parameters.preconditioner_refresh,
+      linear_solver_parameters.preconditioner_refresh_iteration_ratio)
+{}
+
+void
+PreconditionerRefreshPolicy::invalidate()
+{
+  preconditioner_is_valid = false;
+}
+
+PreconditionerRefreshPolicy::Action
+PreconditionerRefreshPolicy::get_setup_action(
+  const bool numeric_refresh_supported) const
+{
+  if (refresh_type ==
+        Parameters::LinearSolver::PreconditionerRefreshType::always ||
+      !preconditioner_is_valid)
+    return Action::rebuild;
+
+  // The quality of the preconditioner can only be assessed once it has been
+  // used in a linear solve
+  if (!solved_since_setup || !reference_is_set)
+    return Action::reuse;
+
+  const double max_iterations =
+    iteration_ratio * std::max(reference_iterations, 1U);
+  if (last_iterations <= max_iterations)
+    return Action::reuse;
+
+  // The number of iterations has grown. A refresh of the numerical values is
+  // attempted first since it is cheaper, unless the previous refresh did not
+  // restore the number of iterations.
+  if (numeric_refresh_supported && !refresh_is_exhausted)
+    return Action::refresh;
+
+  return Action::rebuild;
+}
+
+void
+PreconditionerRefreshPolicy::register_setup(const Action action,
+                                            const double setup_time)
+{
+  switch (action)
+    {
+      case Action::rebuild:
+        {
+          ++n_rebuilds;
+          preconditioner_is_valid = true;
+          solved_since_setup      = false;
+          refresh_is_exhausted    = false;
+          reference_is_set        = false;
+          break;
+        }
+      case Action::refresh:
+        {
+          ++n_refreshes;
+          solved_since_setup   = false;
+          refresh_is_exhausted = true;
+          break;
+        }
+      case Action::reuse:
+        {
+          ++n_reuses;
+          break;
+        }
+    }
+  total_setup_time += setup_time;
+}
+
+void
+PreconditionerRefreshPolicy::register_solve(const unsigned int n_iterations,
+                                            const double       solve_time)
+{
+  last_iterations    = n_iterations;
+  solved_since_setup = true;
+  total_solve_time += solve_time;
+
+  // The first solve after a rebuild sets the reference number of iterations
+  if (!reference_is_set)
+    {
+      reference_iterations = n_iterations;
+      reference_is_set     = true;
+    }
+
+  // A refresh that restored the number of iterations can be attempted again
+  // the next time the number of iterations grows
+  if (n_iterations <= iteration_ratio * std::max(reference_iterations, 1U))
+    refresh_is_exhausted = false;
+}
+
+void
+PreconditionerRefreshPolicy::print_statistics(
+  const ConditionalOStream &pcout) const
+{
+  if (refresh_type ==
+      Parameters::LinearSolver::PreconditionerRefreshType::always)
+    return;
+
+  pcout << "  -Preconditioner rebuilds: " << n_rebuilds
+        << ", refreshes: " << n_refreshes << ", reuses: " << n_reuses
+        << std::endl;
+}
+
+void
+PreconditionerRefreshPolicy::print_total_times(
+  const ConditionalOStream &pcout,
+  const std::string        &physics_name) const
+{
+  pcout << physics_name
+        << " - Total preconditioner setup time: " << total_setup_time
+        << " s, total linear solve time: " << total_solve_time << " s"
+        << std::endl;
+}
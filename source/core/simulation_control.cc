@@ -26,6 +26,12 @@ SimulationControl::SimulationControl(const Parameters::SimulationControl &param)
   , current_capillary_time_step_ratio(0)
   , adapt_with_capillary_time_step_ratio(
       param.adapt_with_capillary_time_step_ratio)
+  , adapt_with_error(param.adapt_with_error)
+  , error_controller(param)
+  , time_step_error(0)
+  , max_time_step_rejections(param.max_time_step_rejections)
+  , n_successive_rejections(0)
+  , n_rejected_time_steps(0)
   , residual(DBL_MAX)
   , stop_tolerance(param.stop_tolerance)
   , output_iteration_frequency(param.output_iteration_frequency)
@@ -331,6 +337,12 @@ SimulationControlTransient::integrate()
       // in the case where the methods are not self-starting (all BDF of orders
       // 2 and above)
       update_assembly_method();
+
+      // Keep the time step history such that the time step can be rejected
+      // and the error of the new time step can be estimated
+      previous_time_step_vector = time_step_vector;
+      time_step_error           = 0;
+
       add_time_step(calculate_time_step());
       current_time += time_step;
 
@@ -369,6 +381,14 @@ SimulationControlTransient::calculate_time_step()
           max_CFL / CFL < adaptative_time_step_scaling)
         new_time_step = time_step * max_CFL / CFL;
 
+      if (adapt_with_error)
+        new_time_step =
+          std::min(new_time_step,
+                   time_step *
+                     error_controller.compute_time_step_factor(
+                       TimeStepErrorController::get_error_estimate_order(
+                         assembly_method)));
+
       new_time_step = std::min(new_time_step, max_dt);
 
       if (adapt_with_capillary_time_step_ratio)
@@ -392,6 +412,48 @@ SimulationControlTransient::calculate_time_step()
   return new_time_step;
 }
 
+bool
+SimulationControlTransient::reject_time_step()
+{
+  const unsigned int order =
+    TimeStepErrorController::get_error_estimate_order(assembly_method);
+
+  // The time step is accepted if its error is within the tolerance, if the
+  // error cannot be estimated or if the time step was already rejected too
+  // many times
+  if (!adapt_with_error || order == 0 || time_step_error <= 1. ||
+      n_successive_rejections >= max_time_step_rejections)
+    {
+      error_controller.register_accepted_error(time_step_error);
+      n_successive_rejections = 0;
+      return false;
+    }
+
+  const double new_time_step =
+    time_step *
+    error_controller.compute_rejection_factor(time_step_error, order);
+
+  // Bring the simulation back to the beginning of the time step and restart
+  // it with the smaller time step
+  time_step_vector = previous_time_step_vector;
+  current_time     = previous_time;
+  add_time_step(new_time_step);
+  current_time += time_step;
+
+  first_assembly  = true;
+  time_step_error = 0;
+
+  if (adapt_with_capillary_time_step_ratio)
+    set_current_capillary_time_step_ratio();
+
+  if (is_bdf())
+    update_bdf_coefficients();
+
+  ++n_successive_rejections;
+  ++n_rejected_time_steps;
+  return true;
+}
+
 bool
 SimulationControlTransient::is_output_iteration()
 {
@@ -77,3 +77,15 @@ SubSimulationControlDEM::iterate()
   iteration_number++;
   return true;
 }
+
+SubSimulationControlMultiRateDEM::SubSimulationControlMultiRateDEM(
+  const unsigned int time_step_ratio,
+  const double       coarse_diameter_threshold)
+  : time_step_ratio(time_step_ratio)
+  , coarse_diameter_threshold(coarse_diameter_threshold)
+  , iteration_number(0)
+{
+  AssertThrow(time_step_ratio > 0,
+              ExcMessage("The time step ratio of the multiple time stepping "
+                         "must be strictly positive."));
+}
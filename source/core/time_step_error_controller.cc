@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <core/time_step_error_controller.h>
+
+#include <deal.II/base/exceptions.h>
+
+#include <algorithm>
+#include <cmath>
+
+TimeStepErrorController::TimeStepErrorController(
+  const Parameters::SimulationControl &param)
+  : absolute_tolerance(param.error_absolute_tolerance)
+  , relative_tolerance(param.error_relative_tolerance)
+  , max_factor(std::max(param.adaptative_time_step_scaling, 1.))
+  , last_error(0.)
+  , second_to_last_error(0.)
+{}
+
+std::vector<double>
+TimeStepErrorController::embedded_sdirk_weights(
+  const Parameters::SimulationControl::TimeSteppingMethod method)
+{
+  const SDIRKTable table = sdirk_table(method);
+  std::vector<double> embedded_weights(table.b.size(), 0.);
+
+  if (table.b.size() == 2)
+    {
+      // First-order method: the weights only need to sum to one
+      embedded_weights[0] = 1.;
+    }
+  else
+    {
+      // Second-order method built on the first two stages:
+      // b_1 + b_2 = 1 and b_1 c_1 + b_2 c_2 = 1/2
+      embedded_weights[1] = (0.5 - table.c[0]) / (table.c[1] - table.c[0]);
+      embedded_weights[0] = 1. - embedded_weights[1];
+    }
+
+  return embedded_weights;
+}
+
+unsigned int
+TimeStepErrorController::get_error_estimate_order(
+  const Parameters::SimulationControl::TimeSteppingMethod method)
+{
+  using Method = Parameters::SimulationControl::TimeSteppingMethod;
+
+  switch (method)
+    {
+      case Method::bdf1:
+        return 2;
+      case Method::bdf2:
+        return 3;
+      case Method::bdf3:
+        return 4;
+      case Method::sdirk22:
+        return 2;
+      case Method::sdirk33:
+      case Method::sdirk43:
+        return 3;
+      default:
+        return 0;
+    }
+}
+
+std::vector<double>
+TimeStepErrorController::extrapolation_coefficients(
+  const std::vector<double> &time_steps,
+  const unsigned int         n_solutions)
+{
+  AssertThrow(time_steps.size() >= n_solutions,
+              ExcMessage("Not enough time steps are stored to extrapolate the "
+                         "solution from the previous solutions."));
+
+  // Times of the previous solutions relative to the end of the time step
+  std::vector<double> times(n_solutions);
+  double              time = 0.;
+  for (unsigned int i = 0; i < n_solutions; ++i)
+    {
+      time -= time_steps[i];
+      times[i] = time;
+    }
+
+  // Lagrange polynomials evaluated at the end of the time step
+  std::vector<double> coefficients(n_solutions, 1.);
+  for (unsigned int i = 0; i < n_solutions; ++i)
+    for (unsigned int j = 0; j < n_solutions; ++j)
+      if (j != i)
+        coefficients[i] *= -times[j] / (times[i] - times[j]);
+
+  return coefficients;
+}
+
+double
+TimeStepErrorController::normalize_error(const double error_norm,
+                                         const double solution_norm,
+                                         const double n_dofs) const
+{
+  const double scaling = 1. / std::sqrt(std::max(n_dofs, 1.));
+  return error_norm * scaling /
+         (absolute_tolerance + relative_tolerance * solution_norm * scaling);
+}
+
+double
+TimeStepErrorController::compute_time_step_factor(
+  const unsigned int order) const
+{
+  // Without an error estimate, the time step grows at the maximal rate
+  if (last_error <= 0. || order == 0)
+    return max_factor;
+
+  // The proportional part is only used when two errors are available,
+  // otherwise a purely integral (elementary) controller is used
+  double factor;
+  if (second_to_last_error > 0.)
+    factor = safety_factor * std::pow(last_error, -0.7 / order) *
+             std::pow(second_to_last_error, 0.4 / order);
+  else
+    factor = safety_factor * std::pow(last_error, -1. / order);
+
+  return std::clamp(factor, min_factor, max_factor);
+}
+
+double
+TimeStepErrorController::compute_rejection_factor(
+  const double       normalized_error,
+  const unsigned int order) const
+{
+  AssertThrow(order > 0,
+              ExcMessage("The error of this time-stepping method cannot be "
+                         "estimated."));
+
+  return std::clamp(safety_factor * std::pow(normalized_error, -1. / order),
+                    min_factor,
+                    1.);
+}
+
+void
+TimeStepErrorController::register_accepted_error(const double normalized_error)
+{
+  second_to_last_error = last_error;
+  last_error           = normalized_error;
+}
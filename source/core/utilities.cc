@@ -4,6 +4,7 @@
 #include <core/revision.h>
 #include <core/utilities.h>
 
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/revision.h>
 
 #if __GNUC__ > 7
@@ -748,6 +749,35 @@ print_version_info(const ConditionalOStream &pcout)
   pcout << std::endl;
 }
 
+unsigned int
+set_number_of_threads(const unsigned int n_threads,
+                      const MPI_Comm     mpi_communicator)
+{
+  unsigned int n_threads_per_process = n_threads;
+  if (n_threads_per_process == 0)
+    {
+      // Share the cores of the node among the MPI processes of the node
+      MPI_Comm node_communicator;
+      const int ierr = MPI_Comm_split_type(
+        mpi_communicator,
+        MPI_COMM_TYPE_SHARED,
+        Utilities::MPI::this_mpi_process(mpi_communicator),
+        MPI_INFO_NULL,
+        &node_communicator);
+      AssertThrowMPI(ierr);
+
+      const unsigned int n_processes_on_node =
+        Utilities::MPI::n_mpi_processes(node_communicator);
+      Utilities::MPI::free_communicator(node_communicator);
+
+      n_threads_per_process =
+        std::max(1U, MultithreadInfo::n_cores() / n_processes_on_node);
+    }
+
+  MultithreadInfo::set_thread_limit(n_threads_per_process);
+  return MultithreadInfo::n_threads();
+}
+
 /**
  * @brief Parse the arguments given to the application
  *
@@ -5,14 +5,24 @@
 
 #include <dem/adaptive_sparse_contacts.h>
 
-#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/base/timer.h>
 
-#include <deal.II/fe/fe_q.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
 
 template <int dim, typename PropertiesIndex>
 AdaptiveSparseContacts<dim, PropertiesIndex>::AdaptiveSparseContacts()
-  : sparse_contacts_enabled(false)
+  : cell_neighbors_are_up_to_date(false)
+  , mobility_status_is_up_to_date(false)
+  , sparse_contacts_enabled(false)
   , advect_particles_enabled(false)
+  , neighbor_lists_wall_time(0.)
+  , criteria_wall_time(0.)
+  , ghost_exchange_wall_time(0.)
+  , propagation_wall_time(0.)
 {}
 
 template <int dim, typename PropertiesIndex>
@@ -24,104 +34,174 @@ AdaptiveSparseContacts<dim, PropertiesIndex>::update_local_and_ghost_cell_set(
     return;
 
   local_and_ghost_cells.clear();
+  cell_positions.assign(background_dh.get_triangulation().n_active_cells(),
+                        numbers::invalid_unsigned_int);
   for (const auto &cell : background_dh.active_cell_iterators())
     {
       if (cell->is_locally_owned() || cell->is_ghost())
-        local_and_ghost_cells.insert(cell);
+        {
+          cell_positions[cell->active_cell_index()] =
+            local_and_ghost_cells.size();
+          local_and_ghost_cells.push_back(cell);
+        }
     }
+
+  // The cells were redistributed, the neighbor lists and the mobility status
+  // are identified from scratch
+  cell_criteria.clear();
+  cell_neighbors_are_up_to_date = false;
+  mobility_status_is_up_to_date = false;
 }
 
 template <int dim, typename PropertiesIndex>
-void
+std::pair<double, double>
 AdaptiveSparseContacts<dim, PropertiesIndex>::
   calculate_granular_temperature_and_solid_fraction(
-    const Particles::ParticleHandler<dim> &particle_handler,
-    const std::set<typename DoFHandler<dim>::active_cell_iterator>
-                   &local_and_ghost_cells_with_particles,
-    Vector<double> &granular_temperature_average,
-    Vector<double> &solid_fractions)
+    const Particles::ParticleHandler<dim>                 &particle_handler,
+    const typename DoFHandler<dim>::active_cell_iterator &cell) const
 {
-  // Iterating through the active cells in cell set with particles
-  for (const auto &cell : local_and_ghost_cells_with_particles)
+  // Particles in the cell
+  auto particles_in_cell = particle_handler.particles_in_cell(cell);
+  const unsigned int n_particles_in_cell =
+    particle_handler.n_particles_in_cell(cell);
+
+  // Initialize variables for solid fraction computation
+  double       solid_volume = 0.0;
+  const double cell_volume  = cell->measure();
+
+  // Initialize variables for granular temperature computation
+  double         granular_temperature_cell = 0.0;
+  Tensor<1, dim> velocity_cell_average;
+  Tensor<1, dim> cell_velocity_fluctuation_squared_average;
+
+  // First loop over particles in cell to compute the sum of particle velocity
+  // and the solid volume of the current cell
+  for (auto particles_in_cell_iterator = particles_in_cell.begin();
+       particles_in_cell_iterator != particles_in_cell.end();
+       ++particles_in_cell_iterator)
     {
-      // Particles in the cell
-      auto particles_in_cell = particle_handler.particles_in_cell(cell);
-      const unsigned int n_particles_in_cell =
-        particle_handler.n_particles_in_cell(cell);
-
-      // Initialize variables for solid fraction computation
-      double       solid_fraction = 0.0;
-      double       solid_volume   = 0.0;
-      const double cell_volume    = cell->measure();
-
-      // Initialize variables for granular temperature computation
-      double         granular_temperature_cell = 0.0;
-      Tensor<1, dim> velocity_cell_average;
-      Tensor<1, dim> cell_velocity_fluctuation_squared_average;
-
-      // First loop over particles in cell to compute the sum of
-      // particle velocity and the solid volume of the current cell
-      for (auto particles_in_cell_iterator = particles_in_cell.begin();
-           particles_in_cell_iterator != particles_in_cell.end();
-           ++particles_in_cell_iterator)
-        {
-          // Get particle properties
-          auto particle_properties =
-            particles_in_cell_iterator->get_properties();
-          const double dp = particle_properties[PropertiesIndex::dp];
-
-          for (int d = 0; d < dim; ++d)
-            {
-              // Get the particle velocity component (v_x, v_y & v_z if dim = 3)
-              int v_axis = PropertiesIndex::v_x + d;
+      // Get particle properties
+      auto particle_properties = particles_in_cell_iterator->get_properties();
+      const double dp = particle_properties[PropertiesIndex::dp];
 
-              // Add the velocity component value
-              velocity_cell_average[d] += particle_properties[v_axis];
-            }
+      for (int d = 0; d < dim; ++d)
+        {
+          // Get the particle velocity component (v_x, v_y & v_z if dim = 3)
+          int v_axis = PropertiesIndex::v_x + d;
 
-          solid_volume += M_PI * Utilities::fixed_power<dim>(dp) / (2.0 * dim);
+          // Add the velocity component value
+          velocity_cell_average[d] += particle_properties[v_axis];
         }
 
-      // Calculate average velocity in the cell (sum/n_particles)
-      velocity_cell_average /= n_particles_in_cell;
+      solid_volume += M_PI * Utilities::fixed_power<dim>(dp) / (2.0 * dim);
+    }
 
-      // Calculate solid fraction of cell
-      solid_fraction = solid_volume / cell_volume;
+  // Calculate average velocity in the cell (sum/n_particles)
+  velocity_cell_average /= n_particles_in_cell;
 
-      // Second loop over particle to compute the sum of the cell velocity
-      // fluctuations
-      for (auto particles_in_cell_iterator = particles_in_cell.begin();
-           particles_in_cell_iterator != particles_in_cell.end();
-           ++particles_in_cell_iterator)
-        {
-          auto particle_properties =
-            particles_in_cell_iterator->get_properties();
+  // Second loop over particle to compute the sum of the cell velocity
+  // fluctuations
+  for (auto particles_in_cell_iterator = particles_in_cell.begin();
+       particles_in_cell_iterator != particles_in_cell.end();
+       ++particles_in_cell_iterator)
+    {
+      auto particle_properties = particles_in_cell_iterator->get_properties();
 
-          for (int d = 0; d < dim; ++d)
-            {
-              // Get the particle velocity component (v_x, v_y & v_z if dim = 3)
-              int v_axis = PropertiesIndex::v_x + d;
+      for (int d = 0; d < dim; ++d)
+        {
+          // Get the particle velocity component (v_x, v_y & v_z if dim = 3)
+          int v_axis = PropertiesIndex::v_x + d;
 
-              cell_velocity_fluctuation_squared_average[d] +=
-                Utilities::fixed_power<2>(particle_properties[v_axis] -
-                                          velocity_cell_average[d]);
-            }
+          cell_velocity_fluctuation_squared_average[d] +=
+            Utilities::fixed_power<2>(particle_properties[v_axis] -
+                                      velocity_cell_average[d]);
         }
+    }
 
-      // Calculate average granular temperature in the cell
-      for (int d = 0; d < dim; ++d)
+  // Calculate average granular temperature in the cell
+  for (int d = 0; d < dim; ++d)
+    {
+      cell_velocity_fluctuation_squared_average[d] /= n_particles_in_cell;
+      granular_temperature_cell +=
+        cell_velocity_fluctuation_squared_average[d] / dim;
+    }
+
+  return std::make_pair(granular_temperature_cell, solid_volume / cell_volume);
+}
+
+template <int dim, typename PropertiesIndex>
+void
+AdaptiveSparseContacts<dim, PropertiesIndex>::find_cell_neighbors(
+  const DoFHandler<dim> &background_dh)
+{
+  const unsigned int dofs_per_cell = background_dh.get_fe().n_dofs_per_cell();
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+
+  // Nodes of each cell, including the periodic nodes coinciding with its nodes
+  std::vector<std::vector<types::global_dof_index>> cell_nodes(
+    local_and_ghost_cells.size());
+  std::unordered_map<types::global_dof_index, std::vector<unsigned int>>
+    cells_at_node;
+
+  for (unsigned int i = 0; i < local_and_ghost_cells.size(); ++i)
+    {
+      local_and_ghost_cells[i]->get_dof_indices(local_dof_indices);
+      for (const auto node_id : local_dof_indices)
         {
-          cell_velocity_fluctuation_squared_average[d] /= n_particles_in_cell;
-          granular_temperature_cell +=
-            cell_velocity_fluctuation_squared_average[d] / dim;
+          cell_nodes[i].push_back(node_id);
+          auto it = periodic_node_ids.find(node_id);
+          if (it != periodic_node_ids.end())
+            cell_nodes[i].push_back(it->second);
         }
 
-      // Store the average granular temperature and solid fraction with
-      // active cell index
-      granular_temperature_average[cell->active_cell_index()] =
-        granular_temperature_cell;
-      solid_fractions[cell->active_cell_index()] = solid_fraction;
+      for (const auto node_id : cell_nodes[i])
+        cells_at_node[node_id].push_back(i);
+    }
+
+  // Gather the cells sharing a node with each cell, without repetition
+  cell_neighbor_offsets.assign(1, 0);
+  cell_neighbors.clear();
+  std::vector<unsigned int> neighbors;
+  for (unsigned int i = 0; i < local_and_ghost_cells.size(); ++i)
+    {
+      neighbors.clear();
+      for (const auto node_id : cell_nodes[i])
+        for (const unsigned int j : cells_at_node[node_id])
+          if (j != i)
+            neighbors.push_back(j);
+
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                      neighbors.end());
+
+      cell_neighbors.insert(cell_neighbors.end(),
+                            neighbors.begin(),
+                            neighbors.end());
+      cell_neighbor_offsets.push_back(cell_neighbors.size());
     }
+
+  cell_neighbors_are_up_to_date = true;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+AdaptiveSparseContacts<dim, PropertiesIndex>::exchange_ghost_cell_flags(
+  const DoFHandler<dim>     &background_dh,
+  std::vector<std::uint8_t> &flags) const
+{
+  if (Utilities::MPI::n_mpi_processes(background_dh.get_communicator()) == 1)
+    return;
+
+  GridTools::exchange_cell_data_to_ghosts<std::uint8_t, DoFHandler<dim>>(
+    background_dh,
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell) {
+      return std::optional<std::uint8_t>(
+        flags[cell_positions[cell->active_cell_index()]]);
+    },
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        const std::uint8_t                                    &flag) {
+      flags[cell_positions[cell->active_cell_index()]] = flag;
+    });
 }
 
 template <int dim, typename PropertiesIndex>
@@ -129,48 +209,119 @@ void
 AdaptiveSparseContacts<dim, PropertiesIndex>::identify_mobility_status(
   const DoFHandler<dim>                 &background_dh,
   const Particles::ParticleHandler<dim> &particle_handler,
-  const unsigned int                     n_active_cells,
   MPI_Comm                               mpi_communicator)
 {
   // If the sparse contacts are not enabled, exit the function
   if (!sparse_contacts_enabled)
     return;
 
-  // Reset cell status containers
-  cell_mobility_status.clear();
-
   // Reset all status to mobile if mobility status needs to be reset
   if (DEMActionManager::get_action_manager()->check_mobility_status_reset())
     {
-      for (auto cell : local_and_ghost_cells)
+      cell_mobility_status.clear();
+      for (const auto &cell : local_and_ghost_cells)
+        cell_mobility_status.insert(
+          {cell->active_cell_index(), mobility_status::mobile});
+
+      mobility_status_is_up_to_date = false;
+      return;
+    }
+
+  Timer timer;
+
+  if (!cell_neighbors_are_up_to_date)
+    {
+      find_cell_neighbors(background_dh);
+      neighbor_lists_wall_time += timer.wall_time();
+      timer.restart();
+    }
+
+  // Evaluate the criterion of each cell. Only whether the ghost cells are
+  // empty is required, the other criteria of the ghost cells are received
+  // from their owner through the mobility flags.
+  const unsigned int n_cells           = local_and_ghost_cells.size();
+  bool               criterion_changed = (cell_criteria.size() != n_cells);
+  cell_criteria.resize(n_cells, cell_criterion::no_particles);
+
+  for (unsigned int i = 0; i < n_cells; ++i)
+    {
+      const auto  &cell      = local_and_ghost_cells[i];
+      std::uint8_t criterion = cell_criterion::settled;
+
+      if (particle_handler.n_particles_in_cell(cell) == 0)
+        criterion = cell_criterion::no_particles;
+      else if (cell->is_locally_owned())
         {
-          assign_mobility_status(cell->active_cell_index(),
-                                 mobility_status::mobile);
+          const auto [granular_temperature, solid_fraction] =
+            calculate_granular_temperature_and_solid_fraction(particle_handler,
+                                                              cell);
+          if (granular_temperature > granular_temperature_threshold ||
+              solid_fraction < solid_fraction_threshold)
+            criterion = cell_criterion::agitated;
         }
 
-      return;
+      criterion_changed |= (criterion != cell_criteria[i]);
+      cell_criteria[i] = criterion;
+    }
+
+  // The mobility status only depend on the criteria, so they are kept if no
+  // criterion changed on any process
+  criterion_changed =
+    Utilities::MPI::logical_or(criterion_changed, mpi_communicator);
+  criteria_wall_time += timer.wall_time();
+  timer.restart();
+
+  if (!criterion_changed && mobility_status_is_up_to_date)
+    return;
+
+  // Flag the locally owned cells that are mobile by criteria: agitated cells
+  // or cells next to an empty cell. The empty cells are not mobile.
+  std::vector<std::uint8_t> mobile_by_criteria(n_cells, 0);
+  for (unsigned int i = 0; i < n_cells; ++i)
+    {
+      if (!local_and_ghost_cells[i]->is_locally_owned() ||
+          cell_criteria[i] == cell_criterion::no_particles)
+        continue;
+
+      bool is_mobile = (cell_criteria[i] == cell_criterion::agitated);
+      for (unsigned int n = cell_neighbor_offsets[i];
+           n < cell_neighbor_offsets[i + 1] && !is_mobile;
+           ++n)
+        is_mobile = (cell_criteria[cell_neighbors[n]] ==
+                     cell_criterion::no_particles);
+
+      mobile_by_criteria[i] = is_mobile;
     }
+  propagation_wall_time += timer.wall_time();
+  timer.restart();
+
+  exchange_ghost_cell_flags(background_dh, mobile_by_criteria);
+  ghost_exchange_wall_time += timer.wall_time();
+  timer.restart();
 
-  // Get a copy of the active & ghost cells set to iterate over and remove cell
-  // of the set when the mobility status is known. It avoids unnecessary
-  // iteration for next loops. We don't want to modify the original set since
-  // it is only updated when there's load balancing or reading of checkpoints.
-  auto local_and_ghost_cells_copy = local_and_ghost_cells;
+  // Flag the locally owned cells that are mobile, either by criteria or by
+  // neighbor (additional mobile layer). The empty cells are not mobile.
+  std::vector<std::uint8_t> mobile(n_cells, 0);
+  for (unsigned int i = 0; i < n_cells; ++i)
+    {
+      if (!local_and_ghost_cells[i]->is_locally_owned() ||
+          cell_criteria[i] == cell_criterion::no_particles)
+        continue;
 
-  // Create dummy dofs for background dof handler for the mobility_at_nodes
-  const FE_Q<dim>    fe(1);
-  const unsigned int dofs_per_cell = fe.dofs_per_cell;
+      bool is_mobile = mobile_by_criteria[i];
+      for (unsigned int n = cell_neighbor_offsets[i];
+           n < cell_neighbor_offsets[i + 1] && !is_mobile;
+           ++n)
+        is_mobile = mobile_by_criteria[cell_neighbors[n]];
 
-  // Get locally owned and relevant dofs
-  const IndexSet &locally_owned_dofs = background_dh.locally_owned_dofs();
-  IndexSet        locally_relevant_dofs =
-    DoFTools::extract_locally_relevant_dofs(background_dh);
+      mobile[i] = is_mobile;
+    }
+  propagation_wall_time += timer.wall_time();
+  timer.restart();
 
-  // Reinit all value of mobility at nodes as inactive
-  mobility_at_nodes.reinit(locally_owned_dofs,
-                           locally_relevant_dofs,
-                           mpi_communicator);
-  mobility_at_nodes = 0;
+  exchange_ghost_cell_flags(background_dh, mobile);
+  ghost_exchange_wall_time += timer.wall_time();
+  timer.restart();
 
   // If the advection of particles setting is enabled (useful for CFD-DEM),
   // mobility status are different: inactive and static_active status are
@@ -186,175 +337,70 @@ AdaptiveSparseContacts<dim, PropertiesIndex>::identify_mobility_status(
                                       mobility_status::static_active :
                                       mobility_status::advected_active;
 
-  // Check if the cell is empty (n_particle = 0), if so, nodes and cells are
-  // flagged as empty mobility status
-  for (auto cell = local_and_ghost_cells_copy.begin();
-       cell != local_and_ghost_cells_copy.end();)
-    {
-      // Check if the cell has any particles
-      if (particle_handler.n_particles_in_cell(*cell) == 0)
-        {
-          std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
-          (*cell)->get_dof_indices(local_dof_indices);
-
-          // Assign inactive status to cell and empty status to nodes
-          assign_mobility_status((*cell)->active_cell_index(),
-                                 local_dof_indices,
-                                 mobility_status::inactive,
-                                 mobility_status::empty);
-
-          // Remove cell from cell set and iterate to the following cell,
-          // erase() function returns the next iterator
-          cell = local_and_ghost_cells_copy.erase(cell);
-        }
-      else
-        {
-          // Since erase() is not called, iterator is incremented
-          ++cell;
-        }
-    }
-
-  // Update ghost values of mobility_at_nodes
-  mobility_at_nodes.update_ghost_values();
-
-  // Calculate the average granular temperature and solid fraction for each
-  // cell currently in the local_and_ghost_cells_copy set (empty cells are
-  // already removed)
-  Vector<double> granular_temperature_average(n_active_cells);
-  Vector<double> solid_fractions(n_active_cells);
-  calculate_granular_temperature_and_solid_fraction(
-    particle_handler,
-    local_and_ghost_cells_copy,
-    granular_temperature_average,
-    solid_fractions);
-
-  // Check if the cell is mobile by criteria:
-  // * granular temperature > threshold or
-  // * solid fraction of cell < threshold or
-  // * is next to an empty cell
-  // If so, nodes are flagged and cells are stored with mobile status
-  for (auto cell = local_and_ghost_cells_copy.begin();
-       cell != local_and_ghost_cells_copy.end();)
+  // Assign the status: empty cells are inactive, the cells next to a mobile
+  // cell are active and the remaining cells are inactive. The neighbors of the
+  // ghost cells are not all known, but the ghost cells only interact with the
+  // locally owned cells, so the ghost cells with particles that are not mobile
+  // are active.
+  cell_mobility_status.clear();
+  for (unsigned int i = 0; i < n_cells; ++i)
     {
-      const unsigned int cell_id = (*cell)->active_cell_index();
-      std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
-      (*cell)->get_dof_indices(local_dof_indices);
-
-      // Check if the cell has any empty neighbor cell by the value at nodes
-      bool has_empty_node = false;
-      for (auto node_id : local_dof_indices)
-        {
-          if (mobility_at_nodes(node_id) == mobility_status::empty)
-            {
-              has_empty_node = true;
-              break; // No need to check other nodes
-            }
-        }
-
-      // Check if the cell is mobile by criteria (granular temperature, solid
-      // fraction, next to empty cell)
-      if (granular_temperature_average[cell_id] >
-            granular_temperature_threshold ||
-          solid_fractions[cell_id] < solid_fraction_threshold || has_empty_node)
-        {
-          // Assign mobile status to cell and nodes
-          assign_mobility_status(cell_id,
-                                 local_dof_indices,
-                                 mobility_status::mobile,
-                                 mobility_status::mobile);
-
-          // Remove cell from cell set
-          cell = local_and_ghost_cells_copy.erase(cell);
-        }
+      const auto  &cell   = local_and_ghost_cells[i];
+      unsigned int status = inactive_status;
+
+      if (cell_criteria[i] == cell_criterion::no_particles)
+        status = mobility_status::inactive;
+      else if (mobile[i])
+        status = mobility_status::mobile;
+      else if (cell->is_ghost())
+        status = active_status;
       else
         {
-          ++cell;
-        }
-    }
-
-  mobility_at_nodes.update_ghost_values();
-
-  // Check if the cell is mobile by neighbor (at least a node is flagged as
-  // mobile from previous check), this is the additional mobile layer.
-  // If so, cells are stored in map as mobile status and nodes that are not
-  // mobile are flagged as active
-  for (auto cell = local_and_ghost_cells_copy.begin();
-       cell != local_and_ghost_cells_copy.end();)
-    {
-      std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
-      (*cell)->get_dof_indices(local_dof_indices);
-
-      // Check if the cell has any mobile nodes by the value at nodes
-      bool has_mobile_node = false;
-      for (auto node_id : local_dof_indices)
-        {
-          if (mobility_at_nodes(node_id) == mobility_status::mobile)
+          for (unsigned int n = cell_neighbor_offsets[i];
+               n < cell_neighbor_offsets[i + 1];
+               ++n)
             {
-              has_mobile_node = true;
-              break;
+              if (mobile[cell_neighbors[n]])
+                {
+                  status = active_status;
+                  break;
+                }
             }
         }
 
-      if (has_mobile_node)
-        {
-          // Assign mobile status to cell and active to nodes
-          assign_mobility_status((*cell)->active_cell_index(),
-                                 local_dof_indices,
-                                 mobility_status::mobile,
-                                 active_status);
-
-          // Remove cell from cell set and iterate to the following cell
-          cell = local_and_ghost_cells_copy.erase(cell);
-        }
-      else
-        {
-          ++cell;
-        }
+      cell_mobility_status.insert({cell->active_cell_index(), status});
     }
+  propagation_wall_time += timer.wall_time();
 
-  mobility_at_nodes.update_ghost_values();
+  mobility_status_is_up_to_date = true;
+}
 
-  // Check if the cell is active (at least a node is flagged as active from
-  // previous check), this is the layer of active cells
-  // If so, cells are stored with active status in the map
-  for (auto cell = local_and_ghost_cells_copy.begin();
-       cell != local_and_ghost_cells_copy.end();)
+template <int dim, typename PropertiesIndex>
+std::vector<std::pair<std::string, statistics>>
+AdaptiveSparseContacts<dim, PropertiesIndex>::
+  calculate_mobility_timing_statistics(MPI_Comm mpi_communicator) const
+{
+  const std::vector<std::pair<std::string, double>> wall_times = {
+    {"Mobility neighbor lists (s)", neighbor_lists_wall_time},
+    {"Mobility criteria (s)", criteria_wall_time},
+    {"Mobility ghost exchange (s)", ghost_exchange_wall_time},
+    {"Mobility propagation (s)", propagation_wall_time}};
+
+  std::vector<std::pair<std::string, statistics>> timing_statistics;
+  for (const auto &[name, wall_time] : wall_times)
     {
-      std::vector<types::global_dof_index> local_dofs_indices(dofs_per_cell);
-      (*cell)->get_dof_indices(local_dofs_indices);
-
-      // Check if cell has active nodes
-      bool has_active_nodes = false;
-      for (auto node_id : local_dofs_indices)
-        {
-          if (mobility_at_nodes(node_id) == (int)active_status)
-            {
-              has_active_nodes = true;
-              break;
-            }
-        }
-
-      if (has_active_nodes)
-        {
-          // Assign active status to cell (no need to assign active to nodes)
-          assign_mobility_status((*cell)->active_cell_index(), active_status);
-          cell = local_and_ghost_cells_copy.erase(cell);
-        }
-      else
-        {
-          ++cell;
-        }
+      const Utilities::MPI::MinMaxAvg min_max_avg =
+        Utilities::MPI::min_max_avg(wall_time, mpi_communicator);
+
+      statistics stats;
+      stats.min     = min_max_avg.min;
+      stats.max     = min_max_avg.max;
+      stats.total   = min_max_avg.sum;
+      stats.average = min_max_avg.avg;
+      timing_statistics.emplace_back(name, stats);
     }
 
-  // Store the inactive cells in the map, those are all the remaining cells
-  // in the local & ghost cells set
-  for (auto cell = local_and_ghost_cells_copy.begin();
-       cell != local_and_ghost_cells_copy.end();
-       ++cell)
-    {
-      // Assign inactive status to cell in map
-      assign_mobility_status((*cell)->active_cell_index(), inactive_status);
-    }
+  return timing_statistics;
 }
 
 template <int dim, typename PropertiesIndex>
@@ -51,6 +51,12 @@ DEMSolver<dim, PropertiesIndex>::DEMSolver(
   , background_dh(triangulation)
   , size_distribution_object_container(
       parameters.lagrangian_physical_properties.particle_type_number)
+  , time_averaging_object(triangulation)
+  , reduced_ghost_update(mpi_communicator)
+  , multi_rate_control(parameters.model_parameters.multiple_time_stepping ?
+                         parameters.model_parameters.coarse_time_step_ratio :
+                         1,
+                       parameters.model_parameters.coarse_diameter_threshold)
 {}
 
 template <int dim, typename PropertiesIndex>
@@ -93,7 +99,8 @@ DEMSolver<dim, PropertiesIndex>::setup_parameters()
   load_balancing.copy_references(simulation_control,
                                  triangulation,
                                  particle_handler,
-                                 sparse_contacts_object);
+                                 sparse_contacts_object,
+                                 contact_manager);
   load_balancing.connect_weight_signals();
 
   // Set the adaptive sparse contacts parameters
@@ -105,6 +112,9 @@ DEMSolver<dim, PropertiesIndex>::setup_parameters()
         parameters.model_parameters.advect_particles);
     }
 
+  // Set the time averaging parameters of the cell-based fields
+  time_averaging_object.set_parameters(parameters.post_processing);
+
   // Set the distribution type and initialize the neighborhood threshold
   setup_distribution_type();
 
@@ -221,6 +231,12 @@ DEMSolver<dim, PropertiesIndex>::setup_functions_and_pointers()
   integrator_object = set_integrator_type();
   particle_particle_contact_force_object =
     set_particle_particle_contact_force_model<dim, PropertiesIndex>(parameters);
+
+  // The contacts between coarse particles use a larger time step (if multiple
+  // time stepping enabled)
+  if (parameters.model_parameters.multiple_time_stepping)
+    particle_particle_contact_force_object->set_coarse_diameter_threshold(
+      multi_rate_control.get_coarse_diameter_threshold());
   particle_wall_contact_force_object =
     set_particle_wall_contact_force_model<dim, PropertiesIndex>(parameters);
 }
@@ -274,12 +290,20 @@ DEMSolver<dim, PropertiesIndex>::setup_triangulation_dependent_parameters()
   // cell size - largest particle radius) and (security factor * (blob
   // diameter - 1) * the largest particle radius). This value is used in
   // find_contact_detection_frequency function
+  // With the hierarchical grid broad search, the neighborhood of each pair is
+  // sized by the diameters of its particles, so the smallest particle is used.
+  const double neighborhood_particle_diameter =
+    (parameters.model_parameters.broad_search_method ==
+     Parameters::Lagrangian::ModelParameters<
+       dim>::BroadSearchMethod::hierarchical_grid) ?
+      find_minimum_particle_diameter(size_distribution_object_container) :
+      maximum_particle_diameter;
   smallest_contact_search_criterion =
     std::min((GridTools::minimal_cell_diameter(triangulation) -
               maximum_particle_diameter * 0.5),
              (parameters.model_parameters.dynamic_contact_search_factor *
               (parameters.model_parameters.neighborhood_threshold - 1) *
-              maximum_particle_diameter * 0.5));
+              neighborhood_particle_diameter * 0.5));
 
   // Find the smallest cell size and use this as the floating mesh mapping
   // criterion. The edge case comes when the cell are completely square/cubic.
@@ -310,8 +334,21 @@ DEMSolver<dim, PropertiesIndex>::setup_triangulation_dependent_parameters()
   particle_particle_contact_force_object->set_periodic_offset(
     periodic_boundaries_object.get_periodic_offset_distance());
 
+  // Set the parameters of the particle-particle broad search
+  contact_manager.set_broad_search_parameters(
+    parameters.model_parameters.broad_search_method,
+    parameters.model_parameters.neighborhood_threshold,
+    maximum_particle_diameter,
+    parameters.model_parameters.broad_search_verbosity,
+    mpi_communicator);
+
   // Set up the local and ghost cells (if ASC enabled)
   sparse_contacts_object.update_local_and_ghost_cell_set(background_dh);
+
+  // Set up the time-averaged fields (if time averaging enabled). When
+  // restarting, they were already set up while reading the checkpoint.
+  if (!action_manager->check_restart_simulation())
+    time_averaging_object.setup_dofs();
 }
 
 template <int dim, typename PropertiesIndex>
@@ -364,12 +401,19 @@ DEMSolver<dim, PropertiesIndex>::load_balance()
   // load
   particle_handler.prepare_for_coarsening_and_refinement();
 
+  // Prepare the time-averaged fields for the repartitioning (if time
+  // averaging enabled)
+  time_averaging_object.prepare_for_mesh_repartitioning();
+
   pcout << "-->Repartitioning triangulation" << std::endl;
   triangulation.repartition();
 
   // Unpack the particle handler after the mesh has been repartitioned
   particle_handler.unpack_after_coarsening_and_refinement();
 
+  // Recover the time-averaged fields (if time averaging enabled)
+  time_averaging_object.post_mesh_repartitioning();
+
   // If PBC are enabled, update the periodic cells
   periodic_boundaries_object.map_periodic_cells(
     triangulation, periodic_boundaries_cells_information);
@@ -553,6 +597,18 @@ template <int dim, typename PropertiesIndex>
 void
 DEMSolver<dim, PropertiesIndex>::finish_simulation()
 {
+  // Write the time-averaged fields accumulated over the whole simulation
+  // (if time averaging enabled and not already written at the last iteration)
+  if (!time_averaging_object.is_output_iteration(
+        simulation_control->get_step_number()))
+    time_averaging_object.write_output_results(
+      parameters.simulation_control.output_folder,
+      parameters.simulation_control.output_name,
+      simulation_control->get_current_time(),
+      simulation_control->get_step_number(),
+      parameters.simulation_control.group_files,
+      mpi_communicator);
+
   // Timer output
   if (parameters.timer.type == Parameters::Timer::Type::end)
     this->computing_timer.print_summary();
@@ -695,6 +751,30 @@ DEMSolver<dim, PropertiesIndex>::post_process_results()
                                          mpi_communicator,
                                          sparse_contacts_object);
     }
+
+  // Accumulate the time-averaged fields (if time averaging enabled)
+  if (time_averaging_object.is_sampling_iteration(
+        simulation_control->get_step_number(),
+        simulation_control->get_current_time()))
+    {
+      TimerOutput::Scope t(this->computing_timer, "Time averaging");
+      time_averaging_object.sample(
+        particle_handler,
+        contact_manager.get_local_adjacent_particles(),
+        contact_manager.get_ghost_adjacent_particles());
+    }
+
+  if (time_averaging_object.is_output_iteration(
+        simulation_control->get_step_number()))
+    {
+      time_averaging_object.write_output_results(
+        parameters.simulation_control.output_folder,
+        parameters.simulation_control.output_name,
+        simulation_control->get_current_time(),
+        simulation_control->get_step_number(),
+        parameters.simulation_control.group_files,
+        mpi_communicator);
+    }
 }
 
 template <int dim, typename PropertiesIndex>
@@ -735,6 +815,13 @@ DEMSolver<dim, PropertiesIndex>::report_statistics()
                                   DEM::dem_statistic_variable::omega>(
       particle_handler, mpi_communicator);
 
+  // Wall time spent in the identification of the mobility status
+  std::vector<std::pair<std::string, statistics>> mobility_timing;
+  if (action_manager->check_sparse_contacts_enabled())
+    mobility_timing =
+      sparse_contacts_object.calculate_mobility_timing_statistics(
+        mpi_communicator);
+
   if (this_mpi_process == 0)
     {
       TableHandler report;
@@ -757,6 +844,8 @@ DEMSolver<dim, PropertiesIndex>::report_statistics()
       add_statistics_to_table_handler("Rotational kinetic energy",
                                       rotational_kinetic_energy,
                                       report);
+      for (const auto &[name, stats] : mobility_timing)
+        add_statistics_to_table_handler(name, stats, report);
 
 
 
@@ -784,6 +873,11 @@ DEMSolver<dim, PropertiesIndex>::sort_particles_into_subdomains_and_cells()
   // Exchange ghost particles
   particle_handler.exchange_ghost_particles(true);
 
+  // Rebuild the lists of the particles of the reduced ghost update, since the
+  // exchange invalidates the iterators to the particles
+  if (parameters.model_parameters.reduced_ghost_update)
+    reduced_ghost_update.setup(particle_handler);
+
   // Resize the displacement, force and torque containers only if the particles
   // have changed subdomains
   if (action_manager->check_resize_containers())
@@ -838,6 +932,7 @@ DEMSolver<dim, PropertiesIndex>::solve()
                   particle_handler,
                   insertion_object,
                   solid_surfaces,
+                  time_averaging_object,
                   checkpoint_controller);
 
   // Set up the various parameters that need the triangulation
@@ -918,7 +1013,6 @@ DEMSolver<dim, PropertiesIndex>::solve()
           sparse_contacts_object.identify_mobility_status(
             background_dh,
             particle_handler,
-            triangulation.n_active_cells(),
             mpi_communicator);
 
           // Execute broad search by filling containers of particle-particle
@@ -959,21 +1053,84 @@ DEMSolver<dim, PropertiesIndex>::solve()
           // Updating number of contact builds
           contact_build_number++;
         }
+      else if (parameters.model_parameters.overlap_ghost_update)
+        {
+          // The update is completed after the calculation of the local-local
+          // contact forces
+          if (parameters.model_parameters.reduced_ghost_update)
+            reduced_ghost_update.update_start();
+          else
+            particle_handler.update_ghost_particles_start();
+        }
+      else if (parameters.model_parameters.reduced_ghost_update)
+        {
+          reduced_ghost_update.update();
+        }
       else
         {
           particle_handler.update_ghost_particles();
         }
 
-      // Particle-particle contact force
-      particle_particle_contact_force_object
-        ->calculate_particle_particle_contact(
-          contact_manager.get_local_adjacent_particles(),
-          contact_manager.get_ghost_adjacent_particles(),
-          contact_manager.get_local_local_periodic_adjacent_particles(),
-          contact_manager.get_local_ghost_periodic_adjacent_particles(),
-          contact_manager.get_ghost_local_periodic_adjacent_particles(),
-          simulation_control->get_time_step(),
-          contact_outcome);
+      // Particle-particle contact force. The computational time of the
+      // force calculation and of the integration is measured for the
+      // load balancing (if measured cost load balancing enabled)
+      // The heat transfer of the contacts is only calculated at the
+      // iterations where the temperature is integrated (DEM multiphysics)
+      const bool thermal_iteration =
+        (simulation_control->get_step_number() %
+           parameters.model_parameters.thermal_time_step_ratio ==
+         0);
+      if constexpr (std::is_same_v<PropertiesIndex,
+                                   DEM::DEMMPProperties::PropertiesIndex>)
+        {
+          particle_particle_contact_force_object
+            ->set_heat_transfer_calculation(thermal_iteration);
+          particle_wall_contact_force_object->set_heat_transfer_calculation(
+            thermal_iteration);
+        }
+
+      load_balancing.start_cost_measurement();
+      particle_particle_contact_force_object->set_coarse_pair_time_step_ratio(
+        multi_rate_control.get_coarse_pair_time_step_ratio());
+      if (parameters.model_parameters.overlap_ghost_update)
+        {
+          particle_particle_contact_force_object
+            ->calculate_local_particle_particle_contact(
+              contact_manager.get_local_adjacent_particles(),
+              contact_manager.get_local_local_periodic_adjacent_particles(),
+              simulation_control->get_time_step(),
+              contact_outcome);
+
+          if (!action_manager->check_contact_search())
+            {
+              if (parameters.model_parameters.reduced_ghost_update)
+                reduced_ghost_update.update_finish();
+              else
+                particle_handler.update_ghost_particles_finish();
+            }
+
+          particle_particle_contact_force_object
+            ->calculate_ghost_particle_particle_contact(
+              contact_manager.get_ghost_adjacent_particles(),
+              contact_manager.get_local_ghost_periodic_adjacent_particles(),
+              contact_manager.get_ghost_local_periodic_adjacent_particles(),
+              simulation_control->get_time_step(),
+              contact_outcome);
+        }
+      else
+        {
+          particle_particle_contact_force_object
+            ->calculate_particle_particle_contact(
+              contact_manager.get_local_adjacent_particles(),
+              contact_manager.get_ghost_adjacent_particles(),
+              contact_manager.get_local_local_periodic_adjacent_particles(),
+              contact_manager.get_local_ghost_periodic_adjacent_particles(),
+              contact_manager.get_ghost_local_periodic_adjacent_particles(),
+              simulation_control->get_time_step(),
+              contact_outcome);
+        }
+      multi_rate_control.iterate();
+      load_balancing.stop_cost_measurement();
 
       // Update the boundary points and vectors (if grid motion)
       // We have to update the positions of the points on boundary faces and
@@ -994,22 +1151,32 @@ DEMSolver<dim, PropertiesIndex>::solve()
       update_temperature_solid_objects();
 
       // Particle-wall contact force
+      load_balancing.start_cost_measurement();
       particle_wall_contact_force();
-
-      // Integration of temperature for multiphysic DEM
+      load_balancing.stop_cost_measurement();
+
+      // Integration of temperature for multiphysic DEM. The temperature is
+      // integrated over the thermal time step, which is a multiple of the DEM
+      // time step. The heat transfer rate of the current iteration is
+      // considered constant over the thermal time step, it is not accumulated
+      // over the skipped iterations since the thermal resistances of the
+      // contacts are not calculated on them
       if constexpr (std::is_same_v<PropertiesIndex,
                                    DEM::DEMMPProperties::PropertiesIndex>)
         {
-          integrate_temperature<dim, PropertiesIndex>(
-            particle_handler,
-            simulation_control->get_time_step(),
-            contact_outcome.heat_transfer_rate,
-            std::vector<double>(force.size()));
+          if (thermal_iteration)
+            integrate_temperature<dim, PropertiesIndex>(
+              particle_handler,
+              simulation_control->get_time_step() *
+                parameters.model_parameters.thermal_time_step_ratio,
+              contact_outcome.heat_transfer_rate,
+              std::vector<double>(force.size()));
         }
 
       // Integration of force and velocity for new location of particles
       // The half step is calculated at the first iteration
 
+      load_balancing.start_cost_measurement();
       if (!disable_position_integration)
         {
           if (simulation_control->get_step_number() == 0)
@@ -1034,6 +1201,7 @@ DEMSolver<dim, PropertiesIndex>::solve()
                                            sparse_contacts_object);
             }
         }
+      load_balancing.stop_cost_measurement();
 
       // Visualization
       if (simulation_control->is_output_iteration())
@@ -1084,6 +1252,7 @@ DEMSolver<dim, PropertiesIndex>::solve()
                            particle_handler,
                            insertion_object,
                            solid_surfaces,
+                           time_averaging_object,
                            pcout,
                            mpi_communicator,
                            checkpoint_controller);
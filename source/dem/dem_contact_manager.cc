@@ -11,6 +11,10 @@
 #include <dem/update_fine_search_candidates.h>
 #include <dem/update_local_particle_containers.h>
 
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+
 
 using namespace DEM;
 
@@ -243,9 +247,52 @@ DEMContactManager<dim, PropertiesIndex>::execute_particle_particle_broad_search(
 {
   auto *action_manager = DEMActionManager::get_action_manager();
 
+  Timer timer;
+
   // Check if sparse contacts are enabled to use proper broad search functions
-  // The first broad search is the default one for sparse contacts
-  if (action_manager->use_default_broad_search_functions())
+  // The first broad search is the default one for sparse contacts. The
+  // linked-cell and hierarchical grid searches are only available without
+  // sparse contacts since the mobility status of the particles is stored per
+  // cell.
+  if (!action_manager->check_sparse_contacts_enabled() &&
+      broad_search_method != Parameters::Lagrangian::ModelParameters<
+                               dim>::BroadSearchMethod::cell_neighbors)
+    {
+      if (broad_search_method == Parameters::Lagrangian::ModelParameters<
+                                   dim>::BroadSearchMethod::hierarchical_grid)
+        find_particle_particle_hierarchical_grid_contact_pairs<dim,
+                                                               PropertiesIndex>(
+          particle_handler,
+          neighborhood_threshold,
+          hierarchical_grid,
+          local_contact_pair_candidates,
+          ghost_contact_pair_candidates);
+      else
+        find_particle_particle_linked_cell_contact_pairs<dim>(
+          particle_handler,
+          neighborhood_diameter,
+          linked_cell_grid,
+          local_contact_pair_candidates,
+          ghost_contact_pair_candidates);
+
+      // The periodic candidates of the hierarchical grid are found with the
+      // neighborhood of the largest particle and filtered by the fine search
+      if (action_manager->check_periodic_boundaries_enabled())
+        {
+          find_particle_particle_linked_cell_periodic_contact_pairs<dim>(
+            particle_handler,
+            cells_local_periodic_neighbor_list,
+            cells_ghost_periodic_neighbor_list,
+            cells_ghost_local_periodic_neighbor_list,
+            periodic_offset,
+            neighborhood_diameter,
+            linked_cell_grid,
+            local_contact_pair_periodic_candidates,
+            ghost_contact_pair_periodic_candidates,
+            ghost_local_contact_pair_periodic_candidates);
+        }
+    }
+  else if (action_manager->use_default_broad_search_functions())
     {
       find_particle_particle_contact_pairs<dim>(particle_handler,
                                                 cells_local_neighbor_list,
@@ -287,6 +334,44 @@ DEMContactManager<dim, PropertiesIndex>::execute_particle_particle_broad_search(
             sparse_contacts_object);
         }
     }
+
+  if (broad_search_verbosity == Parameters::Verbosity::verbose)
+    {
+      timer.stop();
+      print_particle_particle_broad_search_statistics(timer.wall_time());
+    }
+}
+
+template <int dim, typename PropertiesIndex>
+void
+DEMContactManager<dim, PropertiesIndex>::
+  print_particle_particle_broad_search_statistics(const double wall_time) const
+{
+  auto count_candidates =
+    [](const typename dem_data_structures<dim>::particle_particle_candidates
+         &contact_pair_candidates) {
+      unsigned long n_candidates = 0;
+      for (const auto &[id, candidates] : contact_pair_candidates)
+        n_candidates += candidates.size();
+      return n_candidates;
+    };
+
+  const unsigned long n_local_candidates =
+    count_candidates(local_contact_pair_candidates) +
+    count_candidates(ghost_contact_pair_candidates) +
+    count_candidates(local_contact_pair_periodic_candidates) +
+    count_candidates(ghost_contact_pair_periodic_candidates) +
+    count_candidates(ghost_local_contact_pair_periodic_candidates);
+
+  const unsigned long n_candidates =
+    Utilities::MPI::sum(n_local_candidates, mpi_communicator);
+  const double maximum_wall_time =
+    Utilities::MPI::max(wall_time, mpi_communicator);
+
+  ConditionalOStream pcout(
+    std::cout, Utilities::MPI::this_mpi_process(mpi_communicator) == 0);
+  pcout << "Particle-particle broad search: " << n_candidates
+        << " candidate pairs in " << maximum_wall_time << " s" << std::endl;
 }
 
 template <int dim, typename PropertiesIndex>
@@ -398,44 +483,62 @@ void
 DEMContactManager<dim, PropertiesIndex>::execute_particle_particle_fine_search(
   const double neighborhood_threshold)
 {
+  // The hierarchical grid sizes the neighborhood of each pair with the
+  // diameters of its particles, both in the broad and the fine searches. This
+  // is only the case without sparse contacts, which use the cell broad search.
+  const bool use_pair_threshold =
+    broad_search_method == Parameters::Lagrangian::ModelParameters<
+                             dim>::BroadSearchMethod::hierarchical_grid &&
+    !DEMActionManager::get_action_manager()->check_sparse_contacts_enabled();
+
+  auto fine_search =
+    [&](typename dem_data_structures<dim>::adjacent_particle_pairs
+          &adjacent_particles,
+        const typename dem_data_structures<dim>::particle_particle_candidates
+                             &contact_pair_candidates,
+        const Tensor<1, dim> &offset) {
+      if (use_pair_threshold)
+        particle_particle_polydisperse_fine_search<dim, PropertiesIndex>(
+          particle_container,
+          adjacent_particles,
+          contact_pair_candidates,
+          this->neighborhood_threshold,
+          offset);
+      else
+        particle_particle_fine_search<dim>(particle_container,
+                                           adjacent_particles,
+                                           contact_pair_candidates,
+                                           neighborhood_threshold,
+                                           offset);
+    };
+
   // Fine search for local particle-particle
-  particle_particle_fine_search<dim>(particle_container,
-                                     local_adjacent_particles,
-                                     local_contact_pair_candidates,
-                                     neighborhood_threshold);
+  fine_search(local_adjacent_particles,
+              local_contact_pair_candidates,
+              Tensor<1, dim>());
 
   // Fine search for ghost particle-particle
-  particle_particle_fine_search<dim>(particle_container,
-                                     ghost_adjacent_particles,
-                                     ghost_contact_pair_candidates,
-                                     neighborhood_threshold);
+  fine_search(ghost_adjacent_particles,
+              ghost_contact_pair_candidates,
+              Tensor<1, dim>());
 
   if (DEMActionManager::get_action_manager()
         ->check_periodic_boundaries_enabled())
     {
       // Fine search for local-local periodic particle-particle
-      particle_particle_fine_search<dim>(
-        particle_container,
-        local_local_periodic_adjacent_particles,
-        local_contact_pair_periodic_candidates,
-        neighborhood_threshold,
-        periodic_offset);
+      fine_search(local_local_periodic_adjacent_particles,
+                  local_contact_pair_periodic_candidates,
+                  periodic_offset);
 
       // Fine search for local-ghost periodic particle-particle
-      particle_particle_fine_search<dim>(
-        particle_container,
-        local_ghost_periodic_adjacent_particles,
-        ghost_contact_pair_periodic_candidates,
-        neighborhood_threshold,
-        periodic_offset);
+      fine_search(local_ghost_periodic_adjacent_particles,
+                  ghost_contact_pair_periodic_candidates,
+                  periodic_offset);
 
       // Fine search for ghost-local periodic particle-particle
-      particle_particle_fine_search<dim>(
-        particle_container,
-        ghost_local_periodic_adjacent_particles,
-        ghost_local_contact_pair_periodic_candidates,
-        neighborhood_threshold,
-        periodic_offset);
+      fine_search(ghost_local_periodic_adjacent_particles,
+                  ghost_local_contact_pair_periodic_candidates,
+                  periodic_offset);
     }
 }
 
@@ -7,6 +7,7 @@
 
 #include <deal.II/lac/lapack_full_matrix.h>
 
+#include <cstdint>
 #include <numbers>
 #include <numeric>
 Distribution::Distribution(
@@ -16,6 +17,25 @@ Distribution::Distribution(
   , dia_max_cutoff(0)
 {}
 
+void
+Distribution::particle_size_sampling_from_ids(
+  const unsigned int                        prn_seed,
+  const std::vector<types::particle_index> &particle_ids)
+{
+  this->particle_sizes.clear();
+  this->particle_sizes.reserve(particle_ids.size());
+
+  for (const types::particle_index id : particle_ids)
+    {
+      const std::uint64_t id_64 = static_cast<std::uint64_t>(id);
+      std::seed_seq       seeds{static_cast<std::uint32_t>(prn_seed),
+                                static_cast<std::uint32_t>(id_64),
+                                static_cast<std::uint32_t>(id_64 >> 32)};
+      std::mt19937        generator(seeds);
+      this->particle_sizes.push_back(sample_diameter(generator));
+    }
+}
+
 NormalDistribution::NormalDistribution(
   const double                    &d_average,
   const double                    &d_standard_deviation,
@@ -187,6 +207,19 @@ NormalDistribution::particle_size_sampling(
     }
 }
 
+double
+NormalDistribution::sample_diameter(std::mt19937 &generator)
+{
+  std::normal_distribution<> distribution{diameter_average, standard_deviation};
+
+  double diameter;
+  do
+    diameter = distribution(generator);
+  while (diameter <= this->dia_min_cutoff || diameter >= this->dia_max_cutoff);
+
+  return diameter;
+}
+
 double
 NormalDistribution::find_min_diameter()
 {
@@ -305,6 +338,19 @@ LogNormalDistribution::particle_size_sampling(
     }
 }
 
+double
+LogNormalDistribution::sample_diameter(std::mt19937 &generator)
+{
+  std::lognormal_distribution<> distribution{mu_ln, sigma_ln};
+
+  double diameter;
+  do
+    diameter = distribution(generator);
+  while (diameter <= this->dia_min_cutoff || diameter >= this->dia_max_cutoff);
+
+  return diameter;
+}
+
 double
 LogNormalDistribution::find_min_diameter()
 {
@@ -360,6 +406,13 @@ UniformDistribution::particle_size_sampling(
     this->particle_sizes.push_back(this->diameter_value);
 }
 
+double
+UniformDistribution::sample_diameter(std::mt19937 &generator)
+{
+  (void)generator;
+  return this->diameter_value;
+}
+
 double
 UniformDistribution::find_min_diameter()
 {
@@ -629,26 +682,33 @@ CustomDistribution::particle_size_sampling(
 {
   this->particle_sizes.clear();
   this->particle_sizes.reserve(number_of_particles);
-  unsigned int n_created_diameter = 0;
 
+  for (unsigned int n = 0; n < number_of_particles; ++n)
+    this->particle_sizes.push_back(sample_diameter(gen));
+}
+
+double
+CustomDistribution::sample_diameter(std::mt19937 &generator)
+{
   // We sample a random number U between [0, CDF_max]
   // CDF_max is 1.0, but using .back() is safer for floating point precision.
   std::uniform_real_distribution<> dis(0.0, number_based_cdf.back() - 1e-12);
-  if (interpolate_diameter_values)
+  while (true)
     {
-      while (n_created_diameter < number_of_particles)
-        {
-          // Number between 0. and 1.
-          const double u_global = dis(gen);
+      // Number between 0. and 1.
+      const double u_global = dis(generator);
 
-          // Find the first element in the CDF strictly greater than our random
-          // number u_global. 'it' will point to the upper bound of the bin
-          // (node i+1).
-          auto it = std::ranges::upper_bound(number_based_cdf, u_global);
+      // Find the first element in the CDF strictly greater than our random
+      // number u_global. 'it' will point to the upper bound of the bin
+      // (node i+1).
+      auto it = std::ranges::upper_bound(number_based_cdf, u_global);
 
-          const unsigned int index_high =
-            static_cast<unsigned int>(it - number_based_cdf.begin());
+      const unsigned int index_high =
+        static_cast<unsigned int>(it - number_based_cdf.begin());
 
+      double sampled_diameter;
+      if (interpolate_diameter_values)
+        {
           // Interpolated Sampling (Piece-wise Linear)
           const unsigned int index_low = index_high - 1;
 
@@ -665,43 +725,20 @@ CustomDistribution::particle_size_sampling(
           const double inv_d_low2  = 1.0 / (d_low * d_low);
           const double inv_d_high2 = 1.0 / (d_high * d_high);
 
-          const double sampled_diameter =
+          sampled_diameter =
             1.0 / std::sqrt(inv_d_low2 - u_local * (inv_d_low2 - inv_d_high2));
-
-          if (sampled_diameter > this->dia_min_cutoff &&
-              sampled_diameter < this->dia_max_cutoff)
-            {
-              n_created_diameter++;
-              this->particle_sizes.push_back(sampled_diameter);
-            }
         }
-    }
-  else
-    {
-      while (n_created_diameter < number_of_particles)
+      else
         {
-          // Number between 0. and 1.
-          const double u = dis(gen);
-
-          // Find the first element in the CDF strictly greater than our random
-          // number u_global. 'it' will point to the upper bound of the bin
-          // (node i+1).
-          auto it = std::ranges::upper_bound(number_based_cdf, u);
-
-          const unsigned int index_high =
-            static_cast<unsigned int>(it - number_based_cdf.begin());
-
           // Discrete Sampling
           // We simply pick the diameter corresponding to the upper bound node
           // and check if it is within the cutoffs.
-          const double sampled_diameter = diameter_values[index_high];
-          if (sampled_diameter > this->dia_min_cutoff &&
-              sampled_diameter < this->dia_max_cutoff)
-            {
-              n_created_diameter++;
-              this->particle_sizes.push_back(sampled_diameter);
-            }
+          sampled_diameter = diameter_values[index_high];
         }
+
+      if (sampled_diameter > this->dia_min_cutoff &&
+          sampled_diameter < this->dia_max_cutoff)
+        return sampled_diameter;
     }
 }
 
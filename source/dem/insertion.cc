@@ -65,11 +65,12 @@ Insertion<dim, PropertiesIndex>::print_insertion_info(
 template <int dim, typename PropertiesIndex>
 void
 Insertion<dim, PropertiesIndex>::assign_particle_properties(
-  const DEMSolverParameters<dim>   &dem_parameters,
-  const unsigned int               &inserted_this_step_this_proc,
-  const unsigned int               &current_inserting_particle_type,
-  const std::vector<Point<dim>>    &insertion_points,
-  std::vector<std::vector<double>> &particle_properties)
+  const DEMSolverParameters<dim>           &dem_parameters,
+  const unsigned int                       &inserted_this_step_this_proc,
+  const unsigned int                       &current_inserting_particle_type,
+  const std::vector<Point<dim>>            &insertion_points,
+  std::vector<std::vector<double>>         &particle_properties,
+  const std::vector<types::particle_index> &particle_ids)
 {
   // Clearing and resizing particle_properties
   particle_properties.reserve(inserted_this_step_this_proc);
@@ -78,8 +79,13 @@ Insertion<dim, PropertiesIndex>::assign_particle_properties(
   // TODO: MAYBE CHANGE THE INPUT TO PHYSICAL PROPERTIES DIRECTLY
   auto physical_properties = dem_parameters.lagrangian_physical_properties;
 
-  distributions_objects[current_inserting_particle_type]
-    ->particle_size_sampling(inserted_this_step_this_proc);
+  if (particle_ids.empty())
+    distributions_objects[current_inserting_particle_type]
+      ->particle_size_sampling(inserted_this_step_this_proc);
+  else
+    distributions_objects[current_inserting_particle_type]
+      ->particle_size_sampling_from_ids(
+        dem_parameters.insertion_info.seed_for_insertion, particle_ids);
 
   // A loop is defined over the number of particles which are going to be
   // inserted at this step
@@ -5,8 +5,29 @@
 
 #include <dem/insertion_file.h>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
 using namespace DEM;
 
+namespace
+{
+  // Identifier at the beginning of the binary input files
+  constexpr char binary_file_identifier[] = "LETHEDEM";
+
+  // Size of the header of the binary input files: identifier (8 bytes),
+  // number of particles and number of columns (unsigned 64-bit integers)
+  constexpr unsigned int binary_file_header_size = 24;
+
+  // Columns of the binary input files, in the order in which they are stored.
+  // The temperature is only stored for multiphysic DEM simulations
+  const std::array<std::string, 11> binary_file_columns = {
+    {"p_x", "p_y", "p_z", "v_x", "v_y", "v_z", "w_x", "w_y", "w_z",
+     "diameters", "T"}};
+} // namespace
+
 template <int dim, typename PropertiesIndex>
 InsertionFile<dim, PropertiesIndex>::InsertionFile(
   const std::vector<std::shared_ptr<Distribution>>
@@ -53,87 +74,235 @@ InsertionFile<dim, PropertiesIndex>::insert(
           this->remove_particles_in_box(particle_handler);
         }
 
-      // Read the input file
-      std::map<std::string, std::vector<double>> particles_data;
-      fill_vectors_from_file(particles_data,
-                             insertion_files.at(current_file_id),
-                             ";");
+      const std::string &insertion_file = insertion_files.at(current_file_id);
       current_file_id++;
       current_file_id = current_file_id % number_of_files;
 
-      // Number of particles in the file
-      unsigned int n_total_particles_to_insert = particles_data["p_x"].size();
+      MPI_Comm communicator = triangulation.get_mpi_communicator();
 
-      // Adjusting the value in case we exceed the maximum number of particle in
-      // the simulation.
-      n_total_particles_to_insert =
-        std::min(remaining_particles_of_each_type, n_total_particles_to_insert);
+      // Obtain global bounding boxes
+      const auto my_bounding_box =
+        GridTools::compute_mesh_predicate_bounding_box(
+          triangulation, IteratorFilters::LocallyOwnedCell());
+      const auto global_bounding_boxes =
+        Utilities::MPI::all_gather(communicator, my_bounding_box);
 
-      // Processor 0 will be the only one inserting particles
-      MPI_Comm communicator = triangulation.get_mpi_communicator();
-      auto this_mpi_process = Utilities::MPI::this_mpi_process(communicator);
-      const unsigned int n_particles_to_insert_this_proc =
-        this_mpi_process == 0 ? n_total_particles_to_insert : 0;
+      unsigned int n_total_particles_to_insert;
+      if (dem_parameters.insertion_info.insertion_file_format ==
+          Parameters::Lagrangian::InsertionInfo<
+            dim>::InsertionFileFormat::binary)
+        {
+          n_total_particles_to_insert =
+            insert_from_binary_file(particle_handler,
+                                    insertion_file,
+                                    global_bounding_boxes,
+                                    dem_parameters,
+                                    communicator);
+        }
+      else
+        {
+          n_total_particles_to_insert =
+            insert_from_text_file(particle_handler,
+                                  insertion_file,
+                                  global_bounding_boxes,
+                                  dem_parameters,
+                                  communicator);
+        }
 
-      std::vector<Point<dim>> insertion_points_on_proc_this_step;
-      insertion_points_on_proc_this_step.reserve(
-        n_particles_to_insert_this_proc);
+      // Update number of particle remaining to be inserted
+      remaining_particles_of_each_type -= n_total_particles_to_insert;
 
-      if (this_mpi_process == 0)
+
+      ConditionalOStream pcout(
+        std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+      this->print_insertion_info(n_total_particles_to_insert,
+                                 remaining_particles_of_each_type,
+                                 this->current_inserting_particle_type,
+                                 pcout);
+    }
+}
+
+template <int dim, typename PropertiesIndex>
+unsigned int
+InsertionFile<dim, PropertiesIndex>::insert_from_text_file(
+  Particles::ParticleHandler<dim>                  &particle_handler,
+  const std::string                                &file_name,
+  const std::vector<std::vector<BoundingBox<dim>>> &global_bounding_boxes,
+  const DEMSolverParameters<dim>                   &dem_parameters,
+  const MPI_Comm                                    communicator)
+{
+  // Read the input file
+  std::map<std::string, std::vector<double>> particles_data;
+  fill_vectors_from_file(particles_data, file_name, ";");
+
+  // Number of particles in the file
+  unsigned int n_total_particles_to_insert = particles_data["p_x"].size();
+
+  // Adjusting the value in case we exceed the maximum number of particle in
+  // the simulation.
+  n_total_particles_to_insert =
+    std::min(remaining_particles_of_each_type, n_total_particles_to_insert);
+
+  // Processor 0 will be the only one inserting particles
+  auto this_mpi_process = Utilities::MPI::this_mpi_process(communicator);
+  const unsigned int n_particles_to_insert_this_proc =
+    this_mpi_process == 0 ? n_total_particles_to_insert : 0;
+
+  std::vector<Point<dim>> insertion_points_on_proc_this_step;
+  insertion_points_on_proc_this_step.reserve(n_particles_to_insert_this_proc);
+
+  if (this_mpi_process == 0)
+    {
+      for (unsigned int p = 0; p < n_particles_to_insert_this_proc; ++p)
         {
-          for (unsigned int p = 0; p < n_particles_to_insert_this_proc; ++p)
+          if constexpr (dim == 2)
+            {
+              insertion_points_on_proc_this_step.emplace_back(Point<dim>(
+                {particles_data["p_x"][p], particles_data["p_y"][p]}));
+            }
+
+          if constexpr (dim == 3)
             {
-              if constexpr (dim == 2)
-                {
-                  insertion_points_on_proc_this_step.emplace_back(Point<dim>(
-                    {particles_data["p_x"][p], particles_data["p_y"][p]}));
-                }
-
-              if constexpr (dim == 3)
-                {
-                  insertion_points_on_proc_this_step.emplace_back(
-                    Point<dim>({particles_data["p_x"][p],
-                                particles_data["p_y"][p],
-                                particles_data["p_z"][p]}));
-                }
+              insertion_points_on_proc_this_step.emplace_back(
+                Point<dim>({particles_data["p_x"][p],
+                            particles_data["p_y"][p],
+                            particles_data["p_z"][p]}));
             }
         }
+    }
 
-      // Obtain global bounding boxes
-      const auto my_bounding_box =
-        GridTools::compute_mesh_predicate_bounding_box(
-          triangulation, IteratorFilters::LocallyOwnedCell());
-      const auto global_bounding_boxes =
-        Utilities::MPI::all_gather(communicator, my_bounding_box);
+  // A vector of vectors, which contains all the properties of all particles
+  // about to get inserted
+  std::vector<std::vector<double>> particle_properties;
 
-      // A vector of vectors, which contains all the properties of all particles
-      // about to get inserted
-      std::vector<std::vector<double>> particle_properties;
+  // Assign inserted particles properties
+  this->assign_particle_properties_for_file_insertion(
+    dem_parameters,
+    n_particles_to_insert_this_proc,
+    particles_data,
+    particle_properties);
+
+  // Insert the particles using the points and assigned properties
+  particle_handler.insert_global_particles(insertion_points_on_proc_this_step,
+                                           global_bounding_boxes,
+                                           particle_properties);
+
+  return n_total_particles_to_insert;
+}
 
-      // Assign inserted particles properties
+template <int dim, typename PropertiesIndex>
+unsigned int
+InsertionFile<dim, PropertiesIndex>::insert_from_binary_file(
+  Particles::ParticleHandler<dim>                  &particle_handler,
+  const std::string                                &file_name,
+  const std::vector<std::vector<BoundingBox<dim>>> &global_bounding_boxes,
+  const DEMSolverParameters<dim>                   &dem_parameters,
+  const MPI_Comm                                    communicator)
+{
+  MPI_File file;
+  int      ierr = MPI_File_open(
+    communicator, file_name.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+  AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(file_name));
+
+  // Read the header: identifier, number of particles and number of columns
+  std::array<char, binary_file_header_size> header;
+  ierr = MPI_File_read_at_all(
+    file, 0, header.data(), header.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  AssertThrow(std::memcmp(header.data(), binary_file_identifier, 8) == 0,
+              ExcMessage("The file " + file_name +
+                         " is not a binary particle input file."));
+  std::uint64_t n_particles_in_file, n_columns;
+  std::memcpy(&n_particles_in_file, header.data() + 8, sizeof(std::uint64_t));
+  std::memcpy(&n_columns, header.data() + 16, sizeof(std::uint64_t));
+
+  const unsigned int n_required_columns =
+    std::is_same_v<PropertiesIndex, DEM::DEMMPProperties::PropertiesIndex> ?
+      11 :
+      10;
+  AssertThrow(n_columns >= n_required_columns &&
+                n_columns <= binary_file_columns.size(),
+              ExcMessage("The binary particle input file " + file_name +
+                         " has " + std::to_string(n_columns) +
+                         " columns, while " +
+                         std::to_string(n_required_columns) +
+                         " columns are required."));
+
+  // Each process reads a chunk of consecutive particles per round. The
+  // particles are then sent to the processes owning them by the insertion
+  const std::uint64_t chunk_size =
+    dem_parameters.insertion_info.insertion_file_chunk_size;
+  AssertThrow(chunk_size * n_columns <=
+                static_cast<std::uint64_t>(std::numeric_limits<int>::max()),
+              ExcMessage("The input file chunk size is too large."));
+
+  // Adjusting the value in case we exceed the maximum number of particle in
+  // the simulation.
+  const std::uint64_t n_total_particles_to_insert =
+    std::min<std::uint64_t>(remaining_particles_of_each_type,
+                            n_particles_in_file);
+
+  const std::uint64_t this_mpi_process =
+    Utilities::MPI::this_mpi_process(communicator);
+  const std::uint64_t n_particles_per_round =
+    chunk_size * Utilities::MPI::n_mpi_processes(communicator);
+
+  std::vector<double> chunk;
+  for (std::uint64_t first_particle_of_round = 0;
+       first_particle_of_round < n_total_particles_to_insert;
+       first_particle_of_round += n_particles_per_round)
+    {
+      const std::uint64_t first_particle =
+        std::min(first_particle_of_round + this_mpi_process * chunk_size,
+                 n_total_particles_to_insert);
+      const unsigned int n_particles_to_insert_this_proc =
+        std::min(first_particle + chunk_size, n_total_particles_to_insert) -
+        first_particle;
+
+      // The particles are stored as consecutive rows of doubles
+      chunk.resize(n_particles_to_insert_this_proc * n_columns);
+      ierr = MPI_File_read_at_all(file,
+                                  binary_file_header_size +
+                                    first_particle * n_columns * sizeof(double),
+                                  chunk.data(),
+                                  chunk.size(),
+                                  MPI_DOUBLE,
+                                  MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      std::map<std::string, std::vector<double>> particles_data;
+      for (unsigned int c = 0; c < n_columns; ++c)
+        {
+          std::vector<double> &column = particles_data[binary_file_columns[c]];
+          column.resize(n_particles_to_insert_this_proc);
+          for (unsigned int p = 0; p < n_particles_to_insert_this_proc; ++p)
+            column[p] = chunk[p * n_columns + c];
+        }
+
+      std::vector<Point<dim>> insertion_points_on_proc_this_step(
+        n_particles_to_insert_this_proc);
+      for (unsigned int p = 0; p < n_particles_to_insert_this_proc; ++p)
+        for (unsigned int d = 0; d < dim; ++d)
+          insertion_points_on_proc_this_step[p][d] = chunk[p * n_columns + d];
+
+      std::vector<std::vector<double>> particle_properties;
       this->assign_particle_properties_for_file_insertion(
         dem_parameters,
         n_particles_to_insert_this_proc,
         particles_data,
         particle_properties);
 
-      // Insert the particles using the points and assigned properties
       particle_handler.insert_global_particles(
         insertion_points_on_proc_this_step,
         global_bounding_boxes,
         particle_properties);
+    }
 
-      // Update number of particle remaining to be inserted
-      remaining_particles_of_each_type -= n_total_particles_to_insert;
-
+  ierr = MPI_File_close(&file);
+  AssertThrowMPI(ierr);
 
-      ConditionalOStream pcout(
-        std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
-      this->print_insertion_info(n_total_particles_to_insert,
-                                 remaining_particles_of_each_type,
-                                 this->current_inserting_particle_type,
-                                 pcout);
-    }
+  return n_total_particles_to_insert;
 }
 
 template <int dim, typename PropertiesIndex>
@@ -5,6 +5,8 @@
 
 #include <dem/insertion_volume.h>
 
+#include <array>
+
 using namespace DEM;
 
 // The constructor of volume insertion class. In the constructor, we
@@ -53,15 +55,17 @@ InsertionVolume<dim, PropertiesIndex>::insert(
   // not
   if (particles_of_each_type_remaining != 0)
     {
-      if (this->removing_particles_in_region)
+      if (this->mark_for_update)
         {
-          if (this->mark_for_update)
-            {
-              this->find_cells_in_removing_box(triangulation);
-              this->mark_for_update = false;
-            }
-          this->remove_particles_in_box(particle_handler);
+          if (this->removing_particles_in_region)
+            this->find_cells_in_removing_box(triangulation);
+          if (dem_parameters.insertion_info.local_insertion)
+            find_cells_in_insertion_box(triangulation,
+                                        dem_parameters.insertion_info);
+          this->mark_for_update = false;
         }
+      if (this->removing_particles_in_region)
+        this->remove_particles_in_box(particle_handler);
 
       MPI_Comm           communicator = triangulation.get_mpi_communicator();
       ConditionalOStream pcout(
@@ -78,6 +82,22 @@ InsertionVolume<dim, PropertiesIndex>::insert(
       this->inserted_this_step =
         std::min(particles_of_each_type_remaining, this->inserted_this_step);
 
+      // Every process inserts the particles located in its locally owned cells
+      // without any communication (if local insertion enabled)
+      if (dem_parameters.insertion_info.local_insertion)
+        {
+          insert_in_locally_owned_cells(particle_handler, dem_parameters);
+
+          // Updating remaining particles
+          particles_of_each_type_remaining -= this->inserted_this_step;
+
+          this->print_insertion_info(this->inserted_this_step,
+                                     particles_of_each_type_remaining,
+                                     current_inserting_particle_type,
+                                     pcout);
+          return;
+        }
+
       // Obtaining global bounding boxes
       const auto my_bounding_box =
         GridTools::compute_mesh_predicate_bounding_box(
@@ -164,6 +184,233 @@ InsertionVolume<dim, PropertiesIndex>::insert(
     }
 }
 
+// Find the locally owned cells that may contain an insertion point. The
+// insertion points are shifted by at most the maximum offset times the maximum
+// diameter toward the first corner of the insertion box
+template <int dim, typename PropertiesIndex>
+void
+InsertionVolume<dim, PropertiesIndex>::find_cells_in_insertion_box(
+  const parallel::distributed::Triangulation<dim>  &triangulation,
+  const Parameters::Lagrangian::InsertionInfo<dim> &insertion_information)
+{
+  cells_in_insertion_box.clear();
+
+  Point<dim> box_lower_corner, box_upper_corner;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      box_lower_corner[d] = insertion_information.insertion_box_point_1[d] -
+                            insertion_information.insertion_maximum_offset *
+                              this->maximum_diameter;
+      box_upper_corner[d] = insertion_information.insertion_box_point_2[d];
+    }
+  const BoundingBox<dim> insertion_box(
+    std::make_pair(box_lower_corner, box_upper_corner));
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      if (cell->is_locally_owned() &&
+          cell->bounding_box().get_neighbor_type(insertion_box) !=
+            NeighborType::not_neighbors)
+        cells_in_insertion_box.push_back(cell);
+    }
+}
+
+// Insert the particles whose insertion points are located in the locally owned
+// cells. The insertion point, the random offsets and the id of a particle only
+// depend on its index in the insertion lattice, thus the inserted particles do
+// not depend on the partition of the triangulation
+template <int dim, typename PropertiesIndex>
+void
+InsertionVolume<dim, PropertiesIndex>::insert_in_locally_owned_cells(
+  Particles::ParticleHandler<dim> &particle_handler,
+  const DEMSolverParameters<dim>  &dem_parameters)
+{
+  const auto &insertion_information = dem_parameters.insertion_info;
+
+  // Random offsets of all the insertion points of this step
+  std::vector<double> random_number_vector;
+  random_number_vector.reserve(this->inserted_this_step);
+  create_random_number_container(random_number_vector,
+                                 this->inserted_this_step,
+                                 insertion_information.insertion_maximum_offset,
+                                 insertion_information.seed_for_insertion);
+
+  // Number of insertion points in each direction of the direction sequence.
+  // The number of points in the last direction is bounded by the number of
+  // particles inserted at this step
+  std::array<unsigned int, dim> axis, n_points;
+  unsigned int                  n_points_in_first_directions = 1;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      axis[d] = insertion_information.direction_sequence.at(d);
+      if (d < dim - 1)
+        {
+          n_points[d] = this->number_of_particles_directions[axis[d]];
+          n_points_in_first_directions *= n_points[d];
+        }
+      else
+        n_points[d] =
+          (this->inserted_this_step + n_points_in_first_directions - 1) /
+          n_points_in_first_directions;
+    }
+
+  const double spacing =
+    insertion_information.distance_threshold * this->maximum_diameter;
+  const double maximum_offset =
+    insertion_information.insertion_maximum_offset * this->maximum_diameter;
+
+  std::vector<Point<dim>> insertion_points_on_proc;
+  std::vector<typename Triangulation<dim>::active_cell_iterator>
+                                     insertion_cells_on_proc;
+  std::vector<types::particle_index> insertion_ids_on_proc;
+
+  Point<dim> insertion_location;
+  for (const auto &cell : cells_in_insertion_box)
+    {
+      // Range of the insertion points that may be located in the cell in
+      // each direction
+      const BoundingBox<dim>        cell_box = cell->bounding_box();
+      std::array<unsigned int, dim> first_index, last_index;
+      bool                          empty_range = false;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          const double lower_index =
+            (cell_box.lower_bound(axis[d]) - this->axis_min[axis[d]]) /
+              spacing -
+            0.5 - 1e-10;
+          const double upper_index =
+            (cell_box.upper_bound(axis[d]) - this->axis_min[axis[d]] +
+             maximum_offset) /
+              spacing -
+            0.5 + 1e-10;
+
+          if (upper_index < 0 || lower_index > n_points[d] - 1.)
+            {
+              empty_range = true;
+              break;
+            }
+          first_index[d] =
+            static_cast<unsigned int>(std::ceil(std::max(lower_index, 0.)));
+          last_index[d] = std::min(static_cast<unsigned int>(upper_index),
+                                   n_points[d] - 1);
+          if (first_index[d] > last_index[d])
+            {
+              empty_range = true;
+              break;
+            }
+        }
+      if (empty_range)
+        continue;
+
+      std::array<unsigned int, dim> index = first_index;
+      while (true)
+        {
+          unsigned int id = index[dim - 1];
+          for (int d = dim - 2; d >= 0; --d)
+            id = id * n_points[d] + index[d];
+
+          if (id < this->inserted_this_step)
+            {
+              find_insertion_location_volume(
+                insertion_location,
+                id,
+                random_number_vector[id],
+                random_number_vector[this->inserted_this_step - id - 1],
+                insertion_information);
+
+              if (cell->point_inside(insertion_location) &&
+                  is_insertion_cell(cell, insertion_location))
+                {
+                  insertion_points_on_proc.push_back(insertion_location);
+                  insertion_cells_on_proc.push_back(cell);
+                  insertion_ids_on_proc.push_back(id);
+                }
+            }
+
+          // Move to the next insertion point of the range, the first direction
+          // varying fastest
+          unsigned int d = 0;
+          for (; d < dim; ++d)
+            {
+              if (index[d] < last_index[d])
+                {
+                  ++index[d];
+                  break;
+                }
+              index[d] = first_index[d];
+            }
+          if (d == dim)
+            break;
+        }
+    }
+
+  this->inserted_this_step_this_proc = insertion_points_on_proc.size();
+
+  // The ids of the particles inserted at this step follow the next free
+  // particle index, which is the same on all the processes
+  const types::particle_index first_id =
+    particle_handler.get_next_free_particle_index();
+  for (auto &id : insertion_ids_on_proc)
+    id += first_id;
+
+  // The diameters are sampled from the particle ids, so that they do not
+  // depend on the partition either
+  std::vector<std::vector<double>> particle_properties;
+  this->assign_particle_properties(dem_parameters,
+                                   this->inserted_this_step_this_proc,
+                                   current_inserting_particle_type,
+                                   insertion_points_on_proc,
+                                   particle_properties,
+                                   insertion_ids_on_proc);
+
+  for (unsigned int i = 0; i < this->inserted_this_step_this_proc; ++i)
+    {
+      Point<dim> ref_point;
+      particle_handler.insert_particle(insertion_points_on_proc[i],
+                                       ref_point,
+                                       insertion_ids_on_proc[i],
+                                       insertion_cells_on_proc[i],
+                                       particle_properties[i]);
+    }
+}
+
+// A point located on a face shared by two cells is only inserted in the cell
+// with the lowest id, so that it is inserted once regardless of the partition
+template <int dim, typename PropertiesIndex>
+bool
+InsertionVolume<dim, PropertiesIndex>::is_insertion_cell(
+  const typename Triangulation<dim>::active_cell_iterator &cell,
+  const Point<dim>                                        &insertion_location)
+{
+  for (const unsigned int face_id : cell->face_indices())
+    {
+      if (cell->at_boundary(face_id))
+        continue;
+
+      const auto neighbor = cell->neighbor(face_id);
+      if (neighbor->is_active())
+        {
+          if (neighbor->id() < cell->id() &&
+              neighbor->point_inside(insertion_location))
+            return false;
+        }
+      else
+        {
+          for (unsigned int subface_id = 0;
+               subface_id < cell->face(face_id)->n_children();
+               ++subface_id)
+            {
+              const auto neighbor_child =
+                cell->neighbor_child_on_subface(face_id, subface_id);
+              if (neighbor_child->id() < cell->id() &&
+                  neighbor_child->point_inside(insertion_location))
+                return false;
+            }
+        }
+    }
+  return true;
+}
+
 // This function assigns the insertion points of the inserted particles
 template <int dim, typename PropertiesIndex>
 void
@@ -0,0 +1,466 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <core/dem_properties.h>
+#include <core/solutions_output.h>
+
+#include <dem/lagrangian_time_averaging.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+
+#include <deal.II/numerics/data_out.h>
+
+#include <fstream>
+
+template <int dim, typename PropertiesIndex>
+LagrangianTimeAveraging<dim, PropertiesIndex>::LagrangianTimeAveraging(
+  const parallel::distributed::Triangulation<dim> &triangulation)
+  : time_averaging_enabled(false)
+  , sampling_frequency(1)
+  , output_frequency(0)
+  , initial_time(0.)
+  , n_samples(0)
+  , triangulation(triangulation)
+  , fe(FE_DGQ<dim>(0), n_fields + 1)
+  , dof_handler(triangulation)
+{}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::set_parameters(
+  const Parameters::Lagrangian::LagrangianPostProcessing &post_processing)
+{
+  time_averaging_enabled = post_processing.time_averaging_enabled;
+  sampling_frequency     = post_processing.time_averaging_sampling_frequency;
+  output_frequency       = post_processing.time_averaging_output_frequency;
+  initial_time           = post_processing.time_averaging_initial_time;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::reinit_vectors()
+{
+  const MPI_Comm mpi_communicator = triangulation.get_mpi_communicator();
+  const IndexSet locally_owned_dofs = dof_handler.locally_owned_dofs();
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler);
+
+  running_means.reinit(locally_owned_dofs, mpi_communicator);
+  running_squared_deviations.reinit(locally_owned_dofs, mpi_communicator);
+  running_means_with_ghost_cells.reinit(locally_owned_dofs,
+                                        locally_relevant_dofs,
+                                        mpi_communicator);
+  running_squared_deviations_with_ghost_cells.reinit(locally_owned_dofs,
+                                                     locally_relevant_dofs,
+                                                     mpi_communicator);
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::setup_dofs()
+{
+  if (!time_averaging_enabled)
+    return;
+
+  dof_handler.distribute_dofs(fe);
+  reinit_vectors();
+  n_samples = 0;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::sample(
+  const Particles::ParticleHandler<dim> &particle_handler,
+  const typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+    &local_adjacent_particles,
+  const typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+    &ghost_adjacent_particles)
+{
+  if (!time_averaging_enabled)
+    return;
+
+  ++n_samples;
+
+  // Count the particle-particle contacts (positive overlap) of the particles
+  // located in the locally owned cells. The neighborhood lists already
+  // contain all the pairs that may be in contact, so no search is required.
+  std::vector<unsigned int> contacts_in_cell(triangulation.n_active_cells(),
+                                             0);
+  auto count_contacts =
+    [&](const typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+          &adjacent_particles) {
+      for (const auto &[particle_one_id, adjacent_particles_list] :
+           adjacent_particles)
+        {
+          for (const auto &[particle_two_id, contact_info] :
+               adjacent_particles_list)
+            {
+              const auto &particle_one = contact_info.particle_one;
+              const auto &particle_two = contact_info.particle_two;
+
+              const double radii_sum =
+                0.5 * (particle_one->get_properties()[PropertiesIndex::dp] +
+                       particle_two->get_properties()[PropertiesIndex::dp]);
+
+              if (particle_one->get_location().distance_square(
+                    particle_two->get_location()) >= radii_sum * radii_sum)
+                continue;
+
+              for (const auto &particle : {particle_one, particle_two})
+                {
+                  const auto cell = particle->get_surrounding_cell();
+                  if (cell->is_locally_owned())
+                    contacts_in_cell[cell->active_cell_index()]++;
+                }
+            }
+        }
+    };
+  count_contacts(local_adjacent_particles);
+  count_contacts(ghost_adjacent_particles);
+
+  // Map each component to its local DoF index. With a FE_DGQ(0) base element,
+  // each cell holds a single DoF per component.
+  std::vector<types::global_dof_index> local_dof_indices(fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> component_dof(fe.n_dofs_per_cell());
+
+  // Welford's update of the running mean and of the sum of squared deviations
+  auto update_statistics = [&](const unsigned int component,
+                               const double       value,
+                               const double       n_values) {
+    const types::global_dof_index dof = component_dof[component];
+
+    const double delta = value - running_means(dof);
+    running_means(dof) += delta / n_values;
+    running_squared_deviations(dof) += delta * (value - running_means(dof));
+  };
+
+  // Off-diagonal components of the stress tensor in the order xy, yz, xz
+  constexpr std::array<std::pair<unsigned int, unsigned int>, 3>
+    off_diagonal_components = {{{0, 1}, {1, 2}, {0, 2}}};
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (!cell->is_locally_owned())
+        continue;
+
+      cell->get_dof_indices(local_dof_indices);
+      for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+        component_dof[fe.system_to_component_index(i).first] =
+          local_dof_indices[i];
+
+      const unsigned int n_particles_in_cell =
+        particle_handler.n_particles_in_cell(cell);
+      const double cell_volume = cell->measure();
+
+      double                 solid_volume = 0.;
+      Tensor<2, dim>         kinetic_stress;
+      Tensor<1, dim>         velocity_cell_average;
+      double                 granular_temperature_cell = 0.;
+      Tensor<1, dim>         velocity_fluctuation_squared;
+      constexpr unsigned int n_off_diagonal = dim * (dim - 1) / 2;
+
+      if (n_particles_in_cell > 0)
+        {
+          const auto particles_in_cell =
+            particle_handler.particles_in_cell(cell);
+
+          // First loop over the particles to compute the average velocity
+          // and the solid volume of the cell
+          for (const auto &particle : particles_in_cell)
+            {
+              const auto particle_properties = particle.get_properties();
+              for (int d = 0; d < dim; ++d)
+                velocity_cell_average[d] +=
+                  particle_properties[PropertiesIndex::v_x + d];
+
+              solid_volume +=
+                M_PI *
+                Utilities::fixed_power<dim>(
+                  particle_properties[PropertiesIndex::dp]) /
+                (2.0 * dim);
+            }
+          velocity_cell_average /= n_particles_in_cell;
+
+          // Second loop over the particles to compute the velocity
+          // fluctuations and the kinetic stress
+          for (const auto &particle : particles_in_cell)
+            {
+              const auto particle_properties = particle.get_properties();
+
+              Tensor<1, dim> velocity_fluctuation;
+              for (int d = 0; d < dim; ++d)
+                velocity_fluctuation[d] =
+                  particle_properties[PropertiesIndex::v_x + d] -
+                  velocity_cell_average[d];
+
+              for (int d = 0; d < dim; ++d)
+                velocity_fluctuation_squared[d] +=
+                  Utilities::fixed_power<2>(velocity_fluctuation[d]);
+
+              kinetic_stress += particle_properties[PropertiesIndex::mass] *
+                                outer_product(velocity_fluctuation,
+                                              velocity_fluctuation);
+            }
+
+          for (int d = 0; d < dim; ++d)
+            granular_temperature_cell +=
+              velocity_fluctuation_squared[d] / (dim * n_particles_in_cell);
+          kinetic_stress /= cell_volume;
+
+          // The velocity, the granular temperature and the coordination
+          // number are only averaged over the samples for which the cell is
+          // occupied
+          running_means(component_dof[occupied_samples_component]) += 1.;
+          const double n_occupied_samples =
+            running_means(component_dof[occupied_samples_component]);
+
+          for (unsigned int d = 0; d < dim; ++d)
+            update_statistics(d, velocity_cell_average[d], n_occupied_samples);
+
+          update_statistics(granular_temperature_component,
+                            granular_temperature_cell,
+                            n_occupied_samples);
+
+          update_statistics(
+            coordination_number_component,
+            static_cast<double>(contacts_in_cell[cell->active_cell_index()]) /
+              n_particles_in_cell,
+            n_occupied_samples);
+        }
+
+      // The solid fraction and the kinetic stress are averaged over all the
+      // samples, an empty cell having a zero value
+      update_statistics(solid_fraction_component,
+                        solid_volume / cell_volume,
+                        n_samples);
+
+      for (unsigned int d = 0; d < dim; ++d)
+        update_statistics(kinetic_stress_component + d,
+                          kinetic_stress[d][d],
+                          n_samples);
+
+      for (unsigned int i = 0; i < n_off_diagonal; ++i)
+        {
+          const auto [row, column] = off_diagonal_components[i];
+          update_statistics(kinetic_stress_component + dim + i,
+                            kinetic_stress[row][column],
+                            n_samples);
+        }
+    }
+}
+
+template <int dim, typename PropertiesIndex>
+typename LagrangianTimeAveraging<dim, PropertiesIndex>::VectorType
+LagrangianTimeAveraging<dim, PropertiesIndex>::get_variances() const
+{
+  // Convert the sums of squared deviations into variances
+  VectorType variances(running_squared_deviations);
+  std::vector<types::global_dof_index> local_dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (!cell->is_locally_owned())
+        continue;
+
+      cell->get_dof_indices(local_dof_indices);
+
+      types::global_dof_index occupied_samples_dof = 0;
+      for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+        if (fe.system_to_component_index(i).first ==
+            occupied_samples_component)
+          occupied_samples_dof = local_dof_indices[i];
+
+      const double n_occupied_samples = running_means(occupied_samples_dof);
+
+      for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+        {
+          const unsigned int component = fe.system_to_component_index(i).first;
+          const types::global_dof_index dof = local_dof_indices[i];
+
+          if (component == occupied_samples_component)
+            variances(dof) = n_samples;
+          else if (component == solid_fraction_component ||
+                   component >= kinetic_stress_component)
+            variances(dof) /= n_samples;
+          else
+            variances(dof) =
+              n_occupied_samples > 0 ? variances(dof) / n_occupied_samples : 0.;
+        }
+    }
+
+  return variances;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::write_output_results(
+  const std::string &folder,
+  const std::string &output_name,
+  const double       current_time,
+  const unsigned int step_number,
+  const unsigned int group_files,
+  const MPI_Comm    &mpi_communicator)
+{
+  if (!time_averaging_enabled || n_samples == 0)
+    return;
+
+  running_means_with_ghost_cells              = running_means;
+  running_squared_deviations_with_ghost_cells = get_variances();
+
+  // Name the components of the averaged fields
+  const std::array<std::string, 3> axis_names = {{"x", "y", "z"}};
+  const std::array<std::string, 3> off_diagonal_names = {{"xy", "yz", "xz"}};
+
+  std::vector<std::string> field_names;
+  for (unsigned int d = 0; d < dim; ++d)
+    field_names.emplace_back("velocity_" + axis_names[d]);
+  field_names.emplace_back("granular_temperature");
+  field_names.emplace_back("solid_fraction");
+  field_names.emplace_back("coordination_number");
+  for (unsigned int d = 0; d < dim; ++d)
+    field_names.emplace_back("kinetic_stress_" + axis_names[d] +
+                             axis_names[d]);
+  for (unsigned int i = 0; i < dim * (dim - 1) / 2; ++i)
+    field_names.emplace_back("kinetic_stress_" + off_diagonal_names[i]);
+
+  std::vector<std::string> mean_names;
+  std::vector<std::string> variance_names;
+  for (const auto &name : field_names)
+    {
+      mean_names.emplace_back("average_" + name);
+      variance_names.emplace_back("variance_" + name);
+    }
+  mean_names.emplace_back("occupied_samples");
+  variance_names.emplace_back("samples");
+
+  DataOut<dim> data_out;
+  data_out.attach_dof_handler(dof_handler);
+  data_out.add_data_vector(running_means_with_ghost_cells,
+                           mean_names,
+                           DataOut<dim>::type_dof_data);
+  data_out.add_data_vector(running_squared_deviations_with_ghost_cells,
+                           variance_names,
+                           DataOut<dim>::type_dof_data);
+  data_out.build_patches();
+
+  write_vtu_and_pvd<dim>(pvdhandler,
+                         data_out,
+                         folder,
+                         output_name + "_time_averaged_fields",
+                         current_time,
+                         step_number,
+                         group_files,
+                         mpi_communicator);
+}
+
+template <int dim, typename PropertiesIndex>
+std::vector<const typename LagrangianTimeAveraging<dim, PropertiesIndex>::
+                VectorType *>
+LagrangianTimeAveraging<dim, PropertiesIndex>::gather_vectors_to_transfer()
+{
+  running_means_with_ghost_cells              = running_means;
+  running_squared_deviations_with_ghost_cells = running_squared_deviations;
+
+  return {&running_means_with_ghost_cells,
+          &running_squared_deviations_with_ghost_cells};
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::prepare_for_mesh_repartitioning()
+{
+  if (!time_averaging_enabled)
+    return;
+
+  solution_transfer =
+    std::make_shared<SolutionTransfer<dim, VectorType>>(dof_handler);
+  solution_transfer->prepare_for_coarsening_and_refinement(
+    gather_vectors_to_transfer());
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::post_mesh_repartitioning()
+{
+  if (!time_averaging_enabled)
+    return;
+
+  dof_handler.distribute_dofs(fe);
+  reinit_vectors();
+
+  std::vector<VectorType *> transferred_vectors = {
+    &running_means_with_ghost_cells,
+    &running_squared_deviations_with_ghost_cells};
+  solution_transfer->interpolate(transferred_vectors);
+  solution_transfer.reset();
+
+  running_means              = running_means_with_ghost_cells;
+  running_squared_deviations = running_squared_deviations_with_ghost_cells;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::write_checkpoint(
+  const std::string &prefix)
+{
+  if (!time_averaging_enabled)
+    return;
+
+  solution_transfer =
+    std::make_shared<SolutionTransfer<dim, VectorType>>(dof_handler);
+  solution_transfer->prepare_for_serialization(gather_vectors_to_transfer());
+
+  if (Utilities::MPI::this_mpi_process(triangulation.get_mpi_communicator()) ==
+      0)
+    {
+      pvdhandler.save(prefix + "_time_averaged_fields");
+
+      std::string   filename = prefix + ".lagrangian_time_averaging";
+      std::ofstream output(filename.c_str());
+      output << "Lagrangian time averaging" << std::endl;
+      output << "n_samples " << n_samples << std::endl;
+    }
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianTimeAveraging<dim, PropertiesIndex>::read_checkpoint(
+  const std::string &prefix)
+{
+  if (!time_averaging_enabled)
+    return;
+
+  pvdhandler.read(prefix + "_time_averaged_fields");
+
+  std::string   filename = prefix + ".lagrangian_time_averaging";
+  std::ifstream input(filename.c_str());
+  AssertThrow(input, ExcFileNotOpen(filename));
+
+  std::string buffer;
+  std::getline(input, buffer);
+  input >> buffer >> n_samples;
+
+  dof_handler.distribute_dofs(fe);
+  reinit_vectors();
+
+  std::vector<VectorType *> transferred_vectors = {
+    &running_means_with_ghost_cells,
+    &running_squared_deviations_with_ghost_cells};
+  SolutionTransfer<dim, VectorType> checkpoint_transfer(dof_handler);
+  checkpoint_transfer.deserialize(transferred_vectors);
+
+  running_means              = running_means_with_ghost_cells;
+  running_squared_deviations = running_squared_deviations_with_ghost_cells;
+}
+
+template class LagrangianTimeAveraging<2, DEM::DEMProperties::PropertiesIndex>;
+template class LagrangianTimeAveraging<2,
+                                       DEM::CFDDEMProperties::PropertiesIndex>;
+template class LagrangianTimeAveraging<2,
+                                       DEM::DEMMPProperties::PropertiesIndex>;
+template class LagrangianTimeAveraging<3, DEM::DEMProperties::PropertiesIndex>;
+template class LagrangianTimeAveraging<3,
+                                       DEM::CFDDEMProperties::PropertiesIndex>;
+template class LagrangianTimeAveraging<3,
+                                       DEM::DEMMPProperties::PropertiesIndex>;
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <dem/linked_cell_grid.h>
+
+#include <deal.II/base/exceptions.h>
+
+#include <algorithm>
+
+template <int dim>
+void
+LinkedCellGrid<dim>::build(const std::vector<Point<dim>> &points,
+                           const double                   minimal_bin_size)
+{
+  bin_offsets.clear();
+  sorted_points.clear();
+
+  if (points.empty())
+    return;
+
+  AssertThrow(minimal_bin_size > 0.,
+              ExcMessage("The size of the bins of the linked-cell grid must be "
+                         "strictly positive."));
+
+  // Bounding box of the points
+  lower_corner = points[0];
+  Point<dim> upper_corner(points[0]);
+  for (const auto &point : points)
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        lower_corner[d] = std::min(lower_corner[d], point[d]);
+        upper_corner[d] = std::max(upper_corner[d], point[d]);
+      }
+
+  // The number of bins in each direction is the largest one for which the
+  // bins are at least as wide as the minimal bin size. The bin size is
+  // increased as long as the grid holds more than twice as many bins as
+  // points.
+  const double maximal_n_bins = 2. * points.size() + 1.;
+  double       bin_size       = minimal_bin_size;
+  while (true)
+    {
+      double n_bins_total = 1.;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          const double extent = upper_corner[d] - lower_corner[d];
+          n_bins_per_direction[d] =
+            std::max(1u, static_cast<unsigned int>(extent / bin_size));
+          n_bins_total *= n_bins_per_direction[d];
+        }
+      if (n_bins_total <= maximal_n_bins)
+        break;
+      bin_size *= 1.5;
+    }
+
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      const double extent = upper_corner[d] - lower_corner[d];
+      inverse_bin_size[d] =
+        (extent > 0.) ? n_bins_per_direction[d] / extent : 0.;
+    }
+
+  // Counting sort of the points into the bins
+  unsigned int total_n_bins = 1;
+  for (unsigned int d = 0; d < dim; ++d)
+    total_n_bins *= n_bins_per_direction[d];
+
+  std::vector<unsigned int> point_bins(points.size());
+  bin_offsets.assign(total_n_bins + 1, 0);
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      point_bins[i] = linear_index(get_bin(points[i]));
+      ++bin_offsets[point_bins[i] + 1];
+    }
+
+  for (unsigned int b = 0; b < total_n_bins; ++b)
+    bin_offsets[b + 1] += bin_offsets[b];
+
+  std::vector<unsigned int> insertion_position(bin_offsets.begin(),
+                                               bin_offsets.end() - 1);
+  sorted_points.resize(points.size());
+  for (unsigned int i = 0; i < points.size(); ++i)
+    sorted_points[insertion_position[point_bins[i]]++] = i;
+}
+
+template <int dim>
+std::array<unsigned int, dim>
+LinkedCellGrid<dim>::get_bin(const Point<dim> &point) const
+{
+  std::array<unsigned int, dim> bin;
+  for (unsigned int d = 0; d < dim; ++d)
+    bin[d] = static_cast<unsigned int>(
+      std::clamp((point[d] - lower_corner[d]) * inverse_bin_size[d],
+                 0.,
+                 static_cast<double>(n_bins_per_direction[d] - 1)));
+  return bin;
+}
+
+template class LinkedCellGrid<2>;
+template class LinkedCellGrid<3>;
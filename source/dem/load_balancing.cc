@@ -12,6 +12,9 @@ LagrangianLoadBalancing<dim, PropertiesIndex>::LagrangianLoadBalancing()
   : mpi_communicator(MPI_COMM_WORLD)
   , n_mpi_processes(Utilities::MPI::n_mpi_processes(mpi_communicator))
   , this_mpi_process(Utilities::MPI::this_mpi_process(mpi_communicator))
+  , measured_cost_enabled(false)
+  , measured_time(0.)
+  , contact_manager(nullptr)
 {}
 
 template <int dim, typename PropertiesIndex>
@@ -134,6 +137,128 @@ LagrangianLoadBalancing<dim, PropertiesIndex>::
   connect_mobility_status_weight_signals();
 }
 
+template <int dim, typename PropertiesIndex>
+void
+LagrangianLoadBalancing<dim, PropertiesIndex>::update_measured_cell_costs()
+{
+  AssertThrow(contact_manager != nullptr,
+              ExcMessage("The dynamic_with_measured_cost load balancing "
+                         "method requires the contact manager of the solver."));
+
+  // Cost of the contact pairs attributed to each local particle
+  ankerl::unordered_dense::map<types::particle_index, double>
+    particle_contact_costs;
+
+  // Local-local pairs are shared between the two particles, while the force
+  // of a pair with a ghost particle is only computed on this process
+  auto add_pair_costs =
+    [&](const typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+          &adjacent_particles,
+        const bool shared_pair) {
+      const double pair_cost =
+        shared_pair ? 0.5 * contact_weight : double(contact_weight);
+      for (const auto &[particle_one_id, adjacent_particles_list] :
+           adjacent_particles)
+        {
+          particle_contact_costs[particle_one_id] +=
+            pair_cost * adjacent_particles_list.size();
+
+          if (!shared_pair)
+            continue;
+
+          for (const auto &[particle_two_id, contact_info] :
+               adjacent_particles_list)
+            particle_contact_costs[particle_two_id] += pair_cost;
+        }
+    };
+  add_pair_costs(contact_manager->get_local_adjacent_particles(), true);
+  add_pair_costs(contact_manager->get_ghost_adjacent_particles(), false);
+  add_pair_costs(contact_manager->get_local_local_periodic_adjacent_particles(),
+                 true);
+  add_pair_costs(contact_manager->get_local_ghost_periodic_adjacent_particles(),
+                 false);
+
+  // In ghost-local periodic pairs, the local particle is the second one
+  for (const auto &[ghost_particle_id, adjacent_particles_list] :
+       contact_manager->get_ghost_local_periodic_adjacent_particles())
+    for (const auto &[local_particle_id, contact_info] :
+         adjacent_particles_list)
+      particle_contact_costs[local_particle_id] += contact_weight;
+
+  auto add_wall_costs =
+    [&](const typename DEM::dem_data_structures<dim>::particle_wall_in_contact
+          &particle_wall_pairs) {
+      for (const auto &[particle_id, particle_wall_list] : particle_wall_pairs)
+        particle_contact_costs[particle_id] +=
+          double(wall_contact_weight) * particle_wall_list.size();
+    };
+  add_wall_costs(contact_manager->get_particle_wall_in_contact());
+  add_wall_costs(contact_manager->get_particle_floating_wall_in_contact());
+
+  // Accumulate the cost of the particles in their cells. The containers are
+  // accessed with the particle ids only, so the ids of removed particles are
+  // simply not found.
+  std::vector<double> current_cell_costs(triangulation->n_active_cells(), 0.);
+  for (const auto &cell : triangulation->active_cell_iterators())
+    {
+      if (!cell->is_locally_owned())
+        continue;
+
+      double cell_cost = 0.;
+      for (const auto &particle : particle_handler->particles_in_cell(cell))
+        {
+          cell_cost += particle_weight;
+
+          const auto particle_contact_cost =
+            particle_contact_costs.find(particle.get_id());
+          if (particle_contact_cost != particle_contact_costs.end())
+            cell_cost += particle_contact_cost->second;
+        }
+      current_cell_costs[cell->active_cell_index()] = cell_cost;
+    }
+
+  // Exponential smoothing with the costs of the previous checks. The previous
+  // costs are cleared whenever the triangulation changes.
+  if (cell_costs.size() != current_cell_costs.size())
+    {
+      cell_costs = std::move(current_cell_costs);
+      return;
+    }
+
+  for (unsigned int i = 0; i < cell_costs.size(); ++i)
+    cell_costs[i] = cost_smoothing_factor * current_cell_costs[i] +
+                    (1. - cost_smoothing_factor) * cell_costs[i];
+}
+
+template <int dim, typename PropertiesIndex>
+void
+LagrangianLoadBalancing<dim, PropertiesIndex>::
+  check_load_balance_with_measured_cost()
+{
+  if (simulation_control->get_step_number() % dynamic_check_frequency != 0)
+    return;
+
+  // Update the cell costs used as weights if the load balancing is executed
+  update_measured_cell_costs();
+
+  // Compare the time measured on the processes since the last check. The
+  // time spent in communications is not measured, otherwise it would
+  // compensate the imbalance.
+  const double maximum_time_on_proc =
+    Utilities::MPI::max(measured_time, mpi_communicator);
+  const double minimum_time_on_proc =
+    Utilities::MPI::min(measured_time, mpi_communicator);
+  const double total_time =
+    Utilities::MPI::sum(measured_time, mpi_communicator);
+
+  // Restart the measurement for the next check
+  measured_time = 0.;
+
+  if ((maximum_time_on_proc - minimum_time_on_proc) >
+      load_threshold * (total_time / n_mpi_processes))
+    DEMActionManager::get_action_manager()->load_balance_step();
+}
+
 template <int dim, typename PropertiesIndex>
 unsigned int
 LagrangianLoadBalancing<dim, PropertiesIndex>::calculate_total_cell_weight(
@@ -244,6 +369,58 @@ LagrangianLoadBalancing<dim, PropertiesIndex>::
   return 0;
 }
 
+template <int dim, typename PropertiesIndex>
+unsigned int
+LagrangianLoadBalancing<dim, PropertiesIndex>::
+  calculate_total_cell_weight_with_measured_cost(
+    const typename parallel::distributed::Triangulation<dim>::cell_iterator
+                    &cell,
+    const CellStatus status) const
+{
+  // Assign no weight to cells we do not own.
+  if (!cell->is_locally_owned())
+    return 0;
+
+  // Fall back to the number of particles if the costs were not computed on
+  // the current triangulation
+  const bool use_cell_costs =
+    cell_costs.size() == triangulation->n_active_cells();
+  auto active_cell_cost =
+    [&](const typename parallel::distributed::Triangulation<dim>::cell_iterator
+          &active_cell) -> double {
+    if (use_cell_costs)
+      return cell_costs[active_cell->active_cell_index()];
+
+    return double(particle_handler->n_particles_in_cell(active_cell)) *
+           particle_weight;
+  };
+
+  switch (status)
+    {
+      case dealii::CellStatus::cell_will_persist:
+      case dealii::CellStatus::cell_will_be_refined:
+        return static_cast<unsigned int>(active_cell_cost(cell));
+      case dealii::CellStatus::cell_invalid:
+        break;
+      case dealii::CellStatus::children_will_be_coarsened:
+        {
+          double cell_cost = 0.;
+
+          for (unsigned int child_index = 0;
+               child_index < GeometryInfo<dim>::max_children_per_cell;
+               ++child_index)
+            cell_cost += active_cell_cost(cell->child(child_index));
+
+          return static_cast<unsigned int>(cell_cost);
+        }
+      default:
+        Assert(false, ExcInternalError());
+        break;
+    }
+
+  return 0;
+}
+
 template class LagrangianLoadBalancing<2, DEM::DEMProperties::PropertiesIndex>;
 template class LagrangianLoadBalancing<2,
                                        DEM::CFDDEMProperties::PropertiesIndex>;
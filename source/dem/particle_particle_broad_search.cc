@@ -4,6 +4,10 @@
 #include <dem/dem_contact_manager.h>
 #include <dem/particle_particle_broad_search.h>
 
+#include <algorithm>
+#include <cmath>
+#include <set>
+
 using namespace DEM;
 
 template <int dim>
@@ -732,6 +736,277 @@ find_particle_particle_periodic_contact_pairs(
     }
 }
 
+template <int dim>
+void
+find_particle_particle_linked_cell_contact_pairs(
+  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const double                             neighborhood_diameter,
+  LinkedCellGrid<dim>                     &linked_cell_grid,
+  typename dem_data_structures<dim>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<dim>::particle_particle_candidates
+    &ghost_contact_pair_candidates)
+{
+  // Clear containers
+  local_contact_pair_candidates.clear();
+  ghost_contact_pair_candidates.clear();
+
+  // Locations and ids of the local particles followed by the ghost particles
+  const unsigned int n_local_particles =
+    particle_handler.n_locally_owned_particles();
+  std::vector<Point<dim>>           locations;
+  std::vector<types::particle_index> ids;
+  locations.reserve(n_local_particles);
+  ids.reserve(n_local_particles);
+
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    {
+      locations.emplace_back(particle->get_location());
+      ids.emplace_back(particle->get_id());
+    }
+
+  for (auto particle = particle_handler.begin_ghost();
+       particle != particle_handler.end_ghost();
+       ++particle)
+    {
+      locations.emplace_back(particle->get_location());
+      ids.emplace_back(particle->get_id());
+    }
+
+  linked_cell_grid.build(locations, neighborhood_diameter);
+
+  const double neighborhood_diameter_squared = Utilities::fixed_power<2>(
+    neighborhood_diameter);
+
+  // Each local particle is paired with the particles of the adjacent bins.
+  // Since the ghost particles are stored after the local particles, only
+  // keeping the particles with a larger index stores the local-local pairs
+  // once and keeps all the local-ghost pairs.
+  for (unsigned int i = 0; i < n_local_particles; ++i)
+    {
+      const Point<dim> &location = locations[i];
+      linked_cell_grid.for_each_point_in_neighbor_bins(
+        location, [&](const unsigned int j) {
+          if (j <= i || location.distance_square(locations[j]) >
+                          neighborhood_diameter_squared)
+            return;
+
+          auto &contact_pair_candidates = (j < n_local_particles) ?
+                                            local_contact_pair_candidates :
+                                            ghost_contact_pair_candidates;
+          contact_pair_candidates[ids[i]].emplace_back(ids[j]);
+        });
+    }
+}
+
+template <int dim>
+void
+find_particle_particle_linked_cell_periodic_contact_pairs(
+  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const typename dem_data_structures<dim>::cells_neighbor_list
+    &cells_local_periodic_neighbor_list,
+  const typename dem_data_structures<dim>::cells_neighbor_list
+    &cells_ghost_periodic_neighbor_list,
+  const typename dem_data_structures<dim>::cells_neighbor_list
+                       &cells_ghost_local_periodic_neighbor_list,
+  const Tensor<1, dim> &periodic_offset,
+  const double          neighborhood_diameter,
+  LinkedCellGrid<dim>  &linked_cell_grid,
+  typename dem_data_structures<dim>::particle_particle_candidates
+    &local_contact_pair_periodic_candidates,
+  typename dem_data_structures<dim>::particle_particle_candidates
+    &ghost_contact_pair_periodic_candidates,
+  typename dem_data_structures<dim>::particle_particle_candidates
+    &ghost_local_contact_pair_periodic_candidates)
+{
+  // Clear containers
+  local_contact_pair_periodic_candidates.clear();
+  ghost_contact_pair_periodic_candidates.clear();
+  ghost_local_contact_pair_periodic_candidates.clear();
+
+  // Gather the periodic cells on the periodic boundaries 0 (main cells) and
+  // 1 (neighbor cells). A cell may appear in several lists.
+  std::set<typename Triangulation<dim>::active_cell_iterator>
+    cells_on_boundary_0, cells_on_boundary_1;
+  for (const auto *cells_periodic_neighbor_list :
+       {&cells_local_periodic_neighbor_list,
+        &cells_ghost_periodic_neighbor_list,
+        &cells_ghost_local_periodic_neighbor_list})
+    for (const auto &cell_periodic_neighbor_list :
+         *cells_periodic_neighbor_list)
+      {
+        cells_on_boundary_0.insert(cell_periodic_neighbor_list.front());
+        cells_on_boundary_1.insert(
+          std::next(cell_periodic_neighbor_list.begin()),
+          cell_periodic_neighbor_list.end());
+      }
+
+  // Locations (translated by the periodic offset), ids and ownership of the
+  // particles on the periodic boundary 1
+  std::vector<Point<dim>>            locations;
+  std::vector<types::particle_index> ids;
+  std::vector<bool>                  is_local;
+  for (const auto &cell : cells_on_boundary_1)
+    for (const auto &particle : particle_handler.particles_in_cell(cell))
+      {
+        locations.emplace_back(particle.get_location() - periodic_offset);
+        ids.emplace_back(particle.get_id());
+        is_local.emplace_back(cell->is_locally_owned());
+      }
+
+  linked_cell_grid.build(locations, neighborhood_diameter);
+
+  const double neighborhood_diameter_squared = Utilities::fixed_power<2>(
+    neighborhood_diameter);
+
+  // Pair the particles on the periodic boundary 0 with the particles of the
+  // adjacent bins. Pairs of ghost particles are not stored.
+  for (const auto &cell : cells_on_boundary_0)
+    {
+      const bool main_is_local = cell->is_locally_owned();
+      for (const auto &particle : particle_handler.particles_in_cell(cell))
+        {
+          const Point<dim>            location = particle.get_location();
+          const types::particle_index id       = particle.get_id();
+          linked_cell_grid.for_each_point_in_neighbor_bins(
+            location, [&](const unsigned int j) {
+              if ((!main_is_local && !is_local[j]) ||
+                  location.distance_square(locations[j]) >
+                    neighborhood_diameter_squared)
+                return;
+
+              auto &contact_pair_candidates =
+                main_is_local ? (is_local[j] ?
+                                   local_contact_pair_periodic_candidates :
+                                   ghost_contact_pair_periodic_candidates) :
+                                ghost_local_contact_pair_periodic_candidates;
+              contact_pair_candidates[id].emplace_back(ids[j]);
+            });
+        }
+    }
+}
+
+template <int dim, typename PropertiesIndex>
+void
+find_particle_particle_hierarchical_grid_contact_pairs(
+  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const double                             neighborhood_threshold,
+  std::vector<LinkedCellGrid<dim>>        &hierarchical_grid,
+  typename dem_data_structures<dim>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<dim>::particle_particle_candidates
+    &ghost_contact_pair_candidates)
+{
+  // Clear containers
+  local_contact_pair_candidates.clear();
+  ghost_contact_pair_candidates.clear();
+
+  // Locations, ids and diameters of the local particles followed by the ghost
+  // particles
+  const unsigned int n_local_particles =
+    particle_handler.n_locally_owned_particles();
+  std::vector<Point<dim>>            locations;
+  std::vector<types::particle_index> ids;
+  std::vector<double>                diameters;
+
+  auto gather_particle = [&](const auto &particle) {
+    locations.emplace_back(particle->get_location());
+    ids.emplace_back(particle->get_id());
+    diameters.emplace_back(particle->get_properties()[PropertiesIndex::dp]);
+  };
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    gather_particle(particle);
+  for (auto particle = particle_handler.begin_ghost();
+       particle != particle_handler.end_ghost();
+       ++particle)
+    gather_particle(particle);
+
+  if (locations.empty())
+    return;
+
+  // Diameter classes, the class 0 containing the largest particles. The
+  // diameters of the particles of the class k lie in
+  // (maximum_diameter / 2^(k+1), maximum_diameter / 2^k].
+  const auto [minimum_diameter, maximum_diameter] =
+    std::minmax_element(diameters.begin(), diameters.end());
+  const unsigned int n_levels =
+    1 + static_cast<unsigned int>(
+          std::floor(std::log2(*maximum_diameter / *minimum_diameter)));
+
+  std::vector<unsigned int>              particle_level(locations.size());
+  std::vector<std::vector<unsigned int>> level_particles(n_levels);
+  std::vector<double>                    level_maximum_diameter(n_levels, 0.);
+  for (unsigned int i = 0; i < locations.size(); ++i)
+    {
+      const unsigned int level = std::min(
+        n_levels - 1,
+        static_cast<unsigned int>(
+          std::floor(std::log2(*maximum_diameter / diameters[i]))));
+      particle_level[i] = level;
+      level_particles[level].emplace_back(i);
+      level_maximum_diameter[level] =
+        std::max(level_maximum_diameter[level], diameters[i]);
+    }
+
+  // Sort the particles of each class into their own grid
+  hierarchical_grid.resize(n_levels);
+  std::vector<Point<dim>> level_locations;
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      level_locations.clear();
+      for (const unsigned int i : level_particles[level])
+        level_locations.emplace_back(locations[i]);
+
+      hierarchical_grid[level].build(level_locations,
+                                     neighborhood_threshold *
+                                       level_maximum_diameter[level]);
+    }
+
+  // Each particle is paired with the particles of its own class and of the
+  // classes of smaller particles. Within a class, only the particles with a
+  // larger index are kept to store each pair once. Pairs of ghost particles
+  // are not stored and the local particle is always the key of the local-ghost
+  // pairs.
+  for (unsigned int i = 0; i < locations.size(); ++i)
+    {
+      const Point<dim> &location = locations[i];
+      const bool        i_is_local = i < n_local_particles;
+
+      for (unsigned int level = particle_level[i]; level < n_levels; ++level)
+        {
+          const double search_radius =
+            0.5 * neighborhood_threshold *
+            (diameters[i] + level_maximum_diameter[level]);
+
+          hierarchical_grid[level].for_each_point_in_radius(
+            location, search_radius, [&](const unsigned int k) {
+              const unsigned int j          = level_particles[level][k];
+              const bool         j_is_local = j < n_local_particles;
+              if ((level == particle_level[i] && j <= i) ||
+                  (!i_is_local && !j_is_local))
+                return;
+
+              const double neighborhood_diameter =
+                0.5 * neighborhood_threshold * (diameters[i] + diameters[j]);
+              if (location.distance_square(locations[j]) >
+                  Utilities::fixed_power<2>(neighborhood_diameter))
+                return;
+
+              if (i_is_local && j_is_local)
+                local_contact_pair_candidates[ids[i]].emplace_back(ids[j]);
+              else if (i_is_local)
+                ghost_contact_pair_candidates[ids[i]].emplace_back(ids[j]);
+              else
+                ghost_contact_pair_candidates[ids[j]].emplace_back(ids[i]);
+            });
+        }
+    }
+}
+
 template <int dim>
 void
 store_candidates(
@@ -1012,3 +1287,133 @@ find_particle_particle_periodic_contact_pairs<3>(
     &ghost_local_contact_pair_periodic_candidates,
   const AdaptiveSparseContacts<3, DEM::DEMMPProperties::PropertiesIndex>
     &sparse_contacts_object);
+
+template void
+find_particle_particle_linked_cell_contact_pairs<2>(
+  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const double                           neighborhood_diameter,
+  LinkedCellGrid<2>                     &linked_cell_grid,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+template void
+find_particle_particle_linked_cell_contact_pairs<3>(
+  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const double                           neighborhood_diameter,
+  LinkedCellGrid<3>                     &linked_cell_grid,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+template void
+find_particle_particle_linked_cell_periodic_contact_pairs<2>(
+  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const typename dem_data_structures<2>::cells_neighbor_list
+    &cells_local_periodic_neighbor_list,
+  const typename dem_data_structures<2>::cells_neighbor_list
+    &cells_ghost_periodic_neighbor_list,
+  const typename dem_data_structures<2>::cells_neighbor_list
+                     &cells_ghost_local_periodic_neighbor_list,
+  const Tensor<1, 2> &periodic_offset,
+  const double        neighborhood_diameter,
+  LinkedCellGrid<2>  &linked_cell_grid,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &local_contact_pair_periodic_candidates,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &ghost_contact_pair_periodic_candidates,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &ghost_local_contact_pair_periodic_candidates);
+
+template void
+find_particle_particle_linked_cell_periodic_contact_pairs<3>(
+  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const typename dem_data_structures<3>::cells_neighbor_list
+    &cells_local_periodic_neighbor_list,
+  const typename dem_data_structures<3>::cells_neighbor_list
+    &cells_ghost_periodic_neighbor_list,
+  const typename dem_data_structures<3>::cells_neighbor_list
+                     &cells_ghost_local_periodic_neighbor_list,
+  const Tensor<1, 3> &periodic_offset,
+  const double        neighborhood_diameter,
+  LinkedCellGrid<3>  &linked_cell_grid,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &local_contact_pair_periodic_candidates,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &ghost_contact_pair_periodic_candidates,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &ghost_local_contact_pair_periodic_candidates);
+
+template void
+find_particle_particle_hierarchical_grid_contact_pairs<
+  2,
+  DEM::DEMProperties::PropertiesIndex>(
+  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const double                           neighborhood_threshold,
+  std::vector<LinkedCellGrid<2>>        &hierarchical_grid,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+template void
+find_particle_particle_hierarchical_grid_contact_pairs<
+  3,
+  DEM::DEMProperties::PropertiesIndex>(
+  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const double                           neighborhood_threshold,
+  std::vector<LinkedCellGrid<3>>        &hierarchical_grid,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+template void
+find_particle_particle_hierarchical_grid_contact_pairs<
+  2,
+  DEM::CFDDEMProperties::PropertiesIndex>(
+  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const double                           neighborhood_threshold,
+  std::vector<LinkedCellGrid<2>>        &hierarchical_grid,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+template void
+find_particle_particle_hierarchical_grid_contact_pairs<
+  3,
+  DEM::CFDDEMProperties::PropertiesIndex>(
+  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const double                           neighborhood_threshold,
+  std::vector<LinkedCellGrid<3>>        &hierarchical_grid,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+template void
+find_particle_particle_hierarchical_grid_contact_pairs<
+  2,
+  DEM::DEMMPProperties::PropertiesIndex>(
+  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const double                           neighborhood_threshold,
+  std::vector<LinkedCellGrid<2>>        &hierarchical_grid,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<2>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
+
+template void
+find_particle_particle_hierarchical_grid_contact_pairs<
+  3,
+  DEM::DEMMPProperties::PropertiesIndex>(
+  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const double                           neighborhood_threshold,
+  std::vector<LinkedCellGrid<3>>        &hierarchical_grid,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &local_contact_pair_candidates,
+  typename dem_data_structures<3>::particle_particle_candidates
+    &ghost_contact_pair_candidates);
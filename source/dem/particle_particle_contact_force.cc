@@ -100,6 +100,92 @@ ParticleParticleContactForce<dim,
     }
 }
 
+template <int dim,
+          typename PropertiesIndex,
+          ParticleParticleContactForceModel contact_model,
+          RollingResistanceMethod           rolling_friction_model>
+void
+ParticleParticleContactForce<dim,
+                             PropertiesIndex,
+                             contact_model,
+                             rolling_friction_model>::
+  calculate_local_particle_particle_contact(
+    typename dem_data_structures<dim>::adjacent_particle_pairs
+      &local_adjacent_particles,
+    typename dem_data_structures<dim>::adjacent_particle_pairs
+                &local_local_periodic_adjacent_particles,
+    const double dt,
+    ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome)
+{
+  // Calculating the contact forces and heat transfer rates for local-local
+  // adjacent particles.
+  for (auto &&adjacent_particles_list :
+       local_adjacent_particles | boost::adaptors::map_values)
+    {
+      execute_contact_calculation<ContactType::local_particle_particle>(
+        adjacent_particles_list, dt, contact_outcome);
+    }
+
+  // Calculating the contact forces and heat transfer rates for local-local
+  // periodic adjacent particles.
+  for (auto &&periodic_adjacent_particles_list :
+       local_local_periodic_adjacent_particles | boost::adaptors::map_values)
+    {
+      execute_contact_calculation<
+        ContactType::local_periodic_particle_particle>(
+        periodic_adjacent_particles_list, dt, contact_outcome);
+    }
+}
+
+template <int dim,
+          typename PropertiesIndex,
+          ParticleParticleContactForceModel contact_model,
+          RollingResistanceMethod           rolling_friction_model>
+void
+ParticleParticleContactForce<dim,
+                             PropertiesIndex,
+                             contact_model,
+                             rolling_friction_model>::
+  calculate_ghost_particle_particle_contact(
+    typename dem_data_structures<dim>::adjacent_particle_pairs
+      &ghost_adjacent_particles,
+    typename dem_data_structures<dim>::adjacent_particle_pairs
+      &local_ghost_periodic_adjacent_particles,
+    typename dem_data_structures<dim>::adjacent_particle_pairs
+                &ghost_local_periodic_adjacent_particles,
+    const double dt,
+    ParticleInteractionOutcomes<PropertiesIndex> &contact_outcome)
+{
+  // Calculating the contact forces and heat transfer rates for local-ghost
+  // adjacent particles.
+  for (auto &&adjacent_particles_list :
+       ghost_adjacent_particles | boost::adaptors::map_values)
+    {
+      execute_contact_calculation<ContactType::ghost_particle_particle>(
+        adjacent_particles_list, dt, contact_outcome);
+    }
+
+  // Calculating the contact forces and heat transfer rates for local-ghost
+  // periodic adjacent particles.
+  for (auto &&periodic_adjacent_particles_list :
+       local_ghost_periodic_adjacent_particles | boost::adaptors::map_values)
+    {
+      execute_contact_calculation<
+        ContactType::ghost_periodic_particle_particle>(
+        periodic_adjacent_particles_list, dt, contact_outcome);
+    }
+
+  // Calculating the contact forces and heat transfer rates for ghost-local
+  // periodic adjacent particles.
+  for (auto &&periodic_adjacent_particles_list :
+       ghost_local_periodic_adjacent_particles | boost::adaptors::map_values)
+    {
+      execute_contact_calculation<
+        ContactType::ghost_local_periodic_particle_particle>(
+        periodic_adjacent_particles_list, dt, contact_outcome);
+    }
+}
+
 // dem
 // No resistance
 template class ParticleParticleContactForce<
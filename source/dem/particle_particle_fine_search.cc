@@ -105,6 +105,101 @@ particle_particle_fine_search(
     }
 }
 
+template <int dim, typename PropertiesIndex>
+void
+particle_particle_polydisperse_fine_search(
+  const typename DEM::dem_data_structures<dim>::particle_index_iterator_map
+    &particle_container,
+  typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<dim>::particle_particle_candidates
+                      &contact_pair_candidates,
+  const double         neighborhood_threshold,
+  const Tensor<1, dim> periodic_offset)
+{
+  // Square of the neighborhood diameter of a pair of particles, the
+  // neighborhood diameter being the neighborhood threshold times the mean
+  // diameter of the particles
+  const double half_threshold = 0.5 * neighborhood_threshold;
+  auto         pair_neighborhood_threshold =
+    [half_threshold](const auto &particle_one, const auto &particle_two) {
+      return Utilities::fixed_power<2>(
+        half_threshold * (particle_one->get_properties()[PropertiesIndex::dp] +
+                          particle_two->get_properties()[PropertiesIndex::dp]));
+    };
+
+  // First iterating over adjacent_particles
+  for (auto &&adjacent_particles_list :
+       adjacent_particles | boost::adaptors::map_values)
+    {
+      if (adjacent_particles_list.empty())
+        continue;
+
+      // Gather information about particle 1
+      auto &particle_one = adjacent_particles_list.begin()->second.particle_one;
+      Point<dim, double> particle_one_location = particle_one->get_location();
+
+      // Iterating over each map which contains the contact information
+      for (auto adjacent_particles_list_iterator =
+             adjacent_particles_list.begin();
+           adjacent_particles_list_iterator != adjacent_particles_list.end();)
+        {
+          auto &particle_two =
+            adjacent_particles_list_iterator->second.particle_two;
+          Point<dim, double> particle_two_location =
+            particle_two->get_location() - periodic_offset;
+
+          const double square_distance =
+            particle_one_location.distance_square(particle_two_location);
+          if (square_distance >
+              pair_neighborhood_threshold(particle_one, particle_two))
+            {
+              adjacent_particles_list_iterator =
+                adjacent_particles_list.erase(adjacent_particles_list_iterator);
+            }
+          else
+            {
+              ++adjacent_particles_list_iterator;
+            }
+        }
+    }
+
+  // Now iterating over contact_pair_candidates. If a pair is in vicinity, it
+  // is added to the adjacent_particles
+  for (auto &[particle_one_id, second_particle_container] :
+       contact_pair_candidates)
+    {
+      if (second_particle_container.empty())
+        continue;
+
+      auto               particle_one = particle_container.at(particle_one_id);
+      Point<dim, double> particle_one_location = particle_one->get_location();
+
+      for (const types::particle_index &particle_two_id :
+           second_particle_container)
+        {
+          auto particle_two = particle_container.at(particle_two_id);
+          Point<dim, double> particle_two_location =
+            particle_two->get_location() - periodic_offset;
+
+          const double square_distance =
+            particle_one_location.distance_square(particle_two_location);
+
+          if (square_distance <
+              pair_neighborhood_threshold(particle_one, particle_two))
+            {
+              auto &particle_one_contact_list =
+                adjacent_particles[particle_one_id];
+
+              particle_one_contact_list.emplace(
+                particle_two_id,
+                particle_particle_contact_info<dim>{
+                  particle_one, particle_two, Tensor<1, 3>(), Tensor<1, 3>()});
+            }
+        }
+    }
+}
+
 template void
 particle_particle_fine_search<2>(
   typename DEM::dem_data_structures<2>::particle_index_iterator_map const
@@ -126,3 +221,81 @@ particle_particle_fine_search<3>(
                     &contact_pair_candidates,
   const double       neighborhood_threshold,
   const Tensor<1, 3> periodic_offset = Tensor<1, 3>());
+
+template void
+particle_particle_polydisperse_fine_search<
+  2,
+  DEM::DEMProperties::PropertiesIndex>(
+  typename DEM::dem_data_structures<2>::particle_index_iterator_map const
+    &particle_container,
+  typename DEM::dem_data_structures<2>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<2>::particle_particle_candidates
+                    &contact_pair_candidates,
+  const double       neighborhood_threshold,
+  const Tensor<1, 2> periodic_offset);
+
+template void
+particle_particle_polydisperse_fine_search<
+  3,
+  DEM::DEMProperties::PropertiesIndex>(
+  typename DEM::dem_data_structures<3>::particle_index_iterator_map const
+    &particle_container,
+  typename DEM::dem_data_structures<3>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<3>::particle_particle_candidates
+                    &contact_pair_candidates,
+  const double       neighborhood_threshold,
+  const Tensor<1, 3> periodic_offset);
+
+template void
+particle_particle_polydisperse_fine_search<
+  2,
+  DEM::CFDDEMProperties::PropertiesIndex>(
+  typename DEM::dem_data_structures<2>::particle_index_iterator_map const
+    &particle_container,
+  typename DEM::dem_data_structures<2>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<2>::particle_particle_candidates
+                    &contact_pair_candidates,
+  const double       neighborhood_threshold,
+  const Tensor<1, 2> periodic_offset);
+
+template void
+particle_particle_polydisperse_fine_search<
+  3,
+  DEM::CFDDEMProperties::PropertiesIndex>(
+  typename DEM::dem_data_structures<3>::particle_index_iterator_map const
+    &particle_container,
+  typename DEM::dem_data_structures<3>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<3>::particle_particle_candidates
+                    &contact_pair_candidates,
+  const double       neighborhood_threshold,
+  const Tensor<1, 3> periodic_offset);
+
+template void
+particle_particle_polydisperse_fine_search<
+  2,
+  DEM::DEMMPProperties::PropertiesIndex>(
+  typename DEM::dem_data_structures<2>::particle_index_iterator_map const
+    &particle_container,
+  typename DEM::dem_data_structures<2>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<2>::particle_particle_candidates
+                    &contact_pair_candidates,
+  const double       neighborhood_threshold,
+  const Tensor<1, 2> periodic_offset);
+
+template void
+particle_particle_polydisperse_fine_search<
+  3,
+  DEM::DEMMPProperties::PropertiesIndex>(
+  typename DEM::dem_data_structures<3>::particle_index_iterator_map const
+    &particle_container,
+  typename DEM::dem_data_structures<3>::adjacent_particle_pairs
+    &adjacent_particles,
+  const typename DEM::dem_data_structures<3>::particle_particle_candidates
+                    &contact_pair_candidates,
+  const double       neighborhood_threshold,
+  const Tensor<1, 3> periodic_offset);
@@ -530,7 +530,7 @@ ParticleWallContactForce<dim,
                 {
                   if ((thermal_boundary_type !=
                        Parameters::ThermalBoundaryType::adiabatic) &&
-                      (normal_overlap > 0))
+                      (normal_overlap > 0) && this->calculate_heat_transfer)
                     {
                       const unsigned int particle_type =
                         static_cast<unsigned int>(
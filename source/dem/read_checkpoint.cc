@@ -24,6 +24,7 @@ read_checkpoint(
   Particles::ParticleHandler<dim>                         &particle_handler,
   std::shared_ptr<Insertion<dim, PropertiesIndex>>        &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<dim - 1, dim>>> &solid_surfaces,
+  LagrangianTimeAveraging<dim, PropertiesIndex>           &time_averaging,
   CheckpointControl &checkpoint_controller)
 {
   if (!DEMActionManager::get_action_manager()->check_restart_simulation())
@@ -91,6 +92,9 @@ read_checkpoint(
   // Unpack the information in the particle handler
   particle_handler.deserialize();
 
+  // Unpack the time-averaged fields (if enabled)
+  time_averaging.read_checkpoint(prefix);
+
 
   // Load insertion object
   std::string   insertion_object_filename = prefix + ".insertion_object";
@@ -118,6 +122,8 @@ read_checkpoint(
   std::shared_ptr<Insertion<2, DEM::DEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<1, 2>>> &solid_surfaces,
+  LagrangianTimeAveraging<2, DEM::DEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   CheckpointControl                               &checkpoint_controller);
 
 template void
@@ -132,6 +138,8 @@ read_checkpoint(
   std::shared_ptr<Insertion<3, DEM::DEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<2, 3>>> &solid_surfaces,
+  LagrangianTimeAveraging<3, DEM::DEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   CheckpointControl                               &checkpoint_controller);
 
 template void
@@ -146,6 +154,8 @@ read_checkpoint(
   std::shared_ptr<Insertion<2, DEM::CFDDEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<1, 2>>> &solid_surfaces,
+  LagrangianTimeAveraging<2, DEM::CFDDEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   CheckpointControl                               &checkpoint_controller);
 
 template void
@@ -160,6 +170,8 @@ read_checkpoint(
   std::shared_ptr<Insertion<3, DEM::CFDDEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<2, 3>>> &solid_surfaces,
+  LagrangianTimeAveraging<3, DEM::CFDDEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   CheckpointControl                               &checkpoint_controller);
 
 template void
@@ -174,6 +186,8 @@ read_checkpoint(
   std::shared_ptr<Insertion<2, DEM::DEMMPProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<1, 2>>> &solid_surfaces,
+  LagrangianTimeAveraging<2, DEM::DEMMPProperties::PropertiesIndex>
+                                                  &time_averaging,
   CheckpointControl                               &checkpoint_controller);
 
 template void
@@ -188,4 +202,6 @@ read_checkpoint(
   std::shared_ptr<Insertion<3, DEM::DEMMPProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<2, 3>>> &solid_surfaces,
+  LagrangianTimeAveraging<3, DEM::DEMMPProperties::PropertiesIndex>
+                                                  &time_averaging,
   CheckpointControl                               &checkpoint_controller);
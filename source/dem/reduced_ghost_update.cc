@@ -0,0 +1,295 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <core/dem_properties.h>
+
+#include <dem/reduced_ghost_update.h>
+
+#include <cstring>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+
+namespace
+{
+  /// Tag of the messages of the reduced update of the ghost particles.
+  constexpr int reduced_ghost_update_tag = 4728;
+
+  /**
+   * @brief Give the properties which change between two contact searches.
+   *
+   * @tparam PropertiesIndex Index of the properties used within the
+   * ParticleHandler.
+   */
+  template <typename PropertiesIndex>
+  std::vector<unsigned int>
+  get_dynamic_properties()
+  {
+    std::vector<unsigned int> properties = {PropertiesIndex::v_x,
+                                            PropertiesIndex::v_y,
+                                            PropertiesIndex::v_z,
+                                            PropertiesIndex::omega_x,
+                                            PropertiesIndex::omega_y,
+                                            PropertiesIndex::omega_z};
+    if constexpr (std::is_same_v<PropertiesIndex,
+                                 DEM::DEMMPProperties::PropertiesIndex>)
+      properties.push_back(PropertiesIndex::T);
+    return properties;
+  }
+
+  /**
+   * @brief Give the properties which do not change between two contact
+   * searches.
+   *
+   * @tparam PropertiesIndex Index of the properties used within the
+   * ParticleHandler.
+   */
+  template <typename PropertiesIndex>
+  std::vector<unsigned int>
+  get_static_properties()
+  {
+    std::vector<unsigned int> properties = {PropertiesIndex::type,
+                                            PropertiesIndex::dp,
+                                            PropertiesIndex::mass};
+    if constexpr (std::is_same_v<PropertiesIndex,
+                                 DEM::DEMMPProperties::PropertiesIndex>)
+      properties.push_back(PropertiesIndex::specific_heat);
+    return properties;
+  }
+} // namespace
+
+template <int dim, typename PropertiesIndex>
+ReducedGhostUpdate<dim, PropertiesIndex>::ReducedGhostUpdate(
+  const MPI_Comm mpi_communicator)
+  : mpi_communicator(mpi_communicator)
+  , dynamic_properties(get_dynamic_properties<PropertiesIndex>())
+  , static_properties(get_static_properties<PropertiesIndex>())
+  , bytes_per_particle((dim + dynamic_properties.size()) * sizeof(double) +
+                       static_properties.size() * sizeof(float))
+  , update_in_progress(false)
+{}
+
+template <int dim, typename PropertiesIndex>
+ReducedGhostUpdate<dim, PropertiesIndex>::~ReducedGhostUpdate()
+{
+  // The buffers must not be freed while messages are in transit
+  if (update_in_progress && !requests.empty())
+    MPI_Waitall(static_cast<int>(requests.size()),
+                requests.data(),
+                MPI_STATUSES_IGNORE);
+}
+
+template <int dim, typename PropertiesIndex>
+void
+ReducedGhostUpdate<dim, PropertiesIndex>::setup(
+  Particles::ParticleHandler<dim> &particle_handler)
+{
+  AssertThrow(!update_in_progress,
+              ExcMessage("The lists of the ghost particles cannot be rebuilt "
+                         "while an update of the ghost particles is in "
+                         "progress."));
+
+  // The ghost particles are grouped by the process owning them, which is the
+  // process owning their cell
+  std::map<unsigned int, std::vector<types::particle_index>> requested_ids;
+  std::map<unsigned int, std::vector<Particles::ParticleIterator<dim>>>
+    ghost_particles;
+  for (auto particle = particle_handler.begin_ghost();
+       particle != particle_handler.end_ghost();
+       ++particle)
+    {
+      const unsigned int owner =
+        particle->get_surrounding_cell()->subdomain_id();
+      requested_ids[owner].push_back(particle->get_id());
+      ghost_particles[owner].push_back(particle);
+    }
+
+  // Each process receives the ids of its locally owned particles which are
+  // ghost particles of the other processes, in the order in which the other
+  // processes store them
+  const std::map<unsigned int, std::vector<types::particle_index>>
+    received_ids = Utilities::MPI::some_to_some(mpi_communicator,
+                                                requested_ids);
+
+  std::unordered_map<types::particle_index, Particles::ParticleIterator<dim>>
+    local_particles;
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    local_particles.emplace(particle->get_id(), particle);
+
+  send_processes.clear();
+  particles_to_send.clear();
+  for (const auto &[process, ids] : received_ids)
+    {
+      send_processes.push_back(process);
+      std::vector<Particles::ParticleIterator<dim>> &particles =
+        particles_to_send.emplace_back();
+      particles.reserve(ids.size());
+      for (const types::particle_index id : ids)
+        {
+          const auto local_particle = local_particles.find(id);
+          AssertThrow(local_particle != local_particles.end(),
+                      ExcMessage("The particle " + std::to_string(id) +
+                                 " is a ghost particle of the process " +
+                                 std::to_string(process) +
+                                 " but it is not owned by this process."));
+          particles.push_back(local_particle->second);
+        }
+    }
+
+  receive_processes.clear();
+  ghost_particles_to_receive.clear();
+  for (auto &[process, particles] : ghost_particles)
+    {
+      receive_processes.push_back(process);
+      ghost_particles_to_receive.push_back(std::move(particles));
+    }
+
+  // The number of particles exchanged with each process is fixed until the
+  // next exchange of the ghost particles, so are the sizes of the buffers
+  send_buffers.resize(send_processes.size());
+  for (unsigned int i = 0; i < send_processes.size(); ++i)
+    send_buffers[i].resize(particles_to_send[i].size() * bytes_per_particle);
+
+  receive_buffers.resize(receive_processes.size());
+  for (unsigned int i = 0; i < receive_processes.size(); ++i)
+    receive_buffers[i].resize(ghost_particles_to_receive[i].size() *
+                              bytes_per_particle);
+}
+
+template <int dim, typename PropertiesIndex>
+void
+ReducedGhostUpdate<dim, PropertiesIndex>::update_start()
+{
+  AssertThrow(!update_in_progress,
+              ExcMessage("An update of the ghost particles is already in "
+                         "progress."));
+
+  const unsigned int n_receives = receive_processes.size();
+  requests.resize(n_receives + send_processes.size());
+
+  for (unsigned int i = 0; i < n_receives; ++i)
+    {
+      const int ierr = MPI_Irecv(receive_buffers[i].data(),
+                                 static_cast<int>(receive_buffers[i].size()),
+                                 MPI_CHAR,
+                                 receive_processes[i],
+                                 reduced_ghost_update_tag,
+                                 mpi_communicator,
+                                 &requests[i]);
+      AssertThrowMPI(ierr);
+    }
+
+  for (unsigned int i = 0; i < send_processes.size(); ++i)
+    {
+      char *buffer = send_buffers[i].data();
+      for (const auto &particle : particles_to_send[i])
+        pack_particle(particle, buffer);
+
+      const int ierr = MPI_Isend(send_buffers[i].data(),
+                                 static_cast<int>(send_buffers[i].size()),
+                                 MPI_CHAR,
+                                 send_processes[i],
+                                 reduced_ghost_update_tag,
+                                 mpi_communicator,
+                                 &requests[n_receives + i]);
+      AssertThrowMPI(ierr);
+    }
+
+  update_in_progress = true;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+ReducedGhostUpdate<dim, PropertiesIndex>::update_finish()
+{
+  AssertThrow(update_in_progress,
+              ExcMessage("No update of the ghost particles was started."));
+
+  if (!requests.empty())
+    {
+      const int ierr = MPI_Waitall(static_cast<int>(requests.size()),
+                                   requests.data(),
+                                   MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+    }
+
+  for (unsigned int i = 0; i < receive_processes.size(); ++i)
+    {
+      const char *buffer = receive_buffers[i].data();
+      for (auto &particle : ghost_particles_to_receive[i])
+        unpack_particle(particle, buffer);
+    }
+
+  requests.clear();
+  update_in_progress = false;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+ReducedGhostUpdate<dim, PropertiesIndex>::pack_particle(
+  const Particles::ParticleIterator<dim> &particle,
+  char                                  *&buffer) const
+{
+  // The values are copied one by one since the buffer is not aligned for
+  // doubles once it holds single precision values
+  const Point<dim> &location = particle->get_location();
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      std::memcpy(buffer, &location[d], sizeof(double));
+      buffer += sizeof(double);
+    }
+
+  const auto properties = particle->get_properties();
+  for (const unsigned int property : dynamic_properties)
+    {
+      std::memcpy(buffer, &properties[property], sizeof(double));
+      buffer += sizeof(double);
+    }
+
+  for (const unsigned int property : static_properties)
+    {
+      const float value = static_cast<float>(properties[property]);
+      std::memcpy(buffer, &value, sizeof(float));
+      buffer += sizeof(float);
+    }
+}
+
+template <int dim, typename PropertiesIndex>
+void
+ReducedGhostUpdate<dim, PropertiesIndex>::unpack_particle(
+  Particles::ParticleIterator<dim> &particle,
+  const char                      *&buffer) const
+{
+  Point<dim> location;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      std::memcpy(&location[d], buffer, sizeof(double));
+      buffer += sizeof(double);
+    }
+  particle->set_location(location);
+
+  auto properties = particle->get_properties();
+  for (const unsigned int property : dynamic_properties)
+    {
+      std::memcpy(&properties[property], buffer, sizeof(double));
+      buffer += sizeof(double);
+    }
+
+  // The full precision value of the last exchange of the ghost particles is
+  // kept unless the property has changed since
+  for (const unsigned int property : static_properties)
+    {
+      float value;
+      std::memcpy(&value, buffer, sizeof(float));
+      buffer += sizeof(float);
+      if (static_cast<float>(properties[property]) != value)
+        properties[property] = value;
+    }
+}
+
+template class ReducedGhostUpdate<2, DEM::DEMProperties::PropertiesIndex>;
+template class ReducedGhostUpdate<2, DEM::DEMMPProperties::PropertiesIndex>;
+template class ReducedGhostUpdate<3, DEM::DEMProperties::PropertiesIndex>;
+template class ReducedGhostUpdate<3, DEM::DEMMPProperties::PropertiesIndex>;
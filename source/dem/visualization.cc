@@ -3,8 +3,15 @@
 
 #include <dem/visualization.h>
 
+#include <deal.II/base/mpi.h>
+
 #include <deal.II/numerics/data_out.h>
 
+#include <algorithm>
+#include <array>
+#include <map>
+#include <sstream>
+
 using namespace dealii;
 
 template <int dim, typename PropertiesIndex>
@@ -92,7 +99,7 @@ Visualization<dim, PropertiesIndex>::print_xyz(
   const MPI_Comm                          &mpi_communicator,
   const ConditionalOStream                &pcout)
 {
-  const bool is_dem_mp =
+  constexpr bool is_dem_mp =
     std::is_same_v<PropertiesIndex, DEM::DEMMPProperties::PropertiesIndex>;
   pcout << "id, type, dp, x, y, z";
   if constexpr (is_dem_mp)
@@ -100,57 +107,119 @@ Visualization<dim, PropertiesIndex>::print_xyz(
       pcout << ", T";
     }
   pcout << " " << std::endl;
-  // Aggressively force synchronization of the header line
-  usleep(500);
-  MPI_Barrier(mpi_communicator);
-  usleep(500);
-  MPI_Barrier(mpi_communicator);
-
-  std::map<int, Particles::ParticleIterator<dim>> global_particles;
-  unsigned int current_id, current_id_max = 0;
-
-  // Mapping of all particles & find the max id on current processor
-  for (auto particle = particle_handler.begin();
-       particle != particle_handler.end();
-       ++particle)
-    {
-      current_id     = particle->get_id();
-      current_id_max = std::max(current_id, current_id_max);
 
-      global_particles.insert({current_id, particle});
+  // Each particle is packed in a record containing its id, type, diameter,
+  // location and, for DEM-MP, temperature. The id is stored as a double,
+  // which is exact for any realistic number of particles.
+  constexpr unsigned int n_fields = 3 + dim + (is_dem_mp ? 1 : 0);
+  using ParticleRecord            = std::array<double, n_fields>;
+
+  std::vector<ParticleRecord> records;
+  records.reserve(particle_handler.n_locally_owned_particles());
+  for (const auto &particle : particle_handler)
+    {
+      const auto particle_properties = particle.get_properties();
+      const auto particle_location   = particle.get_location();
+
+      ParticleRecord record;
+      record[0] = particle.get_id();
+      record[1] = particle_properties[PropertiesIndex::type];
+      record[2] = particle_properties[PropertiesIndex::dp];
+      for (unsigned int d = 0; d < dim; ++d)
+        record[3 + d] = particle_location[d];
+      if constexpr (is_dem_mp)
+        record[3 + dim] = particle_properties[PropertiesIndex::T];
+
+      records.push_back(record);
     }
 
-  // Find global max particle index
-  unsigned int id_max = Utilities::MPI::max(current_id_max, mpi_communicator);
+  auto compare_ids = [](const ParticleRecord &a, const ParticleRecord &b) {
+    return a[0] < b[0];
+  };
+  std::sort(records.begin(), records.end(), compare_ids);
+
+  // Sample sort of the records by id. Every process contributes regularly
+  // spaced samples of its sorted ids, from which the splitters delimiting
+  // the id range of each process are chosen. The records are then sent to
+  // the process owning their id range, such that the concatenation of the
+  // records of all the processes in rank order is sorted by id.
+  const unsigned int n_procs =
+    Utilities::MPI::n_mpi_processes(mpi_communicator);
+  if (n_procs > 1)
+    {
+      std::vector<double> local_samples;
+      if (!records.empty())
+        for (unsigned int s = 1; s < n_procs; ++s)
+          local_samples.push_back(records[s * records.size() / n_procs][0]);
+
+      std::vector<double> samples;
+      for (const auto &process_samples :
+           Utilities::MPI::all_gather(mpi_communicator, local_samples))
+        samples.insert(samples.end(),
+                       process_samples.begin(),
+                       process_samples.end());
+      std::sort(samples.begin(), samples.end());
+
+      std::vector<double> splitters;
+      if (!samples.empty())
+        for (unsigned int s = 1; s < n_procs; ++s)
+          splitters.push_back(samples[s * samples.size() / n_procs]);
+
+      std::map<unsigned int, std::vector<double>> records_to_send;
+      for (const auto &record : records)
+        {
+          const unsigned int destination =
+            std::upper_bound(splitters.begin(), splitters.end(), record[0]) -
+            splitters.begin();
+          std::vector<double> &buffer = records_to_send[destination];
+          buffer.insert(buffer.end(), record.begin(), record.end());
+        }
+
+      const std::map<unsigned int, std::vector<double>> received_records =
+        Utilities::MPI::some_to_some(mpi_communicator, records_to_send);
+
+      records.clear();
+      for (const auto &[process, buffer] : received_records)
+        for (unsigned int i = 0; i < buffer.size(); i += n_fields)
+          {
+            ParticleRecord record;
+            std::copy(buffer.begin() + i,
+                      buffer.begin() + i + n_fields,
+                      record.begin());
+            records.push_back(record);
+          }
+      std::sort(records.begin(), records.end(), compare_ids);
+    }
 
-  // Print particle info one by one in ascending order
-  for (unsigned int i = 0; i <= id_max; i++)
+  // Format the records of this process
+  std::ostringstream local_output;
+  for (const auto &record : records)
     {
-      for (auto &iterator : global_particles)
+      Point<dim> particle_location;
+      for (unsigned int d = 0; d < dim; ++d)
+        particle_location[d] = record[3 + d];
+
+      local_output << std::fixed << std::setprecision(0) << record[0] << " "
+                   << std::setprecision(0) << record[1] << " "
+                   << std::setprecision(5) << record[2] << " "
+                   << std::setprecision(4) << particle_location << " ";
+      if constexpr (is_dem_mp)
         {
-          unsigned int id = iterator.first;
-          if (id == i)
-            {
-              auto particle            = iterator.second;
-              auto particle_properties = particle->get_properties();
-              auto particle_location   = particle->get_location();
-
-              std::cout << std::fixed << std::setprecision(0) << id << " "
-                        << std::setprecision(0)
-                        << particle_properties[PropertiesIndex::type] << " "
-                        << std::setprecision(5)
-                        << particle_properties[PropertiesIndex::dp] << " "
-                        << std::setprecision(4) << particle_location << " ";
-              if constexpr (is_dem_mp)
-                {
-                  std::cout << std::fixed << std::setprecision(4)
-                            << particle_properties[PropertiesIndex::T];
-                }
-              std::cout << std::endl;
-            }
+          local_output << std::fixed << std::setprecision(4)
+                       << record[3 + dim];
         }
-      usleep(500);
-      MPI_Barrier(mpi_communicator);
+      local_output << std::endl;
+    }
+
+  // Gather the formatted records on the first process, which writes them all
+  // at once
+  const std::vector<std::string> gathered_output =
+    Utilities::MPI::gather(mpi_communicator, local_output.str(), 0);
+  if (Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+    {
+      for (const auto &process_output : gathered_output)
+        std::cout << process_output;
+      std::cout << std::flush;
     }
 }
 
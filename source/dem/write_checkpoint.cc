@@ -23,6 +23,7 @@ write_checkpoint(
   Particles::ParticleHandler<dim>                         &particle_handler,
   std::shared_ptr<Insertion<dim, PropertiesIndex>>        &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<dim - 1, dim>>> &solid_objects,
+  LagrangianTimeAveraging<dim, PropertiesIndex>           &time_averaging,
   const ConditionalOStream                                &pcout,
   MPI_Comm                                                &mpi_communicator,
   const CheckpointControl &checkpoint_controller)
@@ -49,6 +50,9 @@ write_checkpoint(
   // Prepare the particle handler for checkpointing
   particle_handler.prepare_for_serialization();
 
+  // Prepare the time-averaged fields for checkpointing (if enabled)
+  time_averaging.write_checkpoint(prefix);
+
   std::ostringstream            oss;
   boost::archive::text_oarchive oa(oss, boost::archive::no_header);
   oa << particle_handler;
@@ -98,6 +102,8 @@ write_checkpoint(
   std::shared_ptr<Insertion<2, DEM::DEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<1, 2>>> &solid_objects,
+  LagrangianTimeAveraging<2, DEM::DEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   const ConditionalOStream                        &pcout,
   MPI_Comm                                        &mpi_communicator,
   const CheckpointControl                         &checkpoint_controller);
@@ -114,6 +120,8 @@ write_checkpoint(
   std::shared_ptr<Insertion<3, DEM::DEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<2, 3>>> &solid_objects,
+  LagrangianTimeAveraging<3, DEM::DEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   const ConditionalOStream                        &pcout,
   MPI_Comm                                        &mpi_communicator,
   const CheckpointControl                         &checkpoint_controller);
@@ -130,6 +138,8 @@ write_checkpoint(
   std::shared_ptr<Insertion<2, DEM::CFDDEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<1, 2>>> &solid_objects,
+  LagrangianTimeAveraging<2, DEM::CFDDEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   const ConditionalOStream                        &pcout,
   MPI_Comm                                        &mpi_communicator,
   const CheckpointControl                         &checkpoint_controller);
@@ -146,6 +156,8 @@ write_checkpoint(
   std::shared_ptr<Insertion<3, DEM::CFDDEMProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<2, 3>>> &solid_objects,
+  LagrangianTimeAveraging<3, DEM::CFDDEMProperties::PropertiesIndex>
+                                                  &time_averaging,
   const ConditionalOStream                        &pcout,
   MPI_Comm                                        &mpi_communicator,
   const CheckpointControl                         &checkpoint_controller);
@@ -162,6 +174,8 @@ write_checkpoint(
   std::shared_ptr<Insertion<2, DEM::DEMMPProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<1, 2>>> &solid_objects,
+  LagrangianTimeAveraging<2, DEM::DEMMPProperties::PropertiesIndex>
+                                                  &time_averaging,
   const ConditionalOStream                        &pcout,
   MPI_Comm                                        &mpi_communicator,
   const CheckpointControl                         &checkpoint_controller);
@@ -178,6 +192,8 @@ write_checkpoint(
   std::shared_ptr<Insertion<3, DEM::DEMMPProperties::PropertiesIndex>>
                                                   &insertion_object,
   std::vector<std::shared_ptr<SerialSolid<2, 3>>> &solid_objects,
+  LagrangianTimeAveraging<3, DEM::DEMMPProperties::PropertiesIndex>
+                                                  &time_averaging,
   const ConditionalOStream                        &pcout,
   MPI_Comm                                        &mpi_communicator,
   const CheckpointControl                         &checkpoint_controller);
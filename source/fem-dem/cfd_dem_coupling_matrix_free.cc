@@ -85,7 +85,8 @@ CFDDEMMatrixFree<dim>::dem_setup_parameters()
   load_balancing.copy_references(this->simulation_control,
                                  *parallel_triangulation,
                                  this->particle_handler,
-                                 sparse_contacts_object);
+                                 sparse_contacts_object,
+                                 contact_manager);
 
   // Attach the correct functions to the signals inside the triangulation
   load_balancing.connect_weight_signals();
@@ -166,6 +167,18 @@ CFDDEMMatrixFree<dim>::dem_setup_parameters()
       DEM::CFDDEMProperties::PropertiesIndex>(
       this->cfd_dem_simulation_parameters.dem_parameters);
 
+  // The contacts between coarse particles use a larger time step (if multiple
+  // time stepping enabled). The iterations are counted over the CFD time steps.
+  const auto &model_parameters = dem_parameters.model_parameters;
+  multi_rate_control = std::make_shared<SubSimulationControlMultiRateDEM>(
+    model_parameters.multiple_time_stepping ?
+      model_parameters.coarse_time_step_ratio :
+      1,
+    model_parameters.coarse_diameter_threshold);
+  if (model_parameters.multiple_time_stepping)
+    particle_particle_contact_force_object->set_coarse_diameter_threshold(
+      multi_rate_control->get_coarse_diameter_threshold());
+
   // Initialize the contact search counter
   contact_search_total_number = 0;
 }
@@ -216,12 +229,20 @@ CFDDEMMatrixFree<dim>::initialize_dem_parameters()
   // cell size - largest particle radius) and (security factor * (blob diameter
   // - 1) *  the largest particle radius). This value is used in
   // find_contact_detection_frequency function
+  // With the hierarchical grid broad search, the neighborhood of each pair is
+  // sized by the diameters of its particles, so the smallest particle is used.
+  const double neighborhood_particle_diameter =
+    (dem_parameters.model_parameters.broad_search_method ==
+     Parameters::Lagrangian::ModelParameters<
+       dim>::BroadSearchMethod::hierarchical_grid) ?
+      find_minimum_particle_diameter(size_distribution_object_container) :
+      maximum_particle_diameter;
   smallest_contact_search_criterion =
     std::min((GridTools::minimal_cell_diameter(*this->triangulation) -
               maximum_particle_diameter * 0.5),
              (dem_parameters.model_parameters.dynamic_contact_search_factor *
               (dem_parameters.model_parameters.neighborhood_threshold - 1) *
-              maximum_particle_diameter * 0.5));
+              neighborhood_particle_diameter * 0.5));
 
   // Remap periodic cells (if PBC enabled)
   periodic_boundaries_object.map_periodic_cells(
@@ -234,6 +255,14 @@ CFDDEMMatrixFree<dim>::initialize_dem_parameters()
   particle_particle_contact_force_object->set_periodic_offset(
     periodic_boundaries_object.get_periodic_offset_distance());
 
+  // Set the parameters of the particle-particle broad search
+  contact_manager.set_broad_search_parameters(
+    dem_parameters.model_parameters.broad_search_method,
+    dem_parameters.model_parameters.neighborhood_threshold,
+    maximum_particle_diameter,
+    dem_parameters.model_parameters.broad_search_verbosity,
+    this->mpi_communicator);
+
   // Find cell neighbors
   contact_manager.execute_cell_neighbors_search(
     *parallel_triangulation, periodic_boundaries_cells_information);
@@ -582,7 +611,7 @@ CFDDEMMatrixFree<dim>::read_checkpoint()
 
   // Void Fraction Vectors
   std::vector<VectorType *> vf_system(
-    1 + this->particle_projector.previous_void_fraction.size());
+    1 + this->particle_projector.void_fraction_previous_solution.size());
 
   VectorType vf_distributed_system(
     this->particle_projector.locally_owned_dofs,
@@ -594,10 +623,10 @@ CFDDEMMatrixFree<dim>::read_checkpoint()
   std::vector<VectorType> vf_distributed_previous_solutions;
 
   vf_distributed_previous_solutions.reserve(
-    this->particle_projector.previous_void_fraction.size());
+    this->particle_projector.void_fraction_previous_solution.size());
 
   for (unsigned int i = 0;
-       i < this->particle_projector.previous_void_fraction.size();
+       i < this->particle_projector.void_fraction_previous_solution.size();
        ++i)
     {
       vf_distributed_previous_solutions.emplace_back(
@@ -612,33 +641,15 @@ CFDDEMMatrixFree<dim>::read_checkpoint()
 
   vf_system_trans_vectors.deserialize(vf_system);
 
+  // The matrix-free projection of the void fraction only uses deal.II vectors
   this->particle_projector.void_fraction_solution = vf_distributed_system;
 
-#ifndef LETHE_USE_LDV
-  // We also wish the Trilinos solution to be updated.
-  convert_vector_dealii_to_trilinos(
-    this->particle_projector.void_fraction_locally_owned,
-    this->particle_projector.void_fraction_solution);
-
-  this->particle_projector.void_fraction_locally_relevant =
-    this->particle_projector.void_fraction_locally_owned;
-#endif
-
   for (unsigned int i = 0;
-       i < this->particle_projector.previous_void_fraction.size();
+       i < this->particle_projector.void_fraction_previous_solution.size();
        ++i)
     {
       this->particle_projector.void_fraction_previous_solution[i] =
         vf_distributed_previous_solutions[i];
-
-#ifndef LETHE_USE_LDV
-      // We also wish the Trilinos solution to be updated.
-      convert_vector_dealii_to_trilinos(
-        this->particle_projector.void_fraction_locally_owned,
-        this->particle_projector.void_fraction_previous_solution[i]);
-      this->particle_projector.previous_void_fraction[i] =
-        this->particle_projector.void_fraction_locally_owned;
-#endif
     }
 
   if (this->simulation_parameters.flow_control.enable_flow_control)
@@ -848,7 +859,7 @@ CFDDEMMatrixFree<dim>::load_balance()
 
   // Void Fraction Vectors
   std::vector<VectorType *> vf_system(
-    1 + this->particle_projector.previous_void_fraction.size());
+    1 + this->particle_projector.void_fraction_previous_solution.size());
 
   VectorType vf_distributed_system(
     this->particle_projector.locally_owned_dofs,
@@ -860,10 +871,10 @@ CFDDEMMatrixFree<dim>::load_balance()
   std::vector<VectorType> vf_distributed_previous_solutions;
 
   vf_distributed_previous_solutions.reserve(
-    this->particle_projector.previous_void_fraction.size());
+    this->particle_projector.void_fraction_previous_solution.size());
 
   for (unsigned int i = 0;
-       i < this->particle_projector.previous_void_fraction.size();
+       i < this->particle_projector.void_fraction_previous_solution.size();
        ++i)
     {
       vf_distributed_previous_solutions.emplace_back(
@@ -875,33 +886,15 @@ CFDDEMMatrixFree<dim>::load_balance()
 
   vf_system_trans_vectors.interpolate(vf_system);
 
-#ifndef LETHE_USE_LDV
-  // We also wish the Trilinos solution to be updated.
-  convert_vector_dealii_to_trilinos(
-    this->particle_projector.void_fraction_locally_owned,
-    this->particle_projector.void_fraction_solution);
-
-  this->particle_projector.void_fraction_locally_relevant =
-    this->particle_projector.void_fraction_locally_owned,
-#endif
-
+  // The matrix-free projection of the void fraction only uses deal.II vectors
   this->particle_projector.void_fraction_solution = vf_distributed_system;
 
   for (unsigned int i = 0;
-       i < this->particle_projector.previous_void_fraction.size();
+       i < this->particle_projector.void_fraction_previous_solution.size();
        ++i)
     {
       this->particle_projector.void_fraction_previous_solution[i] =
         vf_distributed_previous_solutions[i];
-
-#ifndef LETHE_USE_LDV
-      // We also wish the Trilinos solution to be updated.
-      convert_vector_dealii_to_trilinos(
-        this->particle_projector.void_fraction_locally_owned,
-        this->particle_projector.void_fraction_previous_solution[i]);
-      this->particle_projector.previous_void_fraction[i] =
-        this->particle_projector.void_fraction_locally_owned;
-#endif
     }
 
   vf_system.clear();
@@ -1172,7 +1165,7 @@ CFDDEMMatrixFree<dim>::postprocess_cfd_dem()
       std::tie(total_volume_fluid, total_volume_particles) =
         calculate_fluid_and_particle_volumes(
           this->particle_projector.dof_handler,
-          this->particle_projector.void_fraction_locally_relevant,
+          this->particle_projector.void_fraction_solution,
           *this->cell_quadrature,
           *this->mapping);
       this->table_phase_volumes.add_value(
@@ -1335,18 +1328,49 @@ CFDDEMMatrixFree<dim>::dem_iterator(unsigned int counter)
   // exchange_ghost
   dem_contact_build(counter);
 
-  // Particle-particle contact force
-  particle_particle_contact_force_object->calculate_particle_particle_contact(
-    contact_manager.get_local_adjacent_particles(),
-    contact_manager.get_ghost_adjacent_particles(),
-    contact_manager.get_local_local_periodic_adjacent_particles(),
-    contact_manager.get_local_ghost_periodic_adjacent_particles(),
-    contact_manager.get_ghost_local_periodic_adjacent_particles(),
-    dem_time_step,
-    contact_outcome);
+  // Particle-particle contact force. The computational time of the contact
+  // forces and of the integration is measured for the load balancing (if
+  // measured cost load balancing enabled)
+  load_balancing.start_cost_measurement();
+  particle_particle_contact_force_object->set_coarse_pair_time_step_ratio(
+    multi_rate_control->get_coarse_pair_time_step_ratio());
+  if (dem_parameters.model_parameters.overlap_ghost_update)
+    {
+      particle_particle_contact_force_object
+        ->calculate_local_particle_particle_contact(
+          contact_manager.get_local_adjacent_particles(),
+          contact_manager.get_local_local_periodic_adjacent_particles(),
+          dem_time_step,
+          contact_outcome);
+
+      if (!dem_action_manager->check_contact_search())
+        this->particle_handler.update_ghost_particles_finish();
+
+      particle_particle_contact_force_object
+        ->calculate_ghost_particle_particle_contact(
+          contact_manager.get_ghost_adjacent_particles(),
+          contact_manager.get_local_ghost_periodic_adjacent_particles(),
+          contact_manager.get_ghost_local_periodic_adjacent_particles(),
+          dem_time_step,
+          contact_outcome);
+    }
+  else
+    {
+      particle_particle_contact_force_object
+        ->calculate_particle_particle_contact(
+          contact_manager.get_local_adjacent_particles(),
+          contact_manager.get_ghost_adjacent_particles(),
+          contact_manager.get_local_local_periodic_adjacent_particles(),
+          contact_manager.get_local_ghost_periodic_adjacent_particles(),
+          contact_manager.get_ghost_local_periodic_adjacent_particles(),
+          dem_time_step,
+          contact_outcome);
+    }
+  multi_rate_control->iterate();
 
   // Particles-walls contact force:
   particle_wall_contact_force();
+  load_balancing.stop_cost_measurement();
 
   // Add fluid-particle interaction force to the force container
   add_fluid_particle_interaction();
@@ -1366,6 +1390,7 @@ CFDDEMMatrixFree<dim>::dem_iterator(unsigned int counter)
   // In the first step, we have to obtain location of particles at half-step
   // time
   // TODO do all DEM time step at first CFD time step are half step?
+  load_balancing.start_cost_measurement();
   if (this->simulation_control->get_step_number() == 0)
     {
       integrator_object->integrate_half_step_location(this->particle_handler,
@@ -1389,6 +1414,7 @@ CFDDEMMatrixFree<dim>::dem_iterator(unsigned int counter)
                                    *parallel_triangulation,
                                    sparse_contacts_object);
     }
+  load_balancing.stop_cost_measurement();
 
   auto dem_current_time =
     (this->simulation_control->get_current_time()) + (dem_time_step * counter);
@@ -1440,7 +1466,6 @@ CFDDEMMatrixFree<dim>::dem_contact_build(unsigned int counter)
       sparse_contacts_object.identify_mobility_status(
         this->particle_projector.dof_handler,
         this->particle_handler,
-        (*this->triangulation).n_active_cells(),
         this->mpi_communicator);
 
       // Execute broad search by filling containers of particle-particle
@@ -1478,6 +1503,12 @@ CFDDEMMatrixFree<dim>::dem_contact_build(unsigned int counter)
         this->simulation_control->get_current_time(),
         neighborhood_threshold_squared);
     }
+  else if (dem_parameters.model_parameters.overlap_ghost_update)
+    {
+      // The update is completed in dem_iterator after the calculation of the
+      // local-local contact forces
+      this->particle_handler.update_ghost_particles_start();
+    }
   else
     {
       this->particle_handler.update_ghost_particles();
@@ -1488,6 +1519,12 @@ template <int dim>
 void
 CFDDEMMatrixFree<dim>::solve()
 {
+  AssertThrow(
+    !this->cfd_dem_simulation_parameters.dem_parameters.model_parameters
+       .reduced_ghost_update,
+    ExcMessage(
+      "The reduced ghost update is only supported by the DEM solver. It should be disabled in the contact detection subsection of the model parameters."));
+
   this->computing_timer.enter_subsection("Read mesh, manifolds and particles");
 
   read_mesh_and_manifolds(
@@ -14,6 +14,7 @@
 #include <solvers/postprocessing_cfd.h>
 
 #include <fem-dem/fluid_dynamics_sharp.h>
+#include <fem-dem/sharp_cut_cells_mapping.h>
 
 #include <deal.II/base/work_stream.h>
 
@@ -25,6 +26,7 @@
 
 #include <numbers>
 
+
 // Constructor for class FluidDynamicsSharp
 template <int dim>
 FluidDynamicsSharp<dim>::FluidDynamicsSharp(
@@ -32,8 +34,31 @@ FluidDynamicsSharp<dim>::FluidDynamicsSharp(
   : FluidDynamicsMatrixBased<dim>(p_nsparam.cfd_parameters)
   , cfd_dem_parameters(p_nsparam)
   , all_spheres(true)
+  , cut_cells_mapping_is_up_to_date(false)
   , combined_shapes()
-{}
+{
+  // The active cell indices used to store the cut cells mapping change with
+  // the triangulation, the mapping must then be regenerated entirely. The
+  // cached IB stencils refer to the cells of the triangulation and are
+  // discarded as well.
+  this->triangulation->signals.any_change.connect(
+    [this]() { cut_cells_mapping_is_up_to_date = false; });
+  this->triangulation->signals.post_distributed_repartition.connect(
+    [this]() { cut_cells_mapping_is_up_to_date = false; });
+  ib_stencil_cache.connect_to_triangulation(*this->triangulation);
+
+  AssertThrow(
+    !p_nsparam.cfd_parameters.simulation_control.adapt_with_error,
+    ExcMessage(
+      "The adaptation of the time step with the error estimate is only supported by the matrix-based fluid dynamics solver (lethe-fluid), since the sharp immersed boundary solver does not estimate the error of the time step."));
+
+  AssertThrow(
+    !p_nsparam.cfd_parameters.physics_solving_strategy
+       .at(PhysicsID::fluid_dynamics)
+       .enable_cell_activity_map,
+    ExcMessage(
+      "The cell activity map is not supported by the sharp immersed boundary solver, which assembles its own local matrices."));
+}
 
 template <int dim>
 FluidDynamicsSharp<dim>::~FluidDynamicsSharp() = default;
@@ -103,8 +128,11 @@ FluidDynamicsSharp<dim>::generate_cut_cells_map()
   const bool mapping_overconstrained_cells =
     this->simulation_parameters.fem_parameters.velocity_order == 1;
 
-  cut_cells_map.clear();
-  cells_inside_map.clear();
+  // The mapping of the spheres is regenerated entirely after this mapping.
+  cut_cells_mapping_is_up_to_date = false;
+  cut_cells_map.assign(this->triangulation->n_active_cells(),
+                       {false, 0, std::vector<unsigned int>()});
+  cells_inside_map.assign(this->triangulation->n_active_cells(), {false, 0});
   overconstrained_fluid_cell_map.clear();
   dof_with_more_then_one_particle.clear();
   if (mapping_overconstrained_cells)
@@ -273,11 +301,13 @@ FluidDynamicsSharp<dim>::generate_cut_cells_map()
                 }
             }
 
-          cut_cells_map[cell]    = {cell_is_cut,
-                                    particle_id_which_cuts_this_cell,
-                                    particles_cutting_this_cell};
-          cells_inside_map[cell] = {cell_is_inside,
-                                    particle_id_in_which_this_cell_is_embedded};
+          const unsigned int cell_index = cell->active_cell_index();
+
+          cut_cells_map[cell_index]    = {cell_is_cut,
+                                          particle_id_which_cuts_this_cell,
+                                          particles_cutting_this_cell};
+          cells_inside_map[cell_index] = {
+            cell_is_inside, particle_id_in_which_this_cell_is_embedded};
         }
     }
 
@@ -295,8 +325,9 @@ FluidDynamicsSharp<dim>::generate_cut_cells_map()
               bool cell_is_inside;
               cell->get_dof_indices(local_dof_indices);
               std::tie(cell_is_cut, std::ignore, std::ignore) =
-                cut_cells_map[cell];
-              std::tie(cell_is_inside, std::ignore) = cells_inside_map[cell];
+                cut_cells_map[cell->active_cell_index()];
+              std::tie(cell_is_inside, std::ignore) =
+                cells_inside_map[cell->active_cell_index()];
               if (!cell_is_cut && !cell_is_inside)
                 {
                   unsigned int number_of_vertices_in_cell =
@@ -499,257 +530,62 @@ void
 FluidDynamicsSharp<dim>::optimized_generate_cut_cells_map()
 {
   TimerOutput::Scope t(this->computing_timer, "Optmize cut cells mapping");
-  MappingQ1<dim>     mapping;
-  unsigned int       max_children = GeometryInfo<dim>::max_children_per_cell;
 
-  std::set<typename DoFHandler<dim>::cell_iterator> all_candidate_cells;
-  std::set<typename DoFHandler<dim>::cell_iterator>
-    previous_all_candidate_cells;
-
-  cut_cells_map.clear();
-  cells_inside_map.clear();
-  for (const auto &cell : this->dof_handler->active_cell_iterators())
+  const unsigned int n_particles    = particles.size();
+  const unsigned int n_active_cells = this->triangulation->n_active_cells();
+
+  std::vector<BoundingBox<dim>> particle_boxes(n_particles);
+  for (unsigned int p = 0; p < n_particles; ++p)
+    particle_boxes[p] =
+      SharpCutCellsMapping::sphere_bounding_box(particles[p].position,
+                                                particles[p].radius);
+
+  // The whole mapping is regenerated if the triangulation or the number of
+  // particles changed since the last mapping. Otherwise, only the cells
+  // intersecting the boxes of the particles that moved, at their previous and
+  // at their current positions, are updated. The other cells keep their state
+  // since none of the particles that can cut them moved.
+  const bool full_update = !cut_cells_mapping_is_up_to_date ||
+                           cut_cells_mapping_positions.size() != n_particles ||
+                           cut_cells_map.size() != n_active_cells;
+
+  std::vector<BoundingBox<dim>> updated_boxes;
+  if (full_update)
     {
-      if (cell->is_locally_owned() || cell->is_ghost())
-        {
-          cut_cells_map[cell]    = {false, 0, std::vector<unsigned int>()};
-          cells_inside_map[cell] = {false, 0};
-        }
+      cut_cells_map.assign(n_active_cells,
+                           {false, 0, std::vector<unsigned int>()});
+      cells_inside_map.assign(n_active_cells, {false, 0});
+      updated_boxes = particle_boxes;
     }
-
-  // Loop over particles in reverse.
-  // This is done in reverse to guarantee that the lowest particle ID is
-  // associated to the cut cell or the inside particle cell. For instance, if
-  // you have two particles cutting the same cell, it guarantees that the lowest
-  // ID particle is associated with the cell in the map.
-  for (int p = particles.size() - 1; p >= 0; --p)
+  else
     {
-      bool         empty    = true;
-      unsigned int lvl_iter = 0;
-
-      // Fix max level search
-      unsigned int max_lvl_search =
-        this->dof_handler->get_triangulation().n_levels() - 2;
-      if (max_lvl_search < 4)
-        max_lvl_search = this->dof_handler->get_triangulation().n_levels();
-
-      // Search for candidates until at least one is found or until the
-      // max_lvl_search is reached
-      while (empty || lvl_iter < max_lvl_search)
-        {
-          const auto &cell_iterator =
-            this->dof_handler->cell_iterators_on_level(lvl_iter);
-
-          // Loop over the cells on level lvl_iter of the mesh
-          for (const auto &cell : cell_iterator)
-            {
-              auto is_candidate = generate_cut_cell_candidates(cell, p);
-
-              // check whether the cell is candidate for inside of cut
-              if (is_candidate.first)
-                {
-                  all_candidate_cells.insert(cell);
-                }
-              if (is_candidate.second)
-                {
-                  all_candidate_cells.insert(cell);
-                }
-            }
-          if (all_candidate_cells.size() > 0)
-            empty = false;
-
-          lvl_iter += 1;
-        }
-
-      // Store list with all candidate cells
-      previous_all_candidate_cells = all_candidate_cells;
-
-      // If there are candidate cells
-      if (all_candidate_cells.size() != 0)
+      for (unsigned int p = 0; p < n_particles; ++p)
         {
-          bool all_cells_are_active = false;
-
-          // Loop until candidate cells are active
-          while (!all_cells_are_active)
+          if (particles[p].position != cut_cells_mapping_positions[p] ||
+              particles[p].radius != cut_cells_mapping_radii[p])
             {
-              all_cells_are_active = true;
-              all_candidate_cells.clear();
-
-              // loop over the last set of candidates to check if it is still a
-              // candidate
-              for (auto cell : previous_all_candidate_cells)
-                {
-                  auto is_candidate = generate_cut_cell_candidates(cell, p);
-
-                  // Check if cell is inside particles
-                  if (is_candidate.first)
-                    {
-                      // If it is an active cell, add it to cells_inside_map
-                      if (cell->is_active())
-                        {
-                          cells_inside_map[cell] = {true, p};
-                        }
-                      else
-                        {
-                          // If we are here, the cell has children.
-                          all_cells_are_active = false;
-                          for (unsigned int j = 0; j < max_children; ++j)
-                            {
-                              // Store the children of the cell for
-                              // further checks.
-                              all_candidate_cells.insert(cell->child(j));
-                            }
-                        }
-                    }
-
-                  if (is_candidate.second)
-                    {
-                      // If it is an active cell, add it to cells_cut_map
-                      if (cell->is_active())
-                        {
-                          cut_cells_map[cell] = {true,
-                                                 p,
-                                                 std::vector<unsigned int>()};
-                        }
-                      else
-                        {
-                          // If we are here, the cell has children.
-                          all_cells_are_active = false;
-                          for (unsigned int j = 0; j < max_children; ++j)
-                            {
-                              // Store the children of the cell for
-                              // further checks.
-                              all_candidate_cells.insert(cell->child(j));
-                            }
-                        }
-                    }
-                }
-              previous_all_candidate_cells.clear();
-              previous_all_candidate_cells = all_candidate_cells;
+              updated_boxes.push_back(SharpCutCellsMapping::sphere_bounding_box(
+                cut_cells_mapping_positions[p], cut_cells_mapping_radii[p]));
+              updated_boxes.push_back(particle_boxes[p]);
             }
         }
     }
-}
-
-
-template <int dim>
-std::pair<bool, bool>
-FluidDynamicsSharp<dim>::generate_cut_cell_candidates(
-  const typename DoFHandler<dim>::cell_iterator &cell,
-  const unsigned int                             p_id)
-{
-  bool cell_is_inside = false;
-  bool cell_is_cut    = false;
-
-  double search_radius = particles[p_id].radius * (1.0 - 1e-07);
-  auto   position      = particles[p_id].position;
-
-  bool point_inside_cell = cell->point_inside(position);
-
-  // Check how many vertices are inside the particle
-  unsigned int nb_vertices_inside = 0;
-  for (unsigned int i = 0; i < GeometryInfo<dim>::vertices_per_cell; ++i)
-    {
-      if ((cell->vertex(i) - position).norm() < search_radius)
-        ++nb_vertices_inside;
-    }
 
-  // If vertices are found inside the particle
-  if (nb_vertices_inside > 0)
+  cut_cells_mapping_positions.resize(n_particles);
+  cut_cells_mapping_radii.resize(n_particles);
+  for (unsigned int p = 0; p < n_particles; ++p)
     {
-      // If the number of vertices inside the cell is equal to the number of
-      // vertices per cell, the cell is inside the particle
-      if (nb_vertices_inside == GeometryInfo<dim>::vertices_per_cell)
-        {
-          cell_is_inside = true;
-          cell_is_cut    = false;
-        }
-      // Otherwise, the cell is cut
-      else
-        {
-          cell_is_inside = false;
-          cell_is_cut    = true;
-        }
-      return {cell_is_inside, cell_is_cut};
+      cut_cells_mapping_positions[p] = particles[p].position;
+      cut_cells_mapping_radii[p]     = particles[p].radius;
     }
-
-  // If the particle intersect the cell and is not known whether all
-  // vertices are inside the particles, set all true by default
-  if (point_inside_cell)
-    {
-      cell_is_inside = true;
-      cell_is_cut    = true;
-      return {cell_is_inside, cell_is_cut};
-    }
-
-  // The last check consists of projecting the particle's position on the cells'
-  // face and checking whether the projected points are within the particle. If
-  // one of the projected points is inside the particle, either the cell is
-  // inside or is cut by the particles. If this is true, the next
-  // level will be tested again by this function.
-
-  // Initialize superpoint of manifold
-  std::vector<Point<dim>> manifold_points(
-    GeometryInfo<dim - 1>::vertices_per_cell);
-
-  // Loop through faces
-  for (const auto face : cell->face_indices())
-    {
-      auto  face_iter           = cell->face(face);
-      auto &local_face_manifold = face_iter->get_manifold();
-
-      // Loop through face vertices
-      for (unsigned int i = 0; i < GeometryInfo<dim>::vertices_per_face; ++i)
-        {
-          // Assign vertex to manifold superpoint
-          manifold_points[i] = face_iter->vertex(i);
-        }
-
-      // Create array of points on face
-      auto surrounding_face_points =
-        make_array_view(manifold_points.begin(), manifold_points.end());
-
-      // Loop through face vertices
-      for (unsigned int i = 0; i < GeometryInfo<dim>::vertices_per_face; ++i)
-        {
-          // Project points to face
-          Point<dim> projected_point =
-            local_face_manifold.project_to_manifold(surrounding_face_points,
-                                                    position);
-
-          bool           projected_point_over_face = true;
-          Tensor<1, dim> projected_point_tensor(projected_point);
-
-          // Check whether the projected point is within the cell
-          try
-            {
-              projected_point_over_face = cell->point_inside(projected_point);
-
-              if ((position - projected_point).norm() < search_radius &&
-                  projected_point_over_face)
-                {
-                  cell_is_inside = true;
-                  cell_is_cut    = true;
-                  return {cell_is_inside, cell_is_cut};
-                }
-            }
-          // If the method crashes, change default for false
-          catch (...)
-            {
-              projected_point_over_face = false;
-            }
-
-          for (int d = 0; d != dim; d++)
-            {
-              if (projected_point_tensor[d] < 0 ||
-                  projected_point_tensor[d] > 1)
-                {
-                  projected_point_over_face = false;
-                }
-            }
-        }
-    }
-  return {cell_is_inside, cell_is_cut};
+  cut_cells_mapping_is_up_to_date = true;
+
+  SharpCutCellsMapping::map_sphere_cut_cells(*this->dof_handler,
+                                             cut_cells_mapping_positions,
+                                             cut_cells_mapping_radii,
+                                             updated_boxes,
+                                             cut_cells_map,
+                                             cells_inside_map);
 }
 
 template <int dim>
@@ -1111,7 +947,8 @@ FluidDynamicsSharp<dim>::force_on_ib()
                                // imposition of this cell
           std::vector<unsigned int> p_count;
           bool                      cell_is_cut;
-          std::tie(cell_is_cut, p_main, p_count) = cut_cells_map[cell];
+          std::tie(cell_is_cut, p_main, p_count) =
+            cut_cells_map[cell->active_cell_index()];
           // If the cell is cut
           if (cell_is_cut)
             {
@@ -1714,7 +1551,7 @@ FluidDynamicsSharp<dim>::gather_output_hook()
               bool cell_is_cut;
               int  particle_id;
               std::tie(cell_is_cut, particle_id, std::ignore) =
-                cut_cells_map[cell];
+                cut_cells_map[cell->active_cell_index()];
               if (cell_is_cut)
                 cell_cuts(i) = particle_id;
               else
@@ -1882,9 +1719,11 @@ FluidDynamicsSharp<dim>::calculate_L2_error_particles()
           bool cell_is_cut;
           // std::ignore is used because we don't care about what particle cut
           // the cell or the number of particles that cut the cell.
-          std::tie(cell_is_cut, std::ignore, std::ignore) = cut_cells_map[cell];
+          std::tie(cell_is_cut, std::ignore, std::ignore) =
+            cut_cells_map[cell->active_cell_index()];
           bool cell_is_inside;
-          std::tie(cell_is_inside, std::ignore) = cells_inside_map[cell];
+          std::tie(cell_is_inside, std::ignore) =
+            cells_inside_map[cell->active_cell_index()];
           bool cell_is_overconstrained;
           std::tie(cell_is_overconstrained, std::ignore, std::ignore) =
             overconstrained_fluid_cell_map[cell];
@@ -1936,14 +1775,16 @@ FluidDynamicsSharp<dim>::calculate_L2_error_particles()
           bool cell_is_cut;
           // std::ignore is used because we don't care about what particle cut
           // the cell or the number of particles that cut the cell.
-          std::tie(cell_is_cut, std::ignore, std::ignore) = cut_cells_map[cell];
+          std::tie(cell_is_cut, std::ignore, std::ignore) =
+            cut_cells_map[cell->active_cell_index()];
 
           bool cell_is_overconstrained;
           std::tie(cell_is_overconstrained, std::ignore, std::ignore) =
             overconstrained_fluid_cell_map[cell];
 
           bool cell_is_inside;
-          std::tie(cell_is_inside, std::ignore) = cells_inside_map[cell];
+          std::tie(cell_is_inside, std::ignore) =
+            cells_inside_map[cell->active_cell_index()];
           if (cell->at_boundary() &&
               this->check_existance_of_bc(
                 BoundaryConditions::BoundaryType::function_weak))
@@ -3091,6 +2932,106 @@ FluidDynamicsSharp<dim>::finish_time_step_particles()
     }
 }
 
+template <int dim>
+IBStencilCacheEntry<dim>
+FluidDynamicsSharp<dim>::compute_ib_stencil(
+  const typename DoFHandler<dim>::active_cell_iterator &cell_cut,
+  const unsigned int                                    ib_particle_id,
+  const Point<dim>                                     &support_point,
+  const types::global_dof_index                         dof_index)
+{
+  const unsigned int order =
+    this->simulation_parameters.particlesParameters->order;
+  const double length_ratio =
+    this->simulation_parameters.particlesParameters->length_ratio;
+  const bool enable_extrapolation =
+    this->simulation_parameters.particlesParameters->enable_extrapolation;
+
+  IBStencil<dim>            stencil;
+  const std::vector<double> ib_coef = stencil.coefficients(order, length_ratio);
+
+  IBStencilCacheEntry<dim> ib_stencil;
+  ib_stencil.particle_id            = ib_particle_id;
+  ib_stencil.particle_close_to_wall = false;
+
+  // Define the points for the IB stencil based on the order, particle position,
+  // and DOF position. The definition of the output variable "point" changes
+  // depending on the order. In the case of stencil orders 1 to 4, the variable
+  // point returns the position of the DOF directly. In the case of higher order
+  // stencil (5 or more), it returns the position of the point that is on the
+  // IB. This is because stencil orders higher than four are not implemented.
+  // The function extrapolates the element at the particle's surface in these
+  // cases. To do so, we use the point at the surface of the particle. The
+  // variable "interpolation points" return the points used to define the
+  // cell_cut used for the stencil definition and the locations of the points
+  // used in the stencil calculation.
+  auto [point, interpolation_points] =
+    stencil.support_points_for_interpolation(
+      order, length_ratio, particles[ib_particle_id], support_point, cell_cut);
+
+  // Find the cell used for the stencil definition.
+  auto point_to_find_cell =
+    stencil.point_for_cell_detection(particles[ib_particle_id],
+                                     support_point,
+                                     cell_cut);
+  try
+    {
+      ib_stencil.stencil_cell =
+        LetheGridTools::find_cell_around_point_with_neighbors<dim>(
+          *this->dof_handler, vertices_to_cell, cell_cut, point_to_find_cell);
+    }
+  catch (...)
+    {
+      // If we are here, the DOF is on a boundary.
+      ib_stencil.particle_close_to_wall = true;
+      ib_stencil.stencil_cell           = cell_cut;
+
+      // If a boundary condition is already applied to this DOF, the stencil
+      // is not used.
+      if (this->zero_constraints.is_constrained(dof_index) ||
+          this->nonzero_constraints.is_constrained(dof_index))
+        return ib_stencil;
+    }
+
+  // Check if the point used to define the cell used for the definition of the
+  // stencil is on a face between the cell_cut and the stencil cell. The
+  // extrapolation can be disabled for debugging purposes, although in most
+  // cases it shouldn't since it is a core part of this solver.
+  if (enable_extrapolation)
+    ib_stencil.point_in_cell = cell_cut->point_inside(
+      interpolation_points
+        [stencil.number_of_interpolation_support_points(order) - 1]);
+  else
+    ib_stencil.point_in_cell = cell_cut->point_inside(support_point);
+
+  // Define the unit cell points for the points used in the stencil.
+  std::vector<Point<dim>> unit_cell_interpolation_points(ib_coef.size());
+  unit_cell_interpolation_points[0] =
+    this->mapping->transform_real_to_unit_cell(ib_stencil.stencil_cell, point);
+  for (unsigned int j = 1; j < ib_coef.size(); ++j)
+    {
+      if (enable_extrapolation)
+        unit_cell_interpolation_points[j] =
+          this->mapping->transform_real_to_unit_cell(
+            ib_stencil.stencil_cell, interpolation_points[j - 1]);
+      else
+        unit_cell_interpolation_points[j] =
+          this->mapping->transform_real_to_unit_cell(ib_stencil.stencil_cell,
+                                                     support_point);
+    }
+
+  // Store the values of the shape functions of the stencil cell at the points
+  // of the stencil, which define the matrix entries of the IB equation.
+  const unsigned int dofs_per_cell = this->fe->dofs_per_cell;
+  ib_stencil.shape_values.resize(dofs_per_cell * ib_coef.size());
+  for (unsigned int j = 0; j < dofs_per_cell; ++j)
+    for (unsigned int k = 0; k < ib_coef.size(); ++k)
+      ib_stencil.shape_values[j * ib_coef.size() + k] =
+        this->fe->shape_value(j, unit_cell_interpolation_points[k]);
+
+  return ib_stencil;
+}
+
 template <int dim>
 void
 FluidDynamicsSharp<dim>::sharp_edge()
@@ -3127,6 +3068,24 @@ FluidDynamicsSharp<dim>::sharp_edge()
   IBStencil<dim>      stencil;
   std::vector<double> ib_coef = stencil.coefficients(order, length_ratio);
 
+  // Only keep the stencils of the particles that did not move since the last
+  // assembly.
+  if (this->simulation_parameters.particlesParameters->enable_stencil_cache)
+    {
+      std::vector<Point<dim>>   positions(particles.size());
+      std::vector<Tensor<1, 3>> orientations(particles.size());
+      for (unsigned int p = 0; p < particles.size(); ++p)
+        {
+          positions[p]    = particles[p].position;
+          orientations[p] = particles[p].orientation;
+        }
+      ib_stencil_cache.remove_outdated_stencils(positions, orientations);
+    }
+  else
+    ib_stencil_cache.clear();
+  unsigned int n_stencils_computed = 0;
+  unsigned int n_stencils_reused   = 0;
+
   unsigned int n_q_points = q_formula.size();
 
   // Define multiple local_dof_indices one for the cell iterator one for the
@@ -3228,7 +3187,7 @@ FluidDynamicsSharp<dim>::sharp_edge()
           unsigned int              ib_particle_id;
           std::vector<unsigned int> count_particles;
           std::tie(cell_is_cut, ib_particle_id, count_particles) =
-            cut_cells_map[cell_cut];
+            cut_cells_map[cell_cut->active_cell_index()];
           bool cell_is_overconstrained;
           std::tie(cell_is_overconstrained, std::ignore, std::ignore) =
             overconstrained_fluid_cell_map[cell_cut];
@@ -3414,64 +3373,45 @@ FluidDynamicsSharp<dim>::sharp_edge()
                           // Clear the current line of this dof
                           this->system_matrix.clear_row(global_index_overwrite);
 
-                          // Define the points for the IB stencil based on the
-                          // order, particle position, and DOF position. The
-                          // definition of the output variable "point" changes
-                          // depending on the order. In the case of stencil
-                          // orders 1 to 4, the variable point returns the
-                          // position of the DOF directly. In the case of higher
-                          // order stencil (5 or more), it returns the position
-                          // of the point that is on the IB. This is because
-                          // stencil orders higher than four are not
-                          // implemented. The function extrapolates the element
-                          // at the particle's surface in these cases. To do so,
-                          // we use the point at the surface of the particle.
-                          // The variable "interpolation points" return the
-                          // points used to define the cell_cut used for the
-                          // stencil definition and the locations of the points
-                          // used in the stencil calculation.
-
-                          auto [point, interpolation_points] =
-                            stencil.support_points_for_interpolation(
-                              order,
-                              length_ratio,
-                              particles[ib_particle_id],
-                              support_points[local_dof_indices[i]],
-                              cell_cut);
-                          // Find the cell_cut used for the stencil definition.
-                          auto point_to_find_cell =
-                            stencil.point_for_cell_detection(
-                              particles[ib_particle_id],
-                              support_points[local_dof_indices[i]],
-                              cell_cut);
-                          typename DoFHandler<dim>::active_cell_iterator
-                               stencil_cell;
-                          bool particle_close_to_wall = false;
-                          (void)particle_close_to_wall;
-                          try
+                          // The geometric data of the stencil of the DOF is
+                          // reused if the particle which cuts the cell_cut did
+                          // not move since it was computed.
+                          const IBStencilCacheEntry<dim> *cached_stencil =
+                            ib_stencil_cache.find(cell_cut->active_cell_index(),
+                                                  i,
+                                                  ib_particle_id);
+                          if (cached_stencil == nullptr)
                             {
-                              stencil_cell = LetheGridTools::
-                                find_cell_around_point_with_neighbors<dim>(
-                                  *this->dof_handler,
-                                  vertices_to_cell,
+                              cached_stencil = &ib_stencil_cache.store(
+                                cell_cut->active_cell_index(),
+                                i,
+                                compute_ib_stencil(
                                   cell_cut,
-                                  point_to_find_cell);
+                                  ib_particle_id,
+                                  support_points[local_dof_indices[i]],
+                                  global_index_overwrite));
+                              ++n_stencils_computed;
                             }
-                          catch (...)
+                          else
+                            ++n_stencils_reused;
+
+                          const IBStencilCacheEntry<dim> &ib_stencil =
+                            *cached_stencil;
+                          const auto &stencil_cell = ib_stencil.stencil_cell;
+                          const bool  particle_close_to_wall =
+                            ib_stencil.particle_close_to_wall;
+
+                          // If the DOF is on a boundary and a boundary
+                          // condition is already applied to it we skip it,
+                          // otherwise we impose a value base on the velocity
+                          // of the particle.
+                          if (particle_close_to_wall &&
+                              (this->zero_constraints.is_constrained(
+                                 global_index_overwrite) ||
+                               this->nonzero_constraints.is_constrained(
+                                 global_index_overwrite)))
                             {
-                              // If we are here, the DOF is on a boundary.
-                              particle_close_to_wall = true;
-                              stencil_cell           = cell_cut;
-                              // If a boundary condition is already applied to
-                              // this DOF we skip it otherwise we impose a value
-                              // base on the velocity of the particle.
-                              if (this->zero_constraints.is_constrained(
-                                    global_index_overwrite) ||
-                                  this->nonzero_constraints.is_constrained(
-                                    global_index_overwrite))
-                                {
-                                  continue;
-                                }
+                              continue;
                             }
 
                           stencil_cell->get_dof_indices(local_dof_indices_2);
@@ -3488,27 +3428,15 @@ FluidDynamicsSharp<dim>::sharp_edge()
                           // used for the definition of the stencil
                           // ("stencil_cell") is on a face between the cell_cut
                           // that is cut ("cell_cut") and the "stencil_cell".
-                          bool point_in_cell;
-                          // The extrapolation can be disabled for debugging
-                          // purposes, although in most cases it shouldn't since
-                          // it is a core part of this solver
-                          if (this->simulation_parameters.particlesParameters
-                                ->enable_extrapolation)
-                            point_in_cell = cell_cut->point_inside(
-                              interpolation_points
-                                [stencil.number_of_interpolation_support_points(
-                                   order) -
-                                 1]);
-                          else
-                            point_in_cell = cell_cut->point_inside(
-                              support_points[local_dof_indices[i]]);
+                          const bool point_in_cell = ib_stencil.point_in_cell;
 
                           bool         dof_is_dummy = false;
                           bool         cell2_is_cut;
                           unsigned int ib_particle_id_2;
                           std::tie(cell2_is_cut,
                                    ib_particle_id_2,
-                                   std::ignore) = cut_cells_map[stencil_cell];
+                                   std::ignore) =
+                            cut_cells_map[stencil_cell->active_cell_index()];
                           bool cell2_is_overconstrained;
                           std::tie(cell2_is_overconstrained,
                                    std::ignore,
@@ -3541,33 +3469,6 @@ FluidDynamicsSharp<dim>::sharp_edge()
                                   dof_on_ib = true;
                                 }
                             }
-                          // Define the variable used for the
-                          // extrapolation of the actual solution at the
-                          // boundaries in order to define the correction
-
-                          // Define the unit cell_cut points for the points
-                          // used in the stencil.
-                          std::vector<Point<dim>>
-                            unite_cell_interpolation_points(ib_coef.size());
-                          unite_cell_interpolation_points[0] =
-                            this->mapping->transform_real_to_unit_cell(
-                              stencil_cell, point);
-                          for (unsigned int j = 1; j < ib_coef.size(); ++j)
-                            {
-                              // The extrapolation can be disabled for debugging
-                              // purposes, although in most cases it shouldn't
-                              // since it is a core part of this solver
-                              if (this->simulation_parameters
-                                    .particlesParameters->enable_extrapolation)
-                                unite_cell_interpolation_points[j] =
-                                  this->mapping->transform_real_to_unit_cell(
-                                    stencil_cell, interpolation_points[j - 1]);
-                              else
-                                unite_cell_interpolation_points[j] =
-                                  this->mapping->transform_real_to_unit_cell(
-                                    stencil_cell,
-                                    support_points[local_dof_indices[i]]);
-                            }
 
                           std::vector<double> local_interp_sol(ib_coef.size());
 
@@ -3607,17 +3508,13 @@ FluidDynamicsSharp<dim>::sharp_edge()
                                            k < ib_coef.size();
                                            ++k)
                                         {
+                                          const double shape_value =
+                                            ib_stencil.shape_values
+                                              [j * ib_coef.size() + k];
                                           local_matrix_entry +=
-                                            this->fe->shape_value(
-                                              j,
-                                              unite_cell_interpolation_points
-                                                [k]) *
-                                            ib_coef[k];
+                                            shape_value * ib_coef[k];
                                           local_interp_sol[k] +=
-                                            this->fe->shape_value(
-                                              j,
-                                              unite_cell_interpolation_points
-                                                [k]) *
+                                            shape_value *
                                             this->evaluation_point(
                                               local_dof_indices_2[j]);
                                         }
@@ -3796,7 +3693,9 @@ FluidDynamicsSharp<dim>::sharp_edge()
                                           std::tie(cell_is_cut,
                                                    std::ignore,
                                                    std::ignore) =
-                                            cut_cells_map[neighbor_cell];
+                                            cut_cells_map
+                                              [neighbor_cell
+                                                 ->active_cell_index()];
                                           bool cell_is_overconstrained;
                                           std::tie(cell_is_overconstrained,
                                                    std::ignore,
@@ -3835,6 +3734,21 @@ FluidDynamicsSharp<dim>::sharp_edge()
 
   this->system_rhs.compress(VectorOperation::insert);
   this->system_matrix.compress(VectorOperation::add);
+
+  if (this->simulation_parameters.particlesParameters->print_stencil_reuse)
+    {
+      n_stencils_computed =
+        Utilities::MPI::sum(n_stencils_computed, this->mpi_communicator);
+      n_stencils_reused =
+        Utilities::MPI::sum(n_stencils_reused, this->mpi_communicator);
+      const unsigned int n_stencils = n_stencils_computed + n_stencils_reused;
+
+      this->pcout << "IB stencils reused: " << n_stencils_reused << "/"
+                  << n_stencils << " ("
+                  << (n_stencils > 0 ? 100. * n_stencils_reused / n_stencils :
+                                       0.)
+                  << " %)" << std::endl;
+    }
 }
 
 
@@ -3977,7 +3891,8 @@ FluidDynamicsSharp<dim>::assemble_local_system_matrix(
   // cell is cut or overconstrained, we adjust the copy data so that the
   // assemblers don't execute work on this cell.
   bool cell_is_cut                                = false;
-  std::tie(cell_is_cut, std::ignore, std::ignore) = cut_cells_map[cell];
+  std::tie(cell_is_cut, std::ignore, std::ignore) =
+    cut_cells_map[cell->active_cell_index()];
   bool cell_is_overconstrained;
   std::tie(cell_is_overconstrained, std::ignore, std::ignore) =
     overconstrained_fluid_cell_map[cell];
@@ -4019,7 +3934,8 @@ FluidDynamicsSharp<dim>::assemble_local_system_matrix(
   // check if we assemble the NS equation inside the particle or the Laplacian
   // of the variables
   bool cell_is_inside;
-  std::tie(cell_is_inside, std::ignore) = cells_inside_map[cell];
+  std::tie(cell_is_inside, std::ignore) =
+    cells_inside_map[cell->active_cell_index()];
   if (cell_is_inside && this->simulation_parameters.particlesParameters
                             ->assemble_navier_stokes_inside == false)
     {
@@ -4068,7 +3984,8 @@ FluidDynamicsSharp<dim>::assemble_local_system_rhs(
   // cell is cut or overconstrained, we adjust the copy data so that the
   // assemblers don't execute work on this cell.
   bool cell_is_cut                                = false;
-  std::tie(cell_is_cut, std::ignore, std::ignore) = cut_cells_map[cell];
+  std::tie(cell_is_cut, std::ignore, std::ignore) =
+    cut_cells_map[cell->active_cell_index()];
 
   bool cell_is_overconstrained;
   std::tie(cell_is_overconstrained, std::ignore, std::ignore) =
@@ -4111,7 +4028,8 @@ FluidDynamicsSharp<dim>::assemble_local_system_rhs(
   // check if we assemble the NS equation inside the particle or the Laplacian
   // of the variables
   bool cell_is_inside;
-  std::tie(cell_is_inside, std::ignore) = cells_inside_map[cell];
+  std::tie(cell_is_inside, std::ignore) =
+    cells_inside_map[cell->active_cell_index()];
   if (cell_is_inside && this->simulation_parameters.particlesParameters
                             ->assemble_navier_stokes_inside == false)
     {
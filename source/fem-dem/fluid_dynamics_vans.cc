@@ -49,6 +49,18 @@ FluidDynamicsVANS<dim>::FluidDynamicsVANS(
             }
         }
     }
+
+  AssertThrow(
+    !nsparam.cfd_parameters.simulation_control.adapt_with_error,
+    ExcMessage(
+      "The adaptation of the time step with the error estimate is only supported by the matrix-based fluid dynamics solver (lethe-fluid), since the VANS and CFD-DEM solvers do not estimate the error of the time step."));
+
+  AssertThrow(
+    !nsparam.cfd_parameters.physics_solving_strategy
+       .at(PhysicsID::fluid_dynamics)
+       .enable_cell_activity_map,
+    ExcMessage(
+      "The cell activity map is not supported by the VANS and CFD-DEM solvers, which assemble its own local matrices."));
 }
 
 template <int dim>
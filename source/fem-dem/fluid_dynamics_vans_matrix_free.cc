@@ -23,6 +23,7 @@ MFNavierStokesVANSPreconditionGMG<dim>::MFNavierStokesVANSPreconditionGMG(
                                        dof_handler,
                                        dof_handler_fe_q_iso_q1)
   , cfd_dem_simulation_parameters(param)
+  , particle_fluid_transfers_are_built(false)
 {}
 
 template <int dim>
@@ -63,189 +64,34 @@ MFNavierStokesVANSPreconditionGMG<dim>::initialize(
       const unsigned int min_level = this->minlevel;
       const unsigned int max_level = this->maxlevel;
 
-      // Resize all of the dof handlers related to every field for the
-      // particle-fluid coupling
-      this->void_fraction_dof_handlers.resize(min_level, max_level);
-      this->pf_force_dof_handlers.resize(min_level, max_level);
-      this->pf_drag_dof_handlers.resize(min_level, max_level);
-      this->particle_velocity_dof_handlers.resize(min_level, max_level);
-      this->momentum_transfer_coefficient_dof_handlers.resize(min_level,
-                                                              max_level);
+      // The level DoF handlers and transfers only depend on the mesh, they are
+      // built once for the lifetime of the preconditioner
+      if (!particle_fluid_transfers_are_built)
+        setup_particle_fluid_transfers(particle_projector);
 
-
-      for (unsigned int l = min_level; l <= max_level; l++)
-        {
-          // Void fraction
-          this->void_fraction_dof_handlers[l].reinit(
-            this->dof_handlers[l].get_triangulation());
-          this->void_fraction_dof_handlers[l].distribute_dofs(
-            particle_projector.dof_handler.get_fe());
-
-          // Particle-fluid force
-          this->pf_force_dof_handlers[l].reinit(
-            this->dof_handlers[l].get_triangulation());
-          this->pf_force_dof_handlers[l].distribute_dofs(
-            particle_projector.fluid_force_on_particles_two_way_coupling
-              .dof_handler.get_fe());
-
-          // Particle-fluid drag
-          this->pf_drag_dof_handlers[l].reinit(
-            this->dof_handlers[l].get_triangulation());
-          this->pf_drag_dof_handlers[l].distribute_dofs(
-            particle_projector.fluid_drag_on_particles.dof_handler.get_fe());
-
-          // Particle velocity field
-          this->particle_velocity_dof_handlers[l].reinit(
-            this->dof_handlers[l].get_triangulation());
-          this->particle_velocity_dof_handlers[l].distribute_dofs(
-            particle_projector.particle_velocity.dof_handler.get_fe());
-
-          // Momentum exchange coefficient
-          this->momentum_transfer_coefficient_dof_handlers[l].reinit(
-            this->dof_handlers[l].get_triangulation());
-          this->momentum_transfer_coefficient_dof_handlers[l].distribute_dofs(
-            particle_projector.momentum_transfer_coefficient.dof_handler
-              .get_fe());
-        }
-
-      this->transfers_void_fraction.resize(min_level, max_level);
-      this->transfers_pf_force.resize(min_level, max_level);
-      this->transfers_pf_drag.resize(min_level, max_level);
-      this->transfers_particle_velocity.resize(min_level, max_level);
-      this->transfers_momentum_transfer_coefficient.resize(min_level,
-                                                           max_level);
-
-
-      for (unsigned int l = min_level; l < max_level; l++)
-        {
-          this->transfers_void_fraction[l + 1].reinit(
-            this->void_fraction_dof_handlers[l + 1],
-            this->void_fraction_dof_handlers[l],
-            {},
-            {});
-
-          this->transfers_pf_force[l + 1].reinit(
-            this->pf_force_dof_handlers[l + 1],
-            this->pf_force_dof_handlers[l],
-            {},
-            {});
-
-          this->transfers_pf_drag[l + 1].reinit(
-            this->pf_drag_dof_handlers[l + 1],
-            this->pf_drag_dof_handlers[l],
-            {},
-            {});
-
-          this->transfers_particle_velocity[l + 1].reinit(
-            this->particle_velocity_dof_handlers[l + 1],
-            this->particle_velocity_dof_handlers[l],
-            {},
-            {});
-
-          this->transfers_momentum_transfer_coefficient[l + 1].reinit(
-            this->momentum_transfer_coefficient_dof_handlers[l + 1],
-            this->momentum_transfer_coefficient_dof_handlers[l],
-            {},
-            {});
-        }
-
-      // Make the transfer operators for every field we will transfer
-      this->mg_transfer_gc_void_fraction =
-        std::make_shared<MFNavierStokesVANSPreconditionGMG::GCTransferType>(
-          this->transfers_void_fraction);
-
-      this->mg_transfer_gc_pf_force =
-        std::make_shared<MFNavierStokesVANSPreconditionGMG::GCTransferType>(
-          this->transfers_pf_force);
-
-      this->mg_transfer_gc_pf_drag =
-        std::make_shared<MFNavierStokesVANSPreconditionGMG::GCTransferType>(
-          this->transfers_pf_drag);
-
-      this->mg_transfer_gc_particle_velocity =
-        std::make_shared<MFNavierStokesVANSPreconditionGMG::GCTransferType>(
-          this->transfers_particle_velocity);
-
-      this->mg_transfer_gc_momentum_transfer_coefficient =
-        std::make_shared<MFNavierStokesVANSPreconditionGMG::GCTransferType>(
-          this->transfers_momentum_transfer_coefficient);
-
-
-      // Build transfer operator for every field
-      this->mg_transfer_gc_void_fraction->build(
-        particle_projector.dof_handler, [&](const auto l, auto &vec) {
-          vec.reinit(
-            this->void_fraction_dof_handlers[l].locally_owned_dofs(),
-            DoFTools::extract_locally_active_dofs(
-              this->void_fraction_dof_handlers[l]),
-            this->void_fraction_dof_handlers[l].get_mpi_communicator());
-        });
-
-      this->mg_transfer_gc_pf_force->build(
-        particle_projector.fluid_force_on_particles_two_way_coupling
-          .dof_handler,
-        [&](const auto l, auto &vec) {
-          vec.reinit(this->pf_force_dof_handlers[l].locally_owned_dofs(),
-                     DoFTools::extract_locally_active_dofs(
-                       this->pf_force_dof_handlers[l]),
-                     this->pf_force_dof_handlers[l].get_mpi_communicator());
-        });
-
-      this->mg_transfer_gc_pf_force->build(
-        particle_projector.fluid_drag_on_particles.dof_handler,
-        [&](const auto l, auto &vec) {
-          vec.reinit(this->pf_drag_dof_handlers[l].locally_owned_dofs(),
-                     DoFTools::extract_locally_active_dofs(
-                       this->pf_drag_dof_handlers[l]),
-                     this->pf_drag_dof_handlers[l].get_mpi_communicator());
-        });
-
-      this->mg_transfer_gc_particle_velocity->build(
-        particle_projector.particle_velocity.dof_handler,
-        [&](const auto l, auto &vec) {
-          vec.reinit(
-            this->particle_velocity_dof_handlers[l].locally_owned_dofs(),
-            DoFTools::extract_locally_active_dofs(
-              this->particle_velocity_dof_handlers[l]),
-            this->particle_velocity_dof_handlers[l].get_mpi_communicator());
-        });
-
-      this->mg_transfer_gc_momentum_transfer_coefficient->build(
-        particle_projector.momentum_transfer_coefficient.dof_handler,
-        [&](const auto l, auto &vec) {
-          vec.reinit(this->momentum_transfer_coefficient_dof_handlers[l]
-                       .locally_owned_dofs(),
-                     DoFTools::extract_locally_active_dofs(
-                       this->momentum_transfer_coefficient_dof_handlers[l]),
-                     this->momentum_transfer_coefficient_dof_handlers[l]
-                       .get_mpi_communicator());
-        });
+      // Only the fields required by the drag coupling are transferred to the
+      // levels, the other ones are left empty and are not evaluated by the
+      // level operators
+      const bool is_explicit =
+        cfd_dem_simulation_parameters.cfd_dem.drag_coupling ==
+        Parameters::DragCoupling::fully_explicit;
 
       // Create the MG Level Object for every field
-      MGLevelObject<MFNavierStokesVANSPreconditionGMG::MGVectorType>
-        mg_void_fraction_solution(this->minlevel, this->maxlevel);
-
-      MGLevelObject<MFNavierStokesVANSPreconditionGMG::MGVectorType>
-        mg_time_derivative_void_fraction(this->minlevel, this->maxlevel);
-
-      MGLevelObject<MFNavierStokesVANSPreconditionGMG::MGVectorType>
-        mg_pf_forces_solution(this->minlevel, this->maxlevel);
-
-      MGLevelObject<MFNavierStokesVANSPreconditionGMG::MGVectorType>
-        mg_pf_drag_solution(this->minlevel, this->maxlevel);
-
-      MGLevelObject<MFNavierStokesVANSPreconditionGMG::MGVectorType>
-        mg_particle_velocity_solution(this->minlevel, this->maxlevel);
-
-      MGLevelObject<MFNavierStokesVANSPreconditionGMG::MGVectorType>
-        mg_momentum_transfer_coefficient_solution(this->minlevel,
-                                                  this->maxlevel);
-
-      // A deal.II vector is required here, so we take the deal.II vector
-      // solution from the particle projector instead of the Trillinos vector
-      // one. This is done for every field.
-
-      // Void fraction
+      MGLevelObject<MGVectorType> mg_void_fraction_solution(min_level,
+                                                            max_level);
+      MGLevelObject<MGVectorType> mg_time_derivative_void_fraction(min_level,
+                                                                   max_level);
+      MGLevelObject<MGVectorType> mg_pf_forces_solution(min_level, max_level);
+      MGLevelObject<MGVectorType> mg_pf_drag_solution(min_level, max_level);
+      MGLevelObject<MGVectorType> mg_particle_velocity_solution(min_level,
+                                                                max_level);
+      MGLevelObject<MGVectorType> mg_momentum_transfer_coefficient_solution(
+        min_level, max_level);
+
+      // The deal.II vectors of the particle projector, in which the
+      // matrix-free projection solves the void fraction, are interpolated
+      // directly to the levels. The void fraction and its time derivative use
+      // the same transfer.
       this->mg_transfer_gc_void_fraction->interpolate_to_mg(
         particle_projector.dof_handler,
         mg_void_fraction_solution,
@@ -256,45 +102,49 @@ MFNavierStokesVANSPreconditionGMG<dim>::initialize(
         mg_time_derivative_void_fraction,
         time_derivative_void_fraction);
 
+      // Particle-fluid force
       particle_projector.fluid_force_on_particles_two_way_coupling
         .particle_field_solution.update_ghost_values();
 
-      // Particle-fluid force
-      this->mg_transfer_gc_pf_force->interpolate_to_mg(
+      this->mg_transfer_gc_particle_field->interpolate_to_mg(
         particle_projector.fluid_force_on_particles_two_way_coupling
           .dof_handler,
         mg_pf_forces_solution,
         particle_projector.fluid_force_on_particles_two_way_coupling
           .particle_field_solution);
 
-      // Particle-fluid drag
-      particle_projector.fluid_drag_on_particles.particle_field_solution
-        .update_ghost_values();
-
-      this->mg_transfer_gc_pf_force->interpolate_to_mg(
-        particle_projector.fluid_drag_on_particles.dof_handler,
-        mg_pf_drag_solution,
-        particle_projector.fluid_drag_on_particles.particle_field_solution);
-
-      // Particle-velocity
-      particle_projector.particle_velocity.particle_field_solution
-        .update_ghost_values();
-
-      this->mg_transfer_gc_pf_force->interpolate_to_mg(
-        particle_projector.particle_velocity.dof_handler,
-        mg_particle_velocity_solution,
-        particle_projector.particle_velocity.particle_field_solution);
-
-      // Momentum transfer coefficient
-      particle_projector.momentum_transfer_coefficient.particle_field_solution
-        .update_ghost_values();
-
-      this->mg_transfer_gc_momentum_transfer_coefficient->interpolate_to_mg(
-        particle_projector.momentum_transfer_coefficient.dof_handler,
-        mg_momentum_transfer_coefficient_solution,
-        particle_projector.momentum_transfer_coefficient
-          .particle_field_solution);
+      if (is_explicit)
+        {
+          // Particle-fluid drag
+          particle_projector.fluid_drag_on_particles.particle_field_solution
+            .update_ghost_values();
 
+          this->mg_transfer_gc_particle_field->interpolate_to_mg(
+            particle_projector.fluid_drag_on_particles.dof_handler,
+            mg_pf_drag_solution,
+            particle_projector.fluid_drag_on_particles.particle_field_solution);
+        }
+      else
+        {
+          // Particle velocity
+          particle_projector.particle_velocity.particle_field_solution
+            .update_ghost_values();
+
+          this->mg_transfer_gc_particle_field->interpolate_to_mg(
+            particle_projector.particle_velocity.dof_handler,
+            mg_particle_velocity_solution,
+            particle_projector.particle_velocity.particle_field_solution);
+
+          // Momentum transfer coefficient
+          particle_projector.momentum_transfer_coefficient
+            .particle_field_solution.update_ghost_values();
+
+          this->mg_transfer_gc_momentum_transfer_coefficient->interpolate_to_mg(
+            particle_projector.momentum_transfer_coefficient.dof_handler,
+            mg_momentum_transfer_coefficient_solution,
+            particle_projector.momentum_transfer_coefficient
+              .particle_field_solution);
+        }
 
       for (unsigned int l = min_level; l <= max_level; l++)
         {
@@ -314,11 +164,11 @@ MFNavierStokesVANSPreconditionGMG<dim>::initialize(
                 mg_time_derivative_void_fraction[l]);
 
               mf_operator->compute_particle_fluid_interaction(
-                this->pf_force_dof_handlers[l],
+                this->particle_field_dof_handlers[l],
                 mg_pf_forces_solution[l],
-                this->pf_drag_dof_handlers[l],
+                this->particle_field_dof_handlers[l],
                 mg_pf_drag_solution[l],
-                this->particle_velocity_dof_handlers[l],
+                this->particle_field_dof_handlers[l],
                 mg_particle_velocity_solution[l],
                 this->momentum_transfer_coefficient_dof_handlers[l],
                 mg_momentum_transfer_coefficient_solution[l]);
@@ -333,6 +183,112 @@ MFNavierStokesVANSPreconditionGMG<dim>::initialize(
     time_derivative_previous_solutions);
 }
 
+template <int dim>
+void
+MFNavierStokesVANSPreconditionGMG<dim>::setup_particle_fluid_transfers(
+  const ParticleProjector<dim> &particle_projector)
+{
+  const unsigned int min_level = this->minlevel;
+  const unsigned int max_level = this->maxlevel;
+
+  // Resize all of the dof handlers related to every field for the
+  // particle-fluid coupling
+  this->void_fraction_dof_handlers.resize(min_level, max_level);
+  this->particle_field_dof_handlers.resize(min_level, max_level);
+  this->momentum_transfer_coefficient_dof_handlers.resize(min_level,
+                                                          max_level);
+
+  for (unsigned int l = min_level; l <= max_level; l++)
+    {
+      // Void fraction
+      this->void_fraction_dof_handlers[l].reinit(
+        this->dof_handlers[l].get_triangulation());
+      this->void_fraction_dof_handlers[l].distribute_dofs(
+        particle_projector.dof_handler.get_fe());
+
+      // Particle fields (force, drag and particle velocity)
+      this->particle_field_dof_handlers[l].reinit(
+        this->dof_handlers[l].get_triangulation());
+      this->particle_field_dof_handlers[l].distribute_dofs(
+        particle_projector.fluid_force_on_particles_two_way_coupling.dof_handler
+          .get_fe());
+
+      // Momentum exchange coefficient
+      this->momentum_transfer_coefficient_dof_handlers[l].reinit(
+        this->dof_handlers[l].get_triangulation());
+      this->momentum_transfer_coefficient_dof_handlers[l].distribute_dofs(
+        particle_projector.momentum_transfer_coefficient.dof_handler.get_fe());
+    }
+
+  this->transfers_void_fraction.resize(min_level, max_level);
+  this->transfers_particle_field.resize(min_level, max_level);
+  this->transfers_momentum_transfer_coefficient.resize(min_level, max_level);
+
+  for (unsigned int l = min_level; l < max_level; l++)
+    {
+      this->transfers_void_fraction[l + 1].reinit(
+        this->void_fraction_dof_handlers[l + 1],
+        this->void_fraction_dof_handlers[l],
+        {},
+        {});
+
+      this->transfers_particle_field[l + 1].reinit(
+        this->particle_field_dof_handlers[l + 1],
+        this->particle_field_dof_handlers[l],
+        {},
+        {});
+
+      this->transfers_momentum_transfer_coefficient[l + 1].reinit(
+        this->momentum_transfer_coefficient_dof_handlers[l + 1],
+        this->momentum_transfer_coefficient_dof_handlers[l],
+        {},
+        {});
+    }
+
+  // Make the transfer operators for every field we will transfer
+  this->mg_transfer_gc_void_fraction =
+    std::make_shared<GCTransferType>(this->transfers_void_fraction);
+
+  this->mg_transfer_gc_particle_field =
+    std::make_shared<GCTransferType>(this->transfers_particle_field);
+
+  this->mg_transfer_gc_momentum_transfer_coefficient =
+    std::make_shared<GCTransferType>(
+      this->transfers_momentum_transfer_coefficient);
+
+  // Build transfer operator for every field
+  this->mg_transfer_gc_void_fraction->build(
+    particle_projector.dof_handler, [&](const auto l, auto &vec) {
+      vec.reinit(this->void_fraction_dof_handlers[l].locally_owned_dofs(),
+                 DoFTools::extract_locally_active_dofs(
+                   this->void_fraction_dof_handlers[l]),
+                 this->void_fraction_dof_handlers[l].get_mpi_communicator());
+    });
+
+  this->mg_transfer_gc_particle_field->build(
+    particle_projector.fluid_force_on_particles_two_way_coupling.dof_handler,
+    [&](const auto l, auto &vec) {
+      vec.reinit(this->particle_field_dof_handlers[l].locally_owned_dofs(),
+                 DoFTools::extract_locally_active_dofs(
+                   this->particle_field_dof_handlers[l]),
+                 this->particle_field_dof_handlers[l].get_mpi_communicator());
+    });
+
+  this->mg_transfer_gc_momentum_transfer_coefficient->build(
+    particle_projector.momentum_transfer_coefficient.dof_handler,
+    [&](const auto l, auto &vec) {
+      vec.reinit(
+        this->momentum_transfer_coefficient_dof_handlers[l]
+          .locally_owned_dofs(),
+        DoFTools::extract_locally_active_dofs(
+          this->momentum_transfer_coefficient_dof_handlers[l]),
+        this->momentum_transfer_coefficient_dof_handlers[l]
+          .get_mpi_communicator());
+    });
+
+  particle_fluid_transfers_are_built = true;
+}
+
 template <int dim>
 FluidDynamicsVANSMatrixFree<dim>::FluidDynamicsVANSMatrixFree(
   CFDDEMSimulationParameters<dim> &param)
@@ -351,7 +307,8 @@ FluidDynamicsVANSMatrixFree<dim>::FluidDynamicsVANSMatrixFree(
       this->cfd_dem_simulation_parameters.cfd_parameters.fem_parameters
         .void_fraction_order,
       this->cfd_dem_simulation_parameters.cfd_parameters.mesh.simplex,
-      this->pcout)
+      this->pcout,
+      true)
   , has_periodic_boundaries(false)
 {
   unsigned int n_pbc = 0;
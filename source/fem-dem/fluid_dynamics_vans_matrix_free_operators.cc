@@ -50,6 +50,99 @@ VANSOperator<dim, number>::evaluate_non_linear_term_and_calculate_tau(
     }
 }
 
+template <int dim, typename number>
+template <typename StoreFunction>
+void
+VANSOperator<dim, number>::evaluate_field_at_quadrature_points(
+  const DoFHandler<dim>                            &field_dof_handler,
+  const LinearAlgebra::distributed::Vector<double> &field_solution,
+  const bool                                        evaluate_gradients,
+  const StoreFunction                              &store_values) const
+{
+  const FiniteElement<dim> &fe         = field_dof_handler.get_fe();
+  const Quadrature<dim>    &quadrature = this->matrix_free.get_quadrature();
+  const unsigned int        n_dofs_per_cell = fe.n_dofs_per_cell();
+  const unsigned int        n_q_points      = quadrature.size();
+
+  // The shape functions of the field are evaluated once on the reference cell
+  // at the quadrature points used by the matrix-free operator. The fields are
+  // thus interpolated without reinitializing a FEValues (and its mapping) on
+  // every cell.
+  std::vector<unsigned int> dof_component(n_dofs_per_cell);
+  Table<2, double>          shape_values(n_dofs_per_cell, n_q_points);
+  Table<2, Tensor<1, dim>>  reference_shape_gradients;
+  if (evaluate_gradients)
+    reference_shape_gradients.reinit(n_dofs_per_cell, n_q_points);
+
+  for (unsigned int i = 0; i < n_dofs_per_cell; ++i)
+    {
+      dof_component[i] = fe.system_to_component_index(i).first;
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          shape_values(i, q) = fe.shape_value(i, quadrature.point(q));
+          if (evaluate_gradients)
+            reference_shape_gradients(i, q) =
+              fe.shape_grad(i, quadrature.point(q));
+        }
+    }
+
+  Vector<double>           local_dof_values(n_dofs_per_cell);
+  Table<2, double>         values(n_q_points, fe.n_components());
+  Table<2, Tensor<1, dim>> gradients(n_q_points, fe.n_components());
+
+  // The integrator is only used to access the inverse Jacobians stored by the
+  // matrix-free object when the gradients are required
+  FECellIntegrator integrator(this->matrix_free);
+
+  for (unsigned int cell = 0; cell < this->matrix_free.n_cell_batches(); ++cell)
+    {
+      if (evaluate_gradients)
+        integrator.reinit(cell);
+
+      for (auto lane = 0u;
+           lane < this->matrix_free.n_active_entries_per_cell_batch(cell);
+           lane++)
+        {
+          this->matrix_free.get_cell_iterator(cell, lane)
+            ->as_dof_handler_iterator(field_dof_handler)
+            ->get_dof_values(field_solution, local_dof_values);
+
+          values.reset_values();
+          gradients.reset_values();
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            for (unsigned int i = 0; i < n_dofs_per_cell; ++i)
+              {
+                values(q, dof_component[i]) +=
+                  local_dof_values[i] * shape_values(i, q);
+                if (evaluate_gradients)
+                  gradients(q, dof_component[i]) +=
+                    local_dof_values[i] * reference_shape_gradients(i, q);
+              }
+
+          // Map the gradients from the reference cell to the real cell with
+          // the transposed inverse Jacobian
+          if (evaluate_gradients)
+            for (unsigned int q = 0; q < n_q_points; ++q)
+              {
+                const auto inverse_jacobian = integrator.inverse_jacobian(q);
+                for (unsigned int c = 0; c < fe.n_components(); ++c)
+                  {
+                    const Tensor<1, dim> reference_gradient = gradients(q, c);
+                    for (int d = 0; d < dim; ++d)
+                      {
+                        gradients(q, c)[d] = 0.;
+                        for (int e = 0; e < dim; ++e)
+                          gradients(q, c)[d] += inverse_jacobian[d][e][lane] *
+                                                reference_gradient[e];
+                      }
+                  }
+              }
+
+          store_values(cell, lane, values, gradients);
+        }
+    }
+}
+
 template <int dim, typename number>
 void
 VANSOperator<dim, number>::compute_void_fraction(
@@ -63,54 +156,37 @@ VANSOperator<dim, number>::compute_void_fraction(
   const unsigned int n_cells = this->matrix_free.n_cell_batches();
   FECellIntegrator   integrator(this->matrix_free);
 
-
   void_fraction.reinit(n_cells, integrator.n_q_points);
   void_fraction_gradient.reinit(n_cells, integrator.n_q_points);
   time_derivative_void_fraction.reinit(n_cells, integrator.n_q_points);
 
-
-  FEValues<dim> fe_values(*(this->matrix_free.get_mapping_info().mapping),
-                          void_fraction_dof_handler.get_fe(),
-                          this->matrix_free.get_quadrature(),
-                          update_values | update_gradients);
-
-  std::vector<double> cell_void_fraction(fe_values.n_quadrature_points);
-  std::vector<double> cell_time_derivative_void_fraction(
-    fe_values.n_quadrature_points);
-
-  std::vector<Tensor<1, dim>> cell_void_fraction_gradient(
-    fe_values.n_quadrature_points);
-
-
-  for (unsigned int cell = 0; cell < n_cells; ++cell)
-    {
-      for (auto lane = 0u;
-           lane < this->matrix_free.n_active_entries_per_cell_batch(cell);
-           lane++)
+  evaluate_field_at_quadrature_points(
+    void_fraction_dof_handler,
+    void_fraction_solution,
+    true,
+    [&](const unsigned int              cell,
+        const unsigned int              lane,
+        const Table<2, double>         &values,
+        const Table<2, Tensor<1, dim>> &gradients) {
+      for (unsigned int q = 0; q < integrator.n_q_points; ++q)
         {
-          fe_values.reinit(
-            this->matrix_free.get_cell_iterator(cell, lane)
-              ->as_dof_handler_iterator(void_fraction_dof_handler));
-
-          fe_values.get_function_values(void_fraction_solution,
-                                        cell_void_fraction);
-          fe_values.get_function_values(time_derivative_void_fraction_solution,
-                                        cell_time_derivative_void_fraction);
-          fe_values.get_function_gradients(void_fraction_solution,
-                                           cell_void_fraction_gradient);
-
-          for (const auto q : fe_values.quadrature_point_indices())
-            {
-              for (int c = 0; c < dim; ++c)
-                void_fraction_gradient[cell][q][c][lane] =
-                  cell_void_fraction_gradient[q][c];
-
-              void_fraction[cell][q][lane] = cell_void_fraction[q];
-              time_derivative_void_fraction[cell][q][lane] =
-                cell_time_derivative_void_fraction[q];
-            }
+          void_fraction[cell][q][lane] = values(q, 0);
+          for (int c = 0; c < dim; ++c)
+            void_fraction_gradient[cell][q][c][lane] = gradients(q, 0)[c];
         }
-    }
+    });
+
+  evaluate_field_at_quadrature_points(
+    void_fraction_dof_handler,
+    time_derivative_void_fraction_solution,
+    false,
+    [&](const unsigned int      cell,
+        const unsigned int      lane,
+        const Table<2, double> &values,
+        const Table<2, Tensor<1, dim>> &) {
+      for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+        time_derivative_void_fraction[cell][q][lane] = values(q, 0);
+    });
 
   this->timer.leave_subsection("operator::compute_void_fraction");
 }
@@ -132,14 +208,13 @@ VANSOperator<dim, number>::compute_particle_fluid_interaction(
 
 
   // If the coupling is explicit, we do not need to gather the momentum transfer
-  // and the particle velocity. Consequently, these FEValues will never be
-  // reinit and used.
+  // and the particle velocity. Consequently, these fields are left to zero.
   const bool is_explicit = cfd_dem_parameters.drag_coupling ==
                            Parameters::DragCoupling::fully_explicit;
 
   // If the coupling is implicit, we do not need to gather the drag force since
-  // the drag is calculated from the momentum_transfer term. Consequently, these
-  // two FEValues will never be reinit and used.
+  // the drag is calculated from the momentum_transfer term. Consequently, this
+  // field is left to zero.
   const bool is_implicit = cfd_dem_parameters.drag_coupling !=
                            Parameters::DragCoupling::fully_explicit;
 
@@ -165,113 +240,72 @@ VANSOperator<dim, number>::compute_particle_fluid_interaction(
   particle_velocity.reinit(n_cells, integrator.n_q_points);
   momentum_transfer_coefficient.reinit(n_cells, integrator.n_q_points);
 
-
-  // We create one FE_values per field that we wish to interpolate. This comes
-  // with a significant overhead, but that's life.
-  FEValues<dim> fe_values_force(*(this->matrix_free.get_mapping_info().mapping),
-                                fp_force_dof_handler.get_fe(),
-                                this->matrix_free.get_quadrature(),
-                                update_values);
-
-  FEValues<dim> fe_values_drag(*(this->matrix_free.get_mapping_info().mapping),
-                               fp_force_dof_handler.get_fe(),
-                               this->matrix_free.get_quadrature(),
-                               update_values);
-
-  FEValues<dim> fe_values_particle_velocity(
-    *(this->matrix_free.get_mapping_info().mapping),
-    particle_velocity_dof_handler.get_fe(),
-    this->matrix_free.get_quadrature(),
-    update_values);
-
-  FEValues<dim> fe_values_momentum_transfer_coefficient(
-    *(this->matrix_free.get_mapping_info().mapping),
-    momentum_transfer_coefficient_dof_handler.get_fe(),
-    this->matrix_free.get_quadrature(),
-    update_values);
-
-  std::vector<Tensor<1, dim>> cell_fp_force(
-    fe_values_force.n_quadrature_points);
-  std::vector<Tensor<1, dim>> cell_fp_drag(fe_values_drag.n_quadrature_points);
-  std::vector<Tensor<1, dim>> cell_particle_velocity(
-    fe_values_particle_velocity.n_quadrature_points);
-  std::vector<double> cell_momentum_transfer_coefficient(
-    fe_values_force.n_quadrature_points, 0.);
-
-  constexpr FEValuesExtractors::Vector vector_index(0);
-
-  for (unsigned int cell = 0; cell < n_cells; ++cell)
+  // The fields that are not required by the coupling scheme are left to zero
+  particle_fluid_drag.reset_values();
+  particle_velocity.reset_values();
+  momentum_transfer_coefficient.reset_values();
+
+  // The force applied on the fluid from the particle is (-) the force applied
+  // on the particles by the fluid following Newton's third law. They are also
+  // divided by the density of the fluid phase.
+  evaluate_field_at_quadrature_points(
+    fp_force_dof_handler,
+    fp_force_solution,
+    false,
+    [&](const unsigned int      cell,
+        const unsigned int      lane,
+        const Table<2, double> &values,
+        const Table<2, Tensor<1, dim>> &) {
+      for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+        for (int c = 0; c < dim; ++c)
+          particle_fluid_force[cell][q][c][lane] = -values(q, c) * inv_density;
+    });
+
+  if (is_explicit)
+    evaluate_field_at_quadrature_points(
+      fp_drag_dof_handler,
+      fp_drag_solution,
+      false,
+      [&](const unsigned int      cell,
+          const unsigned int      lane,
+          const Table<2, double> &values,
+          const Table<2, Tensor<1, dim>> &) {
+        for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+          for (int c = 0; c < dim; ++c)
+            particle_fluid_drag[cell][q][c][lane] = -values(q, c) * inv_density;
+      });
+
+  if (is_implicit)
     {
-      for (auto lane = 0u;
-           lane < this->matrix_free.n_active_entries_per_cell_batch(cell);
-           lane++)
-        {
-          // Reinit the particle-fluid force
-          fe_values_force.reinit(
-            this->matrix_free.get_cell_iterator(cell, lane)
-              ->as_dof_handler_iterator(fp_force_dof_handler));
-
-          fe_values_force[vector_index].get_function_values(fp_force_solution,
-                                                            cell_fp_force);
-
-          // Drag only needs to be re-init and collected if the drag model
-          // is explicit
-          if (is_explicit)
-            {
-              fe_values_drag.reinit(
-                this->matrix_free.get_cell_iterator(cell, lane)
-                  ->as_dof_handler_iterator(fp_drag_dof_handler));
-
-              fe_values_drag[vector_index].get_function_values(fp_drag_solution,
-                                                               cell_fp_drag);
-            }
-
-          if (is_implicit)
-            {
-              // Reinit the particle velocity
-              fe_values_particle_velocity.reinit(
-                this->matrix_free.get_cell_iterator(cell, lane)
-                  ->as_dof_handler_iterator(particle_velocity_dof_handler));
-
-              fe_values_particle_velocity[vector_index].get_function_values(
-                particle_velocity_solution, cell_particle_velocity);
-
-              // Reinit the momentum transfer coefficient
-              fe_values_momentum_transfer_coefficient.reinit(
-                this->matrix_free.get_cell_iterator(cell, lane)
-                  ->as_dof_handler_iterator(
-                    momentum_transfer_coefficient_dof_handler));
-
-              fe_values_momentum_transfer_coefficient.get_function_values(
-                momentum_transfer_coefficient_solution,
-                cell_momentum_transfer_coefficient);
-            }
-
-          for (const auto q : fe_values_force.quadrature_point_indices())
-            {
-              for (int c = 0; c < dim; ++c)
-                {
-                  // The force applied on the fluid from the particle is (-) the
-                  // force applied on the particles by the fluid following
-                  // Newton's third law. They are also divided by the density of
-                  // the fluid phase.
-                  particle_fluid_force[cell][q][c][lane] =
-                    -cell_fp_force[q][c] * inv_density;
-                  particle_fluid_drag[cell][q][c][lane] =
-                    -cell_fp_drag[q][c] * inv_density;
-
-                  // The particle velocity is not divided by the fluid density.
-                  particle_velocity[cell][q][c][lane] =
-                    cell_particle_velocity[q][c];
-                }
-              // The momentum transfer coefficient does not need to be divided
-              // by the density since it is by construction divided by density.
-              // This is something to keep in mind later on if we allow for
-              // a variable density.
-              momentum_transfer_coefficient[cell][q][lane] =
-                cell_momentum_transfer_coefficient[q];
-            }
-        }
+      // The particle velocity is not divided by the fluid density.
+      evaluate_field_at_quadrature_points(
+        particle_velocity_dof_handler,
+        particle_velocity_solution,
+        false,
+        [&](const unsigned int      cell,
+            const unsigned int      lane,
+            const Table<2, double> &values,
+            const Table<2, Tensor<1, dim>> &) {
+          for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+            for (int c = 0; c < dim; ++c)
+              particle_velocity[cell][q][c][lane] = values(q, c);
+        });
+
+      // The momentum transfer coefficient does not need to be divided by the
+      // density since it is by construction divided by density. This is
+      // something to keep in mind later on if we allow for a variable
+      // density.
+      evaluate_field_at_quadrature_points(
+        momentum_transfer_coefficient_dof_handler,
+        momentum_transfer_coefficient_solution,
+        false,
+        [&](const unsigned int      cell,
+            const unsigned int      lane,
+            const Table<2, double> &values,
+            const Table<2, Tensor<1, dim>> &) {
+          for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+            momentum_transfer_coefficient[cell][q][lane] = values(q, 0);
+        });
     }
 
   this->timer.leave_subsection("operator::compute_particle_fluid_forces");
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <fem-dem/ib_stencil_cache.h>
+
+template <int dim>
+IBStencilCache<dim>::~IBStencilCache()
+{
+  for (auto &connection : triangulation_connections)
+    connection.disconnect();
+}
+
+template <int dim>
+void
+IBStencilCache<dim>::connect_to_triangulation(
+  const Triangulation<dim> &triangulation)
+{
+  for (auto &connection : triangulation_connections)
+    connection.disconnect();
+  triangulation_connections.clear();
+
+  triangulation_connections.push_back(
+    triangulation.signals.any_change.connect([this]() { clear(); }));
+  triangulation_connections.push_back(
+    triangulation.signals.post_distributed_repartition.connect(
+      [this]() { clear(); }));
+}
+
+template <int dim>
+void
+IBStencilCache<dim>::remove_outdated_stencils(
+  const std::vector<Point<dim>>   &current_positions,
+  const std::vector<Tensor<1, 3>> &current_orientations)
+{
+  AssertDimension(current_positions.size(), current_orientations.size());
+
+  const unsigned int n_particles = current_positions.size();
+
+  if (positions.size() != n_particles)
+    {
+      stencils.clear();
+    }
+  else
+    {
+      std::vector<bool> particle_moved(n_particles, false);
+      bool              some_particles_moved = false;
+      for (unsigned int p = 0; p < n_particles; ++p)
+        {
+          if (current_positions[p] != positions[p] ||
+              current_orientations[p] != orientations[p])
+            {
+              particle_moved[p]    = true;
+              some_particles_moved = true;
+            }
+        }
+
+      if (some_particles_moved)
+        {
+          for (auto it = stencils.begin(); it != stencils.end();)
+            {
+              if (particle_moved[it->second.particle_id])
+                it = stencils.erase(it);
+              else
+                ++it;
+            }
+        }
+    }
+
+  positions    = current_positions;
+  orientations = current_orientations;
+}
+
+template <int dim>
+const IBStencilCacheEntry<dim> *
+IBStencilCache<dim>::find(const unsigned int cell_index,
+                          const unsigned int local_dof_index,
+                          const unsigned int particle_id) const
+{
+  const auto stencil =
+    stencils.find(std::make_pair(cell_index, local_dof_index));
+  if (stencil == stencils.end() || stencil->second.particle_id != particle_id)
+    return nullptr;
+  return &stencil->second;
+}
+
+template <int dim>
+const IBStencilCacheEntry<dim> &
+IBStencilCache<dim>::store(const unsigned int         cell_index,
+                           const unsigned int         local_dof_index,
+                           IBStencilCacheEntry<dim> &&stencil)
+{
+  return stencils
+    .insert_or_assign(std::make_pair(cell_index, local_dof_index),
+                      std::move(stencil))
+    .first->second;
+}
+
+template class IBStencilCache<2>;
+template class IBStencilCache<3>;
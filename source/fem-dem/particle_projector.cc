@@ -16,6 +16,7 @@
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/grid_tools.h>
 
+#include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/solver_cg.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/trilinos_solver.h>
@@ -112,23 +113,6 @@ ParticleProjector<dim>::setup_dofs()
 
   void_fraction_constraints.close();
 
-  void_fraction_locally_relevant.reinit(locally_owned_dofs,
-                                        locally_relevant_dofs,
-                                        mpi_communicator);
-
-  this->previous_void_fraction.resize(maximum_number_of_previous_solutions());
-
-  // Initialize vector of previous solutions for the void fraction
-  for (auto &solution : this->previous_void_fraction)
-    {
-      solution.reinit(this->locally_owned_dofs,
-                      this->locally_relevant_dofs,
-                      this->triangulation->get_mpi_communicator());
-    }
-
-  void_fraction_locally_owned.reinit(
-    locally_owned_dofs, this->triangulation->get_mpi_communicator());
-
   // deal.II vector that will also hold the solution
   this->void_fraction_solution.reinit(
     dof_handler.locally_owned_dofs(),
@@ -145,28 +129,50 @@ ParticleProjector<dim>::setup_dofs()
                       this->triangulation->get_mpi_communicator());
     }
 
-  DynamicSparsityPattern dsp(locally_relevant_dofs);
-  DoFTools::make_sparsity_pattern(dof_handler,
-                                  dsp,
-                                  void_fraction_constraints,
-                                  false);
-
-  SparsityTools::distribute_sparsity_pattern(
-    dsp,
-    locally_owned_dofs,
-    this->triangulation->get_mpi_communicator(),
-    locally_relevant_dofs);
-
-  system_matrix_void_fraction.reinit(
-    locally_owned_dofs,
-    locally_owned_dofs,
-    dsp,
-    this->triangulation->get_mpi_communicator());
+  // The Trilinos vectors and matrix are only used by the matrix-based
+  // projection. The operator of the matrix-free projection is set up with the
+  // constraints.
+  if (!matrix_free_projection)
+    {
+      void_fraction_locally_relevant.reinit(locally_owned_dofs,
+                                            locally_relevant_dofs,
+                                            mpi_communicator);
 
+      this->previous_void_fraction.resize(
+        maximum_number_of_previous_solutions());
 
-  system_rhs_void_fraction.reinit(locally_owned_dofs,
-                                  this->triangulation->get_mpi_communicator());
+      // Initialize vector of previous solutions for the void fraction
+      for (auto &solution : this->previous_void_fraction)
+        {
+          solution.reinit(this->locally_owned_dofs,
+                          this->locally_relevant_dofs,
+                          this->triangulation->get_mpi_communicator());
+        }
 
+      void_fraction_locally_owned.reinit(
+        locally_owned_dofs, this->triangulation->get_mpi_communicator());
+
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(dof_handler,
+                                      dsp,
+                                      void_fraction_constraints,
+                                      false);
+
+      SparsityTools::distribute_sparsity_pattern(
+        dsp,
+        locally_owned_dofs,
+        this->triangulation->get_mpi_communicator(),
+        locally_relevant_dofs);
+
+      system_matrix_void_fraction.reinit(
+        locally_owned_dofs,
+        locally_owned_dofs,
+        dsp,
+        this->triangulation->get_mpi_communicator());
+
+      system_rhs_void_fraction.reinit(
+        locally_owned_dofs, this->triangulation->get_mpi_communicator());
+    }
 
   // Vertices to cell mapping
   LetheGridTools::vertices_cell_mapping(this->dof_handler, vertices_to_cell);
@@ -229,24 +235,39 @@ ParticleProjector<dim>::setup_constraints(
       "The projection of particle velocity is currently not supported for periodic boundary conditions"));
 
 
-  // Reinit system matrix
-  DynamicSparsityPattern dsp(locally_relevant_dofs);
-  DoFTools::make_sparsity_pattern(dof_handler,
-                                  dsp,
-                                  void_fraction_constraints,
-                                  false);
-
-  SparsityTools::distribute_sparsity_pattern(
-    dsp,
-    locally_owned_dofs,
-    this->triangulation->get_mpi_communicator(),
-    locally_relevant_dofs);
-
-  system_matrix_void_fraction.reinit(
-    locally_owned_dofs,
-    locally_owned_dofs,
-    dsp,
-    this->triangulation->get_mpi_communicator());
+  if (matrix_free_projection)
+    {
+      // The MatrixFree object resolves the hanging node and periodic
+      // constraints, and the right-hand side shares its partitioning
+      projection_operator.reinit(*mapping,
+                                 dof_handler,
+                                 void_fraction_constraints,
+                                 *quadrature,
+                                 l2_smoothing_factor);
+      projection_operator.initialize_dof_vector(
+        system_rhs_void_fraction_matrix_free);
+    }
+  else
+    {
+      // Reinit system matrix
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(dof_handler,
+                                      dsp,
+                                      void_fraction_constraints,
+                                      false);
+
+      SparsityTools::distribute_sparsity_pattern(
+        dsp,
+        locally_owned_dofs,
+        this->triangulation->get_mpi_communicator(),
+        locally_relevant_dofs);
+
+      system_matrix_void_fraction.reinit(
+        locally_owned_dofs,
+        locally_owned_dofs,
+        dsp,
+        this->triangulation->get_mpi_communicator());
+    }
 
   if (has_periodic_boundaries)
     LetheGridTools::vertices_cell_mapping_with_periodic_boundaries(
@@ -305,6 +326,18 @@ ParticleProjector<dim>::calculate_void_fraction_function(const double time)
   // This is not an L2 projection, but a direct evaluation.
   // This may lead to some issues on coarses meshes if a high-order
   // interpolation (>FE_Q(1)) is used.
+  if (matrix_free_projection)
+    {
+      // The function is interpolated directly in the deal.II vector
+      void_fraction_solution.zero_out_ghost_values();
+      VectorTools::interpolate(*mapping,
+                               dof_handler,
+                               void_fraction_parameters->void_fraction,
+                               void_fraction_solution);
+      void_fraction_solution.update_ghost_values();
+      return;
+    }
+
   VectorTools::interpolate(*mapping,
                            dof_handler,
                            void_fraction_parameters->void_fraction,
@@ -341,8 +374,7 @@ ParticleProjector<dim>::calculate_void_fraction_particle_centered_method()
   std::vector<double>                  phi_vf(dofs_per_cell);
   std::vector<Tensor<1, dim>>          grad_phi_vf(dofs_per_cell);
 
-  system_rhs_void_fraction    = 0;
-  system_matrix_void_fraction = 0;
+  zero_void_fraction_system();
 
   for (const auto &cell : this->dof_handler.active_cell_iterators())
     {
@@ -410,16 +442,12 @@ ParticleProjector<dim>::calculate_void_fraction_particle_centered_method()
                 }
             }
           cell->get_dof_indices(local_dof_indices);
-          void_fraction_constraints.distribute_local_to_global(
-            local_matrix_void_fraction,
-            local_rhs_void_fraction,
-            local_dof_indices,
-            system_matrix_void_fraction,
-            system_rhs_void_fraction);
+          distribute_local_void_fraction_system(local_matrix_void_fraction,
+                                                local_rhs_void_fraction,
+                                                local_dof_indices);
         }
     }
-  system_matrix_void_fraction.compress(VectorOperation::add);
-  system_rhs_void_fraction.compress(VectorOperation::add);
+  compress_void_fraction_system();
 }
 
 template <int dim>
@@ -440,8 +468,7 @@ ParticleProjector<dim>::calculate_void_fraction_satellite_point_method()
   std::vector<double>                  phi_vf(dofs_per_cell);
   std::vector<Tensor<1, dim>>          grad_phi_vf(dofs_per_cell);
 
-  system_rhs_void_fraction    = 0;
-  system_matrix_void_fraction = 0;
+  zero_void_fraction_system();
 
   // Creation of reference sphere and components required for mapping into
   // individual particles. This calculation is done once and cached
@@ -649,17 +676,13 @@ ParticleProjector<dim>::calculate_void_fraction_satellite_point_method()
                 }
             }
           cell->get_dof_indices(local_dof_indices);
-          void_fraction_constraints.distribute_local_to_global(
-            local_matrix_void_fraction,
-            local_rhs_void_fraction,
-            local_dof_indices,
-            system_matrix_void_fraction,
-            system_rhs_void_fraction);
+          distribute_local_void_fraction_system(local_matrix_void_fraction,
+                                                local_rhs_void_fraction,
+                                                local_dof_indices);
         }
     }
 
-  system_matrix_void_fraction.compress(VectorOperation::add);
-  system_rhs_void_fraction.compress(VectorOperation::add);
+  compress_void_fraction_system();
 }
 
 template <int dim>
@@ -696,8 +719,7 @@ ParticleProjector<dim>::calculate_void_fraction_quadrature_centered_method()
       calculate_reference_sphere_radius = false;
     }
 
-  system_rhs_void_fraction    = 0;
-  system_matrix_void_fraction = 0;
+  zero_void_fraction_system();
 
   // Clear all contributions of particles from the previous time step
   for (const auto &cell : dof_handler.active_cell_iterators())
@@ -1033,17 +1055,13 @@ ParticleProjector<dim>::calculate_void_fraction_quadrature_centered_method()
             }
 
           cell->get_dof_indices(local_dof_indices);
-          void_fraction_constraints.distribute_local_to_global(
-            local_matrix_void_fraction,
-            local_rhs_void_fraction,
-            local_dof_indices,
-            system_matrix_void_fraction,
-            system_rhs_void_fraction);
+          distribute_local_void_fraction_system(local_matrix_void_fraction,
+                                                local_rhs_void_fraction,
+                                                local_dof_indices);
         }
     }
 
-  system_matrix_void_fraction.compress(VectorOperation::add);
-  system_rhs_void_fraction.compress(VectorOperation::add);
+  compress_void_fraction_system();
 }
 
 // first: the template of the class
@@ -1735,6 +1753,20 @@ ParticleProjector<dim>::solve_linear_system_and_update_solution()
                   << linear_solver_tolerance << std::endl;
     }
 
+  if (matrix_free_projection)
+    {
+      const unsigned int n_iterations =
+        solve_matrix_free_linear_system(non_rescaled_linear_solver_tolerance);
+
+      if (linear_solver_parameters.verbosity != Parameters::Verbosity::quiet)
+        {
+          this->pcout << "  -Iterative solver took : "
+                      << n_iterations / rescale_metric << " steps "
+                      << std::endl;
+        }
+      return;
+    }
+
   const IndexSet locally_owned_dofs = dof_handler.locally_owned_dofs();
 
   GlobalVectorType completely_distributed_solution(
@@ -1788,6 +1820,91 @@ ParticleProjector<dim>::solve_linear_system_and_update_solution()
 #endif
 }
 
+template <int dim>
+unsigned int
+ParticleProjector<dim>::solve_matrix_free_linear_system(
+  const double linear_solver_tolerance)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  VectorType completely_distributed_solution;
+  projection_operator.initialize_dof_vector(completely_distributed_solution);
+
+  SolverControl solver_control(linear_solver_parameters.max_iterations,
+                               linear_solver_tolerance,
+                               true,
+                               true);
+
+  SolverCG<VectorType> solver(solver_control);
+
+  DiagonalMatrix<VectorType> preconditioner;
+  projection_operator.compute_inverse_diagonal(preconditioner.get_vector());
+
+  solver.solve(projection_operator,
+               completely_distributed_solution,
+               system_rhs_void_fraction_matrix_free,
+               preconditioner);
+
+  // The solution is copied to the deal.II vector of the void fraction, from
+  // which the multigrid levels are interpolated
+  void_fraction_constraints.distribute(completely_distributed_solution);
+  void_fraction_solution.copy_locally_owned_data_from(
+    completely_distributed_solution);
+  void_fraction_solution.update_ghost_values();
+
+  return solver_control.last_step();
+}
+
+template <int dim>
+void
+ParticleProjector<dim>::zero_void_fraction_system()
+{
+  if (matrix_free_projection)
+    {
+      system_rhs_void_fraction_matrix_free = 0;
+      return;
+    }
+
+  system_rhs_void_fraction    = 0;
+  system_matrix_void_fraction = 0;
+}
+
+template <int dim>
+void
+ParticleProjector<dim>::distribute_local_void_fraction_system(
+  const FullMatrix<double>                   &local_matrix,
+  const Vector<double>                       &local_rhs,
+  const std::vector<types::global_dof_index> &local_dof_indices)
+{
+  if (matrix_free_projection)
+    {
+      void_fraction_constraints.distribute_local_to_global(
+        local_rhs, local_dof_indices, system_rhs_void_fraction_matrix_free);
+      return;
+    }
+
+  void_fraction_constraints.distribute_local_to_global(
+    local_matrix,
+    local_rhs,
+    local_dof_indices,
+    system_matrix_void_fraction,
+    system_rhs_void_fraction);
+}
+
+template <int dim>
+void
+ParticleProjector<dim>::compress_void_fraction_system()
+{
+  if (matrix_free_projection)
+    {
+      system_rhs_void_fraction_matrix_free.compress(VectorOperation::add);
+      return;
+    }
+
+  system_matrix_void_fraction.compress(VectorOperation::add);
+  system_rhs_void_fraction.compress(VectorOperation::add);
+}
+
 // Pre-compile the 2D and 3D ParticleProjector solver to ensure that the
 // library is valid before we actually compile the solver This greatly
 // helps with debugging
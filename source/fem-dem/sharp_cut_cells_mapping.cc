@@ -0,0 +1,413 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <fem-dem/sharp_cut_cells_mapping.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/geometry_info.h>
+
+#include <deal.II/numerics/rtree.h>
+
+#include <algorithm>
+
+namespace
+{
+  /**
+   * @brief Return a box containing a cell and all of its descendants. The
+   * bounding box of the vertices of the cell is enlarged when the cell or one
+   * of its faces is attached to a curved manifold, since the vertices of the
+   * children may then lie outside of the box of the vertices of their parent.
+   *
+   * @param[in] cell Cell, active or not, of the DoFHandler.
+   */
+  template <int dim>
+  BoundingBox<dim>
+  cell_search_box(const typename DoFHandler<dim>::cell_iterator &cell)
+  {
+    BoundingBox<dim> box = cell->bounding_box();
+
+    bool cell_is_curved = cell->manifold_id() != numbers::flat_manifold_id;
+    for (const auto f : cell->face_indices())
+      if (cell->face(f)->manifold_id() != numbers::flat_manifold_id)
+        cell_is_curved = true;
+
+    box.extend(cell_is_curved ? 0.25 * cell->diameter() :
+                                1e-10 * cell->diameter());
+    return box;
+  }
+
+  /**
+   * @brief Return whether two boxes intersect or touch each other.
+   */
+  template <int dim>
+  bool
+  boxes_intersect(const BoundingBox<dim> &box_1, const BoundingBox<dim> &box_2)
+  {
+    for (unsigned int d = 0; d < dim; ++d)
+      if (box_1.upper_bound(d) < box_2.lower_bound(d) ||
+          box_2.upper_bound(d) < box_1.lower_bound(d))
+        return false;
+    return true;
+  }
+
+  /**
+   * @brief Map the active descendants of a cell which intersect at least one
+   * of the updated regions, and skip the others.
+   *
+   * @param[in] cell Cell of the DoFHandler, active or not.
+   * @param[in] positions Centers of the spheres.
+   * @param[in] radii Radii of the spheres.
+   * @param[in] sphere_boxes Bounding boxes of all the spheres.
+   * @param[in] candidate_spheres Ids, sorted in increasing order, of the
+   * spheres whose box intersects the cell.
+   * @param[in] updated_boxes Boxes of the regions in which the mapping is
+   * updated.
+   * @param[in] candidate_updated_boxes Indices of the updated boxes which
+   * intersect the cell.
+   * @param[in,out] cut_cells_map Cut cells mapping indexed by the active cell
+   * index.
+   * @param[in,out] cells_inside_map Mapping of the cells inside the spheres
+   * indexed by the active cell index.
+   */
+  template <int dim>
+  void
+  map_cut_cells_in_subtree(
+    const typename DoFHandler<dim>::cell_iterator &cell,
+    const std::vector<Point<dim>>                 &positions,
+    const std::vector<double>                     &radii,
+    const std::vector<BoundingBox<dim>>           &sphere_boxes,
+    const std::vector<unsigned int>               &candidate_spheres,
+    const std::vector<BoundingBox<dim>>           &updated_boxes,
+    const std::vector<unsigned int>               &candidate_updated_boxes,
+    std::vector<std::tuple<bool, unsigned int, std::vector<unsigned int>>>
+                                                &cut_cells_map,
+    std::vector<std::tuple<bool, unsigned int>> &cells_inside_map)
+  {
+    if (cell->is_active())
+      {
+        if (cell->is_artificial())
+          return;
+
+        const unsigned int cell_index = cell->active_cell_index();
+
+        cut_cells_map[cell_index]    = {false, 0, std::vector<unsigned int>()};
+        cells_inside_map[cell_index] = {false, 0};
+
+        // The candidates are sorted by increasing id, the first sphere in
+        // which the cell is embedded and the first sphere that cuts the cell
+        // are therefore the ones with the lowest id.
+        bool inside_found = false;
+        bool cut_found    = false;
+        for (const unsigned int p : candidate_spheres)
+          {
+            const auto is_candidate =
+              SharpCutCellsMapping::sphere_cut_cell_candidates<dim>(
+                cell, positions[p], radii[p]);
+
+            if (is_candidate.first && !inside_found)
+              {
+                cells_inside_map[cell_index] = {true, p};
+                inside_found                 = true;
+              }
+            if (is_candidate.second && !cut_found)
+              {
+                cut_cells_map[cell_index] = {true,
+                                             p,
+                                             std::vector<unsigned int>()};
+                cut_found                 = true;
+              }
+            if (inside_found && cut_found)
+              break;
+          }
+        return;
+      }
+
+    // Only the candidates whose box intersects the box of a child are tested
+    // on the descendants of this child. The children that do not intersect
+    // any updated region are skipped entirely.
+    std::vector<unsigned int> child_spheres;
+    std::vector<unsigned int> child_updated_boxes;
+    for (const auto &child : cell->child_iterators())
+      {
+        const BoundingBox<dim> child_box = cell_search_box<dim>(child);
+
+        child_updated_boxes.clear();
+        for (const unsigned int b : candidate_updated_boxes)
+          if (boxes_intersect(child_box, updated_boxes[b]))
+            child_updated_boxes.push_back(b);
+        if (child_updated_boxes.empty())
+          continue;
+
+        child_spheres.clear();
+        for (const unsigned int p : candidate_spheres)
+          if (boxes_intersect(child_box, sphere_boxes[p]))
+            child_spheres.push_back(p);
+
+        map_cut_cells_in_subtree<dim>(child,
+                                      positions,
+                                      radii,
+                                      sphere_boxes,
+                                      child_spheres,
+                                      updated_boxes,
+                                      child_updated_boxes,
+                                      cut_cells_map,
+                                      cells_inside_map);
+      }
+  }
+} // namespace
+
+template <int dim>
+std::pair<bool, bool>
+SharpCutCellsMapping::sphere_cut_cell_candidates(
+  const typename DoFHandler<dim>::cell_iterator &cell,
+  const Point<dim>                              &position,
+  const double                                   radius)
+{
+  bool cell_is_inside = false;
+  bool cell_is_cut    = false;
+
+  double search_radius = radius * (1.0 - 1e-07);
+
+  bool point_inside_cell = cell->point_inside(position);
+
+  // Check how many vertices are inside the particle
+  unsigned int nb_vertices_inside = 0;
+  for (unsigned int i = 0; i < GeometryInfo<dim>::vertices_per_cell; ++i)
+    {
+      if ((cell->vertex(i) - position).norm() < search_radius)
+        ++nb_vertices_inside;
+    }
+
+  // If vertices are found inside the particle
+  if (nb_vertices_inside > 0)
+    {
+      // If the number of vertices inside the cell is equal to the number of
+      // vertices per cell, the cell is inside the particle
+      if (nb_vertices_inside == GeometryInfo<dim>::vertices_per_cell)
+        {
+          cell_is_inside = true;
+          cell_is_cut    = false;
+        }
+      // Otherwise, the cell is cut
+      else
+        {
+          cell_is_inside = false;
+          cell_is_cut    = true;
+        }
+      return {cell_is_inside, cell_is_cut};
+    }
+
+  // If the particle intersect the cell and is not known whether all
+  // vertices are inside the particles, set all true by default
+  if (point_inside_cell)
+    {
+      cell_is_inside = true;
+      cell_is_cut    = true;
+      return {cell_is_inside, cell_is_cut};
+    }
+
+  // The last check consists of projecting the particle's position on the cells'
+  // face and checking whether the projected points are within the particle. If
+  // one of the projected points is inside the particle, either the cell is
+  // inside or is cut by the particles. If this is true, the next
+  // level will be tested again by this function.
+
+  // Initialize superpoint of manifold
+  std::vector<Point<dim>> manifold_points(
+    GeometryInfo<dim - 1>::vertices_per_cell);
+
+  // Loop through faces
+  for (const auto face : cell->face_indices())
+    {
+      auto  face_iter           = cell->face(face);
+      auto &local_face_manifold = face_iter->get_manifold();
+
+      // Loop through face vertices
+      for (unsigned int i = 0; i < GeometryInfo<dim>::vertices_per_face; ++i)
+        {
+          // Assign vertex to manifold superpoint
+          manifold_points[i] = face_iter->vertex(i);
+        }
+
+      // Create array of points on face
+      auto surrounding_face_points =
+        make_array_view(manifold_points.begin(), manifold_points.end());
+
+      // Loop through face vertices
+      for (unsigned int i = 0; i < GeometryInfo<dim>::vertices_per_face; ++i)
+        {
+          // Project points to face
+          Point<dim> projected_point =
+            local_face_manifold.project_to_manifold(surrounding_face_points,
+                                                    position);
+
+          bool           projected_point_over_face = true;
+          Tensor<1, dim> projected_point_tensor(projected_point);
+
+          // Check whether the projected point is within the cell
+          try
+            {
+              projected_point_over_face = cell->point_inside(projected_point);
+
+              if ((position - projected_point).norm() < search_radius &&
+                  projected_point_over_face)
+                {
+                  cell_is_inside = true;
+                  cell_is_cut    = true;
+                  return {cell_is_inside, cell_is_cut};
+                }
+            }
+          // If the method crashes, change default for false
+          catch (...)
+            {
+              projected_point_over_face = false;
+            }
+
+          for (int d = 0; d != dim; d++)
+            {
+              if (projected_point_tensor[d] < 0 ||
+                  projected_point_tensor[d] > 1)
+                {
+                  projected_point_over_face = false;
+                }
+            }
+        }
+    }
+  return {cell_is_inside, cell_is_cut};
+}
+
+template <int dim>
+BoundingBox<dim>
+SharpCutCellsMapping::sphere_bounding_box(const Point<dim> &position,
+                                          const double      radius)
+{
+  const double half_width = radius * (1. + 1e-6);
+
+  Point<dim> lower_corner(position), upper_corner(position);
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      lower_corner[d] -= half_width;
+      upper_corner[d] += half_width;
+    }
+  return BoundingBox<dim>(std::make_pair(lower_corner, upper_corner));
+}
+
+template <int dim>
+void
+SharpCutCellsMapping::map_sphere_cut_cells(
+  const DoFHandler<dim>               &dof_handler,
+  const std::vector<Point<dim>>       &positions,
+  const std::vector<double>           &radii,
+  const std::vector<BoundingBox<dim>> &updated_boxes,
+  std::vector<std::tuple<bool, unsigned int, std::vector<unsigned int>>>
+                                              &cut_cells_map,
+  std::vector<std::tuple<bool, unsigned int>> &cells_inside_map)
+{
+  AssertDimension(positions.size(), radii.size());
+  AssertDimension(cut_cells_map.size(),
+                  dof_handler.get_triangulation().n_active_cells());
+  AssertDimension(cells_inside_map.size(),
+                  dof_handler.get_triangulation().n_active_cells());
+
+  if (updated_boxes.empty())
+    return;
+
+  const unsigned int n_spheres = positions.size();
+
+  std::vector<BoundingBox<dim>> sphere_boxes(n_spheres);
+  for (unsigned int p = 0; p < n_spheres; ++p)
+    sphere_boxes[p] = sphere_bounding_box(positions[p], radii[p]);
+
+  // The boxes of the spheres and of the updated regions are packed in
+  // R-trees, which are queried once per coarse cell. The candidates are then
+  // pruned on each level of the traversal of the cell hierarchy.
+  std::vector<std::pair<BoundingBox<dim>, unsigned int>> indexed_sphere_boxes;
+  std::vector<std::pair<BoundingBox<dim>, unsigned int>> indexed_updated_boxes;
+  indexed_sphere_boxes.reserve(n_spheres);
+  indexed_updated_boxes.reserve(updated_boxes.size());
+  for (unsigned int p = 0; p < n_spheres; ++p)
+    indexed_sphere_boxes.emplace_back(sphere_boxes[p], p);
+  for (unsigned int b = 0; b < updated_boxes.size(); ++b)
+    indexed_updated_boxes.emplace_back(updated_boxes[b], b);
+
+  const auto sphere_tree  = pack_rtree(indexed_sphere_boxes);
+  const auto updated_tree = pack_rtree(indexed_updated_boxes);
+
+  std::vector<std::pair<BoundingBox<dim>, unsigned int>> query_result;
+  std::vector<unsigned int> candidate_spheres;
+  std::vector<unsigned int> candidate_updated_boxes;
+
+  for (const auto &cell : dof_handler.cell_iterators_on_level(0))
+    {
+      const BoundingBox<dim> cell_box = cell_search_box<dim>(cell);
+
+      query_result.clear();
+      updated_tree.query(boost::geometry::index::intersects(cell_box),
+                         std::back_inserter(query_result));
+      if (query_result.empty())
+        continue;
+
+      candidate_updated_boxes.clear();
+      for (const auto &indexed_box : query_result)
+        candidate_updated_boxes.push_back(indexed_box.second);
+
+      query_result.clear();
+      sphere_tree.query(boost::geometry::index::intersects(cell_box),
+                        std::back_inserter(query_result));
+
+      // The candidates are sorted by increasing id to guarantee that the
+      // lowest sphere id is associated to the cut cells or to the cells
+      // inside the spheres.
+      candidate_spheres.clear();
+      for (const auto &indexed_box : query_result)
+        candidate_spheres.push_back(indexed_box.second);
+      std::sort(candidate_spheres.begin(), candidate_spheres.end());
+
+      map_cut_cells_in_subtree<dim>(cell,
+                                    positions,
+                                    radii,
+                                    sphere_boxes,
+                                    candidate_spheres,
+                                    updated_boxes,
+                                    candidate_updated_boxes,
+                                    cut_cells_map,
+                                    cells_inside_map);
+    }
+}
+
+template std::pair<bool, bool>
+SharpCutCellsMapping::sphere_cut_cell_candidates<2>(
+  const typename DoFHandler<2>::cell_iterator &cell,
+  const Point<2>                              &position,
+  const double                                 radius);
+template std::pair<bool, bool>
+SharpCutCellsMapping::sphere_cut_cell_candidates<3>(
+  const typename DoFHandler<3>::cell_iterator &cell,
+  const Point<3>                              &position,
+  const double                                 radius);
+
+template BoundingBox<2>
+SharpCutCellsMapping::sphere_bounding_box<2>(const Point<2> &position,
+                                             const double    radius);
+template BoundingBox<3>
+SharpCutCellsMapping::sphere_bounding_box<3>(const Point<3> &position,
+                                             const double    radius);
+
+template void
+SharpCutCellsMapping::map_sphere_cut_cells<2>(
+  const DoFHandler<2>               &dof_handler,
+  const std::vector<Point<2>>       &positions,
+  const std::vector<double>         &radii,
+  const std::vector<BoundingBox<2>> &updated_boxes,
+  std::vector<std::tuple<bool, unsigned int, std::vector<unsigned int>>>
+                                              &cut_cells_map,
+  std::vector<std::tuple<bool, unsigned int>> &cells_inside_map);
+template void
+SharpCutCellsMapping::map_sphere_cut_cells<3>(
+  const DoFHandler<3>               &dof_handler,
+  const std::vector<Point<3>>       &positions,
+  const std::vector<double>         &radii,
+  const std::vector<BoundingBox<3>> &updated_boxes,
+  std::vector<std::tuple<bool, unsigned int, std::vector<unsigned int>>>
+                                              &cut_cells_map,
+  std::vector<std::tuple<bool, unsigned int>> &cells_inside_map);
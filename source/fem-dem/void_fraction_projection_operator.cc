@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <fem-dem/void_fraction_projection_operator.h>
+
+#include <deal.II/matrix_free/tools.h>
+
+template <int dim>
+void
+VoidFractionProjectionOperator<dim>::reinit(
+  const Mapping<dim>              &mapping,
+  const DoFHandler<dim>           &dof_handler,
+  const AffineConstraints<double> &constraints,
+  const Quadrature<dim>           &quadrature,
+  const double                     l2_smoothing_factor)
+{
+  AssertThrow(quadrature.is_tensor_product(),
+              ExcMessage("The matrix-free projection of the void fraction "
+                         "requires a tensor product quadrature."));
+
+  this->l2_smoothing_factor = l2_smoothing_factor;
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme =
+    MatrixFree<dim, double>::AdditionalData::none;
+  additional_data.mapping_update_flags =
+    (update_values | update_gradients | update_JxW_values);
+
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     constraints,
+                     quadrature.get_tensor_basis()[0],
+                     additional_data);
+}
+
+template <int dim>
+void
+VoidFractionProjectionOperator<dim>::vmult(VectorType       &dst,
+                                           const VectorType &src) const
+{
+  matrix_free.cell_loop(
+    &VoidFractionProjectionOperator::local_apply, this, dst, src, true);
+}
+
+template <int dim>
+void
+VoidFractionProjectionOperator<dim>::compute_inverse_diagonal(
+  VectorType &inverse_diagonal) const
+{
+  initialize_dof_vector(inverse_diagonal);
+
+  MatrixFreeTools::compute_diagonal<dim, -1, 0, 1, double>(
+    matrix_free,
+    inverse_diagonal,
+    [&](auto &integrator) { this->do_cell_integral_local(integrator); });
+
+  for (auto &i : inverse_diagonal)
+    i = (std::abs(i) > 1.0e-10) ? (1.0 / i) : 1.0;
+}
+
+template <int dim>
+void
+VoidFractionProjectionOperator<dim>::initialize_dof_vector(
+  VectorType &vec) const
+{
+  matrix_free.initialize_dof_vector(vec);
+}
+
+template <int dim>
+void
+VoidFractionProjectionOperator<dim>::do_cell_integral_local(
+  FECellIntegrator &integrator) const
+{
+  integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+
+  for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      integrator.submit_value(integrator.get_value(q), q);
+      integrator.submit_gradient(l2_smoothing_factor *
+                                   integrator.get_gradient(q),
+                                 q);
+    }
+
+  integrator.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+}
+
+template <int dim>
+void
+VoidFractionProjectionOperator<dim>::local_apply(
+  const MatrixFree<dim, double>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FECellIntegrator integrator(matrix_free);
+
+  for (unsigned int cell = range.first; cell < range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src);
+      do_cell_integral_local(integrator);
+      integrator.distribute_local_to_global(dst);
+    }
+}
+
+template class VoidFractionProjectionOperator<2>;
+template class VoidFractionProjectionOperator<3>;
@@ -22,6 +22,7 @@
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_solver.h>
@@ -96,6 +97,12 @@ CahnHilliard<dim>::assemble_system_matrix()
 {
   TimerOutput::Scope t(this->computing_timer, "Assemble matrix");
 
+  if (simulation_parameters.fem_parameters.cahn_hilliard_uses_matrix_free)
+    {
+      update_matrix_free_operator();
+      return;
+    }
+
   this->system_matrix = 0;
   setup_assemblers();
 
@@ -122,6 +129,48 @@ CahnHilliard<dim>::assemble_system_matrix()
   system_matrix.compress(VectorOperation::add);
 }
 
+template <int dim>
+void
+CahnHilliard<dim>::update_matrix_free_operator()
+{
+  AssertThrow(
+    !multiphysics->fluid_dynamics_is_block(),
+    ExcMessage(
+      "The matrix-free Cahn-Hilliard operator does not support block fluid dynamics solutions."));
+  AssertThrow(
+    time_stepping_is_bdf(this->simulation_control->get_assembly_method()),
+    ExcMessage(
+      "The matrix-free Cahn-Hilliard operator requires a BDF time-stepping scheme."));
+
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  VectorType evaluation_point_mf, fluid_solution;
+  matrix_free_operator->initialize_dof_vector(evaluation_point_mf);
+  matrix_free_operator->initialize_fluid_dof_vector(fluid_solution);
+  convert_vector_trilinos_to_dealii(evaluation_point_mf,
+                                    this->evaluation_point);
+  convert_vector_trilinos_to_dealii(
+    fluid_solution, multiphysics->get_solution(PhysicsID::fluid_dynamics));
+  evaluation_point_mf.update_ghost_values();
+  fluid_solution.update_ghost_values();
+
+  // Epsilon is computed as for the assemblers
+  const double epsilon =
+    (this->simulation_parameters.multiphysics.cahn_hilliard_parameters
+       .epsilon_set_method == Parameters::EpsilonSetMethod::manual) ?
+      this->simulation_parameters.multiphysics.cahn_hilliard_parameters
+        .epsilon :
+      GridTools::minimal_cell_diameter(*triangulation);
+
+  matrix_free_operator->evaluate_non_linear_terms(
+    evaluation_point_mf,
+    fluid_solution,
+    this->simulation_parameters.ale,
+    this->simulation_parameters.physical_properties_manager,
+    this->simulation_parameters.multiphysics.cahn_hilliard_parameters,
+    epsilon);
+}
+
 template <int dim>
 void
 CahnHilliard<dim>::assemble_local_system_matrix(
@@ -633,6 +682,10 @@ CahnHilliard<dim>::finish_simulation()
                                 simulation_control->get_log_precision());
       error_table.write_text(std::cout);
     }
+
+  if (simulation_parameters.timer.type != Parameters::Timer::Type::none)
+    preconditioner_refresh_policy.print_total_times(this->pcout,
+                                                    "Cahn-Hilliard");
 }
 
 template <int dim>
@@ -1049,6 +1102,9 @@ CahnHilliard<dim>::setup_dofs()
   verify_consistency_of_boundary_conditions();
 
   dof_handler->distribute_dofs(*fe);
+
+  // The structure of the matrix changes, its preconditioner must be rebuilt
+  preconditioner_refresh_policy.invalidate();
   DoFRenumbering::Cuthill_McKee(*this->dof_handler);
 
   auto mpi_communicator = triangulation->get_mpi_communicator();
@@ -1155,21 +1211,36 @@ CahnHilliard<dim>::setup_dofs()
 
   zero_constraints.close();
 
-  // Sparse matrices initialization
-  DynamicSparsityPattern dsp(locally_relevant_dofs);
-  DoFTools::make_sparsity_pattern(*this->dof_handler,
-                                  dsp,
-                                  nonzero_constraints,
-                                  /*keep_constrained_dofs = */ true);
-
-  SparsityTools::distribute_sparsity_pattern(dsp,
-                                             locally_owned_dofs,
-                                             mpi_communicator,
-                                             locally_relevant_dofs);
-  system_matrix.reinit(locally_owned_dofs,
-                       locally_owned_dofs,
-                       dsp,
-                       mpi_communicator);
+  if (simulation_parameters.fem_parameters.cahn_hilliard_uses_matrix_free)
+    {
+      // The matrix-free operator replaces the sparse matrix
+      system_matrix.clear();
+      matrix_free_operator->reinit(
+        *this->mapping,
+        *this->dof_handler,
+        multiphysics->get_dof_handler(PhysicsID::fluid_dynamics),
+        zero_constraints,
+        QGauss<1>(fe->degree + 1),
+        simulation_control);
+    }
+  else
+    {
+      // Sparse matrices initialization
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(*this->dof_handler,
+                                      dsp,
+                                      nonzero_constraints,
+                                      /*keep_constrained_dofs = */ true);
+
+      SparsityTools::distribute_sparsity_pattern(dsp,
+                                                 locally_owned_dofs,
+                                                 mpi_communicator,
+                                                 locally_relevant_dofs);
+      system_matrix.reinit(locally_owned_dofs,
+                           locally_owned_dofs,
+                           dsp,
+                           mpi_communicator);
+    }
 
   this->pcout << "   Number of Cahn-Hilliard degrees of freedom: "
               << dof_handler->n_dofs() << std::endl;
@@ -1301,6 +1372,12 @@ CahnHilliard<dim>::solve_linear_system()
   const double non_rescaled_linear_solver_tolerance =
     linear_solver_tolerance * rescale_metric;
 
+  if (simulation_parameters.fem_parameters.cahn_hilliard_uses_matrix_free)
+    {
+      solve_linear_system_matrix_free(non_rescaled_linear_solver_tolerance);
+      return;
+    }
+
   const unsigned int ilu_fill = static_cast<unsigned int>(
     simulation_parameters.linear_solver.at(PhysicsID::cahn_hilliard)
       .ilu_precond_fill);
@@ -1313,9 +1390,19 @@ CahnHilliard<dim>::solve_linear_system()
   TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
     ilu_fill, ilu_atol, ilu_rtol, 0);
 
-  TrilinosWrappers::PreconditionILU ilu_preconditioner;
-
-  ilu_preconditioner.initialize(system_matrix, preconditionerOptions);
+  // The preconditioner is rebuilt or reused according to the refresh policy
+  const PreconditionerRefreshPolicy::Action setup_action =
+    preconditioner_refresh_policy.get_setup_action(false);
+  Timer setup_timer;
+  if (setup_action == PreconditionerRefreshPolicy::Action::rebuild)
+    {
+      system_ilu_preconditioner =
+        std::make_shared<TrilinosWrappers::PreconditionILU>();
+      system_ilu_preconditioner->initialize(system_matrix,
+                                            preconditionerOptions);
+    }
+  preconditioner_refresh_policy.register_setup(setup_action,
+                                               setup_timer.wall_time());
 
   GlobalVectorType completely_distributed_solution(locally_owned_dofs,
                                                    mpi_communicator);
@@ -1336,10 +1423,13 @@ CahnHilliard<dim>::solve_linear_system()
   TrilinosWrappers::SolverGMRES solver(solver_control, solver_parameters);
 
 
+  Timer solve_timer;
   solver.solve(system_matrix,
                completely_distributed_solution,
                system_rhs,
-               ilu_preconditioner);
+               *system_ilu_preconditioner);
+  preconditioner_refresh_policy.register_solve(solver_control.last_step(),
+                                               solve_timer.wall_time());
 
   if (simulation_parameters.linear_solver.at(PhysicsID::cahn_hilliard)
         .verbosity != Parameters::Verbosity::quiet)
@@ -1347,12 +1437,79 @@ CahnHilliard<dim>::solve_linear_system()
       this->pcout << "  -Iterative solver took : " << solver_control.last_step()
                   << " steps to reach a residual norm of "
                   << solver_control.last_value() / rescale_metric << std::endl;
+      preconditioner_refresh_policy.print_statistics(this->pcout);
     }
 
   constraints_used.distribute(completely_distributed_solution);
   newton_update = completely_distributed_solution;
 }
 
+template <int dim>
+void
+CahnHilliard<dim>::solve_linear_system_matrix_free(const double tolerance)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  const double rescale_metric = this->get_residual_rescale_metric();
+
+  // Relative tolerance of the Chebyshev iterations approximating the inverse
+  // of the mass-Laplace operators within the block preconditioner
+  const double inner_tolerance = 1e-2;
+
+  // The block preconditioner is rebuilt or reused according to the refresh
+  // policy, the operator itself always using the present Newton iterate
+  const PreconditionerRefreshPolicy::Action setup_action =
+    preconditioner_refresh_policy.get_setup_action(false);
+  Timer setup_timer;
+  if (setup_action == PreconditionerRefreshPolicy::Action::rebuild)
+    matrix_free_preconditioner->initialize(*matrix_free_operator,
+                                           inner_tolerance);
+  preconditioner_refresh_policy.register_setup(setup_action,
+                                               setup_timer.wall_time());
+
+  VectorType rhs, solution;
+  matrix_free_operator->initialize_dof_vector(rhs);
+  matrix_free_operator->initialize_dof_vector(solution);
+  convert_vector_trilinos_to_dealii(rhs, system_rhs);
+
+  SolverControl solver_control(simulation_parameters.linear_solver
+                                 .at(PhysicsID::cahn_hilliard)
+                                 .max_iterations,
+                               tolerance,
+                               true,
+                               true);
+
+  typename SolverGMRES<VectorType>::AdditionalData solver_parameters;
+  solver_parameters.max_n_tmp_vectors =
+    simulation_parameters.linear_solver.at(PhysicsID::cahn_hilliard)
+      .max_krylov_vectors;
+  SolverGMRES<VectorType> solver(solver_control, solver_parameters);
+
+  Timer solve_timer;
+  solver.solve(*matrix_free_operator,
+               solution,
+               rhs,
+               *matrix_free_preconditioner);
+  preconditioner_refresh_policy.register_solve(solver_control.last_step(),
+                                               solve_timer.wall_time());
+
+  if (simulation_parameters.linear_solver.at(PhysicsID::cahn_hilliard)
+        .verbosity != Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Iterative solver took : " << solver_control.last_step()
+                  << " steps to reach a residual norm of "
+                  << solver_control.last_value() / rescale_metric << std::endl;
+      preconditioner_refresh_policy.print_statistics(this->pcout);
+    }
+
+  GlobalVectorType completely_distributed_solution(
+    locally_owned_dofs, triangulation->get_mpi_communicator());
+  convert_vector_dealii_to_trilinos(completely_distributed_solution, solution);
+
+  zero_constraints.distribute(completely_distributed_solution);
+  newton_update = completely_distributed_solution;
+}
+
 template <int dim>
 template <typename VectorType>
 std::pair<Tensor<1, dim>, Tensor<1, dim>>
@@ -0,0 +1,561 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <core/time_integration_utilities.h>
+#include <core/utilities.h>
+
+#include <solvers/cahn_hilliard_matrix_free_operators.h>
+#include <solvers/fluid_dynamics_matrix_free_operators.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/component_mask.h>
+
+#include <deal.II/matrix_free/tools.h>
+
+#include <numbers>
+
+template <int dim, typename number>
+CahnHilliardMatrixFreeOperator<dim, number>::CahnHilliardMatrixFreeOperator()
+{}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::reinit(
+  const Mapping<dim>                       &mapping,
+  const DoFHandler<dim>                    &dof_handler,
+  const DoFHandler<dim>                    &dof_handler_fluid,
+  const AffineConstraints<number>          &constraints,
+  const Quadrature<1>                      &quadrature,
+  const std::shared_ptr<SimulationControl> &simulation_control)
+{
+  this->simulation_control = simulation_control;
+
+  // The velocity of the fluid is only read, hence its DoFHandler uses empty
+  // constraints
+  fluid_constraints.clear();
+  fluid_constraints.close();
+
+  typename MatrixFree<dim, number>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme =
+    MatrixFree<dim, number>::AdditionalData::none;
+  additional_data.mapping_update_flags =
+    (update_values | update_gradients | update_JxW_values |
+     update_quadrature_points);
+
+  const std::vector<const DoFHandler<dim> *> dof_handlers = {
+    &dof_handler, &dof_handler_fluid};
+  const std::vector<const AffineConstraints<number> *> constraints_vector = {
+    &constraints, &fluid_constraints};
+
+  matrix_free.reinit(
+    mapping, dof_handlers, constraints_vector, quadrature, additional_data);
+
+  // Store the locally owned constrained degrees of freedom, on which the
+  // operator is the identity
+  constrained_indices.clear();
+  for (const auto i : matrix_free.get_constrained_dofs(0))
+    constrained_indices.push_back(i);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::evaluate_non_linear_terms(
+  const VectorType                &evaluation_point,
+  const VectorType                &fluid_solution,
+  const Parameters::ALE<dim>      &ale,
+  const PhysicalPropertiesManager &properties_manager,
+  const Parameters::CahnHilliard  &cahn_hilliard_parameters,
+  const double                     epsilon)
+{
+  AssertThrow(properties_manager.get_number_of_fluids() == 2,
+              ExcMessage("The matrix-free Cahn-Hilliard operator requires "
+                         "exactly two fluids."));
+
+  const auto material_interaction_id =
+    properties_manager.get_material_interaction_id(
+      material_interactions_type::fluid_fluid, 0, 1);
+  const auto surface_tension_model =
+    properties_manager.get_surface_tension(material_interaction_id);
+  const auto mobility_model =
+    properties_manager.get_mobility_cahn_hilliard(material_interaction_id);
+
+  const double xi = cahn_hilliard_parameters.potential_smoothing_coefficient;
+  const unsigned int fe_degree =
+    matrix_free.get_dof_handler(0).get_fe().degree;
+
+  FECellIntegrator         integrator(matrix_free, 0, 0, 0);
+  FEVelocityCellIntegrator velocity_integrator(matrix_free, 1, 0, 0);
+  const unsigned int       n_cell_batches = matrix_free.n_cell_batches();
+  const unsigned int       n_q_points     = integrator.n_q_points;
+
+  velocity.reinit(n_cell_batches, n_q_points);
+  mobility.reinit(n_cell_batches, n_q_points);
+  lambda.reinit(n_cell_batches, n_q_points);
+  potential_smoothing.reinit(n_cell_batches, n_q_points);
+  mobility_derivative_potential_gradient.reinit(n_cell_batches, n_q_points);
+  double_well_derivative.reinit(n_cell_batches, n_q_points);
+
+  std::map<field, double> fields;
+
+  for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values_plain(evaluation_point);
+      integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+
+      velocity_integrator.reinit(cell);
+      velocity_integrator.read_dof_values_plain(fluid_solution);
+      velocity_integrator.evaluate(EvaluationFlags::values);
+
+      // Cell size computed from the measure of the cell, as in the
+      // CahnHilliardScratchData
+      VectorizedArray<number> cell_size = 0.;
+      {
+        VectorizedArray<number> cell_measure = 0.;
+        for (unsigned int q = 0; q < n_q_points; ++q)
+          cell_measure += integrator.JxW(q);
+        for (unsigned int v = 0; v < VectorizedArray<number>::size(); ++v)
+          cell_size[v] = compute_cell_diameter<dim>(cell_measure[v], fe_degree);
+      }
+
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          const auto value    = integrator.get_value(q);
+          const auto gradient = integrator.get_gradient(q);
+
+          Tensor<1, dim, VectorizedArray<number>> advective_velocity =
+            velocity_integrator.get_value(q);
+          if (ale.enabled())
+            advective_velocity -= evaluate_function<dim, number, dim>(
+              *ale.velocity, integrator.quadrature_point(q));
+          velocity(cell, q) = advective_velocity;
+
+          // The physical properties are evaluated lane by lane, the models
+          // being scalar
+          VectorizedArray<number> mobility_derivative = 0.;
+          for (unsigned int v = 0; v < VectorizedArray<number>::size(); ++v)
+            {
+              fields[field::phase_order_cahn_hilliard] = value[0][v];
+
+              mobility(cell, q)[v] = mobility_model->value(fields);
+              mobility_derivative[v] =
+                mobility_model->jacobian(fields,
+                                         field::phase_order_cahn_hilliard);
+              lambda(cell, q)[v] = 3. * epsilon *
+                                   surface_tension_model->value(fields) /
+                                   (2. * std::numbers::sqrt2);
+            }
+
+          mobility_derivative_potential_gradient(cell, q) =
+            mobility_derivative * gradient[1];
+          double_well_derivative(cell, q) =
+            lambda(cell, q) / (epsilon * epsilon) *
+            (3. * value[0] * value[0] - 1.);
+          potential_smoothing(cell, q) = xi * cell_size * cell_size;
+        }
+    }
+}
+
+template <int dim, typename number>
+number
+CahnHilliardMatrixFreeOperator<dim, number>::get_bdf_coefficient() const
+{
+  AssertThrow(
+    time_stepping_is_bdf(simulation_control->get_assembly_method()),
+    ExcMessage(
+      "The matrix-free Cahn-Hilliard operator only supports the BDF time-stepping methods."));
+
+  return simulation_control->get_bdf_coefficients()[0];
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::vmult(VectorType       &dst,
+                                                   const VectorType &src) const
+{
+  matrix_free.cell_loop(
+    &CahnHilliardMatrixFreeOperator::local_apply, this, dst, src, true);
+
+  for (const auto i : constrained_indices)
+    dst.local_element(i) = src.local_element(i);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::vmult_potential_phase_coupling(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  matrix_free.cell_loop(
+    &CahnHilliardMatrixFreeOperator::local_apply_potential_phase_coupling,
+    this,
+    dst,
+    src,
+    true);
+
+  for (const auto i : constrained_indices)
+    dst.local_element(i) = 0.;
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::local_apply(
+  const MatrixFree<dim, number>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FECellIntegrator integrator(matrix_free, 0, 0, 0);
+  const number     bdf_coefficient = get_bdf_coefficient();
+
+  for (unsigned int cell = range.first; cell < range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src,
+                                 EvaluationFlags::values |
+                                   EvaluationFlags::gradients);
+
+      for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+        {
+          const auto value    = integrator.get_value(q);
+          const auto gradient = integrator.get_gradient(q);
+
+          Tensor<1, 2, VectorizedArray<number>>                 value_result;
+          Tensor<1, 2, Tensor<1, dim, VectorizedArray<number>>> gradient_result;
+
+          // Phase order equation: time derivative, advection and diffusion of
+          // the chemical potential
+          value_result[0] =
+            bdf_coefficient * value[0] + velocity(cell, q) * gradient[0];
+          gradient_result[0] =
+            mobility(cell, q) * gradient[1] +
+            mobility_derivative_potential_gradient(cell, q) * value[0];
+
+          // Chemical potential equation: double-well term, interface term and
+          // smoothing of the chemical potential
+          value_result[1] =
+            value[1] - double_well_derivative(cell, q) * value[0];
+          gradient_result[1] = -lambda(cell, q) * gradient[0] +
+                               potential_smoothing(cell, q) * gradient[1];
+
+          integrator.submit_value(value_result, q);
+          integrator.submit_gradient(gradient_result, q);
+        }
+
+      integrator.integrate_scatter(EvaluationFlags::values |
+                                     EvaluationFlags::gradients,
+                                   dst);
+    }
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::
+  local_apply_potential_phase_coupling(
+    const MatrixFree<dim, number>               &matrix_free,
+    VectorType                                  &dst,
+    const VectorType                            &src,
+    const std::pair<unsigned int, unsigned int> &range) const
+{
+  FECellIntegrator integrator(matrix_free, 0, 0, 0);
+
+  for (unsigned int cell = range.first; cell < range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src,
+                                 EvaluationFlags::values |
+                                   EvaluationFlags::gradients);
+
+      for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+        {
+          const auto value    = integrator.get_value(q);
+          const auto gradient = integrator.get_gradient(q);
+
+          Tensor<1, 2, VectorizedArray<number>>                 value_result;
+          Tensor<1, 2, Tensor<1, dim, VectorizedArray<number>>> gradient_result;
+
+          value_result[1]    = -double_well_derivative(cell, q) * value[0];
+          gradient_result[1] = -lambda(cell, q) * gradient[0];
+
+          integrator.submit_value(value_result, q);
+          integrator.submit_gradient(gradient_result, q);
+        }
+
+      integrator.integrate_scatter(EvaluationFlags::values |
+                                     EvaluationFlags::gradients,
+                                   dst);
+    }
+}
+
+template <int dim, typename number>
+types::global_dof_index
+CahnHilliardMatrixFreeOperator<dim, number>::m() const
+{
+  return matrix_free.get_dof_handler(0).n_dofs();
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::initialize_dof_vector(
+  VectorType &vec) const
+{
+  matrix_free.initialize_dof_vector(vec, 0);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMatrixFreeOperator<dim, number>::initialize_fluid_dof_vector(
+  VectorType &vec) const
+{
+  matrix_free.initialize_dof_vector(vec, 1);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMassLaplaceOperator<dim, number>::reinit(
+  const CahnHilliardMatrixFreeOperator<dim, number> &cahn_hilliard_operator,
+  const unsigned int                                 component,
+  const Table<2, VectorizedArray<number>>           &mass_coefficient,
+  const Table<2, VectorizedArray<number>>           &laplace_coefficient)
+{
+  AssertThrow(component < 2,
+              ExcMessage("The Cahn-Hilliard physics only has two components."));
+
+  this->cahn_hilliard_operator = &cahn_hilliard_operator;
+  this->component              = component;
+  this->mass_coefficient       = &mass_coefficient;
+  this->laplace_coefficient    = &laplace_coefficient;
+
+  const auto &matrix_free = cahn_hilliard_operator.get_matrix_free();
+  const auto &partitioner = matrix_free.get_vector_partitioner(0);
+
+  // Sort the locally owned degrees of freedom by component
+  ComponentMask other_component_mask(2, false);
+  other_component_mask.set(1 - component, true);
+  const IndexSet other_component_dofs =
+    DoFTools::extract_dofs(matrix_free.get_dof_handler(0),
+                           other_component_mask);
+
+  other_component_indices.clear();
+  for (const auto i : other_component_dofs)
+    other_component_indices.push_back(partitioner->global_to_local(i));
+
+  constrained_component_indices.clear();
+  for (const auto i : cahn_hilliard_operator.get_constrained_indices())
+    if (!other_component_dofs.is_element(partitioner->local_to_global(i)))
+      constrained_component_indices.push_back(i);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMassLaplaceOperator<dim, number>::vmult(VectorType       &dst,
+                                                    const VectorType &src) const
+{
+  cahn_hilliard_operator->get_matrix_free().cell_loop(
+    &CahnHilliardMassLaplaceOperator::local_apply, this, dst, src, true);
+
+  for (const auto i : constrained_component_indices)
+    dst.local_element(i) = src.local_element(i);
+
+  restrict_to_component(dst);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMassLaplaceOperator<dim, number>::compute_inverse_diagonal(
+  VectorType &inverse_diagonal) const
+{
+  const auto &matrix_free = cahn_hilliard_operator->get_matrix_free();
+  initialize_dof_vector(inverse_diagonal);
+
+  MatrixFreeTools::
+    compute_diagonal<dim, -1, 0, 1, number, VectorizedArray<number>>(
+      matrix_free,
+      inverse_diagonal,
+      [&](auto &integrator) { this->do_cell_integral_local(integrator); },
+      0,
+      0,
+      component);
+
+  for (const auto i : constrained_component_indices)
+    inverse_diagonal.local_element(i) = 1.;
+
+  for (auto &i : inverse_diagonal)
+    i = (std::abs(i) > 1.0e-10) ? (1.0 / i) : 1.0;
+
+  // The Chebyshev iteration then leaves the other component at zero
+  restrict_to_component(inverse_diagonal);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMassLaplaceOperator<dim, number>::restrict_to_component(
+  VectorType &vec) const
+{
+  for (const auto i : other_component_indices)
+    vec.local_element(i) = 0.;
+}
+
+template <int dim, typename number>
+types::global_dof_index
+CahnHilliardMassLaplaceOperator<dim, number>::m() const
+{
+  return cahn_hilliard_operator->m();
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMassLaplaceOperator<dim, number>::initialize_dof_vector(
+  VectorType &vec) const
+{
+  cahn_hilliard_operator->initialize_dof_vector(vec);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMassLaplaceOperator<dim, number>::do_cell_integral_local(
+  FECellIntegrator &integrator) const
+{
+  const unsigned int cell = integrator.get_current_cell_index();
+
+  integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+
+  for (unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      integrator.submit_value((*mass_coefficient)(cell, q) *
+                                integrator.get_value(q),
+                              q);
+      integrator.submit_gradient((*laplace_coefficient)(cell, q) *
+                                   integrator.get_gradient(q),
+                                 q);
+    }
+
+  integrator.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardMassLaplaceOperator<dim, number>::local_apply(
+  const MatrixFree<dim, number>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FECellIntegrator integrator(matrix_free, 0, 0, component);
+
+  for (unsigned int cell = range.first; cell < range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src);
+      do_cell_integral_local(integrator);
+      integrator.distribute_local_to_global(dst);
+    }
+}
+
+template <int dim, typename number>
+void
+CahnHilliardBlockPreconditioner<dim, number>::initialize(
+  const CahnHilliardMatrixFreeOperator<dim, number> &cahn_hilliard_operator,
+  const double                                       tolerance)
+{
+  this->cahn_hilliard_operator = &cahn_hilliard_operator;
+
+  const number bdf_coefficient = cahn_hilliard_operator.get_bdf_coefficient();
+  AssertThrow(bdf_coefficient > 0.,
+              ExcMessage("The block preconditioner of the matrix-free "
+                         "Cahn-Hilliard operator requires a BDF time "
+                         "integration scheme."));
+
+  const auto        &mobility = cahn_hilliard_operator.get_mobility();
+  const auto        &lambda   = cahn_hilliard_operator.get_lambda();
+  const unsigned int n_cell_batches = mobility.size(0);
+  const unsigned int n_q_points     = mobility.size(1);
+
+  // Coefficients of the factor of the approximate Schur complement
+  schur_mass_coefficient.reinit(n_cell_batches, n_q_points);
+  schur_mass_coefficient.fill(
+    VectorizedArray<number>(std::sqrt(bdf_coefficient)));
+  schur_laplace_coefficient.reinit(n_cell_batches, n_q_points);
+  for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    for (unsigned int q = 0; q < n_q_points; ++q)
+      schur_laplace_coefficient(cell, q) =
+        std::sqrt(std::abs(mobility(cell, q) * lambda(cell, q)));
+
+  unit_coefficient.reinit(n_cell_batches, n_q_points);
+  unit_coefficient.fill(VectorizedArray<number>(1.));
+  zero_coefficient.reinit(n_cell_batches, n_q_points);
+  zero_coefficient.fill(VectorizedArray<number>(0.));
+
+  schur_factor_operator.reinit(cahn_hilliard_operator,
+                               0,
+                               schur_mass_coefficient,
+                               schur_laplace_coefficient);
+  phase_mass_operator.reinit(cahn_hilliard_operator,
+                             0,
+                             unit_coefficient,
+                             zero_coefficient);
+  potential_operator.reinit(cahn_hilliard_operator,
+                            1,
+                            unit_coefficient,
+                            cahn_hilliard_operator.get_potential_smoothing());
+
+  initialize_chebyshev(schur_factor_operator, schur_factor_inverse, tolerance);
+  initialize_chebyshev(potential_operator, potential_inverse, tolerance);
+
+  cahn_hilliard_operator.initialize_dof_vector(tmp_phase);
+  cahn_hilliard_operator.initialize_dof_vector(tmp_potential);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardBlockPreconditioner<dim, number>::initialize_chebyshev(
+  const ScalarOperator &scalar_operator,
+  ChebyshevType        &chebyshev,
+  const double          tolerance) const
+{
+  typename ChebyshevType::AdditionalData additional_data;
+  additional_data.preconditioner =
+    std::make_shared<DiagonalMatrix<VectorType>>();
+  scalar_operator.compute_inverse_diagonal(
+    additional_data.preconditioner->get_vector());
+
+  // The number of iterations is chosen by the Chebyshev iteration to reach
+  // the requested reduction of the residual
+  additional_data.degree              = numbers::invalid_unsigned_int;
+  additional_data.smoothing_range     = tolerance;
+  additional_data.eig_cg_n_iterations = 20;
+
+  chebyshev.initialize(scalar_operator, additional_data);
+}
+
+template <int dim, typename number>
+void
+CahnHilliardBlockPreconditioner<dim, number>::vmult(VectorType       &dst,
+                                                    const VectorType &src) const
+{
+  // Phase order: apply the inverse of the approximate Schur complement,
+  // i.e., F^{-1} M F^{-1} with F the factor of the Schur complement
+  tmp_phase = src;
+  schur_factor_operator.restrict_to_component(tmp_phase);
+  schur_factor_inverse.vmult(dst, tmp_phase);
+  phase_mass_operator.vmult(tmp_phase, dst);
+  schur_factor_inverse.vmult(dst, tmp_phase);
+
+  // Chemical potential: apply the inverse of the chemical potential block to
+  // the residual of the chemical potential equation minus the coupling with
+  // the phase order
+  cahn_hilliard_operator->vmult_potential_phase_coupling(tmp_potential, dst);
+  tmp_potential.sadd(-1., 1., src);
+  potential_operator.restrict_to_component(tmp_potential);
+  potential_inverse.vmult(tmp_phase, tmp_potential);
+
+  dst += tmp_phase;
+}
+
+template class CahnHilliardMatrixFreeOperator<2, double>;
+template class CahnHilliardMatrixFreeOperator<3, double>;
+template class CahnHilliardMassLaplaceOperator<2, double>;
+template class CahnHilliardMassLaplaceOperator<3, double>;
+template class CahnHilliardBlockPreconditioner<2, double>;
+template class CahnHilliardBlockPreconditioner<3, double>;
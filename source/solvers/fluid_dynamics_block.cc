@@ -31,7 +31,12 @@ FluidDynamicsBlock<dim>::FluidDynamicsBlock(
   SimulationParameters<dim> &p_nsparam)
   : NavierStokesBase<dim, GlobalBlockVectorType, std::vector<IndexSet>>(
       p_nsparam)
-{}
+{
+  AssertThrow(
+    !p_nsparam.simulation_control.adapt_with_error,
+    ExcMessage(
+      "The adaptation of the time step with the error estimate is only supported by the matrix-based fluid dynamics solver (lethe-fluid), since this solver does not estimate the error of the time step."));
+}
 
 template <int dim>
 FluidDynamicsBlock<dim>::~FluidDynamicsBlock()
@@ -14,6 +14,7 @@
 #include <solvers/navier_stokes_cahn_hilliard_assemblers.h>
 #include <solvers/navier_stokes_vof_assemblers.h>
 
+#include <deal.II/base/timer.h>
 #include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_renumbering.h>
@@ -37,6 +38,8 @@ template <int dim>
 FluidDynamicsMatrixBased<dim>::FluidDynamicsMatrixBased(
   SimulationParameters<dim> &p_nsparam)
   : NavierStokesBase<dim, GlobalVectorType, IndexSet>(p_nsparam)
+  , preconditioner_refresh_policy(
+      p_nsparam.linear_solver.at(PhysicsID::fluid_dynamics))
 {
   initial_preconditioner_fill_level =
     ((this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
@@ -45,6 +48,31 @@ FluidDynamicsMatrixBased<dim>::FluidDynamicsMatrixBased(
          .amg_precond_ilu_fill :
        this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
          .ilu_precond_fill);
+
+  // The cached local matrices only depend on the fluid dynamics degrees of
+  // freedom. Couplings that modify the local matrix of a cell whose velocity
+  // and pressure have not changed are thus not supported.
+  if (this->simulation_parameters.physics_solving_strategy
+        .at(PhysicsID::fluid_dynamics)
+        .enable_cell_activity_map)
+    {
+      AssertThrow(
+        !this->simulation_parameters.multiphysics.VOF &&
+          !this->simulation_parameters.multiphysics.cahn_hilliard &&
+          !this->simulation_parameters.multiphysics.heat_transfer,
+        ExcMessage(
+          "The cell activity map is not supported when the fluid dynamics are coupled with the VOF, Cahn-Hilliard or heat transfer physics."));
+      AssertThrow(
+        !this->simulation_parameters.mortar_parameters.enable &&
+          !this->simulation_parameters.flow_control.enable_flow_control &&
+          !this->simulation_parameters.ale.enabled(),
+        ExcMessage(
+          "The cell activity map is not supported with the mortar method, with flow control or with the arbitrary Lagrangian-Eulerian (ALE) formulation."));
+      AssertThrow(
+        !this->simulation_control->is_sdirk(),
+        ExcMessage(
+          "The cell activity map is not supported with the SDIRK time-stepping methods."));
+    }
 }
 
 template <int dim>
@@ -64,6 +92,7 @@ FluidDynamicsMatrixBased<dim>::setup_dofs_fd()
   amg_preconditioner.reset();
   ilu_preconditioner.reset();
   current_preconditioner_fill_level = initial_preconditioner_fill_level;
+  preconditioner_refresh_policy.invalidate();
 
 
   // Now reset system matrix
@@ -140,6 +169,23 @@ FluidDynamicsMatrixBased<dim>::setup_dofs_fd()
   this->newton_update.reinit(this->locally_owned_dofs, this->mpi_communicator);
   this->system_rhs.reinit(this->locally_owned_dofs, this->mpi_communicator);
 
+  // The cell activity map is indexed by the active cell indices, which change
+  // with the mesh. All the cached local matrices are therefore invalidated.
+  if (this->simulation_parameters.physics_solving_strategy
+        .at(PhysicsID::fluid_dynamics)
+        .enable_cell_activity_map)
+    {
+      const unsigned int n_dofs_per_cell = this->fe->n_dofs_per_cell();
+      cached_local_matrices.assign(
+        this->triangulation->n_active_cells(),
+        FullMatrix<double>(n_dofs_per_cell, n_dofs_per_cell));
+      cached_cell_states.assign(this->triangulation->n_active_cells(),
+                                Vector<double>(n_dofs_per_cell));
+      cached_local_matrix_is_valid.assign(this->triangulation->n_active_cells(),
+                                          false);
+      cached_time_steps.clear();
+    }
+
 
   auto                  &nonzero_constraints = this->get_nonzero_constraints();
   DynamicSparsityPattern dsp(this->locally_relevant_dofs);
@@ -738,6 +784,15 @@ FluidDynamicsMatrixBased<dim>::assemble_system_matrix()
   if (this->simulation_parameters.mortar_parameters.enable)
     scratch_data.enable_mortar();
 
+  const Parameters::NonLinearSolver &non_linear_solver_parameters =
+    this->simulation_parameters.physics_solving_strategy.at(
+      PhysicsID::fluid_dynamics);
+
+  n_assembled_cells = 0;
+  n_skipped_cells   = 0;
+  if (non_linear_solver_parameters.enable_cell_activity_map)
+    prepare_cell_activity_map();
+
   WorkStream::run(
     this->dof_handler->begin_active(),
     this->dof_handler->end(),
@@ -748,6 +803,21 @@ FluidDynamicsMatrixBased<dim>::assemble_system_matrix()
     StabilizedMethodsTensorCopyData<dim>(this->fe->n_dofs_per_cell(),
                                          this->cell_quadrature->size()));
 
+  // Report the fraction of the cells whose local matrix was reused
+  if (non_linear_solver_parameters.enable_cell_activity_map &&
+      non_linear_solver_parameters.verbosity != Parameters::Verbosity::quiet)
+    {
+      const unsigned int n_skipped =
+        Utilities::MPI::sum(n_skipped_cells, this->mpi_communicator);
+      const unsigned int n_cells =
+        n_skipped +
+        Utilities::MPI::sum(n_assembled_cells, this->mpi_communicator);
+      this->pcout << "  -Cell activity map: skipped the assembly of "
+                  << n_skipped << "/" << n_cells << " cells ("
+                  << 100. * n_skipped / std::max(n_cells, 1U) << " %)"
+                  << std::endl;
+    }
+
   // Add mortar entries
   if (this->simulation_parameters.mortar_parameters.enable)
     {
@@ -771,6 +841,28 @@ FluidDynamicsMatrixBased<dim>::assemble_local_system_matrix(
   if (!cell->is_locally_owned())
     return;
 
+  const bool cell_activity_map_enabled =
+    this->simulation_parameters.physics_solving_strategy
+      .at(PhysicsID::fluid_dynamics)
+      .enable_cell_activity_map;
+
+  // Reuse the cached local matrix if the cell is quiescent. The scratch data
+  // is not reinitialized, which is where most of the cost of the assembly of
+  // a cell lies.
+  copy_data.cell_assembly_skipped = false;
+  if (cell_activity_map_enabled)
+    {
+      cell->get_dof_indices(copy_data.local_dof_indices);
+      if (is_cell_quiescent(cell->active_cell_index(),
+                            copy_data.local_dof_indices))
+        {
+          copy_data.local_matrix =
+            cached_local_matrices[cell->active_cell_index()];
+          copy_data.cell_assembly_skipped = true;
+          return;
+        }
+    }
+
   scratch_data.reinit(
     cell,
     this->evaluation_point,
@@ -881,6 +973,19 @@ FluidDynamicsMatrixBased<dim>::assemble_local_system_matrix(
     }
 
   cell->get_dof_indices(copy_data.local_dof_indices);
+
+  // Cache the local matrix along with the state of the cell at which it was
+  // assembled. Every thread works on a different cell, hence on different
+  // entries of the cache.
+  if (cell_activity_map_enabled)
+    {
+      const unsigned int cell_index = cell->active_cell_index();
+      cached_local_matrices[cell_index] = copy_data.local_matrix;
+      for (unsigned int i = 0; i < copy_data.local_dof_indices.size(); ++i)
+        cached_cell_states[cell_index][i] =
+          this->evaluation_point[copy_data.local_dof_indices[i]];
+      cached_local_matrix_is_valid[cell_index] = true;
+    }
 }
 
 template <int dim>
@@ -891,6 +996,11 @@ FluidDynamicsMatrixBased<dim>::copy_local_matrix_to_global_matrix(
   if (!copy_data.cell_is_local)
     return;
 
+  if (copy_data.cell_assembly_skipped)
+    ++n_skipped_cells;
+  else
+    ++n_assembled_cells;
+
   const AffineConstraints<double> &zero_constraints_used =
     (!this->simulation_parameters.constrain_solid_domain.enable) ?
       this->zero_constraints :
@@ -900,6 +1010,56 @@ FluidDynamicsMatrixBased<dim>::copy_local_matrix_to_global_matrix(
                                                    this->system_matrix);
 }
 
+template <int dim>
+void
+FluidDynamicsMatrixBased<dim>::prepare_cell_activity_map()
+{
+  // The local matrices contain the time-stepping coefficients. They must all
+  // be reassembled if the time step (or its history) has changed.
+  const std::vector<double> time_steps =
+    this->simulation_control->get_time_steps_vector();
+  if (time_steps != cached_time_steps)
+    {
+      std::fill(cached_local_matrix_is_valid.begin(),
+                cached_local_matrix_is_valid.end(),
+                false);
+      cached_time_steps = time_steps;
+    }
+}
+
+template <int dim>
+bool
+FluidDynamicsMatrixBased<dim>::is_cell_quiescent(
+  const unsigned int                          cell_index,
+  const std::vector<types::global_dof_index> &local_dof_indices) const
+{
+  if (!cached_local_matrix_is_valid[cell_index])
+    return false;
+
+  const double tolerance =
+    this->simulation_parameters.physics_solving_strategy
+      .at(PhysicsID::fluid_dynamics)
+      .cell_activity_tolerance;
+  const Vector<double> &cached_state = cached_cell_states[cell_index];
+
+  for (unsigned int i = 0; i < local_dof_indices.size(); ++i)
+    {
+      const types::global_dof_index dof = local_dof_indices[i];
+      if (std::abs(this->evaluation_point[dof] - cached_state[i]) > tolerance)
+        return false;
+
+      // In transient simulations, the local matrix also depends on the
+      // previous solutions through the stabilization terms. A cell is only
+      // quiescent if its state has not changed over the previous time steps.
+      if (!this->simulation_control->is_steady())
+        for (const auto &previous_solution : *this->previous_solutions)
+          if (std::abs(previous_solution[dof] - cached_state[i]) > tolerance)
+            return false;
+    }
+
+  return true;
+}
+
 
 template <int dim>
 void
@@ -1456,8 +1616,29 @@ template <int dim>
 void
 FluidDynamicsMatrixBased<dim>::setup_preconditioner()
 {
-  if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
-        .preconditioner == Parameters::LinearSolver::PreconditionerType::ilu)
+  if (!ilu_preconditioner && !amg_preconditioner)
+    preconditioner_refresh_policy.invalidate();
+
+  // The AMG preconditioner can recompute its hierarchy from the new matrix
+  // entries while keeping its aggregates
+  const PreconditionerRefreshPolicy::Action setup_action =
+    preconditioner_refresh_policy.get_setup_action(amg_preconditioner !=
+                                                   nullptr);
+
+  Timer setup_timer;
+  if (setup_action == PreconditionerRefreshPolicy::Action::reuse)
+    {
+      // Nothing to do, the current preconditioner is kept
+    }
+  else if (setup_action == PreconditionerRefreshPolicy::Action::refresh)
+    {
+      TimerOutput::Scope t(this->computing_timer, "Setup AMG");
+      amg_preconditioner->reinit();
+    }
+  else if (this->simulation_parameters.linear_solver
+             .at(PhysicsID::fluid_dynamics)
+             .preconditioner ==
+           Parameters::LinearSolver::PreconditionerType::ilu)
     setup_ILU();
   else if (this->simulation_parameters.linear_solver
              .at(PhysicsID::fluid_dynamics)
@@ -1474,6 +1655,49 @@ FluidDynamicsMatrixBased<dim>::setup_preconditioner()
           Parameters::LinearSolver::PreconditionerType::amg,
       ExcMessage(
         "This linear solver does not support this preconditioner. Only <ilu> and <amg> preconditioners are supported."));
+
+  preconditioner_refresh_policy.register_setup(setup_action,
+                                               setup_timer.wall_time());
+}
+
+template <int dim>
+void
+FluidDynamicsMatrixBased<dim>::setup_lagged_preconditioner()
+{
+  // The Jacobian-vector products of the jfnk solver are computed in terms of
+  // the unscaled pressure, whereas the matrix is assembled for the scaled
+  // pressure
+  AssertThrow(
+    std::abs(this->simulation_parameters.stabilization.pressure_scaling_factor -
+             1.) < 1e-8,
+    ExcMessage(
+      "The jfnk non-linear solver does not support a pressure scaling factor different from 1."));
+
+  if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+        .preconditioner == Parameters::LinearSolver::PreconditionerType::ilu)
+    setup_ILU();
+  else if (this->simulation_parameters.linear_solver
+             .at(PhysicsID::fluid_dynamics)
+             .preconditioner ==
+           Parameters::LinearSolver::PreconditionerType::amg)
+    setup_AMG();
+  else
+    AssertThrow(
+      false,
+      ExcMessage(
+        "The jfnk non-linear solver does not support this preconditioner. Only <ilu> and <amg> preconditioners are supported."));
+}
+
+template <int dim>
+void
+FluidDynamicsMatrixBased<dim>::apply_lagged_preconditioner(
+  GlobalVectorType       &dst,
+  const GlobalVectorType &src)
+{
+  if (ilu_preconditioner)
+    ilu_preconditioner->vmult(dst, src);
+  else
+    amg_preconditioner->vmult(dst, src);
 }
 
 
@@ -1635,6 +1859,7 @@ FluidDynamicsMatrixBased<dim>::solve_system_GMRES(
 
           {
             TimerOutput::Scope t(this->computing_timer, "Solve linear system");
+            Timer              solve_timer;
 
             if (this->simulation_parameters.linear_solver
                   .at(PhysicsID::fluid_dynamics)
@@ -1665,6 +1890,9 @@ FluidDynamicsMatrixBased<dim>::solve_system_GMRES(
                 ExcMessage(
                   "This linear solver does not support this preconditioner. Only <ilu> and <amg> preconditioners are supported."));
 
+            preconditioner_refresh_policy.register_solve(
+              solver_control.last_step(), solve_timer.wall_time());
+
             if (this->simulation_parameters.linear_solver
                   .at(PhysicsID::fluid_dynamics)
                   .verbosity != Parameters::Verbosity::quiet)
@@ -1673,6 +1901,7 @@ FluidDynamicsMatrixBased<dim>::solve_system_GMRES(
                   << "  -Iterative solver took : " << solver_control.last_step()
                   << " steps to reach a residual norm of "
                   << solver_control.last_value() / rescale_metric << std::endl;
+                preconditioner_refresh_policy.print_statistics(this->pcout);
               }
           }
 
@@ -1694,6 +1923,7 @@ FluidDynamicsMatrixBased<dim>::solve_system_GMRES(
           this->pcout
             << " GMRES solver failed! Trying with a higher preconditioner fill level. New fill = "
             << current_preconditioner_fill_level << std::endl;
+          preconditioner_refresh_policy.invalidate();
           setup_preconditioner();
 
           if (iter == max_iter - 1 && !this->simulation_parameters.linear_solver
@@ -1827,6 +2057,7 @@ FluidDynamicsMatrixBased<dim>::solve_L2_system(const double absolute_residual,
           this->pcout
             << " GMRES solver failed while solving the L2 projection problem! Trying with a higher preconditioner fill level. New fill = "
             << current_preconditioner_fill_level << std::endl;
+          preconditioner_refresh_policy.invalidate();
           setup_preconditioner();
 
           if (iter == max_iter - 1 && !this->simulation_parameters.linear_solver
@@ -1837,6 +2068,10 @@ FluidDynamicsMatrixBased<dim>::solve_L2_system(const double absolute_residual,
       iter += 1;
     }
   current_preconditioner_fill_level = initial_preconditioner_fill_level;
+
+  // The preconditioner was built for the L2 projection matrix and must not be
+  // reused for the Navier-Stokes system
+  preconditioner_refresh_policy.invalidate();
 }
 
 // The solver starts from the initial fill level provided in the parameter file.
@@ -1901,6 +2136,7 @@ FluidDynamicsMatrixBased<dim>::solve_system_BiCGStab(
 
           {
             TimerOutput::Scope t(this->computing_timer, "Solve linear system");
+            Timer              solve_timer;
 
             if (this->simulation_parameters.linear_solver
                   .at(PhysicsID::fluid_dynamics)
@@ -1919,6 +2155,9 @@ FluidDynamicsMatrixBased<dim>::solve_system_BiCGStab(
                 ExcMessage(
                   "This linear solver does not support this preconditioner. Only <ilu> preconditioner is supported."));
 
+            preconditioner_refresh_policy.register_solve(
+              solver_control.last_step(), solve_timer.wall_time());
+
             if (this->simulation_parameters.linear_solver
                   .at(PhysicsID::fluid_dynamics)
                   .verbosity != Parameters::Verbosity::quiet)
@@ -1927,6 +2166,7 @@ FluidDynamicsMatrixBased<dim>::solve_system_BiCGStab(
                   << "  -Iterative solver took : " << solver_control.last_step()
                   << " steps to reach a residual norm of "
                   << solver_control.last_value() / rescale_metric << std::endl;
+                preconditioner_refresh_policy.print_statistics(this->pcout);
               }
             zero_constraints_used.distribute(completely_distributed_solution);
             this->newton_update = completely_distributed_solution;
@@ -1939,6 +2179,7 @@ FluidDynamicsMatrixBased<dim>::solve_system_BiCGStab(
           this->pcout
             << " BiCGStab solver failed! Trying with a higher preconditioner fill level. New fill = "
             << current_preconditioner_fill_level << std::endl;
+          preconditioner_refresh_policy.invalidate();
           setup_preconditioner();
 
           if (iter == max_iter - 1 && !this->simulation_parameters.linear_solver
@@ -2155,11 +2396,29 @@ FluidDynamicsMatrixBased<dim>::solve()
         NavierStokesBase<dim, GlobalVectorType, IndexSet>::refine_mesh();
 
       this->define_dynamic_zero_constraints();
+      this->multiphysics->save_time_step_state();
       this->iterate();
+
+      // Solve the time step again with a smaller time step as long as its
+      // estimated error exceeds the tolerance
+      while (this->reject_time_step())
+        {
+          this->forcing_function->set_time(
+            this->simulation_control->get_current_time());
+          this->update_boundary_conditions();
+          this->multiphysics->update_boundary_conditions();
+          this->simulation_control->print_progression(this->pcout);
+          this->define_dynamic_zero_constraints();
+          this->iterate();
+        }
+
       this->postprocess(false);
       this->finish_time_step();
     }
 
+  if (this->simulation_parameters.timer.type != Parameters::Timer::Type::none)
+    preconditioner_refresh_policy.print_total_times(this->pcout,
+                                                    "Fluid Dynamics");
 
   this->finish_simulation();
 }
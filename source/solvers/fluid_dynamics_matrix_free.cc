@@ -2622,6 +2622,11 @@ FluidDynamicsMatrixFree<dim>::FluidDynamicsMatrixFree(
     dealii::ExcMessage(
       "Matrix free Navier-Stokes does not support different orders for the velocity and the pressure!"));
 
+  AssertThrow(
+    !nsparam.simulation_control.adapt_with_error,
+    dealii::ExcMessage(
+      "The adaptation of the time step with the error estimate is only supported by the matrix-based fluid dynamics solver (lethe-fluid), since the matrix-free solver does not estimate the error of the time step."));
+
   this->fe = std::make_shared<FESystem<dim>>(
     FE_Q<dim>(nsparam.fem_parameters.velocity_order), dim + 1);
 
@@ -3035,7 +3040,9 @@ FluidDynamicsMatrixFree<dim>::update_mortar_configuration()
         Parameters::MeshAdaptation::Type::none)
     {
       // Clear the preconditioner before the matrix they are associated with is
-      // cleared
+      // cleared. The GMG preconditioner is otherwise kept across the time
+      // steps and only rebuilt when the mesh changes (setup_dofs_fd), but the
+      // level mappings and mortar operators follow the rotation of the rotor
       gmg_preconditioner.reset();
       ilu_preconditioner.reset();
 
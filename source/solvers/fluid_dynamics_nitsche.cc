@@ -50,6 +50,11 @@ FluidDynamicsNitsche<dim, spacedim>::FluidDynamicsNitsche(
 
   solid_forces_table.resize(n_solids);
   solid_torques_table.resize(n_solids);
+
+  AssertThrow(
+    !p_nsparam.simulation_control.adapt_with_error,
+    ExcMessage(
+      "The adaptation of the time step with the error estimate is only supported by the matrix-based fluid dynamics solver (lethe-fluid), since the Nitsche solver does not estimate the error of the time step."));
 }
 
 template <int dim, int spacedim>
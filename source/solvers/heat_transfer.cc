@@ -961,6 +961,10 @@ HeatTransfer<dim>::finish_simulation()
                                 simulation_control->get_log_precision());
       error_table.write_text(std::cout);
     }
+
+  if (simulation_parameters.timer.type != Parameters::Timer::Type::none)
+    preconditioner_refresh_policy.print_total_times(this->pcout,
+                                                    "Heat Transfer");
 }
 
 template <int dim>
@@ -1351,6 +1355,9 @@ HeatTransfer<dim>::setup_dofs()
 
   // Proceed with setting up the DoFs
   dof_handler->distribute_dofs(*fe);
+
+  // The structure of the matrix changes, its preconditioner must be rebuilt
+  preconditioner_refresh_policy.invalidate();
   DoFRenumbering::Cuthill_McKee(*this->dof_handler);
 
   auto mpi_communicator = triangulation->get_mpi_communicator();
@@ -1556,6 +1563,43 @@ HeatTransfer<dim>::set_initial_conditions()
   percolate_time_vectors();
 }
 
+template <int dim>
+void
+HeatTransfer<dim>::setup_ilu_preconditioner()
+{
+  const unsigned int ilu_fill =
+    simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
+      .ilu_precond_fill;
+  const double ilu_atol =
+    simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
+      .ilu_precond_atol;
+  const double ilu_rtol =
+    simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
+      .ilu_precond_rtol;
+  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
+    ilu_fill, ilu_atol, ilu_rtol, 0);
+
+  system_ilu_preconditioner =
+    std::make_shared<TrilinosWrappers::PreconditionILU>();
+  system_ilu_preconditioner->initialize(system_matrix, preconditionerOptions);
+}
+
+template <int dim>
+void
+HeatTransfer<dim>::setup_lagged_preconditioner()
+{
+  TimerOutput::Scope t(this->computing_timer, "Setup lagged preconditioner");
+  setup_ilu_preconditioner();
+}
+
+template <int dim>
+void
+HeatTransfer<dim>::apply_lagged_preconditioner(GlobalVectorType       &dst,
+                                               const GlobalVectorType &src)
+{
+  system_ilu_preconditioner->vmult(dst, src);
+}
+
 template <int dim>
 void
 HeatTransfer<dim>::solve_linear_system()
@@ -1586,21 +1630,14 @@ HeatTransfer<dim>::solve_linear_system()
   const double non_rescaled_linear_solver_tolerance =
     linear_solver_tolerance * rescale_metric;
 
-  const unsigned int ilu_fill =
-    simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
-      .ilu_precond_fill;
-  const double ilu_atol =
-    simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
-      .ilu_precond_atol;
-  const double ilu_rtol =
-    simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
-      .ilu_precond_rtol;
-  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
-    ilu_fill, ilu_atol, ilu_rtol, 0);
-
-  TrilinosWrappers::PreconditionILU ilu_preconditioner;
-
-  ilu_preconditioner.initialize(system_matrix, preconditionerOptions);
+  // The preconditioner is rebuilt or reused according to the refresh policy
+  const PreconditionerRefreshPolicy::Action setup_action =
+    preconditioner_refresh_policy.get_setup_action(false);
+  Timer setup_timer;
+  if (setup_action == PreconditionerRefreshPolicy::Action::rebuild)
+    setup_ilu_preconditioner();
+  preconditioner_refresh_policy.register_setup(setup_action,
+                                               setup_timer.wall_time());
 
   GlobalVectorType completely_distributed_solution(locally_owned_dofs,
                                                    mpi_communicator);
@@ -1621,10 +1658,13 @@ HeatTransfer<dim>::solve_linear_system()
   TrilinosWrappers::SolverGMRES solver(solver_control, solver_parameters);
 
 
+  Timer solve_timer;
   solver.solve(system_matrix,
                completely_distributed_solution,
                system_rhs,
-               ilu_preconditioner);
+               *system_ilu_preconditioner);
+  preconditioner_refresh_policy.register_solve(solver_control.last_step(),
+                                               solve_timer.wall_time());
 
   if (simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
         .verbosity != Parameters::Verbosity::quiet)
@@ -1632,6 +1672,7 @@ HeatTransfer<dim>::solve_linear_system()
       this->pcout << "  -Iterative solver took : " << solver_control.last_step()
                   << " steps to reach a residual norm of "
                   << solver_control.last_value() / rescale_metric << std::endl;
+      preconditioner_refresh_policy.print_statistics(this->pcout);
     }
 
   constraints_used.distribute(completely_distributed_solution);
@@ -8,7 +8,16 @@
 #include <solvers/tracer.h>
 #include <solvers/vof.h>
 
+#include <core/concurrent_tasks.h>
+
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/timer.h>
+
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <set>
+
 #define _unused(x) ((void)(x))
 
 DeclException1(
@@ -83,9 +92,21 @@ MultiphysicsInterface<dim>::MultiphysicsInterface(
   ConditionalOStream                &p_pcout)
   : multiphysics_parameters(nsparam.multiphysics)
   , pcout(p_pcout)
+  , simulation_control(p_simulation_control)
+  , time_step_error(0.)
+  , mpi_communicator(p_triangulation->get_mpi_communicator())
+  , sequential_fallback_is_announced(false)
+  , cumulated_physics_solve_time(0.)
+  , cumulated_concurrent_wall_time(0.)
 {
   inspect_multiphysics_models_dependencies(nsparam);
 
+  AssertThrow(
+    !nsparam.simulation_control.adapt_with_error ||
+      (!multiphysics_parameters.VOF && !multiphysics_parameters.cahn_hilliard),
+    ExcMessage(
+      "The adaptation of the time step with the error estimate is not supported with the VOF and Cahn-Hilliard physics, since their filtered fields cannot be brought back to the beginning of a rejected time step."));
+
   // Fluid dynamics is always considered active
   // since its DofHandler is required at all time by
   // the other physics. Consequently, disabling it only
@@ -249,6 +270,200 @@ MultiphysicsInterface<dim>::set_immersed_solid_shape(
   immersed_solid_shape = shape;
 }
 
+template <int dim>
+void
+MultiphysicsInterface<dim>::solve_concurrently(
+  const std::vector<PhysicsID> &physics_to_solve,
+  const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method)
+{
+  // Sort the physics into levels. A physics is ready to be solved once the
+  // physics it depends on and that are solved at this stage are solved.
+  std::vector<std::vector<PhysicsID>> levels;
+  std::set<PhysicsID> remaining(physics_to_solve.begin(),
+                                physics_to_solve.end());
+  while (!remaining.empty())
+    {
+      std::vector<PhysicsID> level;
+      for (const auto physics_id : remaining)
+        {
+          bool is_ready = true;
+          for (const auto dependency :
+               physics.at(physics_id)->get_dependencies())
+            if (dependency != physics_id && remaining.contains(dependency))
+              is_ready = false;
+
+          if (is_ready)
+            level.push_back(physics_id);
+        }
+
+      // Circular dependencies are broken by solving the physics in the order
+      // of their identifiers, as in the sequential execution
+      if (level.empty())
+        level.push_back(*remaining.begin());
+
+      for (const auto physics_id : level)
+        remaining.erase(physics_id);
+      levels.push_back(level);
+    }
+
+  // The number of threads may be set after the construction of the
+  // interface, so the support of the concurrent execution is checked here
+  const bool concurrent_execution =
+    concurrent_tasks_are_supported(mpi_communicator);
+  if (!concurrent_execution && !sequential_fallback_is_announced)
+    {
+      pcout
+        << "Warning: the concurrent execution of the auxiliary physics "
+           "requires a single MPI process, an MPI library supporting "
+           "MPI_THREAD_MULTIPLE and more than one thread. The auxiliary "
+           "physics are solved sequentially."
+        << std::endl;
+      sequential_fallback_is_announced = true;
+    }
+
+  for (const auto &level : levels)
+    {
+      if (level.size() == 1 || !concurrent_execution)
+        {
+          for (const auto physics_id : level)
+            solve_physics(physics_id, time_stepping_method);
+          continue;
+        }
+
+      bool is_verbose = false;
+      for (const auto physics_id : level)
+        is_verbose = is_verbose ||
+                     verbosity.at(physics_id) != Parameters::Verbosity::quiet;
+
+      // Each physics has its own timer, whose communicator is MPI_COMM_SELF
+      // in the concurrent execution such that the timers do not synchronize
+      // on the shared communicator
+      std::vector<std::function<void()>> tasks;
+      for (const auto physics_id : level)
+        tasks.emplace_back([&, physics_id]() {
+          // The output of the task is buffered, so the physics is announced
+          // right before its own output
+          if (verbosity.at(physics_id) != Parameters::Verbosity::quiet)
+            announce_physics(physics_id);
+          auto &auxiliary_physics = *physics.at(physics_id);
+          auxiliary_physics.time_stepping_method = time_stepping_method;
+          auxiliary_physics.solve_governing_system();
+          auxiliary_physics.modify_solution();
+        });
+
+      Timer                     level_timer;
+      const std::vector<double> solve_times =
+        run_tasks_with_ordered_output(tasks, std::cout);
+
+      const double level_wall_time = level_timer.wall_time();
+      const double level_solve_time =
+        std::accumulate(solve_times.begin(), solve_times.end(), 0.);
+      cumulated_physics_solve_time += level_solve_time;
+      cumulated_concurrent_wall_time += level_wall_time;
+
+      if (is_verbose)
+        pcout << "  -Concurrent auxiliary physics: cumulated solve time "
+              << level_solve_time << " s, wall time " << level_wall_time
+              << " s, overlap ratio " << level_solve_time / level_wall_time
+              << std::endl;
+    }
+}
+
+template <int dim>
+void
+MultiphysicsInterface<dim>::save_time_step_state()
+{
+  time_step_error = 0.;
+  if (!simulation_control->is_adapting_with_error())
+    return;
+
+  for (auto &iphys : physics)
+    {
+      const PhysicsID physics_id = iphys.first;
+      if (physics_previous_solutions.count(physics_id) == 0)
+        continue;
+
+      saved_solutions[physics_id] = *physics_solutions[physics_id];
+      saved_previous_solutions[physics_id] =
+        *physics_previous_solutions[physics_id];
+      if (oldest_previous_solutions.count(physics_id) > 0)
+        saved_oldest_previous_solutions[physics_id] =
+          oldest_previous_solutions[physics_id];
+      else
+        saved_oldest_previous_solutions.erase(physics_id);
+    }
+}
+
+template <int dim>
+void
+MultiphysicsInterface<dim>::restore_time_step_state()
+{
+  time_step_error = 0.;
+
+  for (auto &saved_solution : saved_solutions)
+    {
+      const PhysicsID physics_id = saved_solution.first;
+      *physics_solutions[physics_id] = saved_solution.second;
+      *physics_previous_solutions[physics_id] =
+        saved_previous_solutions[physics_id];
+      if (saved_oldest_previous_solutions.count(physics_id) > 0)
+        oldest_previous_solutions[physics_id] =
+          saved_oldest_previous_solutions[physics_id];
+      else
+        oldest_previous_solutions.erase(physics_id);
+    }
+}
+
+template <int dim>
+void
+MultiphysicsInterface<dim>::estimate_time_step_error(
+  const PhysicsID physics_id)
+{
+  if (!simulation_control->is_adapting_with_error() ||
+      !simulation_control->is_bdf() ||
+      physics_previous_solutions.count(physics_id) == 0)
+    return;
+
+  const std::vector<GlobalVectorType> &previous_solutions =
+    *physics_previous_solutions[physics_id];
+  const GlobalVectorType &present_solution = *physics_solutions[physics_id];
+
+  // The extrapolation of BDF methods of order k requires k+1 previous
+  // solutions, which are only available once enough time steps were solved
+  const unsigned int bdf_order =
+    number_of_previous_solutions(simulation_control->get_assembly_method());
+  if (bdf_order > 0 && simulation_control->get_step_number() > bdf_order + 1)
+    {
+      std::vector<const GlobalVectorType *> history;
+      for (unsigned int i = 0; i < bdf_order; ++i)
+        history.push_back(&previous_solutions[i]);
+      if (bdf_order < previous_solutions.size())
+        history.push_back(&previous_solutions[bdf_order]);
+      else if (oldest_previous_solutions.count(physics_id) > 0)
+        history.push_back(&oldest_previous_solutions[physics_id]);
+
+      if (history.size() == bdf_order + 1)
+        {
+          GlobalVectorType error, tmp;
+          error.reinit(present_solution.locally_owned_elements(),
+                       present_solution.get_mpi_communicator());
+          tmp.reinit(error);
+
+          time_step_error = std::max(
+            time_step_error,
+            simulation_control->get_time_step_error_controller()
+              .estimate_bdf_error(present_solution,
+                                  history,
+                                  simulation_control->get_time_steps_vector(),
+                                  error,
+                                  tmp));
+        }
+    }
+
+  // Keep the solution that is discarded by the percolation of the physics
+  oldest_previous_solutions[physics_id] = previous_solutions.back();
+}
+
 template <int dim>
 void
 MultiphysicsInterface<dim>::inspect_multiphysics_models_dependencies(
@@ -58,6 +58,7 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
                     TimerOutput::wall_times)
   , simulation_parameters(p_nsparam)
   , flow_control(simulation_parameters.flow_control)
+  , oldest_previous_solution_is_valid(false)
   , velocity_fem_degree(p_nsparam.fem_parameters.velocity_order)
   , pressure_fem_degree(p_nsparam.fem_parameters.pressure_order)
   , number_quadrature_points(p_nsparam.fem_parameters.velocity_order + 1)
@@ -128,6 +129,14 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
   this->pcout.set_condition(
     Utilities::MPI::this_mpi_process(this->mpi_communicator) == 0);
 
+  // Threads of each MPI process used by the thread-parallel assembly, vector
+  // operations and postprocessing
+  const unsigned int n_threads = set_number_of_threads(
+    simulation_parameters.threading.number_of_threads, this->mpi_communicator);
+  if (n_threads > 1)
+    this->pcout << "Running with " << n_threads
+                << " threads per MPI process" << std::endl;
+
   // Initialize solution shared_ptr
   present_solution = std::make_shared<VectorType>();
 
@@ -206,7 +215,8 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
         Parameters::FluidDynamicsInitialConditionType::average_velocity_profile)
     average_velocities =
       std::make_shared<AverageVelocities<dim, VectorType, DofsType>>(
-        *dof_handler);
+        *dof_handler,
+        simulation_parameters.post_processing.average_velocities_scheme);
 
   this->pcout << "Running on "
               << Utilities::MPI::n_mpi_processes(this->mpi_communicator)
@@ -271,23 +281,57 @@ NavierStokesBase<dim, VectorType, DofsType>::check_existance_of_bc(
 }
 
 
-// This is a primitive first implementation that could be greatly improved by
-// doing a single pass instead of N boundary passes
 template <int dim, typename VectorType, typename DofsType>
 void
-NavierStokesBase<dim, VectorType, DofsType>::postprocessing_forces(
-  const VectorType &evaluation_point)
+NavierStokesBase<dim, VectorType, DofsType>::
+  calculate_forces_and_torques_on_boundaries(const VectorType &evaluation_point)
 {
-  TimerOutput::Scope t(this->computing_timer, "Calculate forces");
+  TimerOutput::Scope t(this->computing_timer, "Calculate forces and torques");
 
-  this->forces_on_boundaries =
-    calculate_forces(*this->dof_handler,
-                     evaluation_point,
-                     simulation_parameters.physical_properties_manager,
-                     simulation_parameters.boundary_conditions,
-                     *this->face_quadrature,
-                     *this->get_mapping());
+  const bool calculate_force =
+    simulation_parameters.forces_parameters.calculate_force;
+  const bool calculate_torque =
+    simulation_parameters.forces_parameters.calculate_torque;
+
+  // When both are requested, the forces and the torques are calculated in a
+  // single pass over the boundary faces
+  if (calculate_force && calculate_torque)
+    {
+      std::tie(this->forces_on_boundaries, this->torques_on_boundaries) =
+        calculate_forces_and_torques(
+          *this->dof_handler,
+          evaluation_point,
+          simulation_parameters.physical_properties_manager,
+          simulation_parameters.boundary_conditions,
+          *this->face_quadrature,
+          *this->get_mapping());
+    }
+  else if (calculate_force)
+    {
+      this->forces_on_boundaries =
+        calculate_forces(*this->dof_handler,
+                         evaluation_point,
+                         simulation_parameters.physical_properties_manager,
+                         simulation_parameters.boundary_conditions,
+                         *this->face_quadrature,
+                         *this->get_mapping());
+    }
+  else if (calculate_torque)
+    {
+      this->torques_on_boundaries =
+        calculate_torques(*this->dof_handler,
+                          evaluation_point,
+                          simulation_parameters.physical_properties_manager,
+                          simulation_parameters.boundary_conditions,
+                          *this->face_quadrature,
+                          *this->get_mapping());
+    }
+}
 
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::postprocessing_forces()
+{
   if (simulation_parameters.forces_parameters.verbosity ==
         Parameters::Verbosity::verbose &&
       this->this_mpi_process == 0)
@@ -411,19 +455,8 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocessing_forces(
 
 template <int dim, typename VectorType, typename DofsType>
 void
-NavierStokesBase<dim, VectorType, DofsType>::postprocessing_torques(
-  const VectorType &evaluation_point)
+NavierStokesBase<dim, VectorType, DofsType>::postprocessing_torques()
 {
-  TimerOutput::Scope t(this->computing_timer, "Calculate torques");
-
-  std::map<types::boundary_id, Tensor<1, 3>> torques_on_boundaries =
-    calculate_torques(*this->dof_handler,
-                      evaluation_point,
-                      simulation_parameters.physical_properties_manager,
-                      simulation_parameters.boundary_conditions,
-                      *this->face_quadrature,
-                      *this->get_mapping());
-
   if (simulation_parameters.forces_parameters.verbosity ==
         Parameters::Verbosity::verbose &&
       this->this_mpi_process == 0)
@@ -439,7 +472,7 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocessing_torques(
       std::vector<unsigned int> boundary_ids =
         extract_keys_from_map(simulation_parameters.boundary_conditions.type);
       std::vector<Tensor<1, 3>> torques =
-        extract_values_from_map(torques_on_boundaries);
+        extract_values_from_map(this->torques_on_boundaries);
 
       TableHandler table = make_table_scalars_tensors(
         boundary_ids,
@@ -471,11 +504,11 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocessing_torques(
             "time", simulation_parameters.forces_parameters.output_precision);
         }
       this->torques_tables[boundary_id].add_value(
-        "T_x", torques_on_boundaries[boundary_id][0]);
+        "T_x", this->torques_on_boundaries[boundary_id][0]);
       this->torques_tables[boundary_id].add_value(
-        "T_y", torques_on_boundaries[boundary_id][1]);
+        "T_y", this->torques_on_boundaries[boundary_id][1]);
       this->torques_tables[boundary_id].add_value(
-        "T_z", torques_on_boundaries[boundary_id][2]);
+        "T_z", this->torques_on_boundaries[boundary_id][2]);
 
       // Precision
       this->torques_tables[boundary_id].set_precision(
@@ -540,6 +573,14 @@ template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::percolate_time_vectors_fd()
 {
+  // The error estimate of BDF3 requires one more solution than the ones
+  // stored for the time integration
+  if (simulation_control->is_adapting_with_error())
+    {
+      oldest_previous_solution          = previous_solutions->back();
+      oldest_previous_solution_is_valid = true;
+    }
+
   for (unsigned int i = previous_solutions->size() - 1; i > 0; --i)
     {
       (*previous_solutions)[i] = (*previous_solutions)[i - 1];
@@ -724,6 +765,85 @@ NavierStokesBase<dim, VectorType, DofsType>::iterate()
 }
 
 
+template <int dim, typename VectorType, typename DofsType>
+double
+NavierStokesBase<dim, VectorType, DofsType>::estimate_time_step_error_fd()
+{
+  const auto method = this->simulation_control->get_assembly_method();
+  const TimeStepErrorController &error_controller =
+    this->simulation_control->get_time_step_error_controller();
+
+  VectorType error, tmp;
+  error.reinit(this->local_evaluation_point);
+  tmp.reinit(this->local_evaluation_point);
+
+  if (this->simulation_control->is_sdirk())
+    return error_controller.estimate_sdirk_error(
+      method,
+      this->simulation_control->get_time_step(),
+      *this->present_solution,
+      this->sdirk_vectors.previous_k_j_solutions,
+      error,
+      tmp);
+
+  // The extrapolation of BDF methods of order k requires k+1 previous
+  // solutions, which are only available once enough time steps were solved
+  const unsigned int bdf_order = number_of_previous_solutions(method);
+  if (bdf_order == 0 ||
+      this->simulation_control->get_step_number() <= bdf_order + 1)
+    return 0;
+
+  std::vector<const VectorType *> history;
+  for (unsigned int i = 0; i < bdf_order; ++i)
+    history.push_back(&(*this->previous_solutions)[i]);
+  if (bdf_order < this->previous_solutions->size())
+    history.push_back(&(*this->previous_solutions)[bdf_order]);
+  else if (oldest_previous_solution_is_valid)
+    history.push_back(&oldest_previous_solution);
+  else
+    return 0;
+
+  return error_controller.estimate_bdf_error(
+    *this->present_solution,
+    history,
+    this->simulation_control->get_time_steps_vector(),
+    error,
+    tmp);
+}
+
+template <int dim, typename VectorType, typename DofsType>
+bool
+NavierStokesBase<dim, VectorType, DofsType>::reject_time_step()
+{
+  if (!this->simulation_control->is_adapting_with_error())
+    return false;
+
+  if (this->simulation_parameters.multiphysics.fluid_dynamics)
+    this->simulation_control->provide_time_step_error(
+      estimate_time_step_error_fd());
+  this->simulation_control->provide_time_step_error(
+    this->multiphysics->get_time_step_error());
+
+  const double time_step_error =
+    this->simulation_control->get_time_step_error();
+  const double rejected_time_step = this->simulation_control->get_time_step();
+
+  if (!this->simulation_control->reject_time_step())
+    return false;
+
+  this->pcout << "Time step " << rejected_time_step
+              << " rejected with a normalized error of " << time_step_error
+              << ", restarting with a time step of "
+              << this->simulation_control->get_time_step() << std::endl;
+
+  // Restart the time step from the last accepted solutions
+  this->local_evaluation_point = (*this->previous_solutions)[0];
+  *this->present_solution      = this->local_evaluation_point;
+  this->multiphysics->restore_time_step_state();
+
+  return true;
+}
+
 template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::
@@ -1380,15 +1500,33 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocess_fd(bool firstIter)
 {
   auto &present_solution = *this->present_solution;
 
+  const Parameters::PostProcessing &post_processing =
+    this->simulation_parameters.post_processing;
+
+  // The enstrophy, pressure power, viscous dissipation and kinetic energy are
+  // calculated in a single pass over the cells
+  VolumePostprocessingQuantities volume_quantities;
+  if (post_processing.calculate_enstrophy ||
+      post_processing.calculate_pressure_power ||
+      post_processing.calculate_viscous_dissipation ||
+      post_processing.calculate_kinetic_energy)
+    {
+      TimerOutput::Scope t(this->computing_timer,
+                           "Calculate volume postprocessing quantities");
+
+      volume_quantities = calculate_volume_postprocessing_quantities(
+        *this->dof_handler,
+        present_solution,
+        *this->cell_quadrature,
+        *this->get_mapping(),
+        simulation_parameters.physical_properties_manager,
+        post_processing);
+    }
+
   // Enstrophy
   if (this->simulation_parameters.post_processing.calculate_enstrophy)
     {
-      TimerOutput::Scope t(this->computing_timer, "Calculate enstrophy");
-
-      double enstrophy = calculate_enstrophy(*this->dof_handler,
-                                             present_solution,
-                                             *this->cell_quadrature,
-                                             *this->get_mapping());
+      const double enstrophy = volume_quantities.enstrophy;
 
       this->enstrophy_table.add_value("time",
                                       simulation_control->get_current_time());
@@ -1421,13 +1559,7 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocess_fd(bool firstIter)
   // Pressure power
   if (this->simulation_parameters.post_processing.calculate_pressure_power)
     {
-      TimerOutput::Scope t(this->computing_timer, "Calculate pressure power");
-
-      const double pressure_power =
-        calculate_pressure_power(*this->dof_handler,
-                                 present_solution,
-                                 *this->cell_quadrature,
-                                 *this->get_mapping());
+      const double pressure_power = volume_quantities.pressure_power;
 
       this->pressure_power_table.add_value(
         "time", simulation_control->get_current_time());
@@ -1461,15 +1593,7 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocess_fd(bool firstIter)
   // Viscous dissipation
   if (this->simulation_parameters.post_processing.calculate_viscous_dissipation)
     {
-      TimerOutput::Scope t(this->computing_timer,
-                           "Calculate viscous dissipation");
-
-      const double viscous_dissipation = calculate_viscous_dissipation(
-        *this->dof_handler,
-        present_solution,
-        *this->cell_quadrature,
-        *this->get_mapping(),
-        simulation_parameters.physical_properties_manager);
+      const double viscous_dissipation = volume_quantities.viscous_dissipation;
 
       this->viscous_dissipation_table.add_value(
         "time", simulation_control->get_current_time());
@@ -1514,16 +1638,23 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocess_fd(bool firstIter)
         simulation_parameters.post_processing,
         simulation_control->get_current_time(),
         simulation_control->get_time_step());
+
+      // Write the statistics directly in binary format, which is much
+      // lighter than the VTU output
+      const unsigned int binary_output_frequency =
+        post_processing.average_velocities_binary_output_frequency;
+      if (binary_output_frequency > 0 &&
+          simulation_control->get_step_number() % binary_output_frequency ==
+            0)
+        this->average_velocities->write_binary_statistics(
+          simulation_parameters.simulation_control.output_folder +
+          post_processing.average_velocities_binary_output_name + "." +
+          Utilities::int_to_string(simulation_control->get_step_number(), 5));
     }
 
   if (this->simulation_parameters.post_processing.calculate_kinetic_energy)
     {
-      TimerOutput::Scope t(this->computing_timer, "Calculate kinetic energy");
-
-      double kE = calculate_kinetic_energy(*this->dof_handler,
-                                           present_solution,
-                                           *this->cell_quadrature,
-                                           *this->get_mapping());
+      const double kE = volume_quantities.kinetic_energy;
       this->kinetic_energy_table.add_value(
         "time", simulation_control->get_current_time());
       this->kinetic_energy_table.add_value("kinetic-energy", kE);
@@ -1711,14 +1842,22 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocess_fd(bool firstIter)
 
   if (!firstIter)
     {
-      // Calculate forces on the boundary conditions
+      // Calculate forces and torques on the boundary conditions
+      const bool forces_and_torques_calculation_step =
+        simulation_control->get_step_number() %
+          this->simulation_parameters.forces_parameters
+            .calculation_frequency ==
+        0;
+      if (forces_and_torques_calculation_step &&
+          (this->simulation_parameters.forces_parameters.calculate_force ||
+           this->simulation_parameters.forces_parameters.calculate_torque))
+        this->calculate_forces_and_torques_on_boundaries(present_solution);
+
+      // Output the forces on the boundary conditions
       if (this->simulation_parameters.forces_parameters.calculate_force)
         {
-          if (simulation_control->get_step_number() %
-                this->simulation_parameters.forces_parameters
-                  .calculation_frequency ==
-              0)
-            this->postprocessing_forces(present_solution);
+          if (forces_and_torques_calculation_step)
+            this->postprocessing_forces();
           if (simulation_control->get_step_number() %
                 this->simulation_parameters.forces_parameters
                   .output_frequency ==
@@ -1726,14 +1865,11 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocess_fd(bool firstIter)
             this->write_output_forces();
         }
 
-      // Calculate torques on the boundary conditions
+      // Output the torques on the boundary conditions
       if (this->simulation_parameters.forces_parameters.calculate_torque)
         {
-          if (simulation_control->get_step_number() %
-                this->simulation_parameters.forces_parameters
-                  .calculation_frequency ==
-              0)
-            this->postprocessing_torques(present_solution);
+          if (forces_and_torques_calculation_step)
+            this->postprocessing_torques();
           if (simulation_control->get_step_number() %
                 this->simulation_parameters.forces_parameters
                   .output_frequency ==
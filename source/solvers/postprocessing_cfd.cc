@@ -3,12 +3,14 @@
 
 // Base
 #include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/work_stream.h>
 
 // Lac
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/vector.h>
 
 // grid
+#include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_tools.h>
 
 // Dofs
@@ -36,6 +38,86 @@
 
 using namespace dealii;
 
+namespace
+{
+  /**
+   * @brief Scratch data of the thread-parallel postprocessing loops. Each
+   * thread owns a copy of the FEValues (or FEFaceValues) and of the buffers
+   * holding the solution at the quadrature points.
+   *
+   * @tparam dim Number of spatial dimensions.
+   * @tparam FEValuesType FEValues<dim> or FEFaceValues<dim>.
+   */
+  template <int dim, typename FEValuesType>
+  struct PostprocessingScratchData
+  {
+    template <typename QuadratureType>
+    PostprocessingScratchData(const Mapping<dim>       &mapping,
+                              const FiniteElement<dim> &fe,
+                              const QuadratureType     &quadrature,
+                              const UpdateFlags         update_flags)
+      : fe_values(mapping, fe, quadrature, update_flags)
+      , scalar_values(quadrature.size())
+      , vector_values(quadrature.size())
+      , scalar_gradients(quadrature.size())
+      , vector_gradients(quadrature.size())
+    {}
+
+    PostprocessingScratchData(const PostprocessingScratchData &other)
+      : fe_values(other.fe_values.get_mapping(),
+                  other.fe_values.get_fe(),
+                  other.fe_values.get_quadrature(),
+                  other.fe_values.get_update_flags())
+      , scalar_values(other.scalar_values.size())
+      , vector_values(other.vector_values.size())
+      , scalar_gradients(other.scalar_gradients.size())
+      , vector_gradients(other.vector_gradients.size())
+    {}
+
+    FEValuesType                fe_values;
+    std::vector<double>         scalar_values;
+    std::vector<Tensor<1, dim>> vector_values;
+    std::vector<Tensor<1, dim>> scalar_gradients;
+    std::vector<Tensor<2, dim>> vector_gradients;
+  };
+
+  /**
+   * @brief Run a worker on the locally owned cells with WorkStream, using the
+   * threads of the MPI process. The copier is called in the order of the
+   * cells, which makes the reductions independent of the number of threads.
+   *
+   * @param[in] dof_handler DoFHandler whose locally owned cells are visited.
+   * @param[in] worker Function computing the contribution of a cell.
+   * @param[in] copier Function adding the contribution of a cell.
+   * @param[in] sample_scratch_data Scratch data copied for each thread.
+   * @param[in] sample_copy_data Copy data holding the contribution of a cell.
+   */
+  template <int dim,
+            typename Worker,
+            typename Copier,
+            typename ScratchData,
+            typename CopyData>
+  void
+  run_on_locally_owned_cells(const DoFHandler<dim> &dof_handler,
+                             const Worker          &worker,
+                             const Copier          &copier,
+                             const ScratchData     &sample_scratch_data,
+                             const CopyData        &sample_copy_data)
+  {
+    using CellFilter =
+      FilteredIterator<typename DoFHandler<dim>::active_cell_iterator>;
+
+    WorkStream::run(CellFilter(IteratorFilters::LocallyOwnedCell(),
+                               dof_handler.begin_active()),
+                    CellFilter(IteratorFilters::LocallyOwnedCell(),
+                               dof_handler.end()),
+                    worker,
+                    copier,
+                    sample_scratch_data,
+                    sample_copy_data);
+  }
+} // namespace
+
 template <int dim, typename VectorType>
 std::pair<double, double>
 calculate_pressure_drop(const DoFHandler<dim>     &dof_handler,
@@ -46,240 +128,52 @@ calculate_pressure_drop(const DoFHandler<dim>     &dof_handler,
                         const unsigned int         inlet_boundary_id,
                         const unsigned int         outlet_boundary_id)
 {
-  FESystem<dim, dim> fe = dof_handler.get_fe();
-  FEValues<dim>      fe_values(mapping,
-                          fe,
-                          cell_quadrature_formula,
-                          update_values | update_quadrature_points |
-                            update_JxW_values | update_gradients |
-                            update_hessians);
-  FEFaceValues<dim>  fe_face_values(fe,
-                                   face_quadrature_formula,
-                                   update_values | update_quadrature_points |
-                                     update_normal_vectors | update_JxW_values);
-
-  const FEValuesExtractors::Vector velocities(0);
-  const FEValuesExtractors::Scalar pressure(dim);
-
-  const unsigned int face_n_q_points = face_quadrature_formula.size();
-
-  std::vector<Tensor<1, dim>> velocity_values(face_n_q_points);
-  std::vector<double>         pressure_values(face_n_q_points);
-
-  double static_pressure_outlet_boundary = 0.;
-  double static_pressure_inlet_boundary  = 0.;
-  double static_pressure_drop            = 0.;
-
-  double dynamic_pressure_outlet_boundary = 0.;
-  double dynamic_pressure_inlet_boundary  = 0.;
-  double dynamic_pressure_drop            = 0.;
-
-  double outlet_surface = 0.;
-  double inlet_surface  = 0.;
-
-  double temp_surface                      = 0.;
-  double temp_static_pressure_at_boundary  = 0.;
-  double temp_dynamic_pressure_at_boundary = 0.;
-
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
-        {
-          for (unsigned int face_id = 0;
-               face_id < GeometryInfo<dim>::faces_per_cell;
-               face_id++)
-            {
-              if (cell->face(face_id)->at_boundary())
-                {
-                  unsigned int boundary_id = cell->face(face_id)->boundary_id();
-                  if (boundary_id != inlet_boundary_id &&
-                      boundary_id != outlet_boundary_id)
-                    continue;
-                  fe_face_values.reinit(cell, face_id);
-                  fe_face_values[velocities].get_function_values(
-                    evaluation_point, velocity_values);
-                  fe_face_values[pressure].get_function_values(evaluation_point,
-                                                               pressure_values);
-                  temp_surface                      = 0.;
-                  temp_static_pressure_at_boundary  = 0.;
-                  temp_dynamic_pressure_at_boundary = 0.;
-                  for (unsigned int q = 0; q < face_n_q_points; q++)
-                    {
-                      temp_surface += fe_face_values.JxW(q);
-                      // Integration of velocity^2 and
-                      // pressure, since the pressure in Lethe has units of
-                      // Length^2/Time^2
-                      temp_static_pressure_at_boundary +=
-                        fe_face_values.JxW(q) * pressure_values[q];
-                      temp_dynamic_pressure_at_boundary +=
-                        0.5 * fe_face_values.JxW(q) * velocity_values[q] *
-                        velocity_values[q];
-                    }
-                  if (boundary_id == inlet_boundary_id)
-                    {
-                      inlet_surface += temp_surface;
-                      dynamic_pressure_inlet_boundary +=
-                        temp_dynamic_pressure_at_boundary;
-                      static_pressure_inlet_boundary +=
-                        temp_static_pressure_at_boundary;
-                    }
-                  if (boundary_id == outlet_boundary_id)
-                    {
-                      outlet_surface += temp_surface;
-                      dynamic_pressure_outlet_boundary +=
-                        temp_dynamic_pressure_at_boundary;
-                      static_pressure_outlet_boundary +=
-                        temp_static_pressure_at_boundary;
-                    }
-                }
-            }
-        }
-    }
-
-  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
-  static_pressure_inlet_boundary =
-    Utilities::MPI::sum(static_pressure_inlet_boundary, mpi_communicator);
-  static_pressure_outlet_boundary =
-    Utilities::MPI::sum(static_pressure_outlet_boundary, mpi_communicator);
-
-  dynamic_pressure_inlet_boundary =
-    Utilities::MPI::sum(dynamic_pressure_inlet_boundary, mpi_communicator);
-  dynamic_pressure_outlet_boundary =
-    Utilities::MPI::sum(dynamic_pressure_outlet_boundary, mpi_communicator);
-
-  inlet_surface  = Utilities::MPI::sum(inlet_surface, mpi_communicator);
-  outlet_surface = Utilities::MPI::sum(outlet_surface, mpi_communicator);
-
-  static_pressure_outlet_boundary =
-    static_pressure_outlet_boundary / outlet_surface;
-  static_pressure_inlet_boundary =
-    static_pressure_inlet_boundary / inlet_surface;
-  static_pressure_drop =
-    static_pressure_inlet_boundary - static_pressure_outlet_boundary;
-
-  dynamic_pressure_outlet_boundary =
-    dynamic_pressure_outlet_boundary / outlet_surface;
-  dynamic_pressure_inlet_boundary =
-    dynamic_pressure_inlet_boundary / inlet_surface;
-  dynamic_pressure_drop =
-    dynamic_pressure_inlet_boundary - dynamic_pressure_outlet_boundary;
-
-  return {static_pressure_drop, static_pressure_drop + dynamic_pressure_drop};
-}
-
-template std::pair<double, double>
-calculate_pressure_drop<2, GlobalVectorType>(
-  const DoFHandler<2>    &dof_handler,
-  const Mapping<2>       &mapping,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<2>    &cell_quadrature_formula,
-  const Quadrature<1>    &face_quadrature_formula,
-  const unsigned int      inlet_boundary_id,
-  const unsigned int      outlet_boundary_id);
-
-template std::pair<double, double>
-calculate_pressure_drop<3, GlobalVectorType>(
-  const DoFHandler<3>    &dof_handler,
-  const Mapping<3>       &mapping,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<3>    &cell_quadrature_formula,
-  const Quadrature<2>    &face_quadrature_formula,
-  const unsigned int      inlet_boundary_id,
-  const unsigned int      outlet_boundary_id);
-
-template std::pair<double, double>
-calculate_pressure_drop<2, GlobalBlockVectorType>(
-  const DoFHandler<2>         &dof_handler,
-  const Mapping<2>            &mapping,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<2>         &cell_quadrature_formula,
-  const Quadrature<1>         &face_quadrature_formula,
-  const unsigned int           inlet_boundary_id,
-  const unsigned int           outlet_boundary_id);
-
-template std::pair<double, double>
-calculate_pressure_drop<3, GlobalBlockVectorType>(
-  const DoFHandler<3>         &dof_handler,
-  const Mapping<3>            &mapping,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<3>         &cell_quadrature_formula,
-  const Quadrature<2>         &face_quadrature_formula,
-  const unsigned int           inlet_boundary_id,
-  const unsigned int           outlet_boundary_id);
-
-#ifndef LETHE_USE_LDV
-template std::pair<double, double>
-calculate_pressure_drop<2, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<2>                              &dof_handler,
-  const Mapping<2>                                 &mapping,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const Quadrature<2>                              &cell_quadrature_formula,
-  const Quadrature<1>                              &face_quadrature_formula,
-  const unsigned int                                inlet_boundary_id,
-  const unsigned int                                outlet_boundary_id);
-
-template std::pair<double, double>
-calculate_pressure_drop<3, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<3>                              &dof_handler,
-  const Mapping<3>                                 &mapping,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const Quadrature<3>                              &cell_quadrature_formula,
-  const Quadrature<2>                              &face_quadrature_formula,
-  const unsigned int                                inlet_boundary_id,
-  const unsigned int                                outlet_boundary_id);
-#endif
-
-template <int dim, typename VectorType>
-double
-calculate_CFL(const DoFHandler<dim> &dof_handler,
-              const VectorType      &evaluation_point,
-              const double           time_step,
-              const Quadrature<dim> &quadrature_formula,
-              const Mapping<dim>    &mapping)
-{
-  FESystem<dim, dim> fe = dof_handler.get_fe();
-  FEValues<dim>      fe_values(mapping,
-                          fe,
-                          quadrature_formula,
-                          update_values | update_quadrature_points |
-                            update_JxW_values);
+  using ScratchData = PostprocessingScratchData<dim, FEValues<dim>>;
 
   const FEValuesExtractors::Vector velocities(0);
   const unsigned int               n_q_points = quadrature_formula.size();
 
-
-  std::vector<Tensor<1, dim>> present_velocity_values(n_q_points);
-
-  // Element size
-  double h;
-
   // Element degree
-  const unsigned int degree = fe.degree;
+  const unsigned int degree = dof_handler.get_fe().degree;
 
   // CFL
   double CFL = 0;
 
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
-        {
-          fe_values.reinit(cell);
+  const auto worker =
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        ScratchData                                          &scratch_data,
+        double                                               &local_CFL) {
+      auto &fe_values               = scratch_data.fe_values;
+      auto &present_velocity_values = scratch_data.vector_values;
 
-          // Compute cell diameter
-          double cell_measure =
-            compute_cell_measure_with_JxW(fe_values.get_JxW_values());
-          h = compute_cell_diameter<dim>(cell_measure, degree);
+      fe_values.reinit(cell);
 
-          fe_values[velocities].get_function_values(evaluation_point,
-                                                    present_velocity_values);
-          for (unsigned int q = 0; q < n_q_points; ++q)
-            {
-              const double localCFL =
-                present_velocity_values[q].norm() / h * time_step;
-              CFL = std::max(CFL, localCFL);
-            }
+      // Compute cell diameter
+      const double cell_measure =
+        compute_cell_measure_with_JxW(fe_values.get_JxW_values());
+      const double h = compute_cell_diameter<dim>(cell_measure, degree);
+
+      fe_values[velocities].get_function_values(evaluation_point,
+                                                present_velocity_values);
+      local_CFL = 0;
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          const double localCFL =
+            present_velocity_values[q].norm() / h * time_step;
+          local_CFL = std::max(local_CFL, localCFL);
         }
-    }
+    };
+
+  run_on_locally_owned_cells(
+    dof_handler,
+    worker,
+    [&](const double &local_CFL) { CFL = std::max(CFL, local_CFL); },
+    ScratchData(mapping,
+                dof_handler.get_fe(),
+                quadrature_formula,
+                update_values | update_quadrature_points | update_JxW_values),
+    0.0);
+
   const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
   CFL                             = Utilities::MPI::max(CFL, mpi_communicator);
   return (CFL);
@@ -297,459 +191,262 @@ calculate_CFL<3, GlobalVectorType>(const DoFHandler<3>    &dof_handler,
                                    const GlobalVectorType &evaluation_point,
                                    const double            time_step,
                                    const Quadrature<3>    &quadrature_formula,
-                                   const Mapping<3>       &mapping);
-
-#ifndef LETHE_USE_LDV
-template double
-calculate_CFL<2, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<2>                              &dof_handler,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const double                                      time_step,
-  const Quadrature<2>                              &quadrature_formula,
-  const Mapping<2>                                 &mapping);
-
-template double
-calculate_CFL<3, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<3>                              &dof_handler,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const double                                      time_step,
-  const Quadrature<3>                              &quadrature_formula,
-  const Mapping<3>                                 &mapping);
-#endif
-
-template double
-calculate_CFL<2, GlobalBlockVectorType>(
-  const DoFHandler<2>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const double                 time_step,
-  const Quadrature<2>         &quadrature_formula,
-  const Mapping<2>            &mapping);
-
-template double
-calculate_CFL<3, GlobalBlockVectorType>(
-  const DoFHandler<3>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const double                 time_step,
-  const Quadrature<3>         &quadrature_formula,
-  const Mapping<3>            &mapping);
-
-
-template <int dim, typename VectorType>
-double
-calculate_enstrophy(const DoFHandler<dim> &dof_handler,
-                    const VectorType      &evaluation_point,
-                    const Quadrature<dim> &quadrature_formula,
-                    const Mapping<dim>    &mapping)
-{
-  const FESystem<dim, dim> fe = dof_handler.get_fe();
-  FEValues<dim>            fe_values(mapping,
-                          fe,
-                          quadrature_formula,
-                          update_values | update_gradients |
-                            update_quadrature_points | update_JxW_values);
-
-  const FEValuesExtractors::Vector velocities(0);
-
-  const unsigned int n_q_points = quadrature_formula.size();
-
-  std::vector<Tensor<2, dim>> present_velocity_gradients(n_q_points);
-  double                      en = 0.0;
-  double                      domain_volume =
-    GridTools::volume(dof_handler.get_triangulation(), mapping);
-
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
-        {
-          fe_values.reinit(cell);
-
-          fe_values[velocities].get_function_gradients(
-            evaluation_point, present_velocity_gradients);
-
-          for (unsigned int q = 0; q < n_q_points; q++)
-            {
-              // Find the values of gradient of ux and uy (the finite element
-              // solution) at the quadrature points
-              double ux_y = present_velocity_gradients[q][0][1];
-              double uy_x = present_velocity_gradients[q][1][0];
-
-              if (dim == 2)
-                {
-                  en += 0.5 * (uy_x - ux_y) * (uy_x - ux_y) * fe_values.JxW(q) /
-                        domain_volume;
-                }
-              else
-                {
-                  double uz_y = present_velocity_gradients[q][2][1];
-                  double uy_z = present_velocity_gradients[q][1][2];
-                  double ux_z = present_velocity_gradients[q][0][2];
-                  double uz_x = present_velocity_gradients[q][2][0];
-                  en += 0.5 * (uz_y - uy_z) * (uz_y - uy_z) * fe_values.JxW(q) /
-                        domain_volume;
-                  en += 0.5 * (ux_z - uz_x) * (ux_z - uz_x) * fe_values.JxW(q) /
-                        domain_volume;
-                  en += 0.5 * (uy_x - ux_y) * (uy_x - ux_y) * fe_values.JxW(q) /
-                        domain_volume;
-                }
-            }
-        }
-    }
-  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
-  en                              = Utilities::MPI::sum(en, mpi_communicator);
-  return (en);
-}
-
-template double
-calculate_enstrophy<2, GlobalVectorType>(
-  const DoFHandler<2>    &dof_handler,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<2>    &quadrature_formula,
-  const Mapping<2>       &mapping);
-
-template double
-calculate_enstrophy<3, GlobalVectorType>(
-  const DoFHandler<3>    &dof_handler,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<3>    &quadrature_formula,
-  const Mapping<3>       &mapping);
-
-template double
-calculate_enstrophy<2, GlobalBlockVectorType>(
-  const DoFHandler<2>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<2>         &quadrature_formula,
-  const Mapping<2>            &mapping);
-
-template double
-calculate_enstrophy<3, GlobalBlockVectorType>(
-  const DoFHandler<3>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<3>         &quadrature_formula,
-  const Mapping<3>            &mapping);
-
-#ifndef LETHE_USE_LDV
-template double
-calculate_enstrophy<2, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<2>                              &dof_handler,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const Quadrature<2>                              &quadrature_formula,
-  const Mapping<2>                                 &mapping);
-
-template double
-calculate_enstrophy<3, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<3>                              &dof_handler,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const Quadrature<3>                              &quadrature_formula,
-  const Mapping<3>                                 &mapping);
-#endif
-
-template <int dim, typename VectorType>
-double
-calculate_pressure_power(const DoFHandler<dim> &dof_handler,
-                         const VectorType      &evaluation_point,
-                         const Quadrature<dim> &quadrature_formula,
-                         const Mapping<dim>    &mapping)
-{
-  const FESystem<dim, dim> fe = dof_handler.get_fe();
-  FEValues<dim>            fe_values(mapping,
-                          fe,
-                          quadrature_formula,
-                          update_values | update_gradients | update_JxW_values);
-
-  const FEValuesExtractors::Vector velocities(0);
-  const FEValuesExtractors::Scalar pressure(dim);
-
-  const unsigned int n_q_points = quadrature_formula.size();
-
-  std::vector<Tensor<1, dim>> velocity(n_q_points);
-  std::vector<Tensor<1, dim>> pressure_gradients(n_q_points);
-
-  double pressure_power = 0.0;
-
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
-        {
-          fe_values.reinit(cell);
-
-          fe_values[pressure].get_function_gradients(evaluation_point,
-                                                     pressure_gradients);
-
-          fe_values[velocities].get_function_values(evaluation_point, velocity);
-
-          for (unsigned int q = 0; q < n_q_points; q++)
-            {
-              pressure_power +=
-                velocity[q] * pressure_gradients[q] * fe_values.JxW(q);
-            }
-        }
-    }
-
-  pressure_power /= GridTools::volume(dof_handler.get_triangulation(), mapping);
-
-  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
-  pressure_power = Utilities::MPI::sum(pressure_power, mpi_communicator);
-
-  return pressure_power;
-}
-
-template double
-calculate_pressure_power<2, GlobalVectorType>(
-  const DoFHandler<2>    &dof_handler,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<2>    &quadrature_formula,
-  const Mapping<2>       &mapping);
-
-template double
-calculate_pressure_power<3, GlobalVectorType>(
-  const DoFHandler<3>    &dof_handler,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<3>    &quadrature_formula,
-  const Mapping<3>       &mapping);
-
-template double
-calculate_pressure_power<2, GlobalBlockVectorType>(
-  const DoFHandler<2>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<2>         &quadrature_formula,
-  const Mapping<2>            &mapping);
-
-template double
-calculate_pressure_power<3, GlobalBlockVectorType>(
-  const DoFHandler<3>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<3>         &quadrature_formula,
-  const Mapping<3>            &mapping);
-
-#ifndef LETHE_USE_LDV
-template double
-calculate_pressure_power<2, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<2>                              &dof_handler,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const Quadrature<2>                              &quadrature_formula,
-  const Mapping<2>                                 &mapping);
-
-template double
-calculate_pressure_power<3, LinearAlgebra::distributed::Vector<double>>(
-  const DoFHandler<3>                              &dof_handler,
-  const LinearAlgebra::distributed::Vector<double> &evaluation_point,
-  const Quadrature<3>                              &quadrature_formula,
-  const Mapping<3>                                 &mapping);
-#endif
-
-
-template <int dim, typename VectorType>
-double
-calculate_viscous_dissipation(
-  const DoFHandler<dim>           &dof_handler,
-  const VectorType                &evaluation_point,
-  const Quadrature<dim>           &quadrature_formula,
-  const Mapping<dim>              &mapping,
-  const PhysicalPropertiesManager &properties_manager)
-{
-  const FESystem<dim, dim> fe = dof_handler.get_fe();
-  FEValues<dim>            fe_values(mapping,
-                          fe,
-                          quadrature_formula,
-                          update_gradients | update_JxW_values);
-
-  const FEValuesExtractors::Vector velocity(0);
-
-  const unsigned int n_q_points = quadrature_formula.size();
-
-  std::vector<Tensor<2, dim>> velocity_gradients(n_q_points);
-
-  const auto rheological_model = properties_manager.get_rheology();
-
-  double viscous_dissipation = 0;
-
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
-        {
-          fe_values.reinit(cell);
-
-          fe_values[velocity].get_function_gradients(evaluation_point,
-                                                     velocity_gradients);
-
-          for (unsigned int q = 0; q < n_q_points; q++)
-            {
-              Tensor<2, dim> shear_rate =
-                velocity_gradients[q] + transpose(velocity_gradients[q]);
-
-              const double shear_rate_magnitude =
-                calculate_shear_rate_magnitude(shear_rate);
-
-              std::map<field, double> field_values;
-              field_values[field::shear_rate] = shear_rate_magnitude;
-
-              const double kinematic_viscosity =
-                rheological_model->value(field_values);
-
-              // Equation is t_ij djui (Eq 11.2-1 of BSL 2nd edition)
-              viscous_dissipation +=
-                kinematic_viscosity *
-                scalar_product(shear_rate, transpose(velocity_gradients[q])) *
-                fe_values.JxW(q);
-            }
-        }
-    }
-
-  viscous_dissipation /=
-    GridTools::volume(dof_handler.get_triangulation(), mapping);
-
-  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
-  viscous_dissipation =
-    Utilities::MPI::sum(viscous_dissipation, mpi_communicator);
-  return viscous_dissipation;
-}
-
-template double
-calculate_viscous_dissipation<2, GlobalVectorType>(
-  const DoFHandler<2>             &dof_handler,
-  const GlobalVectorType          &evaluation_point,
-  const Quadrature<2>             &quadrature_formula,
-  const Mapping<2>                &mapping,
-  const PhysicalPropertiesManager &properties_manager);
-
-template double
-calculate_viscous_dissipation<3, GlobalVectorType>(
-  const DoFHandler<3>             &dof_handler,
-  const GlobalVectorType          &evaluation_point,
-  const Quadrature<3>             &quadrature_formula,
-  const Mapping<3>                &mapping,
-  const PhysicalPropertiesManager &properties_manager);
-
-template double
-calculate_viscous_dissipation<2, GlobalBlockVectorType>(
-  const DoFHandler<2>             &dof_handler,
-  const GlobalBlockVectorType     &evaluation_point,
-  const Quadrature<2>             &quadrature_formula,
-  const Mapping<2>                &mapping,
-  const PhysicalPropertiesManager &properties_manager);
-
-template double
-calculate_viscous_dissipation<3, GlobalBlockVectorType>(
-  const DoFHandler<3>             &dof_handler,
-  const GlobalBlockVectorType     &evaluation_point,
-  const Quadrature<3>             &quadrature_formula,
-  const Mapping<3>                &mapping,
-  const PhysicalPropertiesManager &properties_manager);
+                                   const Mapping<3>       &mapping);
 
 #ifndef LETHE_USE_LDV
 template double
-calculate_viscous_dissipation<2, LinearAlgebra::distributed::Vector<double>>(
+calculate_CFL<2, LinearAlgebra::distributed::Vector<double>>(
   const DoFHandler<2>                              &dof_handler,
   const LinearAlgebra::distributed::Vector<double> &evaluation_point,
+  const double                                      time_step,
   const Quadrature<2>                              &quadrature_formula,
-  const Mapping<2>                                 &mapping,
-  const PhysicalPropertiesManager                  &properties_manager);
+  const Mapping<2>                                 &mapping);
 
 template double
-calculate_viscous_dissipation<3, LinearAlgebra::distributed::Vector<double>>(
+calculate_CFL<3, LinearAlgebra::distributed::Vector<double>>(
   const DoFHandler<3>                              &dof_handler,
   const LinearAlgebra::distributed::Vector<double> &evaluation_point,
+  const double                                      time_step,
   const Quadrature<3>                              &quadrature_formula,
-  const Mapping<3>                                 &mapping,
-  const PhysicalPropertiesManager                  &properties_manager);
+  const Mapping<3>                                 &mapping);
 #endif
 
+template double
+calculate_CFL<2, GlobalBlockVectorType>(
+  const DoFHandler<2>         &dof_handler,
+  const GlobalBlockVectorType &evaluation_point,
+  const double                 time_step,
+  const Quadrature<2>         &quadrature_formula,
+  const Mapping<2>            &mapping);
+
+template double
+calculate_CFL<3, GlobalBlockVectorType>(
+  const DoFHandler<3>         &dof_handler,
+  const GlobalBlockVectorType &evaluation_point,
+  const double                 time_step,
+  const Quadrature<3>         &quadrature_formula,
+  const Mapping<3>            &mapping);
 
 template <int dim, typename VectorType>
-double
-calculate_kinetic_energy(const DoFHandler<dim> &dof_handler,
-                         const VectorType      &evaluation_point,
-                         const Quadrature<dim> &quadrature_formula,
-                         const Mapping<dim>    &mapping)
+VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities(
+  const DoFHandler<dim>            &dof_handler,
+  const VectorType                 &evaluation_point,
+  const Quadrature<dim>            &quadrature_formula,
+  const Mapping<dim>               &mapping,
+  const PhysicalPropertiesManager  &properties_manager,
+  const Parameters::PostProcessing &post_processing)
 {
-  const FESystem<dim, dim> fe = dof_handler.get_fe();
-  FEValues<dim>            fe_values(mapping,
-                          fe,
-                          quadrature_formula,
-                          update_values | update_quadrature_points |
-                            update_JxW_values);
+  using ScratchData = PostprocessingScratchData<dim, FEValues<dim>>;
+
+  // Contribution of a cell, in the order enstrophy, kinetic energy, pressure
+  // power and viscous dissipation
+  using QuantitiesCopyData = std::array<double, 4>;
+
+  const bool calculate_enstrophy = post_processing.calculate_enstrophy;
+  const bool calculate_kinetic_energy =
+    post_processing.calculate_kinetic_energy;
+  const bool calculate_pressure_power =
+    post_processing.calculate_pressure_power;
+  const bool calculate_viscous_dissipation =
+    post_processing.calculate_viscous_dissipation;
+
+  VolumePostprocessingQuantities quantities;
+  if (!(calculate_enstrophy || calculate_kinetic_energy ||
+        calculate_pressure_power || calculate_viscous_dissipation))
+    return quantities;
+
+  // Only the values and gradients required by the requested quantities are
+  // evaluated
+  const bool need_velocity_values =
+    calculate_kinetic_energy || calculate_pressure_power;
+  const bool need_velocity_gradients =
+    calculate_enstrophy || calculate_viscous_dissipation;
+
+  UpdateFlags update_flags = update_JxW_values;
+  if (need_velocity_values)
+    update_flags |= update_values;
+  if (need_velocity_gradients || calculate_pressure_power)
+    update_flags |= update_gradients;
 
   const FEValuesExtractors::Vector velocities(0);
-  const unsigned int               n_q_points = quadrature_formula.size();
+  const FEValuesExtractors::Scalar pressure(dim);
 
-  std::vector<Tensor<1, dim>> local_velocity_values(n_q_points);
-  double                      domain_volume =
-    GridTools::volume(dof_handler.get_triangulation(), mapping);
-  // double domain_volume =
-  // GridTools::volume(dof_handler.get_triangulation(),*mapping);
+  const unsigned int n_q_points = quadrature_formula.size();
+
+  const auto rheological_model = properties_manager.get_rheology();
 
-  double KEU = 0.0;
+  QuantitiesCopyData integrals{};
+
+  const auto worker =
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        ScratchData                                          &scratch_data,
+        QuantitiesCopyData                                   &local_integrals) {
+      auto &fe_values          = scratch_data.fe_values;
+      auto &velocity_values    = scratch_data.vector_values;
+      auto &velocity_gradients = scratch_data.vector_gradients;
+      auto &pressure_gradients = scratch_data.scalar_gradients;
+      auto &[local_enstrophy,
+             local_kinetic_energy,
+             local_pressure_power,
+             local_viscous_dissipation] = local_integrals;
+
+      fe_values.reinit(cell);
+
+      if (need_velocity_values)
+        fe_values[velocities].get_function_values(evaluation_point,
+                                                  velocity_values);
+      if (need_velocity_gradients)
+        fe_values[velocities].get_function_gradients(evaluation_point,
+                                                     velocity_gradients);
+      if (calculate_pressure_power)
+        fe_values[pressure].get_function_gradients(evaluation_point,
+                                                   pressure_gradients);
 
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
+      local_integrals.fill(0.);
+      for (unsigned int q = 0; q < n_q_points; q++)
         {
-          fe_values.reinit(cell);
-          fe_values[velocities].get_function_values(evaluation_point,
-                                                    local_velocity_values);
+          const double JxW = fe_values.JxW(q);
 
-          for (unsigned int q = 0; q < n_q_points; q++)
+          if (calculate_enstrophy)
             {
-              double ux_sim = local_velocity_values[q][0];
-              double uy_sim = local_velocity_values[q][1];
-
-              KEU += 0.5 * ((ux_sim) * (ux_sim)*fe_values.JxW(q));
-              KEU += 0.5 * ((uy_sim) * (uy_sim)*fe_values.JxW(q));
-              if (dim == 3)
+              // The enstrophy is half the squared norm of the vorticity
+              const Tensor<2, dim> &grad_u = velocity_gradients[q];
+              double vorticity_norm_square =
+                (grad_u[1][0] - grad_u[0][1]) * (grad_u[1][0] - grad_u[0][1]);
+              if constexpr (dim == 3)
                 {
-                  double uz_sim = local_velocity_values[q][2];
-                  KEU += 0.5 * ((uz_sim) * (uz_sim)*fe_values.JxW(q));
+                  vorticity_norm_square +=
+                    (grad_u[2][1] - grad_u[1][2]) *
+                      (grad_u[2][1] - grad_u[1][2]) +
+                    (grad_u[0][2] - grad_u[2][0]) *
+                      (grad_u[0][2] - grad_u[2][0]);
                 }
+              local_enstrophy += 0.5 * vorticity_norm_square * JxW;
+            }
+
+          if (calculate_kinetic_energy)
+            local_kinetic_energy +=
+              0.5 * velocity_values[q].norm_square() * JxW;
+
+          if (calculate_pressure_power)
+            local_pressure_power +=
+              velocity_values[q] * pressure_gradients[q] * JxW;
+
+          if (calculate_viscous_dissipation)
+            {
+              const Tensor<2, dim> shear_rate =
+                velocity_gradients[q] + transpose(velocity_gradients[q]);
+
+              std::map<field, double> field_values;
+              field_values[field::shear_rate] =
+                calculate_shear_rate_magnitude(shear_rate);
+
+              const double kinematic_viscosity =
+                rheological_model->value(field_values);
+
+              // Equation is t_ij djui (Eq 11.2-1 of BSL 2nd edition)
+              local_viscous_dissipation +=
+                kinematic_viscosity *
+                scalar_product(shear_rate, transpose(velocity_gradients[q])) *
+                JxW;
             }
         }
-    }
-  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
-  KEU = Utilities::MPI::sum(KEU / domain_volume, mpi_communicator);
-  return (KEU);
-}
+    };
+
+  const auto copier = [&](const QuantitiesCopyData &local_integrals) {
+    for (unsigned int i = 0; i < integrals.size(); ++i)
+      integrals[i] += local_integrals[i];
+  };
+
+  run_on_locally_owned_cells(
+    dof_handler,
+    worker,
+    copier,
+    ScratchData(mapping,
+                dof_handler.get_fe(),
+                quadrature_formula,
+                update_flags),
+    QuantitiesCopyData());
+
+  // All the quantities are averaged over the domain and reduced with a single
+  // collective communication
+  const double domain_volume =
+    GridTools::volume(dof_handler.get_triangulation(), mapping);
+  for (double &integral : integrals)
+    integral /= domain_volume;
 
-template double
-calculate_kinetic_energy<2, GlobalVectorType>(
-  const DoFHandler<2>    &dof_handler,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<2>    &quadrature_formula,
-  const Mapping<2>       &mapping);
+  Utilities::MPI::sum(ArrayView<const double>(integrals.data(),
+                                              integrals.size()),
+                      dof_handler.get_mpi_communicator(),
+                      ArrayView<double>(integrals.data(), integrals.size()));
 
-template double
-calculate_kinetic_energy<3, GlobalVectorType>(
-  const DoFHandler<3>    &dof_handler,
-  const GlobalVectorType &evaluation_point,
-  const Quadrature<3>    &quadrature_formula,
-  const Mapping<3>       &mapping);
+  quantities.enstrophy           = integrals[0];
+  quantities.kinetic_energy      = integrals[1];
+  quantities.pressure_power      = integrals[2];
+  quantities.viscous_dissipation = integrals[3];
 
-template double
-calculate_kinetic_energy<2, GlobalBlockVectorType>(
-  const DoFHandler<2>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<2>         &quadrature_formula,
-  const Mapping<2>            &mapping);
+  return quantities;
+}
 
-template double
-calculate_kinetic_energy<3, GlobalBlockVectorType>(
-  const DoFHandler<3>         &dof_handler,
-  const GlobalBlockVectorType &evaluation_point,
-  const Quadrature<3>         &quadrature_formula,
-  const Mapping<3>            &mapping);
+template VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities<2, GlobalVectorType>(
+  const DoFHandler<2>              &dof_handler,
+  const GlobalVectorType           &evaluation_point,
+  const Quadrature<2>              &quadrature_formula,
+  const Mapping<2>                 &mapping,
+  const PhysicalPropertiesManager  &properties_manager,
+  const Parameters::PostProcessing &post_processing);
+
+template VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities<3, GlobalVectorType>(
+  const DoFHandler<3>              &dof_handler,
+  const GlobalVectorType           &evaluation_point,
+  const Quadrature<3>              &quadrature_formula,
+  const Mapping<3>                 &mapping,
+  const PhysicalPropertiesManager  &properties_manager,
+  const Parameters::PostProcessing &post_processing);
+
+template VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities<2, GlobalBlockVectorType>(
+  const DoFHandler<2>              &dof_handler,
+  const GlobalBlockVectorType      &evaluation_point,
+  const Quadrature<2>              &quadrature_formula,
+  const Mapping<2>                 &mapping,
+  const PhysicalPropertiesManager  &properties_manager,
+  const Parameters::PostProcessing &post_processing);
+
+template VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities<3, GlobalBlockVectorType>(
+  const DoFHandler<3>              &dof_handler,
+  const GlobalBlockVectorType      &evaluation_point,
+  const Quadrature<3>              &quadrature_formula,
+  const Mapping<3>                 &mapping,
+  const PhysicalPropertiesManager  &properties_manager,
+  const Parameters::PostProcessing &post_processing);
 
 #ifndef LETHE_USE_LDV
-template double
-calculate_kinetic_energy<2, LinearAlgebra::distributed::Vector<double>>(
+template VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities<
+  2,
+  LinearAlgebra::distributed::Vector<double>>(
   const DoFHandler<2>                              &dof_handler,
   const LinearAlgebra::distributed::Vector<double> &evaluation_point,
   const Quadrature<2>                              &quadrature_formula,
-  const Mapping<2>                                 &mapping);
+  const Mapping<2>                                 &mapping,
+  const PhysicalPropertiesManager                  &properties_manager,
+  const Parameters::PostProcessing                 &post_processing);
 
-template double
-calculate_kinetic_energy<3, LinearAlgebra::distributed::Vector<double>>(
+template VolumePostprocessingQuantities
+calculate_volume_postprocessing_quantities<
+  3,
+  LinearAlgebra::distributed::Vector<double>>(
   const DoFHandler<3>                              &dof_handler,
   const LinearAlgebra::distributed::Vector<double> &evaluation_point,
   const Quadrature<3>                              &quadrature_formula,
-  const Mapping<3>                                 &mapping);
+  const Mapping<3>                                 &mapping,
+  const PhysicalPropertiesManager                  &properties_manager,
+  const Parameters::PostProcessing                 &post_processing);
 #endif
 
 template <int dim, typename VectorType>
@@ -887,94 +584,115 @@ calculate_forces(
   const Quadrature<dim - 1>                           &face_quadrature_formula,
   const Mapping<dim>                                  &mapping)
 {
-  const FESystem<dim, dim> fe = dof_handler.get_fe();
+  using ScratchData = PostprocessingScratchData<dim, FEFaceValues<dim>>;
+
+  // Forces on each boundary of the locally owned cells, in the order force,
+  // viscous force and pressure force
+  using ForcesCopyData =
+    std::array<std::map<types::boundary_id, Tensor<1, dim>>, 3>;
 
   // Rheological model for viscosity properties
-  double     kinematic_viscosity;
   const auto rheological_model = properties_manager.get_rheology();
 
 
   const unsigned int               n_q_points = face_quadrature_formula.size();
   const FEValuesExtractors::Vector velocities(0);
   const FEValuesExtractors::Scalar pressure(dim);
-  std::vector<double>              pressure_values(n_q_points);
-  std::vector<Tensor<2, dim>>      velocity_gradients(n_q_points);
-  Tensor<1, dim>                   normal_vector;
-  Tensor<2, dim>                   shear_rate;
-  Tensor<2, dim>                   fluid_stress;
-  Tensor<2, dim>                   fluid_viscous_stress;
-  Tensor<2, dim>                   fluid_pressure;
 
   std::map<types::boundary_id, Tensor<1, dim>> viscous_force_map;
   std::map<types::boundary_id, Tensor<1, dim>> pressure_force_map;
   std::map<types::boundary_id, Tensor<1, dim>> force_map;
 
-  FEFaceValues<dim> fe_face_values(mapping,
-                                   fe,
-                                   face_quadrature_formula,
-                                   update_values | update_quadrature_points |
-                                     update_gradients | update_JxW_values |
-                                     update_normal_vectors);
-  const MPI_Comm    mpi_communicator = dof_handler.get_mpi_communicator();
+  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
 
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
+  const auto worker =
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        ScratchData                                          &scratch_data,
+        ForcesCopyData                                       &copy_data) {
+      auto &local_force_map          = copy_data[0];
+      auto &local_viscous_force_map  = copy_data[1];
+      auto &local_pressure_force_map = copy_data[2];
+      local_force_map.clear();
+      local_viscous_force_map.clear();
+      local_pressure_force_map.clear();
+
+      if (!cell->at_boundary())
+        return;
+
+      auto &fe_face_values     = scratch_data.fe_values;
+      auto &pressure_values    = scratch_data.scalar_values;
+      auto &velocity_gradients = scratch_data.vector_gradients;
+
+      Tensor<1, dim> normal_vector;
+      Tensor<2, dim> shear_rate;
+      Tensor<2, dim> fluid_stress;
+      Tensor<2, dim> fluid_viscous_stress;
+      Tensor<2, dim> fluid_pressure;
+
+      for (const auto face : cell->face_indices())
         {
-          if (cell->at_boundary())
+          if (cell->face(face)->at_boundary())
             {
-              for (const auto face : cell->face_indices())
-                {
-                  if (cell->face(face)->at_boundary())
-                    {
-                      const auto boundary_id = cell->face(face)->boundary_id();
+              const auto boundary_id = cell->face(face)->boundary_id();
 
-                      fe_face_values.reinit(cell, face);
+              fe_face_values.reinit(cell, face);
 
-                      std::vector<Point<dim>> q_points =
-                        fe_face_values.get_quadrature_points();
-                      fe_face_values[velocities].get_function_gradients(
-                        evaluation_point, velocity_gradients);
-                      fe_face_values[pressure].get_function_values(
-                        evaluation_point, pressure_values);
-                      for (unsigned int q = 0; q < n_q_points; q++)
-                        {
-                          normal_vector = -fe_face_values.normal_vector(q);
-                          for (int d = 0; d < dim; ++d)
-                            {
-                              fluid_pressure[d][d] = pressure_values[q];
-                            }
-                          shear_rate = velocity_gradients[q] +
-                                       transpose(velocity_gradients[q]);
-
-                          const double shear_rate_magnitude =
-                            calculate_shear_rate_magnitude(shear_rate);
-
-                          std::map<field, double> field_values;
-                          field_values[field::shear_rate] =
-                            shear_rate_magnitude;
-
-                          kinematic_viscosity =
-                            rheological_model->value(field_values);
-                          fluid_viscous_stress =
-                            -kinematic_viscosity * shear_rate;
-                          fluid_stress = -fluid_viscous_stress - fluid_pressure;
-
-                          viscous_force_map[boundary_id] -=
-                            fluid_viscous_stress * normal_vector *
-                            fe_face_values.JxW(q);
-                          pressure_force_map[boundary_id] -=
-                            fluid_pressure * normal_vector *
-                            fe_face_values.JxW(q);
-                          force_map[boundary_id] += fluid_stress *
-                                                    normal_vector *
-                                                    fe_face_values.JxW(q);
-                        }
+              fe_face_values[velocities].get_function_gradients(
+                evaluation_point, velocity_gradients);
+              fe_face_values[pressure].get_function_values(evaluation_point,
+                                                           pressure_values);
+              for (unsigned int q = 0; q < n_q_points; q++)
+                {
+                  normal_vector = -fe_face_values.normal_vector(q);
+                  for (int d = 0; d < dim; ++d)
+                    {
+                      fluid_pressure[d][d] = pressure_values[q];
                     }
+                  shear_rate =
+                    velocity_gradients[q] + transpose(velocity_gradients[q]);
+
+                  const double shear_rate_magnitude =
+                    calculate_shear_rate_magnitude(shear_rate);
+
+                  std::map<field, double> field_values;
+                  field_values[field::shear_rate] = shear_rate_magnitude;
+
+                  const double kinematic_viscosity =
+                    rheological_model->value(field_values);
+                  fluid_viscous_stress = -kinematic_viscosity * shear_rate;
+                  fluid_stress = -fluid_viscous_stress - fluid_pressure;
+
+                  local_viscous_force_map[boundary_id] -=
+                    fluid_viscous_stress * normal_vector *
+                    fe_face_values.JxW(q);
+                  local_pressure_force_map[boundary_id] -=
+                    fluid_pressure * normal_vector * fe_face_values.JxW(q);
+                  local_force_map[boundary_id] +=
+                    fluid_stress * normal_vector * fe_face_values.JxW(q);
                 }
             }
         }
-    }
+    };
+
+  const auto copier = [&](const ForcesCopyData &copy_data) {
+    for (const auto &[id, force] : copy_data[0])
+      force_map[id] += force;
+    for (const auto &[id, force] : copy_data[1])
+      viscous_force_map[id] += force;
+    for (const auto &[id, force] : copy_data[2])
+      pressure_force_map[id] += force;
+  };
+
+  run_on_locally_owned_cells(
+    dof_handler,
+    worker,
+    copier,
+    ScratchData(mapping,
+                dof_handler.get_fe(),
+                face_quadrature_formula,
+                update_values | update_quadrature_points | update_gradients |
+                  update_JxW_values | update_normal_vectors),
+    ForcesCopyData());
 
   for (auto const &[id, type] : boundary_conditions.type)
     {
@@ -1054,101 +772,114 @@ calculate_torques(
   const Quadrature<dim - 1>                           &face_quadrature_formula,
   const Mapping<dim>                                  &mapping)
 {
-  const FESystem<dim, dim> fe = dof_handler.get_fe();
+  using ScratchData = PostprocessingScratchData<dim, FEFaceValues<dim>>;
+
+  // Torques on each boundary of the locally owned cells
+  using TorquesCopyData = std::map<types::boundary_id, Tensor<1, 3>>;
 
   // Rheological model for viscosity properties
-  double     kinematic_viscosity;
   const auto rheological_model = properties_manager.get_rheology();
 
 
   const unsigned int               n_q_points = face_quadrature_formula.size();
   const FEValuesExtractors::Vector velocities(0);
   const FEValuesExtractors::Scalar pressure(dim);
-  std::vector<double>              pressure_values(n_q_points);
-  std::vector<Tensor<2, dim>>      velocity_gradients(n_q_points);
-  Tensor<1, dim>                   normal_vector;
-  Tensor<2, dim>                   shear_rate;
-  Tensor<2, dim>                   fluid_stress;
-  Tensor<2, dim>                   fluid_pressure;
-
 
   std::map<types::boundary_id, Tensor<1, 3>> torque_map;
 
-  FEFaceValues<dim> fe_face_values(mapping,
-                                   fe,
-                                   face_quadrature_formula,
-                                   update_values | update_quadrature_points |
-                                     update_gradients | update_JxW_values |
-                                     update_normal_vectors);
-  const MPI_Comm    mpi_communicator = dof_handler.get_mpi_communicator();
+  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
 
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
-        {
-          for (const auto face : cell->face_indices())
-            {
-              if (cell->face(face)->at_boundary())
-                {
-                  fe_face_values.reinit(cell, face);
-                  unsigned int boundary_id = cell->face(face)->boundary_id();
+  const auto worker =
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        ScratchData                                          &scratch_data,
+        TorquesCopyData                                      &copy_data) {
+      auto &local_torque_map = copy_data;
+      local_torque_map.clear();
 
-                  Point<dim> center_of_rotation =
-                    boundary_conditions.navier_stokes_functions.at(boundary_id)
-                      ->center_of_rotation;
+      if (!cell->at_boundary())
+        return;
 
-                  std::vector<Point<dim>> q_points =
-                    fe_face_values.get_quadrature_points();
-                  fe_face_values[velocities].get_function_gradients(
-                    evaluation_point, velocity_gradients);
-                  fe_face_values[pressure].get_function_values(evaluation_point,
-                                                               pressure_values);
+      auto &fe_face_values     = scratch_data.fe_values;
+      auto &pressure_values    = scratch_data.scalar_values;
+      auto &velocity_gradients = scratch_data.vector_gradients;
 
-                  for (unsigned int q = 0; q < n_q_points; q++)
-                    {
-                      normal_vector = -fe_face_values.normal_vector(q);
-                      for (int d = 0; d < dim; ++d)
-                        {
-                          fluid_pressure[d][d] = pressure_values[q];
-                        }
-                      shear_rate = velocity_gradients[q] +
-                                   transpose(velocity_gradients[q]);
-                      const double shear_rate_magnitude =
-                        calculate_shear_rate_magnitude(shear_rate);
+      Tensor<1, dim> normal_vector;
+      Tensor<2, dim> shear_rate;
+      Tensor<2, dim> fluid_stress;
+      Tensor<2, dim> fluid_pressure;
+
+      for (const auto face : cell->face_indices())
+        {
+          if (cell->face(face)->at_boundary())
+            {
+              const auto boundary_id = cell->face(face)->boundary_id();
 
-                      std::map<field, double> field_values;
-                      field_values[field::shear_rate] = shear_rate_magnitude;
+              fe_face_values.reinit(cell, face);
 
-                      kinematic_viscosity =
-                        rheological_model->value(field_values);
+              const Point<dim> center_of_rotation =
+                boundary_conditions.navier_stokes_functions.at(boundary_id)
+                  ->center_of_rotation;
 
-                      fluid_stress =
-                        kinematic_viscosity * shear_rate - fluid_pressure;
-                      auto force =
-                        fluid_stress * normal_vector * fe_face_values.JxW(q);
+              fe_face_values[velocities].get_function_gradients(
+                evaluation_point, velocity_gradients);
+              fe_face_values[pressure].get_function_values(evaluation_point,
+                                                           pressure_values);
 
-                      auto distance = q_points[q] - center_of_rotation;
-                      if (dim == 2)
-                        {
-                          torque_map[boundary_id][0] = 0.;
-                          torque_map[boundary_id][1] = 0.;
-                          torque_map[boundary_id][2] +=
-                            distance[0] * force[1] - distance[1] * force[0];
-                        }
-                      else if (dim == 3)
-                        {
-                          torque_map[boundary_id][0] +=
-                            distance[1] * force[2] - distance[2] * force[1];
-                          torque_map[boundary_id][1] +=
-                            distance[2] * force[0] - distance[0] * force[2];
-                          torque_map[boundary_id][2] +=
-                            distance[0] * force[1] - distance[1] * force[0];
-                        }
+              for (unsigned int q = 0; q < n_q_points; q++)
+                {
+                  normal_vector = -fe_face_values.normal_vector(q);
+                  for (int d = 0; d < dim; ++d)
+                    {
+                      fluid_pressure[d][d] = pressure_values[q];
                     }
+                  shear_rate =
+                    velocity_gradients[q] + transpose(velocity_gradients[q]);
+                  const double shear_rate_magnitude =
+                    calculate_shear_rate_magnitude(shear_rate);
+
+                  std::map<field, double> field_values;
+                  field_values[field::shear_rate] = shear_rate_magnitude;
+
+                  const double kinematic_viscosity =
+                    rheological_model->value(field_values);
+
+                  fluid_stress =
+                    kinematic_viscosity * shear_rate - fluid_pressure;
+                  const auto force =
+                    fluid_stress * normal_vector * fe_face_values.JxW(q);
+
+                  const auto distance =
+                    fe_face_values.quadrature_point(q) - center_of_rotation;
+                  auto &torque = local_torque_map[boundary_id];
+                  if constexpr (dim == 3)
+                    {
+                      torque[0] +=
+                        distance[1] * force[2] - distance[2] * force[1];
+                      torque[1] +=
+                        distance[2] * force[0] - distance[0] * force[2];
+                    }
+                  torque[2] += distance[0] * force[1] - distance[1] * force[0];
                 }
             }
         }
-    }
+    };
+
+  const auto copier = [&](const TorquesCopyData &local_torque_map) {
+    for (const auto &[id, torque] : local_torque_map)
+      torque_map[id] += torque;
+  };
+
+  run_on_locally_owned_cells(
+    dof_handler,
+    worker,
+    copier,
+    ScratchData(mapping,
+                dof_handler.get_fe(),
+                face_quadrature_formula,
+                update_values | update_quadrature_points | update_gradients |
+                  update_JxW_values | update_normal_vectors),
+    TorquesCopyData());
+
   for (auto const &[id, type] : boundary_conditions.type)
     {
       torque_map[id] = Utilities::MPI::sum(torque_map[id], mpi_communicator);
@@ -1213,6 +944,228 @@ calculate_torques<3, LinearAlgebra::distributed::Vector<double>>(
   const Mapping<3>                                  &mapping);
 #endif
 
+template <int dim, typename VectorType>
+std::pair<std::vector<std::map<types::boundary_id, Tensor<1, dim>>>,
+          std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques(
+  const DoFHandler<dim>                               &dof_handler,
+  const VectorType                                    &evaluation_point,
+  const PhysicalPropertiesManager                     &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<dim> &boundary_conditions,
+  const Quadrature<dim - 1>                           &face_quadrature_formula,
+  const Mapping<dim>                                  &mapping)
+{
+  using ScratchData = PostprocessingScratchData<dim, FEFaceValues<dim>>;
+
+  // Forces and torques on each boundary of the locally owned cells. The
+  // forces are stored in the order force, viscous force and pressure force.
+  struct ForcesAndTorquesCopyData
+  {
+    std::array<std::map<types::boundary_id, Tensor<1, dim>>, 3> forces;
+    std::map<types::boundary_id, Tensor<1, 3>>                  torques;
+  };
+
+  // Rheological model for viscosity properties
+  const auto rheological_model = properties_manager.get_rheology();
+
+  const unsigned int               n_q_points = face_quadrature_formula.size();
+  const FEValuesExtractors::Vector velocities(0);
+  const FEValuesExtractors::Scalar pressure(dim);
+
+  std::map<types::boundary_id, Tensor<1, dim>> viscous_force_map;
+  std::map<types::boundary_id, Tensor<1, dim>> pressure_force_map;
+  std::map<types::boundary_id, Tensor<1, dim>> force_map;
+  std::map<types::boundary_id, Tensor<1, 3>>   torque_map;
+
+  const MPI_Comm mpi_communicator = dof_handler.get_mpi_communicator();
+
+  const auto worker =
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        ScratchData                                          &scratch_data,
+        ForcesAndTorquesCopyData                             &copy_data) {
+      auto &local_force_map          = copy_data.forces[0];
+      auto &local_viscous_force_map  = copy_data.forces[1];
+      auto &local_pressure_force_map = copy_data.forces[2];
+      auto &local_torque_map         = copy_data.torques;
+      local_force_map.clear();
+      local_viscous_force_map.clear();
+      local_pressure_force_map.clear();
+      local_torque_map.clear();
+
+      if (!cell->at_boundary())
+        return;
+
+      auto &fe_face_values     = scratch_data.fe_values;
+      auto &pressure_values    = scratch_data.scalar_values;
+      auto &velocity_gradients = scratch_data.vector_gradients;
+
+      Tensor<1, dim> normal_vector;
+      Tensor<2, dim> shear_rate;
+      Tensor<2, dim> fluid_stress;
+      Tensor<2, dim> fluid_viscous_stress;
+      Tensor<2, dim> fluid_pressure;
+
+      for (const auto face : cell->face_indices())
+        {
+          if (!cell->face(face)->at_boundary())
+            continue;
+
+          const auto boundary_id = cell->face(face)->boundary_id();
+
+          const Point<dim> center_of_rotation =
+            boundary_conditions.navier_stokes_functions.at(boundary_id)
+              ->center_of_rotation;
+
+          fe_face_values.reinit(cell, face);
+
+          fe_face_values[velocities].get_function_gradients(evaluation_point,
+                                                            velocity_gradients);
+          fe_face_values[pressure].get_function_values(evaluation_point,
+                                                       pressure_values);
+
+          // Create the entries of the boundary even if the face has no
+          // contribution, as done in calculate_torques()
+          Tensor<1, 3> &torque = local_torque_map[boundary_id];
+
+          for (unsigned int q = 0; q < n_q_points; q++)
+            {
+              normal_vector = -fe_face_values.normal_vector(q);
+              for (int d = 0; d < dim; ++d)
+                {
+                  fluid_pressure[d][d] = pressure_values[q];
+                }
+              shear_rate =
+                velocity_gradients[q] + transpose(velocity_gradients[q]);
+
+              const double shear_rate_magnitude =
+                calculate_shear_rate_magnitude(shear_rate);
+
+              std::map<field, double> field_values;
+              field_values[field::shear_rate] = shear_rate_magnitude;
+
+              const double kinematic_viscosity =
+                rheological_model->value(field_values);
+              fluid_viscous_stress = -kinematic_viscosity * shear_rate;
+              fluid_stress         = -fluid_viscous_stress - fluid_pressure;
+
+              const double         JxW   = fe_face_values.JxW(q);
+              const Tensor<1, dim> force = fluid_stress * normal_vector * JxW;
+
+              local_viscous_force_map[boundary_id] -=
+                fluid_viscous_stress * normal_vector * JxW;
+              local_pressure_force_map[boundary_id] -=
+                fluid_pressure * normal_vector * JxW;
+              local_force_map[boundary_id] += force;
+
+              const Tensor<1, dim> distance =
+                fe_face_values.quadrature_point(q) - center_of_rotation;
+              if constexpr (dim == 3)
+                {
+                  torque[0] += distance[1] * force[2] - distance[2] * force[1];
+                  torque[1] += distance[2] * force[0] - distance[0] * force[2];
+                }
+              torque[2] += distance[0] * force[1] - distance[1] * force[0];
+            }
+        }
+    };
+
+  const auto copier = [&](const ForcesAndTorquesCopyData &copy_data) {
+    for (const auto &[id, force] : copy_data.forces[0])
+      force_map[id] += force;
+    for (const auto &[id, force] : copy_data.forces[1])
+      viscous_force_map[id] += force;
+    for (const auto &[id, force] : copy_data.forces[2])
+      pressure_force_map[id] += force;
+    for (const auto &[id, torque] : copy_data.torques)
+      torque_map[id] += torque;
+  };
+
+  run_on_locally_owned_cells(
+    dof_handler,
+    worker,
+    copier,
+    ScratchData(mapping,
+                dof_handler.get_fe(),
+                face_quadrature_formula,
+                update_values | update_quadrature_points | update_gradients |
+                  update_JxW_values | update_normal_vectors),
+    ForcesAndTorquesCopyData());
+
+  for (auto const &[id, type] : boundary_conditions.type)
+    {
+      viscous_force_map[id] =
+        Utilities::MPI::sum(viscous_force_map[id], mpi_communicator);
+      pressure_force_map[id] =
+        Utilities::MPI::sum(pressure_force_map[id], mpi_communicator);
+      force_map[id]  = Utilities::MPI::sum(force_map[id], mpi_communicator);
+      torque_map[id] = Utilities::MPI::sum(torque_map[id], mpi_communicator);
+    }
+
+  return {{force_map, viscous_force_map, pressure_force_map}, torque_map};
+}
+
+template std::pair<std::vector<std::map<types::boundary_id, Tensor<1, 2>>>,
+                   std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques<2, GlobalVectorType>(
+  const DoFHandler<2>                               &dof_handler,
+  const GlobalVectorType                            &evaluation_point,
+  const PhysicalPropertiesManager                   &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<2> &boundary_conditions,
+  const Quadrature<1>                               &face_quadrature_formula,
+  const Mapping<2>                                  &mapping);
+
+template std::pair<std::vector<std::map<types::boundary_id, Tensor<1, 3>>>,
+                   std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques<3, GlobalVectorType>(
+  const DoFHandler<3>                               &dof_handler,
+  const GlobalVectorType                            &evaluation_point,
+  const PhysicalPropertiesManager                   &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<3> &boundary_conditions,
+  const Quadrature<2>                               &face_quadrature_formula,
+  const Mapping<3>                                  &mapping);
+
+template std::pair<std::vector<std::map<types::boundary_id, Tensor<1, 2>>>,
+                   std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques<2, GlobalBlockVectorType>(
+  const DoFHandler<2>                               &dof_handler,
+  const GlobalBlockVectorType                       &evaluation_point,
+  const PhysicalPropertiesManager                   &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<2> &boundary_conditions,
+  const Quadrature<1>                               &face_quadrature_formula,
+  const Mapping<2>                                  &mapping);
+
+template std::pair<std::vector<std::map<types::boundary_id, Tensor<1, 3>>>,
+                   std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques<3, GlobalBlockVectorType>(
+  const DoFHandler<3>                               &dof_handler,
+  const GlobalBlockVectorType                       &evaluation_point,
+  const PhysicalPropertiesManager                   &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<3> &boundary_conditions,
+  const Quadrature<2>                               &face_quadrature_formula,
+  const Mapping<3>                                  &mapping);
+
+#ifndef LETHE_USE_LDV
+template std::pair<std::vector<std::map<types::boundary_id, Tensor<1, 2>>>,
+                   std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques<2, LinearAlgebra::distributed::Vector<double>>(
+  const DoFHandler<2>                               &dof_handler,
+  const LinearAlgebra::distributed::Vector<double>  &evaluation_point,
+  const PhysicalPropertiesManager                   &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<2> &boundary_conditions,
+  const Quadrature<1>                               &face_quadrature_formula,
+  const Mapping<2>                                  &mapping);
+
+template std::pair<std::vector<std::map<types::boundary_id, Tensor<1, 3>>>,
+                   std::map<types::boundary_id, Tensor<1, 3>>>
+calculate_forces_and_torques<3, LinearAlgebra::distributed::Vector<double>>(
+  const DoFHandler<3>                               &dof_handler,
+  const LinearAlgebra::distributed::Vector<double>  &evaluation_point,
+  const PhysicalPropertiesManager                   &properties_manager,
+  const BoundaryConditions::NSBoundaryConditions<3> &boundary_conditions,
+  const Quadrature<2>                               &face_quadrature_formula,
+  const Mapping<3>                                  &mapping);
+#endif
+
 // Find the l2 norm of the error between the finite element sol'n and the exact
 // sol'n for both the velocity and the pressure
 // Mean pressure is removed from both the analytical and the simulation solution
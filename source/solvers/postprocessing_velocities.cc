@@ -5,14 +5,135 @@
 
 #include <solvers/postprocessing_velocities.h>
 
+#include <cstdint>
 #include <fstream>
 
+namespace
+{
+  /**
+   * @brief Get the range of the locally owned entries of a (non-block) vector.
+   *
+   * @param[in] vector Trilinos or deal.II vector.
+   *
+   * @return Global indices of the first and one past the last locally owned
+   * entries.
+   */
+  template <typename ScalarVectorType>
+  std::pair<unsigned int, unsigned int>
+  get_local_range(const ScalarVectorType &vector)
+  {
+    if constexpr (std::is_same_v<ScalarVectorType,
+                                 TrilinosWrappers::MPI::Vector>)
+      return vector.local_range();
+    else
+      return vector.get_partitioner()->local_range();
+  }
+
+  /**
+   * @brief Update in place the average velocities and Reynolds stresses with
+   * a new sample of the solution using the weighted Welford algorithm. With
+   * the fluctuations u' = u - <u>_old and u'' = u - <u>_new, the Reynolds
+   * stresses are updated as <u'v'>_new = (1 - r) <u'v'>_old + r u' v'', where
+   * r is the ratio of the weight of the sample to the total weight.
+   *
+   * @param[in] solution Present solution, the velocity of each vertex being
+   * stored in dofs_per_vertex consecutive entries.
+   *
+   * @param[in,out] average Average solution.
+   *
+   * @param[in,out] normal_stresses Reynolds normal stresses.
+   *
+   * @param[in,out] shear_stresses Reynolds shear stresses.
+   *
+   * @param[in,out] turbulent_kinetic_energy Vector holding the turbulent
+   * kinetic energy.
+   *
+   * @param[in] interleaved_pressure Whether the pressure follows the velocity
+   * of each vertex. In this case, the average pressure and the turbulent
+   * kinetic energy are stored at the location of the pressure, otherwise the
+   * turbulent kinetic energy of the entry i is stored at i / dim.
+   *
+   * @param[in] dofs_per_vertex Number of entries per vertex.
+   *
+   * @param[in] weight_ratio Ratio of the weight of the sample to the total
+   * weight of the samples.
+   */
+  template <int dim, typename ScalarVectorType>
+  void
+  update_welford_velocity_statistics(
+    const ScalarVectorType &solution,
+    ScalarVectorType       &average,
+    ScalarVectorType       &normal_stresses,
+    ScalarVectorType       &shear_stresses,
+    ScalarVectorType       &turbulent_kinetic_energy,
+    const bool              interleaved_pressure,
+    const unsigned int      dofs_per_vertex,
+    const double            weight_ratio)
+  {
+    const auto [begin_index, end_index] = get_local_range(solution);
+    const double previous_weight_ratio  = 1. - weight_ratio;
+
+    for (unsigned int i = begin_index; i < end_index; i += dofs_per_vertex)
+      {
+        // Fluctuations with respect to the previous and the updated averages
+        Tensor<1, dim> fluctuation;
+        Tensor<1, dim> updated_fluctuation;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            fluctuation[d] = solution[i + d] - average[i + d];
+            average[i + d] += weight_ratio * fluctuation[d];
+            updated_fluctuation[d] = solution[i + d] - average[i + d];
+          }
+
+        // <u'u'>, <v'v'>, <w'w'> and k = 1/2(<u'u'>+<v'v'>+<w'w'>)
+        double k = 0;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            normal_stresses[i + d] =
+              previous_weight_ratio * normal_stresses[i + d] +
+              weight_ratio * fluctuation[d] * updated_fluctuation[d];
+            k += 0.5 * normal_stresses[i + d];
+          }
+
+        // <u'v'>
+        shear_stresses[i] = previous_weight_ratio * shear_stresses[i] +
+                            weight_ratio * fluctuation[0] *
+                              updated_fluctuation[1];
+        if constexpr (dim == 3)
+          {
+            // <v'w'>
+            shear_stresses[i + 1] =
+              previous_weight_ratio * shear_stresses[i + 1] +
+              weight_ratio * fluctuation[1] * updated_fluctuation[2];
+
+            // <w'u'>
+            shear_stresses[i + 2] =
+              previous_weight_ratio * shear_stresses[i + 2] +
+              weight_ratio * fluctuation[2] * updated_fluctuation[0];
+          }
+
+        if (interleaved_pressure)
+          {
+            average[i + dim] +=
+              weight_ratio * (solution[i + dim] - average[i + dim]);
+            turbulent_kinetic_energy[i + dim] = k;
+          }
+        else
+          turbulent_kinetic_energy[i / dim] = k;
+      }
+  }
+} // namespace
+
 template <int dim, typename VectorType, typename DofsType>
 AverageVelocities<dim, VectorType, DofsType>::AverageVelocities(
-  DoFHandler<dim> &dof_handler)
-  : solution_transfer_sum_velocity_dt(dof_handler, true)
+  DoFHandler<dim>                                        &dof_handler,
+  const Parameters::PostProcessing::AverageVelocitiesScheme scheme)
+  : scheme(scheme)
+  , solution_transfer_sum_velocity_dt(dof_handler, true)
   , solution_transfer_sum_reynolds_normal_stress_dt(dof_handler, true)
   , solution_transfer_sum_reynolds_shear_stress_dt(dof_handler, true)
+  , n_steps_since_last_update(0)
+  , time_since_last_update(0.0)
   , total_time_for_average(0.0)
   , has_started_averaging(false)
 {
@@ -31,7 +152,6 @@ AverageVelocities<dim, VectorType, DofsType>::calculate_average_velocities(
   const double epsilon = 1e-6;
   const double initial_time =
     post_processing.initial_time_for_average_velocities;
-  dt = time_step;
 
   // When averaging velocities begins
   if (current_time >= (initial_time - epsilon))
@@ -42,16 +162,40 @@ AverageVelocities<dim, VectorType, DofsType>::calculate_average_velocities(
           real_initial_time     = current_time;
 
           // Store the first dt value in case dt varies.
-          dt_0 = dt;
+          dt_0 = time_step;
+
+          // The averages are always updated at the first time step
+          n_steps_since_last_update =
+            post_processing.average_velocities_frequency - 1;
+          time_since_last_update = 0.;
         }
-      // Calculate (u*dt) at each time step and accumulate the values
-      velocity_dt.equ(dt, local_evaluation_point);
-      sum_velocity_dt += velocity_dt;
+
+      // The averages are only updated every average_velocities_frequency
+      // time steps, with a weight equal to the time elapsed since the last
+      // update
+      time_since_last_update += time_step;
+      if (++n_steps_since_last_update <
+          post_processing.average_velocities_frequency)
+        return;
+      dt                        = time_since_last_update;
+      n_steps_since_last_update = 0;
+      time_since_last_update    = 0.;
 
       // Get the inverse of the time since the beginning of the time averaging
       total_time_for_average = (current_time - real_initial_time) + dt_0;
       inv_range_time         = 1. / total_time_for_average;
 
+      if (scheme ==
+          Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+        {
+          update_welford_statistics(local_evaluation_point);
+          return;
+        }
+
+      // Calculate (u*dt) at each time step and accumulate the values
+      velocity_dt.equ(dt, local_evaluation_point);
+      sum_velocity_dt += velocity_dt;
+
       // Calculate the average velocities.
       average_velocities.equ(inv_range_time, sum_velocity_dt);
 
@@ -65,7 +209,10 @@ void
 AverageVelocities<dim, VectorType, DofsType>::update_average_velocities()
 {
   // Use the inverse of the time since the beginning of the time averaging to
-  // reevaluate the average velocity field and Reynolds stress.
+  // reevaluate the average velocity field and Reynolds stress. The Welford
+  // scheme stores the averages directly.
+  if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+    return;
 
   if (total_time_for_average > 1e-16)
     {
@@ -289,6 +436,85 @@ AverageVelocities<dim, VectorType, DofsType>::calculate_reynolds_stresses(
   reynolds_shear_stresses.equ(inv_range_time, sum_reynolds_shear_stress_dt);
 }
 
+template <int dim, typename VectorType, typename DofsType>
+void
+AverageVelocities<dim, VectorType, DofsType>::update_welford_statistics(
+  const VectorType &local_evaluation_point)
+{
+  const double weight_ratio = dt * inv_range_time;
+
+  if constexpr (std::is_same_v<VectorType, GlobalBlockVectorType>)
+    {
+      // The pressure is stored in the second block of the solution and the
+      // turbulent kinetic energy in the second block of the normal stresses
+      average_velocities.block(1).sadd(1. - weight_ratio,
+                                       weight_ratio,
+                                       local_evaluation_point.block(1));
+      update_welford_velocity_statistics<dim>(
+        local_evaluation_point.block(0),
+        average_velocities.block(0),
+        reynolds_normal_stresses.block(0),
+        reynolds_shear_stresses.block(0),
+        reynolds_normal_stresses.block(1),
+        false,
+        n_dofs_per_vertex,
+        weight_ratio);
+    }
+  else
+    {
+      update_welford_velocity_statistics<dim>(local_evaluation_point,
+                                              average_velocities,
+                                              reynolds_normal_stresses,
+                                              reynolds_shear_stresses,
+                                              reynolds_normal_stresses,
+                                              true,
+                                              n_dofs_per_vertex,
+                                              weight_ratio);
+    }
+}
+
+template <int dim, typename VectorType, typename DofsType>
+void
+AverageVelocities<dim, VectorType, DofsType>::write_binary_statistics(
+  const std::string &prefix) const
+{
+  const IndexSet locally_owned_dofs =
+    average_velocities.locally_owned_elements();
+
+  const std::uint32_t dimension = dim;
+  const std::uint64_t n_dofs    = locally_owned_dofs.n_elements();
+
+  std::vector<std::uint64_t> indices;
+  indices.reserve(n_dofs);
+  for (const auto index : locally_owned_dofs)
+    indices.push_back(index);
+
+  const std::string filename =
+    prefix + "." +
+    Utilities::int_to_string(Utilities::MPI::this_mpi_process(
+                               mpi_communicator),
+                             4) +
+    ".bin";
+  std::ofstream output(filename, std::ios::binary);
+  AssertThrow(output, ExcFileNotOpen(filename));
+
+  output.write(reinterpret_cast<const char *>(&dimension), sizeof(dimension));
+  output.write(reinterpret_cast<const char *>(&n_dofs), sizeof(n_dofs));
+  output.write(reinterpret_cast<const char *>(indices.data()),
+               n_dofs * sizeof(std::uint64_t));
+
+  std::vector<double> values(n_dofs);
+  for (const VectorType *statistics : {&average_velocities,
+                                       &reynolds_normal_stresses,
+                                       &reynolds_shear_stresses})
+    {
+      for (std::uint64_t i = 0; i < n_dofs; ++i)
+        values[i] = (*statistics)(indices[i]);
+      output.write(reinterpret_cast<const char *>(values.data()),
+                   n_dofs * sizeof(double));
+    }
+}
+
 
 template <int dim, typename VectorType, typename DofsType>
 void
@@ -300,7 +526,26 @@ AverageVelocities<dim, VectorType, DofsType>::initialize_vectors(
 {
   // Save the number of dofs per vertex. If solution is in block vectors,
   // this is the number of dofs about velocity, dim.
-  n_dofs_per_vertex = dofs_per_vertex;
+  n_dofs_per_vertex      = dofs_per_vertex;
+  this->mpi_communicator = mpi_communicator;
+
+  // The Welford scheme only stores the averages and their ghosted copies
+  if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+    {
+      average_velocities.reinit(locally_owned_dofs, mpi_communicator);
+      get_av->reinit(locally_owned_dofs,
+                     locally_relevant_dofs,
+                     mpi_communicator);
+      reynolds_normal_stresses.reinit(locally_owned_dofs, mpi_communicator);
+      get_rns.reinit(locally_owned_dofs,
+                     locally_relevant_dofs,
+                     mpi_communicator);
+      reynolds_shear_stresses.reinit(locally_owned_dofs, mpi_communicator);
+      get_rss.reinit(locally_owned_dofs,
+                     locally_relevant_dofs,
+                     mpi_communicator);
+      return;
+    }
 
   // Reinitialisation of the average velocity and reynolds stress vectors
   // to get the right length.
@@ -337,9 +582,20 @@ template <int dim, typename VectorType, typename DofsType>
 void
 AverageVelocities<dim, VectorType, DofsType>::prepare_for_mesh_adaptation()
 {
-  *get_av = sum_velocity_dt;
-  get_rns = sum_reynolds_normal_stress_dt;
-  get_rss = sum_reynolds_shear_stress_dt;
+  // The Welford scheme transfers the averages, which are linear in the
+  // solution like the time integrals of the cumulative scheme
+  if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+    {
+      *get_av = average_velocities;
+      get_rns = reynolds_normal_stresses;
+      get_rss = reynolds_shear_stresses;
+    }
+  else
+    {
+      *get_av = sum_velocity_dt;
+      get_rns = sum_reynolds_normal_stress_dt;
+      get_rss = sum_reynolds_shear_stress_dt;
+    }
   solution_transfer_sum_velocity_dt.prepare_for_coarsening_and_refinement(
     *get_av);
   solution_transfer_sum_reynolds_normal_stress_dt
@@ -352,6 +608,39 @@ template <int dim, typename VectorType, typename DofsType>
 void
 AverageVelocities<dim, VectorType, DofsType>::post_mesh_adaptation()
 {
+  if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+    {
+      if constexpr (std::is_same_v<VectorType,
+                                   LinearAlgebra::distributed::Vector<double>>)
+        {
+          // The solution transfer expects vectors with ghost entries, which
+          // are temporarily allocated since the Welford scheme does not store
+          // ghosted copies of the time integrals
+          VectorType average_with_ghost_cells(*get_av);
+          VectorType rns_with_ghost_cells(get_rns);
+          VectorType rss_with_ghost_cells(get_rss);
+          solution_transfer_sum_velocity_dt.interpolate(
+            average_with_ghost_cells);
+          solution_transfer_sum_reynolds_normal_stress_dt.interpolate(
+            rns_with_ghost_cells);
+          solution_transfer_sum_reynolds_shear_stress_dt.interpolate(
+            rss_with_ghost_cells);
+
+          average_velocities       = average_with_ghost_cells;
+          reynolds_normal_stresses = rns_with_ghost_cells;
+          reynolds_shear_stresses  = rss_with_ghost_cells;
+        }
+      else
+        {
+          solution_transfer_sum_velocity_dt.interpolate(average_velocities);
+          solution_transfer_sum_reynolds_normal_stress_dt.interpolate(
+            reynolds_normal_stresses);
+          solution_transfer_sum_reynolds_shear_stress_dt.interpolate(
+            reynolds_shear_stresses);
+        }
+      return;
+    }
+
   if constexpr (std::is_same_v<VectorType,
                                LinearAlgebra::distributed::Vector<double>>)
     {
@@ -394,15 +683,27 @@ template <int dim, typename VectorType, typename DofsType>
 std::vector<const VectorType *>
 AverageVelocities<dim, VectorType, DofsType>::save(const std::string &prefix)
 {
-  sum_velocity_dt_with_ghost_cells = sum_velocity_dt;
-  sum_rns_dt_with_ghost_cells      = sum_reynolds_normal_stress_dt;
-  sum_rss_dt_with_ghost_cells      = sum_reynolds_shear_stress_dt;
-
-
   std::vector<const VectorType *> av_set_transfer;
-  av_set_transfer.push_back(&sum_velocity_dt_with_ghost_cells);
-  av_set_transfer.push_back(&sum_rns_dt_with_ghost_cells);
-  av_set_transfer.push_back(&sum_rss_dt_with_ghost_cells);
+  if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+    {
+      // The ghosted getter vectors are used to checkpoint the averages
+      *get_av = average_velocities;
+      get_rns = reynolds_normal_stresses;
+      get_rss = reynolds_shear_stresses;
+      av_set_transfer.push_back(get_av.get());
+      av_set_transfer.push_back(&get_rns);
+      av_set_transfer.push_back(&get_rss);
+    }
+  else
+    {
+      sum_velocity_dt_with_ghost_cells = sum_velocity_dt;
+      sum_rns_dt_with_ghost_cells      = sum_reynolds_normal_stress_dt;
+      sum_rss_dt_with_ghost_cells      = sum_reynolds_shear_stress_dt;
+
+      av_set_transfer.push_back(&sum_velocity_dt_with_ghost_cells);
+      av_set_transfer.push_back(&sum_rns_dt_with_ghost_cells);
+      av_set_transfer.push_back(&sum_rss_dt_with_ghost_cells);
+    }
 
 
   std::string   filename = prefix + ".averagevelocities";
@@ -412,6 +713,11 @@ AverageVelocities<dim, VectorType, DofsType>::save(const std::string &prefix)
   output << "has_started_averaging_boolean " << has_started_averaging
          << std::endl;
   output << "Real_initial_time " << real_initial_time << std::endl;
+  output << "Average_velocities_scheme " << static_cast<unsigned int>(scheme)
+         << std::endl;
+  output << "Steps_since_last_update " << n_steps_since_last_update
+         << std::endl;
+  output << "Time_since_last_update " << time_since_last_update << std::endl;
 
   return av_set_transfer;
 }
@@ -421,9 +727,18 @@ std::vector<VectorType *>
 AverageVelocities<dim, VectorType, DofsType>::read(const std::string &prefix)
 {
   std::vector<VectorType *> sum_vectors;
-  sum_vectors.push_back(&sum_velocity_dt_with_ghost_cells);
-  sum_vectors.push_back(&sum_rns_dt_with_ghost_cells);
-  sum_vectors.push_back(&sum_rss_dt_with_ghost_cells);
+  if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+    {
+      sum_vectors.push_back(get_av.get());
+      sum_vectors.push_back(&get_rns);
+      sum_vectors.push_back(&get_rss);
+    }
+  else
+    {
+      sum_vectors.push_back(&sum_velocity_dt_with_ghost_cells);
+      sum_vectors.push_back(&sum_rns_dt_with_ghost_cells);
+      sum_vectors.push_back(&sum_rss_dt_with_ghost_cells);
+    }
 
 
   std::string   filename = prefix + ".averagevelocities";
@@ -436,6 +751,20 @@ AverageVelocities<dim, VectorType, DofsType>::read(const std::string &prefix)
   input >> buffer >> has_started_averaging;
   input >> buffer >> real_initial_time;
 
+  // Checkpoints written before the introduction of the Welford scheme and of
+  // the update frequency do not contain the following entries
+  unsigned int checkpointed_scheme =
+    static_cast<unsigned int>(Parameters::PostProcessing::
+                                AverageVelocitiesScheme::cumulative);
+  if (input >> buffer >> checkpointed_scheme)
+    {
+      input >> buffer >> n_steps_since_last_update;
+      input >> buffer >> time_since_last_update;
+    }
+  AssertThrow(checkpointed_scheme == static_cast<unsigned int>(scheme),
+              ExcMessage("The average velocities scheme of the checkpoint "
+                         "differs from the one of the simulation."));
+
   return sum_vectors;
 }
 
@@ -443,6 +772,19 @@ template <int dim, typename VectorType, typename DofsType>
 void
 AverageVelocities<dim, VectorType, DofsType>::zero_average_after_restart()
 {
+  has_started_averaging = false;
+
+  if (scheme == Parameters::PostProcessing::AverageVelocitiesScheme::welford)
+    {
+      *get_av                  = 0.0;
+      get_rns                  = 0.0;
+      get_rss                  = 0.0;
+      average_velocities       = 0.0;
+      reynolds_normal_stresses = 0.0;
+      reynolds_shear_stresses  = 0.0;
+      return;
+    }
+
   sum_velocity_dt_with_ghost_cells = 0.0;
   sum_rns_dt_with_ghost_cells      = 0.0;
   sum_rss_dt_with_ghost_cells      = 0.0;
@@ -450,8 +792,6 @@ AverageVelocities<dim, VectorType, DofsType>::zero_average_after_restart()
   sum_velocity_dt               = 0.0;
   sum_reynolds_normal_stress_dt = 0.0;
   sum_reynolds_shear_stress_dt  = 0.0;
-
-  has_started_averaging = false;
 }
 
 template class AverageVelocities<2, GlobalVectorType, IndexSet>;
@@ -11,7 +11,9 @@ TimeHarmonicMaxwell<dim>::TimeHarmonicMaxwell(
   std::shared_ptr<SimulationControl> p_simulation_control)
   : AuxiliaryPhysics<dim, GlobalVectorType>()
   , multiphysics(multiphysics_interface)
-  , computing_timer(p_triangulation->get_mpi_communicator(),
+  , computing_timer(this->get_timer_communicator(
+                          p_simulation_parameters,
+                          p_triangulation->get_mpi_communicator()),
                     this->pcout,
                     TimerOutput::summary,
                     TimerOutput::wall_times)
@@ -20,6 +20,7 @@
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_solver.h>
@@ -79,6 +80,12 @@ Tracer<dim>::assemble_system_matrix()
 {
   TimerOutput::Scope t(this->computing_timer, "Assemble matrix");
 
+  if (simulation_parameters.fem_parameters.tracer_dg_uses_matrix_free)
+    {
+      update_matrix_free_operator();
+      return;
+    }
+
   this->system_matrix = 0;
   setup_assemblers();
 
@@ -254,6 +261,42 @@ Tracer<dim>::assemble_system_matrix_dg()
 }
 
 
+template <int dim>
+void
+Tracer<dim>::update_matrix_free_operator()
+{
+  AssertThrow(
+    !multiphysics->fluid_dynamics_is_block(),
+    ExcMessage(
+      "The matrix-free tracer operator does not support block fluid dynamics solutions."));
+
+  // Check if the velocity needs to be the average velocity profile or the
+  // fluid solution, as in the assembly of the matrix
+  const bool use_average_velocity =
+    this->simulation_parameters.initial_condition->type ==
+      Parameters::FluidDynamicsInitialConditionType::average_velocity_profile &&
+    !this->simulation_parameters.multiphysics.fluid_dynamics &&
+    simulation_control->get_current_time() >
+      this->simulation_parameters.post_processing
+        .initial_time_for_average_velocities;
+
+  const GlobalVectorType &fluid_solution =
+    use_average_velocity ?
+      multiphysics->get_time_average_solution(PhysicsID::fluid_dynamics) :
+      multiphysics->get_solution(PhysicsID::fluid_dynamics);
+
+  LinearAlgebra::distributed::Vector<double> velocity;
+  matrix_free_operator->initialize_fluid_dof_vector(velocity);
+  convert_vector_trilinos_to_dealii(velocity, fluid_solution);
+  velocity.update_ghost_values();
+
+  matrix_free_operator->evaluate_velocity(
+    velocity,
+    this->simulation_parameters.tracer_drift_velocity.drift_velocity,
+    this->simulation_parameters.ale);
+}
+
+
 
 template <int dim>
 void
@@ -738,6 +781,9 @@ Tracer<dim>::finish_simulation()
                                 simulation_control->get_log_precision());
       error_table.write_text(std::cout);
     }
+
+  if (simulation_parameters.timer.type != Parameters::Timer::Type::none)
+    preconditioner_refresh_policy.print_total_times(this->pcout, "Tracer");
 }
 
 template <int dim>
@@ -1231,6 +1277,9 @@ Tracer<dim>::setup_dofs()
   verify_consistency_of_boundary_conditions();
 
   dof_handler->distribute_dofs(*fe);
+
+  // The structure of the matrix changes, its preconditioner must be rebuilt
+  preconditioner_refresh_policy.invalidate();
   DoFRenumbering::Cuthill_McKee(*this->dof_handler);
 
   auto mpi_communicator = triangulation->get_mpi_communicator();
@@ -1325,35 +1374,52 @@ Tracer<dim>::setup_dofs()
   }
   zero_constraints.close();
 
-  // Sparse matrices initialization
-  DynamicSparsityPattern dsp(locally_relevant_dofs);
-
-
-  if (simulation_parameters.fem_parameters.tracer_uses_dg)
+  if (simulation_parameters.fem_parameters.tracer_dg_uses_matrix_free)
     {
-      DoFTools::make_flux_sparsity_pattern(*this->dof_handler,
-                                           dsp,
-                                           nonzero_constraints,
-                                           /*keep_constrained_dofs = */ true);
+      // The matrix-free operator replaces the sparse matrix, whose face
+      // coupling blocks dominate the memory of the DG formulation
+      system_matrix.clear();
+      matrix_free_operator->reinit(
+        *this->mapping,
+        *this->dof_handler,
+        multiphysics->get_dof_handler(PhysicsID::fluid_dynamics),
+        QGauss<1>(fe->degree + 1),
+        simulation_parameters.physical_properties_manager
+          .get_tracer_diffusivity()
+          ->value({}),
+        simulation_parameters.boundary_conditions_tracer,
+        simulation_control);
     }
   else
     {
-      DoFTools::make_sparsity_pattern(*this->dof_handler,
-                                      dsp,
-                                      nonzero_constraints,
-                                      /*keep_constrained_dofs = */ true);
-    }
-
+      // Sparse matrices initialization
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
 
+      if (simulation_parameters.fem_parameters.tracer_uses_dg)
+        {
+          DoFTools::make_flux_sparsity_pattern(
+            *this->dof_handler,
+            dsp,
+            nonzero_constraints,
+            /*keep_constrained_dofs = */ true);
+        }
+      else
+        {
+          DoFTools::make_sparsity_pattern(*this->dof_handler,
+                                          dsp,
+                                          nonzero_constraints,
+                                          /*keep_constrained_dofs = */ true);
+        }
 
-  SparsityTools::distribute_sparsity_pattern(dsp,
-                                             locally_owned_dofs,
-                                             mpi_communicator,
-                                             locally_relevant_dofs);
-  system_matrix.reinit(locally_owned_dofs,
-                       locally_owned_dofs,
-                       dsp,
-                       mpi_communicator);
+      SparsityTools::distribute_sparsity_pattern(dsp,
+                                                 locally_owned_dofs,
+                                                 mpi_communicator,
+                                                 locally_relevant_dofs);
+      system_matrix.reinit(locally_owned_dofs,
+                           locally_owned_dofs,
+                           dsp,
+                           mpi_communicator);
+    }
 
   this->pcout << "   Number of tracer degrees of freedom: "
               << dof_handler->n_dofs() << std::endl;
@@ -1448,6 +1514,55 @@ Tracer<dim>::compute_kelly(
     }
 }
 
+template <int dim>
+void
+Tracer<dim>::setup_ilu_preconditioner()
+{
+  const unsigned int ilu_fill =
+    simulation_parameters.linear_solver.at(PhysicsID::tracer).ilu_precond_fill;
+  const double ilu_atol =
+    simulation_parameters.linear_solver.at(PhysicsID::tracer).ilu_precond_atol;
+  const double ilu_rtol =
+    simulation_parameters.linear_solver.at(PhysicsID::tracer).ilu_precond_rtol;
+  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
+    ilu_fill, ilu_atol, ilu_rtol, 0);
+
+  system_ilu_preconditioner =
+    std::make_shared<TrilinosWrappers::PreconditionILU>();
+  system_ilu_preconditioner->initialize(system_matrix, preconditionerOptions);
+}
+
+template <int dim>
+void
+Tracer<dim>::setup_lagged_preconditioner()
+{
+  TimerOutput::Scope t(this->computing_timer, "Setup lagged preconditioner");
+
+  if (simulation_parameters.fem_parameters.tracer_dg_uses_matrix_free)
+    matrix_free_operator->compute_inverse_block_diagonal();
+  else
+    setup_ilu_preconditioner();
+}
+
+template <int dim>
+void
+Tracer<dim>::apply_lagged_preconditioner(GlobalVectorType       &dst,
+                                         const GlobalVectorType &src)
+{
+  if (!simulation_parameters.fem_parameters.tracer_dg_uses_matrix_free)
+    {
+      system_ilu_preconditioner->vmult(dst, src);
+      return;
+    }
+
+  LinearAlgebra::distributed::Vector<double> src_dealii, dst_dealii;
+  matrix_free_operator->initialize_dof_vector(src_dealii);
+  matrix_free_operator->initialize_dof_vector(dst_dealii);
+  convert_vector_trilinos_to_dealii(src_dealii, src);
+  matrix_free_operator->apply_inverse_block_diagonal(dst_dealii, src_dealii);
+  convert_vector_dealii_to_trilinos(dst, dst_dealii);
+}
+
 template <int dim>
 void
 Tracer<dim>::solve_linear_system()
@@ -1476,18 +1591,20 @@ Tracer<dim>::solve_linear_system()
   const double non_rescaled_linear_solver_tolerance =
     linear_solver_tolerance * rescale_metric;
 
-  const unsigned int ilu_fill =
-    simulation_parameters.linear_solver.at(PhysicsID::tracer).ilu_precond_fill;
-  const double ilu_atol =
-    simulation_parameters.linear_solver.at(PhysicsID::tracer).ilu_precond_atol;
-  const double ilu_rtol =
-    simulation_parameters.linear_solver.at(PhysicsID::tracer).ilu_precond_rtol;
-  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
-    ilu_fill, ilu_atol, ilu_rtol, 0);
-
-  TrilinosWrappers::PreconditionILU ilu_preconditioner;
+  if (simulation_parameters.fem_parameters.tracer_dg_uses_matrix_free)
+    {
+      solve_linear_system_matrix_free(non_rescaled_linear_solver_tolerance);
+      return;
+    }
 
-  ilu_preconditioner.initialize(system_matrix, preconditionerOptions);
+  // The preconditioner is rebuilt or reused according to the refresh policy
+  const PreconditionerRefreshPolicy::Action setup_action =
+    preconditioner_refresh_policy.get_setup_action(false);
+  Timer setup_timer;
+  if (setup_action == PreconditionerRefreshPolicy::Action::rebuild)
+    setup_ilu_preconditioner();
+  preconditioner_refresh_policy.register_setup(setup_action,
+                                               setup_timer.wall_time());
 
   GlobalVectorType completely_distributed_solution(locally_owned_dofs,
                                                    mpi_communicator);
@@ -1507,10 +1624,13 @@ Tracer<dim>::solve_linear_system()
   TrilinosWrappers::SolverGMRES solver(solver_control, solver_parameters);
 
 
+  Timer solve_timer;
   solver.solve(system_matrix,
                completely_distributed_solution,
                system_rhs,
-               ilu_preconditioner);
+               *system_ilu_preconditioner);
+  preconditioner_refresh_policy.register_solve(solver_control.last_step(),
+                                               solve_timer.wall_time());
 
   if (simulation_parameters.linear_solver.at(PhysicsID::tracer).verbosity !=
       Parameters::Verbosity::quiet)
@@ -1518,12 +1638,73 @@ Tracer<dim>::solve_linear_system()
       this->pcout << "  -Iterative solver took : " << solver_control.last_step()
                   << " steps to reach a residual norm of "
                   << solver_control.last_value() / rescale_metric << std::endl;
+      preconditioner_refresh_policy.print_statistics(this->pcout);
     }
 
   constraints_used.distribute(completely_distributed_solution);
   newton_update = completely_distributed_solution;
 }
 
+template <int dim>
+void
+Tracer<dim>::solve_linear_system_matrix_free(const double tolerance)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  const double rescale_metric = this->get_residual_rescale_metric();
+
+  // The inverse of the diagonal blocks is rebuilt or reused according to the
+  // refresh policy, the operator itself always using the present velocity
+  const PreconditionerRefreshPolicy::Action setup_action =
+    preconditioner_refresh_policy.get_setup_action(false);
+  Timer setup_timer;
+  if (setup_action == PreconditionerRefreshPolicy::Action::rebuild)
+    matrix_free_operator->compute_inverse_block_diagonal();
+  preconditioner_refresh_policy.register_setup(setup_action,
+                                               setup_timer.wall_time());
+
+  VectorType rhs, solution;
+  matrix_free_operator->initialize_dof_vector(rhs);
+  matrix_free_operator->initialize_dof_vector(solution);
+  convert_vector_trilinos_to_dealii(rhs, system_rhs);
+
+  SolverControl solver_control(
+    simulation_parameters.linear_solver.at(PhysicsID::tracer).max_iterations,
+    tolerance,
+    true,
+    true);
+
+  typename SolverGMRES<VectorType>::AdditionalData solver_parameters;
+  solver_parameters.max_n_tmp_vectors =
+    simulation_parameters.linear_solver.at(PhysicsID::tracer)
+      .max_krylov_vectors;
+  SolverGMRES<VectorType> solver(solver_control, solver_parameters);
+
+  const TracerDGBlockJacobiPreconditioner<dim, double> preconditioner(
+    *matrix_free_operator);
+
+  Timer solve_timer;
+  solver.solve(*matrix_free_operator, solution, rhs, preconditioner);
+  preconditioner_refresh_policy.register_solve(solver_control.last_step(),
+                                               solve_timer.wall_time());
+
+  if (simulation_parameters.linear_solver.at(PhysicsID::tracer).verbosity !=
+      Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Iterative solver took : " << solver_control.last_step()
+                  << " steps to reach a residual norm of "
+                  << solver_control.last_value() / rescale_metric << std::endl;
+      preconditioner_refresh_policy.print_statistics(this->pcout);
+    }
+
+  GlobalVectorType completely_distributed_solution(
+    locally_owned_dofs, triangulation->get_mpi_communicator());
+  convert_vector_dealii_to_trilinos(completely_distributed_solution, solution);
+
+  zero_constraints.distribute(completely_distributed_solution);
+  newton_update = completely_distributed_solution;
+}
+
 
 
 template class Tracer<2>;
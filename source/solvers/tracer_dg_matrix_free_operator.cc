@@ -0,0 +1,580 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#include <core/time_integration_utilities.h>
+#include <core/utilities.h>
+
+#include <solvers/fluid_dynamics_matrix_free_operators.h>
+#include <solvers/tracer_dg_matrix_free_operator.h>
+
+#include <deal.II/lac/vector.h>
+
+template <int dim, typename number>
+TracerDGMatrixFreeOperator<dim, number>::TracerDGMatrixFreeOperator()
+  : fe_degree(0)
+  , diffusivity(0.)
+{}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::reinit(
+  const Mapping<dim>                                      &mapping,
+  const DoFHandler<dim>                                   &dof_handler_tracer,
+  const DoFHandler<dim>                                   &dof_handler_fluid,
+  const Quadrature<1>                                     &quadrature,
+  const double                                             diffusivity,
+  const BoundaryConditions::TracerBoundaryConditions<dim> &boundary_conditions,
+  const std::shared_ptr<SimulationControl>                &simulation_control)
+{
+  this->fe_degree           = dof_handler_tracer.get_fe().degree;
+  this->diffusivity         = diffusivity;
+  this->boundary_conditions = boundary_conditions;
+  this->simulation_control  = simulation_control;
+
+  // The boundary conditions are imposed weakly and the velocity of the fluid
+  // is only read, hence both DoFHandlers share empty constraints
+  constraints.clear();
+  constraints.close();
+
+  typename MatrixFree<dim, number>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme =
+    MatrixFree<dim, number>::AdditionalData::none;
+  additional_data.mapping_update_flags =
+    (update_values | update_gradients | update_JxW_values |
+     update_quadrature_points);
+  additional_data.mapping_update_flags_inner_faces =
+    (update_values | update_gradients | update_JxW_values |
+     update_quadrature_points | update_normal_vectors);
+  additional_data.mapping_update_flags_boundary_faces =
+    (update_values | update_gradients | update_JxW_values |
+     update_quadrature_points | update_normal_vectors);
+
+  const std::vector<const DoFHandler<dim> *> dof_handlers = {
+    &dof_handler_tracer, &dof_handler_fluid};
+  const std::vector<const AffineConstraints<number> *> constraints_vector = {
+    &constraints, &constraints};
+
+  matrix_free.reinit(
+    mapping, dof_handlers, constraints_vector, quadrature, additional_data);
+
+  // The penalty factor of each face is computed from the extent of the cells
+  // normal to the face, as in the TracerScratchData
+  const unsigned int n_face_batches =
+    matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+  face_penalty.resize(n_face_batches);
+  for (unsigned int face = 0; face < n_face_batches; ++face)
+    {
+      const bool is_inner_face = face < matrix_free.n_inner_face_batches();
+      face_penalty[face]       = 0.;
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_face_batch(face);
+           ++v)
+        {
+          const auto [cell_m, face_no_m] =
+            matrix_free.get_face_iterator(face, v, true);
+          const double extent_here =
+            cell_m->measure() / cell_m->face(face_no_m)->measure();
+
+          double extent_there = extent_here;
+          if (is_inner_face)
+            {
+              const auto [cell_p, face_no_p] =
+                matrix_free.get_face_iterator(face, v, false);
+              extent_there =
+                cell_p->measure() / cell_p->face(face_no_p)->measure();
+            }
+
+          face_penalty[face][v] =
+            get_penalty_factor(fe_degree, extent_here, extent_there);
+        }
+    }
+
+  inverse_block_diagonal.clear();
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::evaluate_velocity(
+  const VectorType                                      &fluid_solution,
+  const std::shared_ptr<Functions::ParsedFunction<dim>> &drift_velocity,
+  const Parameters::ALE<dim>                            &ale)
+{
+  // Advective velocity at a batch of points: the velocity of the fluid, plus
+  // the drift velocity, minus the velocity of the ALE frame
+  const auto advective_velocity =
+    [&](const Tensor<1, dim, VectorizedArray<number>> &fluid_velocity,
+        const Point<dim, VectorizedArray<number>>     &point) {
+      Tensor<1, dim, VectorizedArray<number>> velocity =
+        fluid_velocity +
+        evaluate_function<dim, number, dim>(*drift_velocity, point);
+      if (ale.enabled())
+        velocity -= evaluate_function<dim, number, dim>(*ale.velocity, point);
+      return velocity;
+    };
+
+  // Cells
+  FEVelocityCellIntegrator velocity_integrator(matrix_free, 1, 0, 0);
+  const unsigned int       n_cell_batches = matrix_free.n_cell_batches();
+  const unsigned int       n_q_points     = velocity_integrator.n_q_points;
+
+  cell_velocity.reinit(n_cell_batches, n_q_points);
+  cell_velocity_divergence.reinit(n_cell_batches, n_q_points);
+
+  for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      velocity_integrator.reinit(cell);
+      velocity_integrator.read_dof_values_plain(fluid_solution);
+      velocity_integrator.evaluate(EvaluationFlags::values |
+                                   EvaluationFlags::gradients);
+
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          cell_velocity(cell, q) =
+            advective_velocity(velocity_integrator.get_value(q),
+                               velocity_integrator.quadrature_point(q));
+          cell_velocity_divergence(cell, q) =
+            velocity_integrator.get_divergence(q);
+        }
+    }
+
+  // Interior and boundary faces. The velocity of the fluid being continuous,
+  // it is evaluated from the interior side only.
+  FEVelocityFaceIntegrator velocity_face_integrator(matrix_free, true, 1, 0, 0);
+  const unsigned int       n_face_batches =
+    matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+  const unsigned int n_face_q_points = velocity_face_integrator.n_q_points;
+
+  face_normal_velocity.reinit(n_face_batches, n_face_q_points);
+
+  for (unsigned int face = 0; face < n_face_batches; ++face)
+    {
+      velocity_face_integrator.reinit(face);
+      velocity_face_integrator.read_dof_values_plain(fluid_solution);
+      velocity_face_integrator.evaluate(EvaluationFlags::values);
+
+      for (unsigned int q = 0; q < n_face_q_points; ++q)
+        face_normal_velocity(face, q) =
+          advective_velocity(velocity_face_integrator.get_value(q),
+                             velocity_face_integrator.quadrature_point(q)) *
+          velocity_face_integrator.normal_vector(q);
+    }
+}
+
+template <int dim, typename number>
+number
+TracerDGMatrixFreeOperator<dim, number>::get_bdf_coefficient() const
+{
+  const auto method = simulation_control->get_assembly_method();
+  if (time_stepping_is_bdf(method))
+    return simulation_control->get_bdf_coefficients()[0];
+
+  AssertThrow(
+    is_steady(method),
+    ExcMessage(
+      "The matrix-free tracer operator only supports the steady and BDF time-stepping methods."));
+
+  return 0.;
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::do_cell_integral_local(
+  FECellIntegrator  &integrator,
+  const unsigned int cell,
+  const number       bdf_coefficient) const
+{
+  for (const auto q : integrator.quadrature_point_indices())
+    {
+      const VectorizedArray<number> value    = integrator.get_value(q);
+      const auto                    gradient = integrator.get_gradient(q);
+
+      // Time derivative and correction for the non-divergence-free velocity
+      integrator.submit_value(
+        (bdf_coefficient - cell_velocity_divergence(cell, q)) * value, q);
+
+      // Diffusion and weak advection terms
+      integrator.submit_gradient(diffusivity * gradient -
+                                   cell_velocity(cell, q) * value,
+                                 q);
+    }
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::do_face_integral_local(
+  FEFaceIntegrator  &integrator_m,
+  FEFaceIntegrator  &integrator_p,
+  const unsigned int face) const
+{
+  const VectorizedArray<number> penalty = face_penalty[face];
+
+  for (const auto q : integrator_m.quadrature_point_indices())
+    {
+      const VectorizedArray<number> normal_velocity =
+        face_normal_velocity(face, q);
+      const VectorizedArray<number> value_m = integrator_m.get_value(q);
+      const VectorizedArray<number> value_p = integrator_p.get_value(q);
+
+      // Upwind value of the advective flux
+      const VectorizedArray<number> upwind_value =
+        compare_and_apply_mask<SIMDComparison::greater_than>(
+          normal_velocity, VectorizedArray<number>(0.), value_m, value_p);
+
+      // Symmetric interior penalty diffusive flux
+      const VectorizedArray<number> jump = value_m - value_p;
+      const VectorizedArray<number> average_normal_derivative =
+        number(0.5) * (integrator_m.get_normal_derivative(q) +
+                       integrator_p.get_normal_derivative(q));
+
+      const VectorizedArray<number> flux =
+        normal_velocity * upwind_value +
+        diffusivity * (penalty * jump - average_normal_derivative);
+
+      integrator_m.submit_value(flux, q);
+      integrator_p.submit_value(-flux, q);
+      integrator_m.submit_normal_derivative(-number(0.5) * diffusivity * jump,
+                                            q);
+      integrator_p.submit_normal_derivative(-number(0.5) * diffusivity * jump,
+                                            q);
+    }
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::do_boundary_face_integral_local(
+  FEFaceIntegrator  &integrator,
+  const unsigned int face) const
+{
+  // The faces of a boundary face batch share the same boundary id
+  const auto boundary_type =
+    boundary_conditions.type.find(matrix_free.get_boundary_id(face));
+  const bool is_outlet =
+    boundary_type != boundary_conditions.type.end() &&
+    boundary_type->second == BoundaryConditions::BoundaryType::outlet;
+  const bool is_dirichlet =
+    boundary_type != boundary_conditions.type.end() &&
+    boundary_type->second == BoundaryConditions::BoundaryType::tracer_dirichlet;
+
+  const VectorizedArray<number> penalty = face_penalty[face];
+
+  for (const auto q : integrator.quadrature_point_indices())
+    {
+      const VectorizedArray<number> value = integrator.get_value(q);
+      VectorizedArray<number>       value_flux(0.);
+      VectorizedArray<number>       normal_derivative_flux(0.);
+
+      // Outflow of the tracer
+      if (is_outlet || is_dirichlet)
+        value_flux += std::max(face_normal_velocity(face, q),
+                               VectorizedArray<number>(0.)) *
+                      value;
+
+      // Nitsche imposition of the Dirichlet boundary condition
+      if (is_dirichlet)
+        {
+          value_flux += diffusivity * (penalty * value -
+                                       integrator.get_normal_derivative(q));
+          normal_derivative_flux = -diffusivity * value;
+        }
+
+      integrator.submit_value(value_flux, q);
+      integrator.submit_normal_derivative(normal_derivative_flux, q);
+    }
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::local_apply_cell(
+  const MatrixFree<dim, number>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FECellIntegrator integrator(matrix_free);
+  const number     bdf_coefficient = get_bdf_coefficient();
+
+  for (unsigned int cell = range.first; cell < range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src,
+                                 EvaluationFlags::values |
+                                   EvaluationFlags::gradients);
+      do_cell_integral_local(integrator, cell, bdf_coefficient);
+      integrator.integrate_scatter(EvaluationFlags::values |
+                                     EvaluationFlags::gradients,
+                                   dst);
+    }
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::local_apply_face(
+  const MatrixFree<dim, number>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FEFaceIntegrator integrator_m(matrix_free, true);
+  FEFaceIntegrator integrator_p(matrix_free, false);
+
+  for (unsigned int face = range.first; face < range.second; ++face)
+    {
+      integrator_m.reinit(face);
+      integrator_p.reinit(face);
+      integrator_m.gather_evaluate(src,
+                                   EvaluationFlags::values |
+                                     EvaluationFlags::gradients);
+      integrator_p.gather_evaluate(src,
+                                   EvaluationFlags::values |
+                                     EvaluationFlags::gradients);
+      do_face_integral_local(integrator_m, integrator_p, face);
+      integrator_m.integrate_scatter(EvaluationFlags::values |
+                                       EvaluationFlags::gradients,
+                                     dst);
+      integrator_p.integrate_scatter(EvaluationFlags::values |
+                                       EvaluationFlags::gradients,
+                                     dst);
+    }
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::local_apply_boundary(
+  const MatrixFree<dim, number>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FEFaceIntegrator integrator(matrix_free, true);
+
+  for (unsigned int face = range.first; face < range.second; ++face)
+    {
+      integrator.reinit(face);
+      integrator.gather_evaluate(src,
+                                 EvaluationFlags::values |
+                                   EvaluationFlags::gradients);
+      do_boundary_face_integral_local(integrator, face);
+      integrator.integrate_scatter(EvaluationFlags::values |
+                                     EvaluationFlags::gradients,
+                                   dst);
+    }
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::vmult(VectorType       &dst,
+                                               const VectorType &src) const
+{
+  matrix_free.loop(&TracerDGMatrixFreeOperator::local_apply_cell,
+                   &TracerDGMatrixFreeOperator::local_apply_face,
+                   &TracerDGMatrixFreeOperator::local_apply_boundary,
+                   this,
+                   dst,
+                   src,
+                   true,
+                   MatrixFree<dim, number>::DataAccessOnFaces::gradients,
+                   MatrixFree<dim, number>::DataAccessOnFaces::gradients);
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::compute_inverse_block_diagonal()
+{
+  const unsigned int n_lanes       = VectorizedArray<number>::size();
+  const unsigned int dofs_per_cell = matrix_free.get_dofs_per_cell();
+  const unsigned int n_cells       = matrix_free.n_cell_batches() * n_lanes;
+  const number       bdf_coefficient = get_bdf_coefficient();
+
+  std::vector<FullMatrix<number>> block_diagonal(
+    n_cells, FullMatrix<number>(dofs_per_cell, dofs_per_cell));
+
+  // Set the degrees of freedom of an integrator to the j-th unit vector of
+  // the cell, or to zero
+  const auto set_unit_vector =
+    [dofs_per_cell](auto &integrator, const unsigned int j) {
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        integrator.begin_dof_values()[i] = VectorizedArray<number>(i == j);
+    };
+
+  // Add the j-th column of the block of each lane of the batch
+  const auto add_column = [&](const auto         &integrator,
+                              const unsigned int *cell_indices,
+                              const unsigned int  n_active_lanes,
+                              const unsigned int  j) {
+    for (unsigned int v = 0; v < n_active_lanes; ++v)
+      {
+        // Ghost cells have no block on this process
+        if (cell_indices[v] >= n_cells)
+          continue;
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          block_diagonal[cell_indices[v]](i, j) +=
+            integrator.begin_dof_values()[i][v];
+      }
+  };
+
+  const auto flags = EvaluationFlags::values | EvaluationFlags::gradients;
+
+  // Cell terms
+  FECellIntegrator          integrator(matrix_free);
+  std::vector<unsigned int> cell_indices(n_lanes);
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+      for (unsigned int v = 0; v < n_lanes; ++v)
+        cell_indices[v] = cell * n_lanes + v;
+
+      for (unsigned int j = 0; j < dofs_per_cell; ++j)
+        {
+          set_unit_vector(integrator, j);
+          integrator.evaluate(flags);
+          do_cell_integral_local(integrator, cell, bdf_coefficient);
+          integrator.integrate(flags);
+          add_column(integrator,
+                     cell_indices.data(),
+                     matrix_free.n_active_entries_per_cell_batch(cell),
+                     j);
+        }
+    }
+
+  // Interior face terms, the unit vector being set on one side of the face
+  // and zero on the other side
+  FEFaceIntegrator integrator_m(matrix_free, true);
+  FEFaceIntegrator integrator_p(matrix_free, false);
+  for (unsigned int face = 0; face < matrix_free.n_inner_face_batches();
+       ++face)
+    {
+      integrator_m.reinit(face);
+      integrator_p.reinit(face);
+      const auto        &face_info = matrix_free.get_face_info(face);
+      const unsigned int n_active_lanes =
+        matrix_free.n_active_entries_per_face_batch(face);
+
+      for (unsigned int j = 0; j < dofs_per_cell; ++j)
+        {
+          set_unit_vector(integrator_m, j);
+          set_unit_vector(integrator_p, numbers::invalid_unsigned_int);
+          integrator_m.evaluate(flags);
+          integrator_p.evaluate(flags);
+          do_face_integral_local(integrator_m, integrator_p, face);
+          integrator_m.integrate(flags);
+          add_column(integrator_m,
+                     face_info.cells_interior.data(),
+                     n_active_lanes,
+                     j);
+
+          set_unit_vector(integrator_m, numbers::invalid_unsigned_int);
+          set_unit_vector(integrator_p, j);
+          integrator_m.evaluate(flags);
+          integrator_p.evaluate(flags);
+          do_face_integral_local(integrator_m, integrator_p, face);
+          integrator_p.integrate(flags);
+          add_column(integrator_p,
+                     face_info.cells_exterior.data(),
+                     n_active_lanes,
+                     j);
+        }
+    }
+
+  // Boundary face terms
+  for (unsigned int face = matrix_free.n_inner_face_batches();
+       face < matrix_free.n_inner_face_batches() +
+                matrix_free.n_boundary_face_batches();
+       ++face)
+    {
+      integrator_m.reinit(face);
+      const auto        &face_info = matrix_free.get_face_info(face);
+      const unsigned int n_active_lanes =
+        matrix_free.n_active_entries_per_face_batch(face);
+
+      for (unsigned int j = 0; j < dofs_per_cell; ++j)
+        {
+          set_unit_vector(integrator_m, j);
+          integrator_m.evaluate(flags);
+          do_boundary_face_integral_local(integrator_m, face);
+          integrator_m.integrate(flags);
+          add_column(integrator_m,
+                     face_info.cells_interior.data(),
+                     n_active_lanes,
+                     j);
+        }
+    }
+
+  // Inversion of the blocks of the locally owned cells
+  inverse_block_diagonal.resize(n_cells);
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    for (unsigned int v = 0;
+         v < matrix_free.n_active_entries_per_cell_batch(cell);
+         ++v)
+      {
+        const unsigned int index = cell * n_lanes + v;
+        inverse_block_diagonal[index].reinit(dofs_per_cell, dofs_per_cell);
+        inverse_block_diagonal[index] = block_diagonal[index];
+        inverse_block_diagonal[index].gauss_jordan();
+      }
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::apply_inverse_block_diagonal(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  AssertThrow(!inverse_block_diagonal.empty(),
+              ExcMessage("The inverse of the block diagonal of the matrix-free "
+                         "DG tracer operator has not been computed."));
+
+  const unsigned int n_lanes       = VectorizedArray<number>::size();
+  const unsigned int dofs_per_cell = matrix_free.get_dofs_per_cell();
+
+  FECellIntegrator integrator(matrix_free);
+  Vector<number>   local_src(dofs_per_cell);
+  Vector<number>   local_dst(dofs_per_cell);
+
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src);
+
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++v)
+        {
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            local_src(i) = integrator.begin_dof_values()[i][v];
+
+          inverse_block_diagonal[cell * n_lanes + v].vmult(local_dst,
+                                                           local_src);
+
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            integrator.begin_dof_values()[i][v] = local_dst(i);
+        }
+
+      integrator.set_dof_values(dst);
+    }
+}
+
+template <int dim, typename number>
+types::global_dof_index
+TracerDGMatrixFreeOperator<dim, number>::m() const
+{
+  return matrix_free.get_dof_handler(0).n_dofs();
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::initialize_dof_vector(
+  VectorType &vec) const
+{
+  matrix_free.initialize_dof_vector(vec, 0);
+}
+
+template <int dim, typename number>
+void
+TracerDGMatrixFreeOperator<dim, number>::initialize_fluid_dof_vector(
+  VectorType &vec) const
+{
+  matrix_free.initialize_dof_vector(vec, 1);
+}
+
+template class TracerDGMatrixFreeOperator<2, double>;
+template class TracerDGMatrixFreeOperator<3, double>;
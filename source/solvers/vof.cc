@@ -26,7 +26,9 @@ VolumeOfFluid<dim>::VolumeOfFluid(
   : AuxiliaryPhysics<dim, GlobalVectorType>(
       p_simulation_parameters.physics_solving_strategy.at(PhysicsID::VOF))
   , multiphysics(multiphysics_interface)
-  , computing_timer(p_triangulation->get_mpi_communicator(),
+  , computing_timer(this->get_timer_communicator(
+                          p_simulation_parameters,
+                          p_triangulation->get_mpi_communicator()),
                     this->pcout,
                     TimerOutput::summary,
                     TimerOutput::wall_times)
@@ -36,6 +38,8 @@ VolumeOfFluid<dim>::VolumeOfFluid(
   , dof_handler(std::make_shared<DoFHandler<dim>>(*triangulation))
   , sharpening_threshold(simulation_parameters.multiphysics.vof_parameters
                            .regularization_method.sharpening.threshold)
+  , preconditioner_refresh_policy(
+      p_simulation_parameters.linear_solver.at(PhysicsID::VOF))
 {
   AssertThrow(
     simulation_parameters.physical_properties_manager.get_number_of_fluids() ==
@@ -1352,6 +1356,9 @@ VolumeOfFluid<dim>::finish_simulation()
         "error_phase", this->simulation_control->get_log_precision());
       this->error_table.write_text(std::cout);
     }
+
+  if (this->simulation_parameters.timer.type != Parameters::Timer::Type::none)
+    preconditioner_refresh_policy.print_total_times(this->pcout, "VOF");
 }
 
 template <int dim>
@@ -1896,6 +1903,12 @@ VolumeOfFluid<dim>::handle_interface_sharpening()
       this->pcout << "Sharpening interface at step "
                   << this->simulation_control->get_step_number() << std::endl;
     }
+
+  // The mass matrix of the projection and its preconditioner do not depend on
+  // the sharpening threshold. They are assembled once and reused for all the
+  // thresholds tested and for the sharpening of all the solutions.
+  assemble_interface_sharpening_matrix();
+
   if (this->simulation_parameters.multiphysics.vof_parameters
         .regularization_method.sharpening.type ==
       Parameters::SharpeningType::adaptive)
@@ -1961,15 +1974,41 @@ VolumeOfFluid<dim>::find_sharpening_threshold()
   double mass_deviation_avg = 0.;
   double st_avg             = 0.;
 
+  const Parameters::SharpeningSearchMethod search_method =
+    this->simulation_parameters.multiphysics.vof_parameters
+      .regularization_method.sharpening.search_method;
 
-  // Bissection algorithm to calculate an interface sharpening value that would
-  // ensure mass conservation of the monitored phase (do-while loop, see
-  // condition below)
+  // Endpoint of the bracket retained at the previous step of the search, used
+  // by the Illinois method to scale down the mass deviation of an endpoint
+  // retained twice in a row
+  enum class RetainedEndpoint : std::int8_t
+  {
+    none,
+    min,
+    max
+  };
+  RetainedEndpoint retained_endpoint = RetainedEndpoint::none;
+  const bool       use_illinois =
+    search_method == Parameters::SharpeningSearchMethod::illinois;
+
+
+  // Bracketing search (bisection or Illinois method) to calculate an interface
+  // sharpening value that would ensure mass conservation of the monitored
+  // phase (do-while loop, see condition below)
   do
     {
       nb_search_ite++;
-      // Calculate middle point value
-      st_avg = (st_min + st_max) / 2.;
+      // Calculate the tested value. The first step always tests the middle
+      // point, which is the solution in most cases. The Illinois method then
+      // uses the root of the secant through the endpoints of the bracket,
+      // scaling down the mass deviation of an endpoint retained twice in a
+      // row to avoid the one-sided convergence of the regula falsi method.
+      if (use_illinois && nb_search_ite > 1 &&
+          mass_deviation_max != mass_deviation_min)
+        st_avg = st_min - mass_deviation_min * (st_max - st_min) /
+                            (mass_deviation_max - mass_deviation_min);
+      else
+        st_avg = (st_min + st_max) / 2.;
 
       mass_deviation_avg = calculate_mass_deviation(monitored_fluid, st_avg);
 
@@ -1987,11 +2026,17 @@ VolumeOfFluid<dim>::find_sharpening_threshold()
         {
           st_max             = st_avg;
           mass_deviation_max = mass_deviation_avg;
+          if (use_illinois && retained_endpoint == RetainedEndpoint::min)
+            mass_deviation_min /= 2.;
+          retained_endpoint = RetainedEndpoint::min;
         }
       else
         {
           st_min             = st_avg;
           mass_deviation_min = mass_deviation_avg;
+          if (use_illinois && retained_endpoint == RetainedEndpoint::max)
+            mass_deviation_max /= 2.;
+          retained_endpoint = RetainedEndpoint::max;
         }
     }
   while (std::abs(mass_deviation_avg) > mass_deviation_tol &&
@@ -2482,6 +2527,9 @@ VolumeOfFluid<dim>::setup_dofs()
   this->vof_subequations_interface->setup_dofs();
 
   this->dof_handler->distribute_dofs(*this->fe);
+
+  // The structure of the matrix changes, its preconditioner must be rebuilt
+  preconditioner_refresh_policy.invalidate();
   DoFRenumbering::Cuthill_McKee(*this->dof_handler);
 
   this->locally_owned_dofs = this->dof_handler->locally_owned_dofs();
@@ -2814,6 +2862,41 @@ VolumeOfFluid<dim>::set_initial_conditions()
 }
 
 
+template <int dim>
+void
+VolumeOfFluid<dim>::setup_ilu_preconditioner()
+{
+  const unsigned int ilu_fill =
+    simulation_parameters.linear_solver.at(PhysicsID::VOF).ilu_precond_fill;
+  const double ilu_atol =
+    simulation_parameters.linear_solver.at(PhysicsID::VOF).ilu_precond_atol;
+  const double ilu_rtol =
+    simulation_parameters.linear_solver.at(PhysicsID::VOF).ilu_precond_rtol;
+  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
+    ilu_fill, ilu_atol, ilu_rtol, 0);
+
+  system_ilu_preconditioner =
+    std::make_shared<TrilinosWrappers::PreconditionILU>();
+  system_ilu_preconditioner->initialize(this->system_matrix,
+                                        preconditionerOptions);
+}
+
+template <int dim>
+void
+VolumeOfFluid<dim>::setup_lagged_preconditioner()
+{
+  TimerOutput::Scope t(this->computing_timer, "Setup lagged preconditioner");
+  setup_ilu_preconditioner();
+}
+
+template <int dim>
+void
+VolumeOfFluid<dim>::apply_lagged_preconditioner(GlobalVectorType       &dst,
+                                                const GlobalVectorType &src)
+{
+  system_ilu_preconditioner->vmult(dst, src);
+}
+
 template <int dim>
 void
 VolumeOfFluid<dim>::solve_linear_system()
@@ -2843,18 +2926,14 @@ VolumeOfFluid<dim>::solve_linear_system()
                   << linear_solver_tolerance << std::endl;
     }
 
-  const unsigned int ilu_fill =
-    simulation_parameters.linear_solver.at(PhysicsID::VOF).ilu_precond_fill;
-  const double ilu_atol =
-    simulation_parameters.linear_solver.at(PhysicsID::VOF).ilu_precond_atol;
-  const double ilu_rtol =
-    simulation_parameters.linear_solver.at(PhysicsID::VOF).ilu_precond_rtol;
-  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
-    ilu_fill, ilu_atol, ilu_rtol, 0);
-
-  TrilinosWrappers::PreconditionILU ilu_preconditioner;
-
-  ilu_preconditioner.initialize(this->system_matrix, preconditionerOptions);
+  // The preconditioner is rebuilt or reused according to the refresh policy
+  const PreconditionerRefreshPolicy::Action setup_action =
+    preconditioner_refresh_policy.get_setup_action(false);
+  Timer setup_timer;
+  if (setup_action == PreconditionerRefreshPolicy::Action::rebuild)
+    setup_ilu_preconditioner();
+  preconditioner_refresh_policy.register_setup(setup_action,
+                                               setup_timer.wall_time());
 
   GlobalVectorType completely_distributed_solution(this->locally_owned_dofs,
                                                    mpi_communicator);
@@ -2871,10 +2950,13 @@ VolumeOfFluid<dim>::solve_linear_system()
 
   TrilinosWrappers::SolverGMRES solver(solver_control, solver_parameters);
 
+  Timer solve_timer;
   solver.solve(this->system_matrix,
                completely_distributed_solution,
                this->system_rhs,
-               ilu_preconditioner);
+               *system_ilu_preconditioner);
+  preconditioner_refresh_policy.register_solve(solver_control.last_step(),
+                                               solve_timer.wall_time());
 
   if (simulation_parameters.linear_solver.at(PhysicsID::VOF).verbosity !=
       Parameters::Verbosity::quiet)
@@ -2882,6 +2964,7 @@ VolumeOfFluid<dim>::solve_linear_system()
       this->pcout << "  -Iterative solver took : " << solver_control.last_step()
                   << " steps to reach a residual norm of "
                   << solver_control.last_value() / rescale_metric << std::endl;
+      preconditioner_refresh_policy.print_statistics(this->pcout);
     }
 
   // Update constraints and newton vectors
@@ -2964,6 +3047,68 @@ VolumeOfFluid<dim>::update_solution_and_constraints(GlobalVectorType &solution)
 }
 
 
+template <int dim>
+void
+VolumeOfFluid<dim>::assemble_interface_sharpening_matrix()
+{
+  FEValues<dim> fe_values_vof(*this->mapping,
+                              *this->fe,
+                              *this->cell_quadrature,
+                              update_values | update_JxW_values);
+
+  const unsigned int dofs_per_cell = this->fe->dofs_per_cell;
+  const unsigned int n_q_points    = this->cell_quadrature->size();
+  FullMatrix<double> local_matrix_phase_fraction(dofs_per_cell, dofs_per_cell);
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+
+  system_matrix_phase_fraction = 0;
+
+  for (const auto &cell : this->dof_handler->active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values_vof.reinit(cell);
+
+          local_matrix_phase_fraction = 0;
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              for (unsigned int j = 0; j < dofs_per_cell; ++j)
+                local_matrix_phase_fraction(i, j) +=
+                  fe_values_vof.shape_value(j, q) *
+                  fe_values_vof.shape_value(i, q) * fe_values_vof.JxW(q);
+
+          cell->get_dof_indices(local_dof_indices);
+          this->nonzero_constraints.distribute_local_to_global(
+            local_matrix_phase_fraction,
+            local_dof_indices,
+            system_matrix_phase_fraction);
+        }
+    }
+
+  system_matrix_phase_fraction.compress(VectorOperation::add);
+
+  // The preconditioner is built once and reused for all the projections
+  // carried out with this matrix
+  const unsigned int ilu_fill =
+    this->simulation_parameters.linear_solver.at(PhysicsID::VOF)
+      .ilu_precond_fill;
+  const double ilu_atol =
+    this->simulation_parameters.linear_solver.at(PhysicsID::VOF)
+      .ilu_precond_atol;
+  const double ilu_rtol =
+    this->simulation_parameters.linear_solver.at(PhysicsID::VOF)
+      .ilu_precond_rtol;
+
+  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
+    ilu_fill, ilu_atol, ilu_rtol, 0);
+
+  interface_sharpening_preconditioner =
+    std::make_shared<TrilinosWrappers::PreconditionILU>();
+  interface_sharpening_preconditioner->initialize(system_matrix_phase_fraction,
+                                                  preconditionerOptions);
+}
+
 template <int dim>
 void
 VolumeOfFluid<dim>::assemble_L2_projection_interface_sharpening(
@@ -2988,8 +3133,18 @@ VolumeOfFluid<dim>::assemble_L2_projection_interface_sharpening(
 
   std::vector<double> phase_values(n_q_points);
 
-  system_rhs_phase_fraction    = 0;
-  system_matrix_phase_fraction = 0;
+  // The local mass matrix is only required to account for the inhomogeneous
+  // constraints in the right-hand side
+  const bool has_inhomogeneities =
+    this->nonzero_constraints.has_inhomogeneities();
+
+  // Constant factors of the sharpening function
+  const double lower_branch_factor =
+    std::pow(sharpening_threshold, (1. - interface_sharpness));
+  const double upper_branch_factor =
+    std::pow((1. - sharpening_threshold), (1. - interface_sharpness));
+
+  system_rhs_phase_fraction = 0;
 
   for (const auto &cell : this->dof_handler->active_cell_iterators())
     {
@@ -3005,55 +3160,48 @@ VolumeOfFluid<dim>::assemble_L2_projection_interface_sharpening(
           for (unsigned int q = 0; q < n_q_points; ++q)
             {
               auto phase_value = phase_values[q];
-              // phase_value      = std::min(std::max(phase_value, 0.), 1.);
 
               for (unsigned int k = 0; k < dofs_per_cell; ++k)
                 {
                   phi_phase[k] = fe_values_vof.shape_value(k, q);
                 }
+
+              // $$ (if 0 <= \phi <= c)  {\Phi = c ^ (1 - \alpha) * (\phi
+              // ^ \alpha)}$$
+              // $$ (if c <  \phi <= 1)  {\Phi = 1 - (1 - c) ^ (1 -
+              // \alpha)
+              // * (1 - \phi) ^ \alpha}
+              const double sharpened_phase_value =
+                (phase_value >= 0 && phase_value <= sharpening_threshold) ?
+                  lower_branch_factor *
+                    std::pow(phase_value, interface_sharpness) :
+                  1 - upper_branch_factor *
+                        std::pow((1. - phase_value), interface_sharpness);
+
               for (unsigned int i = 0; i < dofs_per_cell; ++i)
                 {
-                  // Matrix assembly
-                  for (unsigned int j = 0; j < dofs_per_cell; ++j)
-                    {
-                      local_matrix_phase_fraction(i, j) +=
-                        (phi_phase[j] * phi_phase[i]) * fe_values_vof.JxW(q);
-                    }
-
-                  // $$ (if 0 <= \phi <= c)  {\Phi = c ^ (1 - \alpha) * (\phi
-                  // ^ \alpha)}$$
-                  // $$ (if c <  \phi <= 1)  {\Phi = 1 - (1 - c) ^ (1 -
-                  // \alpha)
-                  // * (1 - \phi) ^ \alpha}
-                  if (phase_value >= 0 && phase_value <= sharpening_threshold)
-                    local_rhs_phase_fraction(i) +=
-                      std::pow(sharpening_threshold,
-                               (1. - interface_sharpness)) *
-                      std::pow(phase_value, interface_sharpness) *
-                      phi_phase[i] * fe_values_vof.JxW(q);
-                  else
-                    {
-                      local_rhs_phase_fraction(i) +=
-                        (1 -
-                         std::pow((1. - sharpening_threshold),
-                                  (1. - interface_sharpness)) *
-                           std::pow((1. - phase_value), interface_sharpness)) *
-                        phi_phase[i] * fe_values_vof.JxW(q);
-                    }
+                  if (has_inhomogeneities)
+                    for (unsigned int j = 0; j < dofs_per_cell; ++j)
+                      {
+                        local_matrix_phase_fraction(i, j) +=
+                          (phi_phase[j] * phi_phase[i]) * fe_values_vof.JxW(q);
+                      }
+
+                  local_rhs_phase_fraction(i) += sharpened_phase_value *
+                                                 phi_phase[i] *
+                                                 fe_values_vof.JxW(q);
                 }
             }
 
           cell->get_dof_indices(local_dof_indices);
           this->nonzero_constraints.distribute_local_to_global(
-            local_matrix_phase_fraction,
             local_rhs_phase_fraction,
             local_dof_indices,
-            system_matrix_phase_fraction,
-            system_rhs_phase_fraction);
+            system_rhs_phase_fraction,
+            local_matrix_phase_fraction);
         }
     }
 
-  system_matrix_phase_fraction.compress(VectorOperation::add);
   system_rhs_phase_fraction.compress(VectorOperation::add);
 }
 
@@ -3084,32 +3232,10 @@ VolumeOfFluid<dim>::solve_interface_sharpening(GlobalVectorType &solution)
 
   TrilinosWrappers::SolverCG solver(solver_control);
 
-  //**********************************************
-  // Trillinos Wrapper ILU Preconditioner
-  //*********************************************
-  const unsigned int ilu_fill =
-    this->simulation_parameters.linear_solver.at(PhysicsID::VOF)
-      .ilu_precond_fill;
-  const double ilu_atol =
-    this->simulation_parameters.linear_solver.at(PhysicsID::VOF)
-      .ilu_precond_atol;
-  const double ilu_rtol =
-    this->simulation_parameters.linear_solver.at(PhysicsID::VOF)
-      .ilu_precond_rtol;
-
-  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
-    ilu_fill, ilu_atol, ilu_rtol, 0);
-
-  std::shared_ptr<TrilinosWrappers::PreconditionILU> ilu_preconditioner =
-    std::make_shared<TrilinosWrappers::PreconditionILU>();
-
-  ilu_preconditioner->initialize(system_matrix_phase_fraction,
-                                 preconditionerOptions);
-
   solver.solve(system_matrix_phase_fraction,
                completely_distributed_phase_fraction_solution,
                system_rhs_phase_fraction,
-               *ilu_preconditioner);
+               *interface_sharpening_preconditioner);
 
   if (this->simulation_parameters.multiphysics.vof_parameters
         .regularization_method.verbosity ==
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief This code tests the concurrent execution of tasks whose output is
+ * written to the standard output. The tasks finish in the reverse order of
+ * their launch, but their output must be written in the order of the tasks
+ * and without being interleaved. The test also checks that an exception
+ * thrown by a task is propagated to the caller and that the concurrent
+ * execution is not supported when a single thread is available.
+ */
+
+// Deal.II includes
+#include <deal.II/base/multithread_info.h>
+
+// Lethe
+#include <core/concurrent_tasks.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+void
+test()
+{
+  MultithreadInfo::set_thread_limit(1);
+  deallog << "Supported with one thread: "
+          << concurrent_tasks_are_supported(MPI_COMM_WORLD) << std::endl;
+
+  MultithreadInfo::set_thread_limit(4);
+
+  const unsigned int                 n_tasks = 4;
+  std::vector<std::function<void()>> tasks;
+  for (unsigned int i = 0; i < n_tasks; ++i)
+    tasks.emplace_back([i]() {
+      for (unsigned int line = 0; line < 3; ++line)
+        {
+          std::cout << "Task " << i << " line " << line << std::endl;
+          std::this_thread::sleep_for(
+            std::chrono::milliseconds(10 * (n_tasks - i)));
+        }
+    });
+
+  std::ostringstream        output;
+  const std::vector<double> wall_times =
+    run_tasks_with_ordered_output(tasks, output);
+
+  std::istringstream output_lines(output.str());
+  std::string        line;
+  while (std::getline(output_lines, line))
+    deallog << line << std::endl;
+  deallog << "Number of wall times: " << wall_times.size() << std::endl;
+
+  bool all_times_are_positive = true;
+  for (const double wall_time : wall_times)
+    all_times_are_positive = all_times_are_positive && wall_time > 0.;
+  deallog << "All wall times are positive: " << all_times_are_positive
+          << std::endl;
+
+  tasks.emplace_back([]() { throw std::runtime_error("Task failure"); });
+  try
+    {
+      run_tasks_with_ordered_output(tasks, output);
+      deallog << "The exception of the task was not propagated" << std::endl;
+    }
+  catch (const std::runtime_error &exc)
+    {
+      deallog << "Caught: " << exc.what() << std::endl;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -95,6 +95,19 @@ public:
     newton_update = system_rhs;
   }
 
+  /**
+   * @brief apply_lagged_preconditioner
+   *
+   * Apply the inverse of the lagged jacobian matrix using its LU factorization
+   */
+  void
+  apply_lagged_preconditioner(Vector<double>       &dst,
+                              const Vector<double> &src) override
+  {
+    dst = src;
+    system_matrix.solve(dst);
+  }
+
   virtual void
   apply_constraints() override
   {}
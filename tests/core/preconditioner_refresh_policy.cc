@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief This code tests the decisions of the adaptive preconditioner refresh
+ * policy for a prescribed sequence of numbers of linear solver iterations.
+ */
+
+// Lethe
+#include <core/parameters.h>
+#include <core/preconditioner_refresh_policy.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+std::string
+action_name(const PreconditionerRefreshPolicy::Action action)
+{
+  switch (action)
+    {
+      case PreconditionerRefreshPolicy::Action::rebuild:
+        return "rebuild";
+      case PreconditionerRefreshPolicy::Action::refresh:
+        return "refresh";
+      case PreconditionerRefreshPolicy::Action::reuse:
+        return "reuse";
+    }
+  return "";
+}
+
+void
+test()
+{
+  // Sequence of numbers of iterations returned by the linear solver
+  const std::vector<unsigned int> iterations = {10, 14, 20, 18, 12};
+
+  PreconditionerRefreshPolicy always_policy(
+    Parameters::LinearSolver::PreconditionerRefreshType::always, 1.5);
+  PreconditionerRefreshPolicy adaptive_policy(
+    Parameters::LinearSolver::PreconditionerRefreshType::adaptive, 1.5);
+
+  for (const auto n_iterations : iterations)
+    {
+      const auto always_action   = always_policy.get_setup_action(true);
+      const auto adaptive_action = adaptive_policy.get_setup_action(true);
+      deallog << "Always : " << action_name(always_action)
+              << " - Adaptive : " << action_name(adaptive_action)
+              << " - Iterations : " << n_iterations << std::endl;
+
+      always_policy.register_setup(always_action, 0.);
+      always_policy.register_solve(n_iterations, 0.);
+      adaptive_policy.register_setup(adaptive_action, 0.);
+      adaptive_policy.register_solve(n_iterations, 0.);
+    }
+
+  // A preconditioner without numerical refresh is rebuilt instead
+  adaptive_policy.register_solve(20, 0.);
+  deallog << "Adaptive without refresh : "
+          << action_name(adaptive_policy.get_setup_action(false)) << std::endl;
+
+  // A change of the degrees of freedom forces a rebuild
+  adaptive_policy.invalidate();
+  deallog << "Adaptive after invalidation : "
+          << action_name(adaptive_policy.get_setup_action(true)) << std::endl;
+
+  deallog << "Always rebuilds : " << always_policy.get_n_rebuilds()
+          << " refreshes : " << always_policy.get_n_refreshes()
+          << " reuses : " << always_policy.get_n_reuses() << std::endl;
+  deallog << "Adaptive rebuilds : " << adaptive_policy.get_n_rebuilds()
+          << " refreshes : " << adaptive_policy.get_n_refreshes()
+          << " reuses : " << adaptive_policy.get_n_reuses() << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief This test checks that the SubSimulationControlMultiRateDEM only
+ * calculates the contacts between coarse particles every time step ratio
+ * iterations, including over several CFD time steps whose number of DEM
+ * iterations is not a multiple of the time step ratio.
+ */
+
+
+// Lethe
+#include <core/sub_simulation_control.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  // Three CFD time steps of five DEM iterations each with a time step ratio of
+  // four. The contacts between coarse particles are calculated at the DEM
+  // iterations 0, 4, 8 and 12.
+  SubSimulationControlMultiRateDEM multi_rate_control(4, 0.001);
+
+  deallog << "Coarse diameter threshold: "
+          << multi_rate_control.get_coarse_diameter_threshold() << std::endl;
+
+  for (unsigned int cfd_step = 0; cfd_step < 3; ++cfd_step)
+    {
+      SubSimulationControlDEM dem_iterations(
+        SubSimulationControlDEM::DEMSubIterationLogic::
+          fixed_number_of_iterations,
+        0.1,
+        5,
+        1,
+        1);
+
+      deallog << "CFD time step " << cfd_step << std::endl;
+      while (dem_iterations.iterate())
+        {
+          deallog << "Iteration: " << dem_iterations.get_iteration()
+                  << " Coarse pair time step ratio: "
+                  << multi_rate_control.get_coarse_pair_time_step_ratio()
+                  << std::endl;
+          multi_rate_control.iterate();
+        }
+    }
+}
+
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief This code tests the error estimates of the time steps and the PI
+ * control of the time step used by the error-controlled time stepping.
+ */
+
+// Deal.II
+#include <deal.II/lac/vector.h>
+
+// Lethe
+#include <core/parameters.h>
+#include <core/time_step_error_controller.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  using Method = Parameters::SimulationControl::TimeSteppingMethod;
+
+  Parameters::SimulationControl param;
+  param.error_absolute_tolerance     = 1e-4;
+  param.error_relative_tolerance     = 1e-3;
+  param.adaptative_time_step_scaling = 1.5;
+
+  TimeStepErrorController controller(param);
+
+  // Extrapolation coefficients with uniform and variable time steps
+  const std::vector<double> uniform_time_steps  = {0.1, 0.1, 0.1, 0.1};
+  const std::vector<double> variable_time_steps = {1., 0.5, 0.5, 0.5};
+  for (unsigned int n_solutions = 2; n_solutions <= 3; ++n_solutions)
+    {
+      deallog << "Uniform extrapolation with " << n_solutions
+              << " solutions :";
+      for (const double coefficient :
+           TimeStepErrorController::extrapolation_coefficients(
+             uniform_time_steps, n_solutions))
+        deallog << " " << coefficient;
+      deallog << std::endl;
+    }
+  deallog << "Variable extrapolation with 2 solutions :";
+  for (const double coefficient :
+       TimeStepErrorController::extrapolation_coefficients(variable_time_steps,
+                                                           2))
+    deallog << " " << coefficient;
+  deallog << std::endl;
+
+  // Embedded methods of the SDIRK methods
+  for (const auto method : {Method::sdirk22, Method::sdirk33})
+    {
+      deallog << "Embedded weights :";
+      for (const double weight :
+           TimeStepErrorController::embedded_sdirk_weights(method))
+        deallog << " " << weight;
+      deallog << std::endl;
+    }
+
+  // Error of BDF1 for a solution that is quadratic in time, u = t^2 * x
+  Vector<double> direction(4);
+  for (unsigned int i = 0; i < direction.size(); ++i)
+    direction[i] = i + 1.;
+
+  std::vector<Vector<double>> solutions(3, direction);
+  solutions[0] *= 1.;
+  solutions[1] *= 0.81;
+  solutions[2] *= 0.64;
+  Vector<double> error(4), tmp(4);
+
+  const double bdf_error =
+    controller.estimate_bdf_error(solutions[0],
+                                  {&solutions[1], &solutions[2]},
+                                  uniform_time_steps,
+                                  error,
+                                  tmp);
+  deallog << "BDF1 normalized error : " << bdf_error << std::endl;
+
+  // PI control of the time step
+  const unsigned int order =
+    TimeStepErrorController::get_error_estimate_order(Method::bdf2);
+  deallog << "Factor without error : "
+          << controller.compute_time_step_factor(order) << std::endl;
+  controller.register_accepted_error(0.5);
+  deallog << "Factor with one error : "
+          << controller.compute_time_step_factor(order) << std::endl;
+  controller.register_accepted_error(0.3);
+  deallog << "Factor with two errors : "
+          << controller.compute_time_step_factor(order) << std::endl;
+  controller.register_accepted_error(0.01);
+  deallog << "Factor with small errors : "
+          << controller.compute_time_step_factor(order) << std::endl;
+  deallog << "Rejection factor : "
+          << controller.compute_rejection_factor(8., order) << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
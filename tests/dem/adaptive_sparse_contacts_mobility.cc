@@ -0,0 +1,339 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief Test that the mobility status of the adaptive sparse contacts,
+ * identified with per-cell flags, matches the node-based identification
+ * previously used. The domain is periodic in x and holds a bed of particles
+ * covered by empty cells, with an empty cell inside the bed and agitated
+ * cells, one of them being next to the periodic boundary. The reference
+ * node-based identification is done on a serial copy of the mesh, such that
+ * the output does not depend on the number of processes.
+ */
+
+// Deal.II includes
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+
+// Lethe
+#include <core/dem_properties.h>
+
+#include <dem/adaptive_sparse_contacts.h>
+#include <dem/dem_action_manager.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+using PropertiesIndex = DEM::DEMProperties::PropertiesIndex;
+using ASC             = AdaptiveSparseContacts<2, PropertiesIndex>;
+
+// Number of unit cells of the mesh in x and y
+const unsigned int n_cells_x = 16;
+const unsigned int n_cells_y = 8;
+
+/**
+ * @brief Return the coordinates of the unit cell of the mesh containing a
+ * point.
+ */
+std::pair<int, int>
+cell_coordinates(const Point<2> &point)
+{
+  return {static_cast<int>(std::floor(point[0])),
+          static_cast<int>(std::floor(point[1]))};
+}
+
+/**
+ * @brief Return whether a cell of the mesh contains no particle: the two top
+ * rows of cells and one cell inside the bed.
+ */
+bool
+cell_is_empty(const std::pair<int, int> &cell)
+{
+  return cell.second >= 6 || cell == std::make_pair(10, 1);
+}
+
+/**
+ * @brief Return whether the particles of a cell have opposite velocities.
+ * Cell (15, 2) is next to the periodic boundary x = 16 / x = 0.
+ */
+bool
+cell_is_agitated(const std::pair<int, int> &cell)
+{
+  return cell == std::make_pair(3, 1) || cell == std::make_pair(15, 2);
+}
+
+void
+create_mesh(Triangulation<2> &triangulation)
+{
+  GridGenerator::subdivided_hyper_rectangle(triangulation,
+                                            {n_cells_x, n_cells_y},
+                                            Point<2>(0, 0),
+                                            Point<2>(n_cells_x, n_cells_y),
+                                            true);
+
+  std::vector<GridTools::PeriodicFacePair<Triangulation<2>::cell_iterator>>
+    periodicity_vector;
+  GridTools::collect_periodic_faces(triangulation, 0, 1, 0, periodicity_vector);
+  triangulation.add_periodicity(periodicity_vector);
+}
+
+/**
+ * @brief Identify the mobility status with the node-based algorithm used
+ * before the per-cell flags: the status is stored at the nodes, the status of
+ * a node being the highest status assigned by the cells sharing it or sharing
+ * its periodic node, and each step reads the status of the nodes of a cell.
+ *
+ * @return Mobility status of each cell by cell coordinates.
+ */
+std::map<std::pair<int, int>, unsigned int>
+node_based_mobility_status(const bool advect_particles)
+{
+  Triangulation<2> triangulation;
+  create_mesh(triangulation);
+
+  const FE_Q<2> fe(1);
+  DoFHandler<2> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_periodicity_constraints(dof_handler, 0, 1, 0, constraints);
+  constraints.close();
+
+  std::map<types::global_dof_index, types::global_dof_index> periodic_nodes;
+  for (types::global_dof_index i = 0; i < dof_handler.n_dofs(); ++i)
+    for (types::global_dof_index j = 0; j < dof_handler.n_dofs(); ++j)
+      if (constraints.are_identity_constrained(i, j))
+        periodic_nodes.insert({i, j});
+
+  const unsigned int inactive_status =
+    advect_particles ? ASC::advected : ASC::inactive;
+  const unsigned int active_status =
+    advect_particles ? ASC::advected_active : ASC::static_active;
+
+  std::vector<unsigned int> node_status(dof_handler.n_dofs(), ASC::inactive);
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+
+  const auto assign_node_status = [&](const DoFHandler<2>::cell_iterator &cell,
+                                      const unsigned int status) {
+    cell->get_dof_indices(dof_indices);
+    for (const auto node : dof_indices)
+      {
+        node_status[node] = std::max(status, node_status[node]);
+        const auto periodic_node = periodic_nodes.find(node);
+        if (periodic_node != periodic_nodes.end())
+          node_status[periodic_node->second] =
+            std::max(node_status[node], node_status[periodic_node->second]);
+      }
+  };
+  const auto has_node_status = [&](const DoFHandler<2>::cell_iterator &cell,
+                                   const unsigned int status) {
+    cell->get_dof_indices(dof_indices);
+    for (const auto node : dof_indices)
+      if (node_status[node] == status)
+        return true;
+    return false;
+  };
+
+  std::map<std::pair<int, int>, unsigned int> cell_status;
+  std::vector<DoFHandler<2>::active_cell_iterator> remaining_cells;
+
+  // Empty cells
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (cell_is_empty(cell_coordinates(cell->center())))
+        {
+          cell_status[cell_coordinates(cell->center())] = ASC::inactive;
+          assign_node_status(cell, ASC::empty);
+        }
+      else
+        remaining_cells.push_back(cell);
+    }
+
+  // Cells mobile by criteria, then cells mobile by neighbor and active cells
+  std::vector<DoFHandler<2>::active_cell_iterator> next_cells;
+  for (const auto &cell : remaining_cells)
+    {
+      if (cell_is_agitated(cell_coordinates(cell->center())) ||
+          has_node_status(cell, ASC::empty))
+        {
+          cell_status[cell_coordinates(cell->center())] = ASC::mobile;
+          assign_node_status(cell, ASC::mobile);
+        }
+      else
+        next_cells.push_back(cell);
+    }
+  remaining_cells.swap(next_cells);
+  next_cells.clear();
+
+  for (const auto &cell : remaining_cells)
+    {
+      if (has_node_status(cell, ASC::mobile))
+        {
+          cell_status[cell_coordinates(cell->center())] = ASC::mobile;
+          assign_node_status(cell, active_status);
+        }
+      else
+        next_cells.push_back(cell);
+    }
+
+  for (const auto &cell : next_cells)
+    cell_status[cell_coordinates(cell->center())] =
+      has_node_status(cell, active_status) ? active_status : inactive_status;
+
+  return cell_status;
+}
+
+void
+test()
+{
+  MPI_Comm communicator = MPI_COMM_WORLD;
+
+  parallel::distributed::Triangulation<2> triangulation(communicator);
+  create_mesh(triangulation);
+
+  const MappingQ<2>             mapping(1);
+  Particles::ParticleHandler<2> particle_handler(triangulation,
+                                                 mapping,
+                                                 PropertiesIndex::n_properties);
+
+  // Two particles in each non-empty locally owned cell, at rest or with
+  // opposite velocities. Their solid fraction is 0.318.
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      const std::pair<int, int> coordinates = cell_coordinates(cell->center());
+      if (!cell->is_locally_owned() || cell_is_empty(coordinates))
+        continue;
+
+      for (unsigned int p = 0; p < 2; ++p)
+        {
+          const Point<2> reference_location(0.3 + 0.4 * p, 0.5);
+          const Point<2> location(coordinates.first + reference_location[0],
+                                  coordinates.second + reference_location[1]);
+
+          const types::particle_index id =
+            2 * (coordinates.second * n_cells_x + coordinates.first) + p;
+
+          Particles::Particle<2> particle(location, reference_location, id);
+          auto pit = particle_handler.insert_particle(particle, cell);
+
+          for (unsigned int i = 0; i < PropertiesIndex::n_properties; ++i)
+            pit->get_properties()[i] = 0.;
+          pit->get_properties()[PropertiesIndex::dp]   = 0.45;
+          pit->get_properties()[PropertiesIndex::mass] = 1.;
+          if (cell_is_agitated(coordinates))
+            pit->get_properties()[PropertiesIndex::v_x] = (p == 0) ? 1. : -1.;
+        }
+    }
+  particle_handler.update_cached_numbers();
+  particle_handler.exchange_ghost_particles();
+
+  // Background DoFHandler and periodic nodes as in the DEM solver
+  const FE_Q<2> background_fe(1);
+  DoFHandler<2> background_dh(triangulation);
+  background_dh.distribute_dofs(background_fe);
+
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(background_dh);
+  AffineConstraints<double> background_constraints;
+  background_constraints.reinit(background_dh.locally_owned_dofs(),
+                                locally_relevant_dofs);
+  DoFTools::make_periodicity_constraints(
+    background_dh, 0, 1, 0, background_constraints);
+  background_constraints.close();
+
+  ASC sparse_contacts;
+  for (const bool advect_particles : {false, true})
+    {
+      deallog << "Advection of particles: " << advect_particles << std::endl;
+
+      sparse_contacts.set_parameters(1e-4, 0.2, advect_particles);
+      sparse_contacts.map_periodic_nodes(background_constraints);
+      sparse_contacts.update_local_and_ghost_cell_set(background_dh);
+      DEMActionManager::get_action_manager()->reset_triggers();
+      sparse_contacts.identify_mobility_status(background_dh,
+                                               particle_handler,
+                                               communicator);
+
+      const auto reference_status =
+        node_based_mobility_status(advect_particles);
+
+      // Compare the status of the locally owned cells and count them by status
+      unsigned int              n_mismatches = 0;
+      std::vector<unsigned int> n_cells_by_status(ASC::empty + 1, 0);
+      for (const auto &cell : background_dh.active_cell_iterators())
+        {
+          if (!cell->is_locally_owned())
+            continue;
+
+          const unsigned int status = sparse_contacts.check_cell_mobility(cell);
+          if (status != reference_status.at(cell_coordinates(cell->center())))
+            ++n_mismatches;
+          ++n_cells_by_status[status];
+        }
+
+      n_mismatches = Utilities::MPI::sum(n_mismatches, communicator);
+      for (unsigned int status = 0; status < n_cells_by_status.size(); ++status)
+        deallog << "Cells with status " << status << ": "
+                << Utilities::MPI::sum(n_cells_by_status[status], communicator)
+                << std::endl;
+      deallog << "Cells differing from the node-based status: " << n_mismatches
+              << std::endl;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      mpi_initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
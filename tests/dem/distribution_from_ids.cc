@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief Sampling the diameters of particles from their ids with a normal
+ * distribution. The ids are first sampled at once, then split between two
+ * samplings in a different order, as two processes would do. The diameter of
+ * each particle must not depend on the sampling, and the mean and the standard
+ * deviation of the diameters must follow the distribution.
+ */
+
+// Lethe
+#include <dem/distributions.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+void
+test()
+{
+  const double       mu          = 0.005;
+  const double       sigma       = 0.0005;
+  const unsigned int seed        = 19;
+  const unsigned int n_particles = 1000;
+
+  NormalDistribution distribution(
+    mu, sigma, 10, -1., -1., DistributionWeightingType::number_based);
+
+  // Sampling of all the particles at once
+  std::vector<types::particle_index> all_ids(n_particles);
+  for (unsigned int i = 0; i < n_particles; ++i)
+    all_ids[i] = i;
+  distribution.particle_size_sampling_from_ids(seed, all_ids);
+  const std::vector<double> all_diameters = distribution.particle_sizes;
+
+  // Sampling of the odd ids in reverse order, then of the even ids
+  std::vector<types::particle_index> odd_ids, even_ids;
+  for (unsigned int i = n_particles; i-- > 0;)
+    if (i % 2 == 1)
+      odd_ids.push_back(i);
+  for (unsigned int i = 0; i < n_particles; i += 2)
+    even_ids.push_back(i);
+
+  bool same_diameters = true;
+  distribution.particle_size_sampling_from_ids(seed, odd_ids);
+  for (unsigned int i = 0; i < odd_ids.size(); ++i)
+    same_diameters = same_diameters && distribution.particle_sizes[i] ==
+                                         all_diameters[odd_ids[i]];
+  distribution.particle_size_sampling_from_ids(seed, even_ids);
+  for (unsigned int i = 0; i < even_ids.size(); ++i)
+    same_diameters = same_diameters && distribution.particle_sizes[i] ==
+                                         all_diameters[even_ids[i]];
+
+  // Statistics of the diameters
+  bool   diameters_in_cutoffs = true;
+  double sum_dp               = 0.;
+  for (const double dp : all_diameters)
+    {
+      diameters_in_cutoffs = diameters_in_cutoffs &&
+                             dp >= distribution.find_min_diameter() &&
+                             dp <= distribution.find_max_diameter();
+      sum_dp += dp;
+    }
+  const double mean_dp  = sum_dp / n_particles;
+  double       variance = 0.;
+  for (const double dp : all_diameters)
+    variance += std::pow(dp - mean_dp, 2);
+  const double sigma_dp = std::sqrt(variance / n_particles);
+
+  // A different seed gives different diameters
+  distribution.particle_size_sampling_from_ids(seed + 1, all_ids);
+  const bool seed_changes_diameters =
+    distribution.particle_sizes != all_diameters;
+
+  // Output
+  deallog << "The diameters do not depend on the sampled ids: "
+          << (same_diameters ? "true" : "false") << std::endl;
+  deallog << "The diameters are within the cutoffs: "
+          << (diameters_in_cutoffs ? "true" : "false") << std::endl;
+  deallog << "The mean of the diameters is within 1% of the distribution "
+             "mean: "
+          << (std::abs(mean_dp - mu) < 0.01 * mu ? "true" : "false")
+          << std::endl;
+  deallog << "The standard deviation of the diameters is within 10% of the "
+             "distribution standard deviation: "
+          << (std::abs(sigma_dp - sigma) < 0.1 * sigma ? "true" : "false")
+          << std::endl;
+  deallog << "The diameters depend on the seed: "
+          << (seed_changes_diameters ? "true" : "false") << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
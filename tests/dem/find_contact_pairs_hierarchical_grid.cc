@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief A large particle and three small particles are inserted manually in
+ * the x direction. We check that the hierarchical grid broad search and the
+ * fine search only pair the particles closer than the neighborhood threshold
+ * times their mean diameter, whereas a neighborhood sized by the large
+ * particle would pair all the particles together.
+ */
+
+#include <../tests/dem/test_particles_functions.h>
+#include <dem/adaptive_sparse_contacts.h>
+#include <dem/dem_contact_manager.h>
+
+#include <algorithm>
+
+template <int dim, typename PropertiesIndex>
+void
+test()
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(triangulation,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  triangulation.refine_global(refinement_number);
+  MappingQ<dim> mapping(1);
+
+  const double neighborhood_threshold = 1.3;
+  const double large_diameter         = 0.8;
+  const double small_diameter         = 0.1;
+
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, PropertiesIndex::n_properties);
+
+  DEMContactManager<dim, PropertiesIndex> contact_manager;
+  contact_manager.set_broad_search_parameters(
+    Parameters::Lagrangian::ModelParameters<dim>::BroadSearchMethod::
+      hierarchical_grid,
+    neighborhood_threshold,
+    large_diameter,
+    Parameters::Verbosity::quiet,
+    MPI_COMM_WORLD);
+
+  typename dem_data_structures<dim>::periodic_boundaries_cells_info
+    dummy_pbc_info;
+  contact_manager.execute_cell_neighbors_search(triangulation, dummy_pbc_info);
+
+  // Particle 0 is large and particles 1 to 3 are small. Only the pairs 0-1
+  // (distance 0.5 < 1.3 * 0.45) and 2-3 (distance 0.08 < 1.3 * 0.1) are
+  // within the neighborhood of their particles.
+  std::vector<Point<3>> positions = {Point<3>(-0.5, 0, 0),
+                                     Point<3>(0, 0, 0),
+                                     Point<3>(0.3, 0, 0),
+                                     Point<3>(0.38, 0, 0)};
+  std::vector<double>   diameters = {large_diameter,
+                                     small_diameter,
+                                     small_diameter,
+                                     small_diameter};
+
+  for (unsigned int id = 0; id < positions.size(); ++id)
+    {
+      Particles::ParticleIterator<dim> pit = construct_particle_iterator<dim>(
+        particle_handler, triangulation, positions[id], id);
+      Tensor<1, dim> v, omega;
+      set_particle_properties<dim, PropertiesIndex>(
+        pit, 0, diameters[id], 1., v, omega);
+    }
+
+  particle_handler.sort_particles_into_subdomains_and_cells();
+  contact_manager.update_local_particles_in_cells(particle_handler);
+
+  // Dummy Adaptive sparse contacts object and particle-particle broad search
+  AdaptiveSparseContacts<dim, PropertiesIndex> dummy_adaptive_sparse_contacts;
+  contact_manager.execute_particle_particle_broad_search(
+    particle_handler, dummy_adaptive_sparse_contacts);
+
+  // Output the candidates sorted by particle ids since their order depends on
+  // the order of the particles in the bins
+  std::vector<std::pair<unsigned int, unsigned int>> pairs;
+  for (const auto &[particle_id, candidates] :
+       contact_manager.get_local_contact_pair_candidates())
+    for (const auto &candidate_id : candidates)
+      pairs.emplace_back(std::min<unsigned int>(particle_id, candidate_id),
+                         std::max<unsigned int>(particle_id, candidate_id));
+  std::sort(pairs.begin(), pairs.end());
+
+  deallog << "Number of candidate pairs: " << pairs.size() << std::endl;
+  for (const auto &[first_id, second_id] : pairs)
+    deallog << "A pair is detected: particle " << first_id << " and particle "
+            << second_id << std::endl;
+
+  // The fine search uses the same neighborhood for each pair, the threshold
+  // given as argument being ignored
+  contact_manager.execute_particle_particle_fine_search(
+    Utilities::fixed_power<2>(neighborhood_threshold * large_diameter));
+
+  unsigned int n_adjacent_pairs = 0;
+  for (const auto &[particle_id, adjacent_particles] :
+       contact_manager.get_local_adjacent_particles())
+    n_adjacent_pairs += adjacent_particles.size();
+  deallog << "Number of adjacent pairs: " << n_adjacent_pairs << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      initlog();
+      test<3, DEM::DEMProperties::PropertiesIndex>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
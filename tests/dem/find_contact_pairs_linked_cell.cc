@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief Three particles are inserted manually in the x direction.
+ * We check that the linked-cell broad search only pairs the particles
+ * located closer than the neighborhood diameter.
+ */
+
+// Deal.II includes
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+
+// Lethe
+#include <dem/dem_contact_manager.h>
+
+#include <algorithm>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+test()
+{
+  // Generate a cube triangulation and refine it twice globally
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(triangulation,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  triangulation.refine_global(refinement_number);
+
+  MappingQ1<dim> mapping;
+
+  DEMContactManager<dim, DEM::DEMProperties::PropertiesIndex> contact_manager;
+  Particles::ParticleHandler<dim> particle_handler(triangulation, mapping);
+
+  // The linked-cell search only keeps the particles closer than the
+  // neighborhood diameter (1.25 * 0.4 = 0.5), which is smaller than the size
+  // of the cells
+  const double neighborhood_threshold    = 1.25;
+  const double maximum_particle_diameter = 0.4;
+  contact_manager.set_broad_search_parameters(
+    Parameters::Lagrangian::ModelParameters<dim>::BroadSearchMethod::
+      linked_cell,
+    neighborhood_threshold,
+    maximum_particle_diameter,
+    Parameters::Verbosity::quiet,
+    MPI_COMM_WORLD);
+
+  typename dem_data_structures<dim>::periodic_boundaries_cells_info
+    dummy_pbc_info;
+  contact_manager.execute_cell_neighbors_search(triangulation, dummy_pbc_info);
+
+  // Inserting three particles at x = -0.4, x = 0.4 and x = 0.8, in three
+  // adjacent cells in x direction. Only the last two particles are closer than
+  // the neighborhood diameter.
+  std::vector<Point<dim>> positions = {Point<dim>(-0.4, 0, 0),
+                                       Point<dim>(0.4, 0, 0),
+                                       Point<dim>(0.8, 0, 0)};
+
+  for (unsigned int id = 0; id < positions.size(); ++id)
+    {
+      std::pair<typename Triangulation<dim>::active_cell_iterator, Point<dim>>
+        pt_info = GridTools::find_active_cell_around_point(mapping,
+                                                           triangulation,
+                                                           positions[id]);
+      Particles::Particle<dim> particle(positions[id], pt_info.second, id);
+      particle_handler.insert_particle(particle, pt_info.first);
+    }
+
+  // Dummy Adaptive sparse contacts object for next call
+  AdaptiveSparseContacts<dim, DEM::DEMProperties::PropertiesIndex>
+    dummy_adaptive_sparse_contacts;
+
+  // Calling broad search function
+  contact_manager.execute_particle_particle_broad_search(
+    particle_handler, dummy_adaptive_sparse_contacts);
+
+  // Output the pairs sorted by particle ids since the order of the candidates
+  // depends on the order of the particles in the bins
+  std::vector<std::pair<unsigned int, unsigned int>> pairs;
+  for (const auto &[particle_id, candidates] :
+       contact_manager.get_local_contact_pair_candidates())
+    for (const auto &candidate_id : candidates)
+      pairs.emplace_back(std::min<unsigned int>(particle_id, candidate_id),
+                         std::max<unsigned int>(particle_id, candidate_id));
+  std::sort(pairs.begin(), pairs.end());
+
+  deallog << "Number of candidate pairs: " << pairs.size() << std::endl;
+  for (const auto &[first_id, second_id] : pairs)
+    deallog << "A pair is detected: particle " << first_id << " and particle "
+            << second_id << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc, argv, dealii::numbers::invalid_unsigned_int);
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
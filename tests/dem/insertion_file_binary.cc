@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief Inserting particles from a binary input file using the file insertion
+ * class. The file is read in chunks smaller than its number of particles.
+ */
+
+// Deal.II includes
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <cstdint>
+#include <fstream>
+
+// Lethe
+#include <dem/dem_solver_parameters.h>
+#include <dem/insertion_file.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim, typename PropertiesIndex>
+void
+test()
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(tr,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  tr.refine_global(refinement_number);
+
+  MappingQ<dim>            mapping(1);
+  DEMSolverParameters<dim> dem_parameters;
+
+  InsertionInfo<dim>           &insert_info = dem_parameters.insertion_info;
+  LagrangianPhysicalProperties &lpp =
+    dem_parameters.lagrangian_physical_properties;
+
+  // Writing the binary input file with three particles
+  const std::string file_name = "particles.bin";
+  {
+    const std::vector<std::vector<double>> particles = {
+      {-0.05, -0.05, -0.05, 0.1, 0., 0., 0., 0., 1., 0.005},
+      {0.05, -0.05, -0.05, 0., 0.2, 0., 0., 0., 2., 0.006},
+      {0.05, 0.05, 0.05, 0., 0., 0.3, 0., 0., 3., 0.007}};
+    const std::uint64_t n_particles = particles.size();
+    const std::uint64_t n_columns   = particles[0].size();
+
+    std::ofstream file(file_name, std::ios::binary);
+    file.write("LETHEDEM", 8);
+    file.write(reinterpret_cast<const char *>(&n_particles),
+               sizeof(std::uint64_t));
+    file.write(reinterpret_cast<const char *>(&n_columns),
+               sizeof(std::uint64_t));
+    for (const auto &particle : particles)
+      file.write(reinterpret_cast<const char *>(particle.data()),
+                 particle.size() * sizeof(double));
+  }
+
+  // Defining simulation general parameters
+  // Insertion info
+  insert_info.list_of_input_files = {file_name};
+  insert_info.insertion_file_format =
+    InsertionInfo<dim>::InsertionFileFormat::binary;
+  insert_info.insertion_file_chunk_size    = 2;
+  insert_info.removing_particles_in_region = false;
+
+  // Lagrangian physical properties
+  lpp.particle_type_number = 1;
+  lpp.distribution_type.push_back(SizeDistributionType::uniform);
+  lpp.particle_average_diameter.push_back(0.005);
+  lpp.density_particle.push_back(2500);
+  lpp.number.push_back(3);
+
+  // Defining particle handler
+  Particles::ParticleHandler<dim> particle_handler(
+    tr, mapping, PropertiesIndex::n_properties);
+  // Calling uniform insertion
+  std::vector<std::shared_ptr<Distribution>> distribution_object_container;
+  distribution_object_container.push_back(std::make_shared<UniformDistribution>(
+    dem_parameters.lagrangian_physical_properties
+      .particle_average_diameter[0]));
+
+  // Calling file insertion
+  InsertionFile<dim, PropertiesIndex> insertion_object(
+    distribution_object_container, tr, dem_parameters);
+
+  insertion_object.insert(particle_handler, tr, dem_parameters);
+
+  // Output
+  int particle_number = 1;
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle, ++particle_number)
+    {
+      deallog << "Particle " << particle_number
+              << " is inserted at: " << particle->get_location()[0] << " "
+              << particle->get_location()[1] << " "
+              << particle->get_location()[2] << " with diameter "
+              << particle->get_properties()[PropertiesIndex::dp]
+              << " and velocity "
+              << particle->get_properties()[PropertiesIndex::v_x] << " "
+              << particle->get_properties()[PropertiesIndex::v_y] << " "
+              << particle->get_properties()[PropertiesIndex::v_z]
+              << std::endl;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test<3, DEM::DEMProperties::PropertiesIndex>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief In this test, the in-situ time averaging of the cell-based fields is
+ * checked. Two particles in contact are located in the first of two cells and
+ * their velocities are changed between three samples. The running means and
+ * the variances of the fields are written for both cells, the second cell
+ * remaining empty.
+ */
+
+#include <../tests/dem/test_particles_functions.h>
+#include <dem/adaptive_sparse_contacts.h>
+#include <dem/dem_contact_manager.h>
+#include <dem/lagrangian_time_averaging.h>
+
+template <int dim, typename PropertiesIndex>
+void
+test()
+{
+  // Creating a mesh of two unit cells
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::subdivided_hyper_rectangle(triangulation,
+                                            {2, 1, 1},
+                                            Point<dim>(0, 0, 0),
+                                            Point<dim>(2, 1, 1));
+  MappingQ<dim> mapping(1);
+
+  const double particle_diameter      = 0.1;
+  const double neighborhood_threshold = std::pow(1.3 * particle_diameter, 2);
+
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, PropertiesIndex::n_properties);
+
+  // Creating containers manager for finding cell neighbor and also broad and
+  // fine particle-particle search objects
+  DEMContactManager<dim, PropertiesIndex> contact_manager;
+  typename dem_data_structures<dim>::periodic_boundaries_cells_info
+    dummy_pbc_info;
+  contact_manager.execute_cell_neighbors_search(triangulation, dummy_pbc_info);
+
+  // Inserting two particles in contact in the first cell
+  Point<3>       position_0 = {0.3, 0.5, 0.5};
+  Point<3>       position_1 = {0.35, 0.5, 0.5};
+  Tensor<1, dim> v{{0, 0, 0}};
+  Tensor<1, dim> omega{{0, 0, 0}};
+  double         mass = 1;
+  int            type = 0;
+
+  Particles::ParticleIterator<dim> pit_0 = construct_particle_iterator<dim>(
+    particle_handler, triangulation, position_0, 0);
+  Particles::ParticleIterator<dim> pit_1 = construct_particle_iterator<dim>(
+    particle_handler, triangulation, position_1, 1);
+  set_particle_properties<dim, PropertiesIndex>(
+    pit_0, type, particle_diameter, mass, v, omega);
+  set_particle_properties<dim, PropertiesIndex>(
+    pit_1, type, particle_diameter, mass, v, omega);
+
+  particle_handler.sort_particles_into_subdomains_and_cells();
+
+  contact_manager.update_local_particles_in_cells(particle_handler);
+  AdaptiveSparseContacts<dim, PropertiesIndex> dummy_adaptive_sparse_contacts;
+  contact_manager.execute_particle_particle_broad_search(
+    particle_handler, dummy_adaptive_sparse_contacts);
+  contact_manager.execute_particle_particle_fine_search(neighborhood_threshold);
+
+  // Time averaging object
+  Parameters::Lagrangian::LagrangianPostProcessing post_processing;
+  post_processing.time_averaging_enabled            = true;
+  post_processing.time_averaging_sampling_frequency = 1;
+  post_processing.time_averaging_output_frequency   = 0;
+  post_processing.time_averaging_initial_time       = 0.;
+
+  LagrangianTimeAveraging<dim, PropertiesIndex> time_averaging(triangulation);
+  time_averaging.set_parameters(post_processing);
+  time_averaging.setup_dofs();
+
+  // Velocities of both particles at each sample
+  const std::vector<std::array<Tensor<1, dim>, 2>> sampled_velocities = {
+    {{Tensor<1, dim>{{1, 0, 0}}, Tensor<1, dim>{{3, 0, 0}}}},
+    {{Tensor<1, dim>{{2, 0, 0}}, Tensor<1, dim>{{2, 0, 0}}}},
+    {{Tensor<1, dim>{{0, 1, 0}}, Tensor<1, dim>{{0, -1, 0}}}}};
+
+  for (const auto &velocities : sampled_velocities)
+    {
+      for (auto &particle : particle_handler)
+        {
+          auto particle_properties = particle.get_properties();
+          for (unsigned int d = 0; d < dim; ++d)
+            particle_properties[PropertiesIndex::v_x + d] =
+              velocities[particle.get_id()][d];
+        }
+
+      time_averaging.sample(particle_handler,
+                            contact_manager.get_local_adjacent_particles(),
+                            contact_manager.get_ghost_adjacent_particles());
+    }
+
+  // Output
+  const std::vector<std::string> component_names = {"velocity_x",
+                                                    "velocity_y",
+                                                    "velocity_z",
+                                                    "granular_temperature",
+                                                    "solid_fraction",
+                                                    "coordination_number",
+                                                    "kinetic_stress_xx",
+                                                    "kinetic_stress_yy",
+                                                    "kinetic_stress_zz",
+                                                    "kinetic_stress_xy",
+                                                    "kinetic_stress_yz",
+                                                    "kinetic_stress_xz",
+                                                    "occupied_samples"};
+
+  const DoFHandler<dim>    &dof_handler = time_averaging.get_dof_handler();
+  const FiniteElement<dim> &fe          = dof_handler.get_fe();
+  const auto               &means       = time_averaging.get_running_means();
+  const auto                variances   = time_averaging.get_variances();
+
+  deallog << "Number of samples: " << time_averaging.get_n_samples()
+          << std::endl;
+
+  std::vector<types::global_dof_index> local_dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(local_dof_indices);
+      deallog << "Cell centered at x = " << cell->center()[0] << std::endl;
+      for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+        {
+          const unsigned int component = fe.system_to_component_index(i).first;
+          const types::global_dof_index dof = local_dof_indices[i];
+          deallog << "  " << component_names[component] << ": mean "
+                  << means(dof) << ", variance " << variances(dof)
+                  << std::endl;
+        }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      initlog();
+      test<3, DEM::DEMProperties::PropertiesIndex>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
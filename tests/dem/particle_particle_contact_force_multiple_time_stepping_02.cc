@@ -0,0 +1,257 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief In this test, a column of coarse particles resting on a fixed
+ * particle is settled under gravity without multiple time stepping and with a
+ * time step ratio of 4 for the pairs of coarse particles. The normal overlaps
+ * of the settled columns are compared with the overlaps of the static
+ * equilibrium and with each other.
+ */
+
+#include <core/sub_simulation_control.h>
+
+#include <../tests/dem/test_particles_functions.h>
+#include <dem/adaptive_sparse_contacts.h>
+#include <dem/dem_contact_manager.h>
+#include <dem/velocity_verlet_integrator.h>
+
+template <int dim, typename PropertiesIndex>
+std::vector<double>
+settle_column(const unsigned int time_step_ratio)
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(triangulation,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  triangulation.refine_global(refinement_number);
+  MappingQ<dim> mapping(1);
+
+  // Defining general simulation parameters
+  DEMSolverParameters<dim>                              dem_parameters;
+  Parameters::Lagrangian::LagrangianPhysicalProperties &lpp =
+    dem_parameters.lagrangian_physical_properties;
+
+  set_default_dem_parameters(1, dem_parameters);
+
+  Tensor<1, 3>       g{{0, 0, -9.81}};
+  const double       dt                        = 1e-6;
+  const unsigned int n_iterations              = 30000;
+  const unsigned int n_particles               = 5;
+  const double       particle_diameter         = 0.005;
+  lpp.particle_type_number                     = 1;
+  lpp.youngs_modulus_particle[0]               = 50000000;
+  lpp.poisson_ratio_particle[0]                = 0.3;
+  lpp.restitution_coefficient_particle[0]      = 0.1;
+  lpp.friction_coefficient_particle[0]         = 0.5;
+  lpp.rolling_friction_coefficient_particle[0] = 0.1;
+  lpp.density_particle[0]                      = 2500;
+  const double mass = lpp.density_particle[0] * M_PI *
+                      Utilities::fixed_power<3>(particle_diameter) / 6.;
+
+  const double neighborhood_threshold = std::pow(1.3 * particle_diameter, 2);
+
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, PropertiesIndex::n_properties);
+
+  // Creating containers manager for finding cell neighbor and also broad and
+  // fine particle-particle search objects
+  DEMContactManager<dim, PropertiesIndex> contact_manager;
+  typename dem_data_structures<dim>::periodic_boundaries_cells_info
+    dummy_pbc_info;
+  contact_manager.execute_cell_neighbors_search(triangulation, dummy_pbc_info);
+
+  // Inserting a column of particles which touch each other. The particle 0,
+  // at the bottom of the column, is fixed
+  Tensor<1, dim> v{{0, 0, 0}};
+  Tensor<1, dim> omega{{0, 0, 0}};
+  for (unsigned int i = 0; i < n_particles; ++i)
+    {
+      Point<3> position = {0.4, 0, i * particle_diameter};
+      Particles::ParticleIterator<dim> pit = construct_particle_iterator<dim>(
+        particle_handler, triangulation, position, i);
+      set_particle_properties<dim, PropertiesIndex>(
+        pit, 0, particle_diameter, mass, v, omega);
+    }
+
+  ParticleInteractionOutcomes<PropertiesIndex> contact_outcome;
+  std::vector<double>                          MOI;
+
+  particle_handler.sort_particles_into_subdomains_and_cells();
+  const unsigned int number_of_particles =
+    particle_handler.get_max_local_particle_index();
+  contact_outcome.resize_interaction_containers(number_of_particles);
+  MOI.resize(number_of_particles);
+  for (auto &moi_val : MOI)
+    moi_val = 1;
+
+  // The particles do not leave their cells and the contacts do not change
+  // while the column settles, so the contact search is only done once
+  contact_manager.update_local_particles_in_cells(particle_handler);
+  AdaptiveSparseContacts<dim, PropertiesIndex> dummy_adaptive_sparse_contacts;
+  contact_manager.execute_particle_particle_broad_search(
+    particle_handler, dummy_adaptive_sparse_contacts);
+  contact_manager.execute_particle_particle_fine_search(neighborhood_threshold);
+
+  // All the particles are coarse
+  ParticleParticleContactForce<
+    dim,
+    PropertiesIndex,
+    Parameters::Lagrangian::ParticleParticleContactForceModel::linear,
+    Parameters::Lagrangian::RollingResistanceMethod::constant>
+    linear_force_object(dem_parameters);
+  SubSimulationControlMultiRateDEM multi_rate_control(time_step_ratio,
+                                                      0.8 * particle_diameter);
+  linear_force_object.set_coarse_diameter_threshold(
+    multi_rate_control.get_coarse_diameter_threshold());
+
+  VelocityVerletIntegrator<dim, PropertiesIndex> integrator_object;
+
+  for (unsigned int iteration = 0; iteration < n_iterations; ++iteration)
+    {
+      linear_force_object.set_coarse_pair_time_step_ratio(
+        multi_rate_control.get_coarse_pair_time_step_ratio());
+      linear_force_object.calculate_particle_particle_contact(
+        contact_manager.get_local_adjacent_particles(),
+        contact_manager.get_ghost_adjacent_particles(),
+        contact_manager.get_local_local_periodic_adjacent_particles(),
+        contact_manager.get_local_ghost_periodic_adjacent_particles(),
+        contact_manager.get_ghost_local_periodic_adjacent_particles(),
+        dt,
+        contact_outcome);
+      multi_rate_control.iterate();
+
+      // Integration, the forces and torques are reset by the integrator
+      integrator_object.integrate(particle_handler,
+                                  g,
+                                  dt,
+                                  contact_outcome.torque,
+                                  contact_outcome.force,
+                                  MOI);
+
+      // Bring the bottom particle back to its initial position
+      for (auto &particle : particle_handler)
+        if (particle.get_id() == 0)
+          {
+            particle.set_location(Point<dim>(0.4, 0, 0));
+            auto particle_properties = particle.get_properties();
+            for (unsigned int d = 0; d < dim; ++d)
+              particle_properties[PropertiesIndex::v_x + d] = 0;
+          }
+    }
+
+  // Normal overlaps from the bottom to the top of the column
+  std::vector<double> heights(n_particles);
+  for (auto &particle : particle_handler)
+    heights[particle.get_id()] = particle.get_location()[2];
+
+  std::vector<double> normal_overlaps(n_particles - 1);
+  for (unsigned int i = 0; i < n_particles - 1; ++i)
+    normal_overlaps[i] = particle_diameter - (heights[i + 1] - heights[i]);
+
+  return normal_overlaps;
+}
+
+template <int dim, typename PropertiesIndex>
+void
+test()
+{
+  // The static overlap of a contact is the weight of the particles above it
+  // divided by the normal spring constant of the linear model
+  const double particle_diameter = 0.005;
+  const double effective_radius  = 0.25 * particle_diameter;
+  const double youngs_modulus    = 50000000 / (2 * (1 - 0.3 * 0.3));
+
+  const double mass =
+    2500 * M_PI * Utilities::fixed_power<3>(particle_diameter) / 6.;
+  const double effective_mass = 0.5 * mass;
+
+  const double normal_stiffness =
+    1.0667 * sqrt(effective_radius) * youngs_modulus *
+    pow(0.9375 * effective_mass / (sqrt(effective_radius) * youngs_modulus),
+        0.2);
+  const double single_weight_overlap = mass * 9.81 / normal_stiffness;
+
+  const std::vector<double> reference_overlaps =
+    settle_column<dim, PropertiesIndex>(1);
+  const std::vector<double> multiple_time_stepping_overlaps =
+    settle_column<dim, PropertiesIndex>(4);
+
+  const unsigned int n_contacts = reference_overlaps.size();
+
+  // Maximal relative deviations from the static overlaps and maximal relative
+  // difference between the overlaps of both time step ratios
+  double reference_deviation              = 0;
+  double multiple_time_stepping_deviation = 0;
+  double difference                       = 0;
+  for (unsigned int i = 0; i < n_contacts; ++i)
+    {
+      const double static_overlap = (n_contacts - i) * single_weight_overlap;
+      reference_deviation =
+        std::max(reference_deviation,
+                 std::abs(reference_overlaps[i] - static_overlap) /
+                   static_overlap);
+      multiple_time_stepping_deviation =
+        std::max(multiple_time_stepping_deviation,
+                 std::abs(multiple_time_stepping_overlaps[i] - static_overlap) /
+                   static_overlap);
+      difference = std::max(difference,
+                            std::abs(multiple_time_stepping_overlaps[i] -
+                                     reference_overlaps[i]) /
+                              reference_overlaps[i]);
+    }
+
+  // Output
+  const double tolerance = 0.01;
+  deallog << "The overlaps for a time step ratio of 1 match the static "
+             "equilibrium: "
+          << (reference_deviation < tolerance ? "true" : "false")
+          << std::endl;
+  deallog << "The overlaps for a time step ratio of 4 match the static "
+             "equilibrium: "
+          << (multiple_time_stepping_deviation < tolerance ? "true" : "false")
+          << std::endl;
+  deallog << "The overlaps for time step ratios of 1 and 4 match: "
+          << (difference < tolerance ? "true" : "false") << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      initlog();
+      test<3, DEM::DEMProperties::PropertiesIndex>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
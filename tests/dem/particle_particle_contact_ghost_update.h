@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+#ifndef particle_particle_contact_ghost_update_h
+#define particle_particle_contact_ghost_update_h
+
+// Deal.II
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+// Lethe
+#include <core/dem_properties.h>
+
+#include <../tests/dem/test_particles_functions.h>
+#include <dem/data_containers.h>
+#include <dem/dem_contact_manager.h>
+#include <dem/particle_particle_contact_force.h>
+#include <dem/reduced_ghost_update.h>
+#include <dem/velocity_verlet_integrator.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+/**
+ * @brief Calculate the non-linear (Hertzian) particle-particle contact force
+ * between a local and a ghost particle on two processes, with a single
+ * contact search. The update of the ghost particles is overlapped with the
+ * calculation of the local-local contact forces and the location of the
+ * particle 0 is written every 10 iterations.
+ *
+ * @tparam dim Integer that denotes the number of spatial dimensions.
+ * @tparam PropertiesIndex Index of the properties used within the
+ * ParticleHandler.
+ * @param[in] reduced_ghost_update Flag to update the ghost particles with the
+ * ReducedGhostUpdate instead of the ParticleHandler.
+ */
+template <int dim, typename PropertiesIndex>
+void
+test_overlapped_ghost_update(const bool reduced_ghost_update)
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(triangulation,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  triangulation.refine_global(refinement_number);
+  MappingQ<dim>                                         mapping(1);
+  DEMSolverParameters<dim>                              dem_parameters;
+  Parameters::Lagrangian::LagrangianPhysicalProperties &lpp =
+    dem_parameters.lagrangian_physical_properties;
+
+  set_default_dem_parameters(1, dem_parameters);
+
+  // Defining general simulation parameters
+  Tensor<1, 3> g{{0, 0, 0}};
+  double       dt                                     = 0.00001;
+  double       particle_diameter                      = 0.005;
+  unsigned int step_end                               = 1000;
+  unsigned int output_frequency                       = 10;
+  lpp.particle_type_number                            = 1;
+  lpp.youngs_modulus_particle[0]                      = 50000000;
+  lpp.poisson_ratio_particle[0]                       = 0.9;
+  lpp.restitution_coefficient_particle[0]             = 0.9;
+  lpp.friction_coefficient_particle[0]                = 0.5;
+  lpp.rolling_viscous_damping_coefficient_particle[0] = 0.5;
+  lpp.rolling_friction_coefficient_particle[0]        = 0.1;
+  lpp.surface_energy_particle[0]                      = 0.;
+  lpp.hamaker_constant_particle[0]                    = 0.;
+  lpp.density_particle[0]                             = 2500;
+  dem_parameters.model_parameters.rolling_resistance_method =
+    Parameters::Lagrangian::RollingResistanceMethod::constant;
+
+  const double neighborhood_threshold = std::pow(1.3 * particle_diameter, 2);
+
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, PropertiesIndex::n_properties);
+
+  typename dem_data_structures<2>::particle_index_iterator_map
+    local_particle_container;
+
+  DEMContactManager<dim, PropertiesIndex> contact_manager;
+
+  // Finding cell neighbors
+  typename dem_data_structures<dim>::periodic_boundaries_cells_info
+    dummy_pbc_info;
+  contact_manager.execute_cell_neighbors_search(triangulation, dummy_pbc_info);
+
+  // Creating particle-particle force objects
+  ParticleParticleContactForce<
+    dim,
+    PropertiesIndex,
+    Parameters::Lagrangian::ParticleParticleContactForceModel::
+      hertz_mindlin_limit_overlap,
+    Parameters::Lagrangian::RollingResistanceMethod::constant>
+    nonlinear_force_object(dem_parameters);
+  VelocityVerletIntegrator<dim, PropertiesIndex> integrator_object;
+
+  MPI_Comm communicator     = triangulation.get_communicator();
+  auto     this_mpi_process = Utilities::MPI::this_mpi_process(communicator);
+
+  // Inserting two particles in contact
+  Point<2> position1 = {0, 0.003};
+  int      id1       = 0;
+  Point<2> position2 = {0, -0.003};
+  int      id2       = 1;
+
+  // Particle 1 is inserted in a cell owned by process1
+  if (this_mpi_process == 1)
+    {
+      Particles::Particle<dim> particle1(position1, position1, id1);
+
+      typename Triangulation<dim>::active_cell_iterator cell1 =
+        GridTools::find_active_cell_around_point(triangulation,
+                                                 particle1.get_location());
+      Particles::ParticleIterator<dim> pit1 =
+        particle_handler.insert_particle(particle1, cell1);
+      pit1->get_properties()[PropertiesIndex::type]    = 0;
+      pit1->get_properties()[PropertiesIndex::dp]      = particle_diameter;
+      pit1->get_properties()[PropertiesIndex::v_x]     = 0;
+      pit1->get_properties()[PropertiesIndex::v_y]     = -0.5;
+      pit1->get_properties()[PropertiesIndex::v_z]     = 0;
+      pit1->get_properties()[PropertiesIndex::omega_x] = 0;
+      pit1->get_properties()[PropertiesIndex::omega_y] = 0;
+      pit1->get_properties()[PropertiesIndex::omega_z] = 0;
+      pit1->get_properties()[PropertiesIndex::mass]    = 1;
+    }
+
+  // Particle 2 is inserted in a cell owned by process0
+  if (this_mpi_process == 0)
+    {
+      Particles::Particle<dim> particle2(position2, position2, id2);
+      typename Triangulation<dim>::active_cell_iterator cell2 =
+        GridTools::find_active_cell_around_point(triangulation,
+                                                 particle2.get_location());
+      Particles::ParticleIterator<dim> pit2 =
+        particle_handler.insert_particle(particle2, cell2);
+      pit2->get_properties()[PropertiesIndex::type]    = 0;
+      pit2->get_properties()[PropertiesIndex::dp]      = particle_diameter;
+      pit2->get_properties()[PropertiesIndex::v_x]     = 0;
+      pit2->get_properties()[PropertiesIndex::v_y]     = 0.5;
+      pit2->get_properties()[PropertiesIndex::v_z]     = 0;
+      pit2->get_properties()[PropertiesIndex::omega_x] = 0;
+      pit2->get_properties()[PropertiesIndex::omega_y] = 0;
+      pit2->get_properties()[PropertiesIndex::omega_z] = 0;
+      pit2->get_properties()[PropertiesIndex::mass]    = 1;
+    }
+
+  ParticleInteractionOutcomes<PropertiesIndex> contact_outcome;
+  std::vector<double>                          MOI;
+
+  particle_handler.sort_particles_into_subdomains_and_cells();
+  const unsigned int number_of_particles =
+    particle_handler.get_max_local_particle_index();
+  contact_outcome.resize_interaction_containers(number_of_particles);
+  MOI.resize(number_of_particles);
+  for (auto &moi_val : MOI)
+    moi_val = 1;
+
+  // Single contact search, the ghost particles being only updated afterwards.
+  // The particles remain in their cells during the whole simulation.
+  particle_handler.exchange_ghost_particles(true);
+
+  ReducedGhostUpdate<dim, PropertiesIndex> reduced_update(communicator);
+  if (reduced_ghost_update)
+    reduced_update.setup(particle_handler);
+
+  contact_manager.update_local_particles_in_cells(particle_handler);
+
+  // Dummy Adaptive sparse contacts object and particle-particle broad search
+  AdaptiveSparseContacts<dim, PropertiesIndex> dummy_adaptive_sparse_contacts;
+  contact_manager.execute_particle_particle_broad_search(
+    particle_handler, dummy_adaptive_sparse_contacts);
+
+  // Calling fine search
+  contact_manager.execute_particle_particle_fine_search(neighborhood_threshold);
+
+  for (unsigned int iteration = 0; iteration < step_end; ++iteration)
+    {
+      // Reinitializing contact outcomes
+      reinitialize_contact_outcomes<dim, PropertiesIndex>(particle_handler,
+                                                          contact_outcome);
+
+      // Non-blocking update of the ghost particles, overlapped with the
+      // local-local contact forces
+      if (iteration > 0)
+        {
+          if (reduced_ghost_update)
+            reduced_update.update_start();
+          else
+            particle_handler.update_ghost_particles_start();
+        }
+
+      nonlinear_force_object.calculate_local_particle_particle_contact(
+        contact_manager.get_local_adjacent_particles(),
+        contact_manager.get_local_local_periodic_adjacent_particles(),
+        dt,
+        contact_outcome);
+
+      if (iteration > 0)
+        {
+          if (reduced_ghost_update)
+            reduced_update.update_finish();
+          else
+            particle_handler.update_ghost_particles_finish();
+        }
+
+      nonlinear_force_object.calculate_ghost_particle_particle_contact(
+        contact_manager.get_ghost_adjacent_particles(),
+        contact_manager.get_local_ghost_periodic_adjacent_particles(),
+        contact_manager.get_ghost_local_periodic_adjacent_particles(),
+        dt,
+        contact_outcome);
+
+      // Integration
+      integrator_object.integrate(particle_handler,
+                                  g,
+                                  dt,
+                                  contact_outcome.torque,
+                                  contact_outcome.force,
+                                  MOI);
+
+      if (iteration % output_frequency == 0)
+        {
+          if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 1)
+            {
+              // Output particle 0 position
+              for (auto particle = particle_handler.begin();
+                   particle != particle_handler.end();
+                   ++particle)
+                {
+                  if (particle->get_id() == 0)
+                    {
+                      deallog
+                        << "The location of particle " << particle->get_id()
+                        << " is: " << particle->get_location() << std::endl;
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // particle_particle_contact_ghost_update_h
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief In this test, the non-linear (Hertzian) particle-particle contact
+ * force between a local and a ghost particle is calculated while the ghost
+ * particles are updated with the reduced payload of the ReducedGhostUpdate,
+ * overlapped with the calculation of the local-local contact forces. The
+ * results must be the same as in the
+ * particle_particle_contact_on_two_processors test.
+ */
+
+#include <../tests/dem/particle_particle_contact_ghost_update.h>
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test_overlapped_ghost_update<2, DEM::DEMProperties::PropertiesIndex>(
+        true);
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief Test the invalidation of the cached sharp-edge IB stencils. The
+ * stencils of a particle must be discarded when this particle moves or
+ * rotates, all the stencils must be discarded when the mesh is refined or the
+ * number of particles changes, and a stencil computed for another particle
+ * must not be returned.
+ */
+
+// Deal.II includes
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+// Lethe
+#include <fem-dem/ib_stencil_cache.h>
+
+// Tests
+#include <../tests/tests.h>
+
+/**
+ * @brief Store a stencil for the 4 DOFs of each cell, the cells with an index
+ * lower than half the number of cells being cut by particle 0 and the others
+ * by particle 1.
+ */
+void
+fill_cache(const DoFHandler<2> &dof_handler, IBStencilCache<2> &cache)
+{
+  const unsigned int n_cells = dof_handler.get_triangulation().n_active_cells();
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    for (unsigned int i = 0; i < cell->get_fe().n_dofs_per_cell(); ++i)
+      {
+        const unsigned int particle_id =
+          cell->active_cell_index() < n_cells / 2 ? 0 : 1;
+
+        IBStencilCacheEntry<2> stencil;
+        stencil.particle_id            = particle_id;
+        stencil.stencil_cell           = cell;
+        stencil.particle_close_to_wall = false;
+        stencil.shape_values           = {1., 0., 0., 0.};
+        cache.store(cell->active_cell_index(), i, std::move(stencil));
+      }
+}
+
+void
+test()
+{
+  Triangulation<2> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1, 1);
+  triangulation.refine_global(2);
+
+  const FE_Q<2> fe(1);
+  DoFHandler<2> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  IBStencilCache<2> cache;
+  cache.connect_to_triangulation(triangulation);
+
+  std::vector<Point<2>>     positions    = {Point<2>(-0.5, -0.5),
+                                            Point<2>(0.5, 0.5)};
+  std::vector<Tensor<1, 3>> orientations = {Tensor<1, 3>(), Tensor<1, 3>()};
+
+  cache.remove_outdated_stencils(positions, orientations);
+  fill_cache(dof_handler, cache);
+  deallog << "Stencils stored: " << cache.size() << std::endl;
+
+  deallog << "Stencil of cell 3 found for particle 0: "
+          << (cache.find(3, 1, 0) != nullptr) << std::endl;
+  deallog << "Stencil of cell 3 found for particle 1: "
+          << (cache.find(3, 1, 1) != nullptr) << std::endl;
+
+  cache.remove_outdated_stencils(positions, orientations);
+  deallog << "Stencils kept when no particle moves: " << cache.size()
+          << std::endl;
+
+  positions[1][0] += 1e-3;
+  cache.remove_outdated_stencils(positions, orientations);
+  deallog << "Stencils kept after the motion of particle 1: " << cache.size()
+          << std::endl;
+  deallog << "Stencil of cell 3 found for particle 0: "
+          << (cache.find(3, 1, 0) != nullptr) << std::endl;
+  deallog << "Stencil of cell 12 found for particle 1: "
+          << (cache.find(12, 1, 1) != nullptr) << std::endl;
+
+  orientations[0][2] += 1e-3;
+  cache.remove_outdated_stencils(positions, orientations);
+  deallog << "Stencils kept after the rotation of particle 0: " << cache.size()
+          << std::endl;
+
+  fill_cache(dof_handler, cache);
+  positions.emplace_back(0.5, -0.5);
+  orientations.emplace_back();
+  cache.remove_outdated_stencils(positions, orientations);
+  deallog << "Stencils kept after the insertion of a particle: "
+          << cache.size() << std::endl;
+
+  fill_cache(dof_handler, cache);
+  deallog << "Stencils stored: " << cache.size() << std::endl;
+  triangulation.begin_active()->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+  deallog << "Stencils kept after the refinement of the mesh: " << cache.size()
+          << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,259 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief Test if the matrix-free projection of the void fraction gives the
+ * same solution as the matrix-based projection. Particles are homogeneously
+ * placed in a grid within a cubic triangulation and the void fraction is
+ * calculated with the QCM, with and without L2 smoothing, by both projections.
+ * The nodal values of the void fraction and the particle volumes obtained by
+ * integrating the void fraction must match.
+ */
+
+// Deal.II includes
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/generators.h>
+#include <deal.II/particles/particle_handler.h>
+// Lethe
+#include <core/dem_properties.h>
+
+#include <fem-dem/particle_projector.h>
+
+// Tests
+#include <../tests/tests.h>
+#include <../tests/tests_utilities.h>
+
+using namespace dealii;
+
+/**
+ * @brief Calculate the void fraction with the QCM and return the projector.
+ */
+std::shared_ptr<ParticleProjector<3>>
+calculate_void_fraction(
+  parallel::distributed::Triangulation<3> &triangulation,
+  Particles::ParticleHandler<3>           &particle_handler,
+  const unsigned int                       fe_degree,
+  const unsigned int                       number_quadrature_points,
+  const double                             l2_smoothing_length,
+  const bool                               matrix_free_projection)
+{
+  std::shared_ptr<Parameters::VoidFractionParameters<3>>
+    void_fraction_parameters = make_default_void_fraction_parameters();
+  void_fraction_parameters->n_quadrature_points = number_quadrature_points;
+  void_fraction_parameters->l2_smoothing_length = l2_smoothing_length;
+
+  // Setup a default linear solver which converges with both preconditioners
+  Parameters::LinearSolver linear_solver_parameters =
+    make_default_linear_solver();
+  linear_solver_parameters.minimum_residual = 1e-13;
+  linear_solver_parameters.max_iterations   = 1000;
+  linear_solver_parameters.verbosity        = Parameters::Verbosity::quiet;
+
+  // The information of the projection is not printed
+  ConditionalOStream pcout(std::cout, false);
+
+  BoundaryConditions::NSBoundaryConditions<3> boundary_conditions;
+
+  auto particle_projector =
+    std::make_shared<ParticleProjector<3>>(&triangulation,
+                                           void_fraction_parameters,
+                                           linear_solver_parameters,
+                                           &particle_handler,
+                                           fe_degree,
+                                           false,
+                                           pcout,
+                                           matrix_free_projection);
+
+  particle_projector->setup_dofs();
+  particle_projector->setup_constraints(boundary_conditions);
+  particle_projector->calculate_void_fraction(0.);
+
+  return particle_projector;
+}
+
+/**
+ * @brief Integrate the solid fraction over the triangulation.
+ */
+double
+calculate_particle_volume(const ParticleProjector<3> &particle_projector)
+{
+  FEValues<3> fe_values_void_fraction(*particle_projector.mapping,
+                                      *particle_projector.fe,
+                                      *particle_projector.quadrature,
+                                      update_values | update_JxW_values);
+
+  double              particle_volume = 0;
+  std::vector<double> void_fraction_values(
+    fe_values_void_fraction.n_quadrature_points);
+  for (const auto &cell :
+       particle_projector.dof_handler.active_cell_iterators())
+    {
+      if (!cell->is_locally_owned())
+        continue;
+
+      fe_values_void_fraction.reinit(cell);
+      fe_values_void_fraction.get_function_values(
+        particle_projector.void_fraction_solution, void_fraction_values);
+      for (unsigned int q = 0; q < fe_values_void_fraction.n_quadrature_points;
+           ++q)
+        particle_volume += fe_values_void_fraction.JxW(q) *
+                           (1. - void_fraction_values[q]);
+    }
+
+  return Utilities::MPI::sum(particle_volume, MPI_COMM_WORLD);
+}
+
+void
+test_void_fraction_qcm(const unsigned int fe_degree,
+                       const unsigned int number_quadrature_points,
+                       const double       l2_smoothing_length)
+{
+  // We make a background triangulation which consists in a 1x1x1 cube.
+  parallel::distributed::Triangulation<3> domain_triangulation(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(domain_triangulation, 0, 1, false);
+  domain_triangulation.refine_global(1);
+
+  // We initialize the particle handler
+  const MappingQ1<3>            mapping;
+  Particles::ParticleHandler<3> particle_handler;
+  particle_handler.initialize(domain_triangulation,
+                              mapping,
+                              DEM::CFDDEMProperties::n_properties);
+
+  // We generate a grid of particles at the centers of the cells of a refined
+  // cube
+  parallel::distributed::Triangulation<3> particle_triangulation(
+    MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(particle_triangulation, 0, 1, false);
+  particle_triangulation.refine_global(3);
+
+  const auto my_bounding_box = GridTools::compute_mesh_predicate_bounding_box(
+    domain_triangulation, IteratorFilters::LocallyOwnedCell());
+  const auto global_bounding_boxes =
+    Utilities::MPI::all_gather(MPI_COMM_WORLD, my_bounding_box);
+
+  std::vector<std::vector<double>> properties(
+    particle_triangulation.n_locally_owned_active_cells(),
+    std::vector<double>(DEM::CFDDEMProperties::n_properties, 0.));
+
+  Particles::Generators::quadrature_points(particle_triangulation,
+                                           QMidpoint<3>(),
+                                           global_bounding_boxes,
+                                           particle_handler,
+                                           mapping,
+                                           properties);
+
+  // We fix the diameter of all the particles to have a solid fraction of 0.1
+  const double target_eps_solid = 0.1;
+  const double dp =
+    std::pow(target_eps_solid / particle_handler.n_global_particles() * 6 /
+               numbers::PI,
+             1. / 3.);
+  for (auto &particle : particle_handler)
+    {
+      auto particle_properties = particle.get_properties();
+      particle_properties[DEM::CFDDEMProperties::dp] = dp;
+    }
+
+  // The convergence history of the solvers is not written
+  const unsigned int previous_depth = deallog.depth_file(0);
+
+  const auto matrix_based_projector =
+    calculate_void_fraction(domain_triangulation,
+                            particle_handler,
+                            fe_degree,
+                            number_quadrature_points,
+                            l2_smoothing_length,
+                            false);
+  const auto matrix_free_projector =
+    calculate_void_fraction(domain_triangulation,
+                            particle_handler,
+                            fe_degree,
+                            number_quadrature_points,
+                            l2_smoothing_length,
+                            true);
+  deallog.depth_file(previous_depth);
+
+  const double tolerance = 1e-8;
+
+  LinearAlgebra::distributed::Vector<double> difference;
+  difference.reinit(matrix_based_projector->void_fraction_solution, true);
+  difference.copy_locally_owned_data_from(
+    matrix_based_projector->void_fraction_solution);
+  difference.add(-1., matrix_free_projector->void_fraction_solution);
+  const bool void_fractions_match = difference.linfty_norm() < tolerance;
+
+  const double matrix_based_volume =
+    calculate_particle_volume(*matrix_based_projector);
+  const double matrix_free_volume =
+    calculate_particle_volume(*matrix_free_projector);
+  const bool volumes_match =
+    std::abs(matrix_based_volume - matrix_free_volume) < tolerance;
+
+  deallog << "Void fractions of both projections match: "
+          << (void_fractions_match ? "true" : "false") << std::endl;
+  deallog << "Particle volumes of both projections match: "
+          << (volumes_match ? "true" : "false") << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      deallog << "Void fraction: fe_degree=1    number_quadrature_points=2    "
+                 "l2_smoothing_length=0"
+              << std::endl;
+      test_void_fraction_qcm(1, 2, 0.);
+      deallog << "Void fraction: fe_degree=1    number_quadrature_points=3    "
+                 "l2_smoothing_length=0.25"
+              << std::endl;
+      test_void_fraction_qcm(1, 3, 0.25);
+      deallog << "Void fraction: fe_degree=2    number_quadrature_points=3    "
+                 "l2_smoothing_length=0.25"
+              << std::endl;
+      test_void_fraction_qcm(2, 3, 0.25);
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
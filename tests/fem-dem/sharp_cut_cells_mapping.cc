@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief Test that the hierarchical traversal of the sharp-edge cut cells
+ * mapping finds the same cut cells and cells inside the particles as a search
+ * looping over the particles and testing every active cell. The mesh is
+ * refined locally and several spheres overlap each other, cross refinement
+ * levels and the boundary of the domain. The incremental update of the
+ * mapping after the motion of some of the spheres is tested as well.
+ */
+
+// Deal.II includes
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+// Lethe
+#include <fem-dem/sharp_cut_cells_mapping.h>
+
+// Tests
+#include <../tests/tests.h>
+
+using CutCellsMap =
+  std::vector<std::tuple<bool, unsigned int, std::vector<unsigned int>>>;
+using CellsInsideMap = std::vector<std::tuple<bool, unsigned int>>;
+
+template <int dim>
+Point<dim>
+sphere_center(const double x, const double y, const double z)
+{
+  Point<dim> center;
+  center[0] = x;
+  center[1] = y;
+  if constexpr (dim == 3)
+    center[2] = z;
+  return center;
+}
+
+/**
+ * @brief Map the cut cells by looping over the spheres in reverse order and
+ * testing every active cell, such that the sphere with the lowest id is
+ * associated to the cells. This is the per-particle search that the
+ * hierarchical traversal replaces.
+ */
+template <int dim>
+void
+per_particle_search(const DoFHandler<dim>         &dof_handler,
+                    const std::vector<Point<dim>> &positions,
+                    const std::vector<double>     &radii,
+                    CutCellsMap                   &cut_cells_map,
+                    CellsInsideMap                &cells_inside_map)
+{
+  const unsigned int n_active_cells =
+    dof_handler.get_triangulation().n_active_cells();
+  cut_cells_map.assign(n_active_cells, {false, 0, std::vector<unsigned int>()});
+  cells_inside_map.assign(n_active_cells, {false, 0});
+
+  for (int p = positions.size() - 1; p >= 0; --p)
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      {
+        const auto is_candidate =
+          SharpCutCellsMapping::sphere_cut_cell_candidates<dim>(cell,
+                                                                positions[p],
+                                                                radii[p]);
+        if (is_candidate.first)
+          cells_inside_map[cell->active_cell_index()] = {true, p};
+        if (is_candidate.second)
+          cut_cells_map[cell->active_cell_index()] = {
+            true, p, std::vector<unsigned int>()};
+      }
+}
+
+/**
+ * @brief Compare the mapping of the hierarchical traversal with the one of
+ * the per-particle search and print the number of cells cut by, and inside,
+ * each sphere.
+ */
+template <int dim>
+void
+compare_mappings(const DoFHandler<dim>         &dof_handler,
+                 const std::vector<Point<dim>> &positions,
+                 const std::vector<double>     &radii,
+                 const CutCellsMap             &cut_cells_map,
+                 const CellsInsideMap          &cells_inside_map)
+{
+  CutCellsMap    reference_cut_cells_map;
+  CellsInsideMap reference_cells_inside_map;
+  per_particle_search(dof_handler,
+                      positions,
+                      radii,
+                      reference_cut_cells_map,
+                      reference_cells_inside_map);
+
+  unsigned int              n_mismatches = 0;
+  std::vector<unsigned int> n_cut_cells(positions.size(), 0);
+  std::vector<unsigned int> n_cells_inside(positions.size(), 0);
+  for (unsigned int i = 0; i < cut_cells_map.size(); ++i)
+    {
+      const bool cut       = std::get<0>(cut_cells_map[i]);
+      const bool inside    = std::get<0>(cells_inside_map[i]);
+      const auto cut_id    = std::get<1>(cut_cells_map[i]);
+      const auto inside_id = std::get<1>(cells_inside_map[i]);
+
+      if (cut != std::get<0>(reference_cut_cells_map[i]) ||
+          (cut && cut_id != std::get<1>(reference_cut_cells_map[i])) ||
+          inside != std::get<0>(reference_cells_inside_map[i]) ||
+          (inside && inside_id != std::get<1>(reference_cells_inside_map[i])))
+        ++n_mismatches;
+
+      if (cut)
+        ++n_cut_cells[cut_id];
+      if (inside)
+        ++n_cells_inside[inside_id];
+    }
+
+  for (unsigned int p = 0; p < positions.size(); ++p)
+    deallog << "Sphere " << p << ": " << n_cut_cells[p] << " cut cells, "
+            << n_cells_inside[p] << " cells inside" << std::endl;
+  deallog << "Cells differing from the per-particle search: " << n_mismatches
+          << std::endl;
+}
+
+template <int dim>
+void
+test()
+{
+  deallog << "Dimension " << dim << std::endl;
+
+  // Mesh refined three times on the half x < 0 and four times on the quarter
+  // x < -0.5 of the domain
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1, 1);
+  triangulation.refine_global(2);
+  for (const double refinement_limit : {0., -0.5})
+    {
+      for (const auto &cell : triangulation.active_cell_iterators())
+        if (cell->center()[0] < refinement_limit)
+          cell->set_refine_flag();
+      triangulation.execute_coarsening_and_refinement();
+    }
+
+  const FE_Q<dim> fe(1);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  deallog << "Number of active cells: " << triangulation.n_active_cells()
+          << std::endl;
+
+  // Spheres 0 and 1 overlap and cross refinement levels, sphere 3 crosses the
+  // boundary of the domain
+  std::vector<Point<dim>> positions = {sphere_center<dim>(-0.6, 0.1, 0.05),
+                                       sphere_center<dim>(-0.45, 0.3, -0.1),
+                                       sphere_center<dim>(0.4, -0.35, 0.2),
+                                       sphere_center<dim>(0.9, 0.8, 0.85)};
+  std::vector<double>     radii     = {0.3, 0.2, 0.33, 0.25};
+
+  std::vector<BoundingBox<dim>> updated_boxes;
+  for (unsigned int p = 0; p < positions.size(); ++p)
+    updated_boxes.push_back(
+      SharpCutCellsMapping::sphere_bounding_box(positions[p], radii[p]));
+
+  CutCellsMap    cut_cells_map(triangulation.n_active_cells(),
+                            {false, 0, std::vector<unsigned int>()});
+  CellsInsideMap cells_inside_map(triangulation.n_active_cells(), {false, 0});
+  SharpCutCellsMapping::map_sphere_cut_cells(dof_handler,
+                                             positions,
+                                             radii,
+                                             updated_boxes,
+                                             cut_cells_map,
+                                             cells_inside_map);
+
+  deallog << "Complete mapping" << std::endl;
+  compare_mappings(
+    dof_handler, positions, radii, cut_cells_map, cells_inside_map);
+
+  // Move sphere 1 to the other refinement level and grow sphere 3. Only the
+  // regions covered by these spheres before and after the change are updated.
+  updated_boxes.clear();
+  updated_boxes.push_back(
+    SharpCutCellsMapping::sphere_bounding_box(positions[1], radii[1]));
+  updated_boxes.push_back(
+    SharpCutCellsMapping::sphere_bounding_box(positions[3], radii[3]));
+  positions[1] = sphere_center<dim>(-0.2, -0.4, 0.1);
+  radii[3]     = 0.3;
+  updated_boxes.push_back(
+    SharpCutCellsMapping::sphere_bounding_box(positions[1], radii[1]));
+  updated_boxes.push_back(
+    SharpCutCellsMapping::sphere_bounding_box(positions[3], radii[3]));
+
+  SharpCutCellsMapping::map_sphere_cut_cells(dof_handler,
+                                             positions,
+                                             radii,
+                                             updated_boxes,
+                                             cut_cells_map,
+                                             cells_inside_map);
+
+  deallog << "Incremental mapping after the motion of the spheres"
+          << std::endl;
+  compare_mappings(
+    dof_handler, positions, radii, cut_cells_map, cells_inside_map);
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      test<2>();
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
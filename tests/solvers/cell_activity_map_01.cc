@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 The Lethe Authors
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+
+/**
+ * @brief This code checks that the cell activity map of the matrix-based
+ * fluid dynamics solver does not change the Newton residuals and the solution
+ * of a partly quiescent flow. The domain is made of two disconnected squares.
+ * A rotating forcing drives the flow in the left square while the fluid of
+ * the right square stays at rest, such that the local matrices of its cells
+ * are reused. The same time steps are solved with and without the cell
+ * activity map.
+ */
+
+// Lethe
+#include <core/parameters.h>
+
+#include <solvers/fluid_dynamics_matrix_based.h>
+#include <solvers/simulation_parameters.h>
+
+
+// Deal.II includes
+#include <deal.II/base/function.h>
+#include <deal.II/base/parameter_handler.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+
+// Tests
+#include <../tests/tests.h>
+
+template <int dim>
+class RotatingForcingFunction : public Function<dim>
+{
+public:
+  RotatingForcingFunction()
+    : Function<dim>(3)
+  {}
+  virtual void
+  vector_value(const Point<dim> &p, Vector<double> &values) const;
+};
+template <int dim>
+void
+RotatingForcingFunction<dim>::vector_value(const Point<dim> &p,
+                                           Vector<double>   &values) const
+{
+  // The forcing rotates around the center of the left square and vanishes in
+  // the right square
+  values = 0;
+  if (p[0] < 1.5)
+    {
+      values(0) = -(p[1] - 0.5);
+      values(1) = p[0] - 0.5;
+    }
+}
+
+
+template <int dim>
+class CellActivityNavierStokes : public FluidDynamicsMatrixBased<dim>
+{
+public:
+  CellActivityNavierStokes(SimulationParameters<dim> nsparam)
+    : FluidDynamicsMatrixBased<dim>(nsparam)
+    , n_skipped_cells(0)
+  {}
+  void
+  run();
+
+  /// Norms of the right-hand side at every assembly, that is the Newton
+  /// residuals.
+  std::vector<double> newton_residuals;
+
+  /// Number of cells whose local matrix was reused, over all the assemblies.
+  unsigned int n_skipped_cells;
+
+  /// Solution at the end of the last time step.
+  Vector<double> final_solution;
+
+protected:
+  void
+  assemble_system_rhs() override
+  {
+    FluidDynamicsMatrixBased<dim>::assemble_system_rhs();
+    newton_residuals.push_back(this->system_rhs.l2_norm());
+  }
+
+  void
+  copy_local_matrix_to_global_matrix(
+    const StabilizedMethodsTensorCopyData<dim> &copy_data) override
+  {
+    if (copy_data.cell_is_local && copy_data.cell_assembly_skipped)
+      ++n_skipped_cells;
+    FluidDynamicsMatrixBased<dim>::copy_local_matrix_to_global_matrix(
+      copy_data);
+  }
+};
+
+template <int dim>
+void
+CellActivityNavierStokes<dim>::run()
+{
+  // Two disconnected unit squares
+  Triangulation<dim> left_square;
+  Triangulation<dim> right_square;
+  Triangulation<dim> squares;
+  GridGenerator::hyper_cube(left_square, 0, 1);
+  GridGenerator::hyper_cube(right_square, 2, 3);
+  GridGenerator::merge_triangulations(left_square, right_square, squares);
+  this->triangulation->copy_triangulation(squares);
+  this->triangulation->refine_global(3);
+  this->setup_dofs_fd();
+  this->forcing_function = std::make_shared<RotatingForcingFunction<dim>>();
+  Parameters::PhysicalProperties physical_properties;
+  physical_properties.fluids.resize(1);
+  physical_properties.number_of_fluids = 1;
+  physical_properties.fluids[0].rheological_model =
+    Parameters::Material::RheologicalModel::newtonian;
+  physical_properties.fluids[0].kinematic_viscosity = 1;
+  physical_properties.fluids[0].density_model =
+    Parameters::Material::DensityModel::constant;
+  physical_properties.number_of_solids                = 0;
+  physical_properties.number_of_material_interactions = 0;
+
+  this->simulation_parameters.physical_properties_manager.initialize(
+    physical_properties);
+
+  while (this->simulation_control->integrate())
+    {
+      this->forcing_function->set_time(
+        this->simulation_control->get_current_time());
+      this->define_dynamic_zero_constraints();
+      this->iterate();
+      this->finish_time_step();
+    }
+
+  final_solution = Vector<double>(*this->present_solution);
+}
+
+template <int dim>
+void
+solve_time_steps(const bool           enable_cell_activity_map,
+                 std::vector<double> &newton_residuals,
+                 Vector<double>      &solution,
+                 unsigned int        &n_skipped_cells)
+{
+  ParameterHandler              prm;
+  SimulationParameters<dim>     NSparam;
+  Parameters::SizeOfSubsections size_of_subsections;
+  size_of_subsections.boundary_conditions = 1;
+  size_of_subsections.manifolds           = 0;
+
+  NSparam.declare(prm, size_of_subsections);
+  NSparam.parse(prm);
+
+  // Manually alter some of the default parameters of the solver
+  NSparam.simulation_control.method =
+    Parameters::SimulationControl::TimeSteppingMethod::bdf1;
+  NSparam.simulation_control.dt       = 0.01;
+  NSparam.simulation_control.time_end = 0.05;
+  NSparam.linear_solver.at(PhysicsID::fluid_dynamics).verbosity =
+    Parameters::Verbosity::quiet;
+  NSparam.physics_solving_strategy.at(PhysicsID::fluid_dynamics).verbosity =
+    Parameters::Verbosity::quiet;
+  NSparam.physics_solving_strategy.at(PhysicsID::fluid_dynamics)
+    .enable_cell_activity_map = enable_cell_activity_map;
+  NSparam.boundary_conditions.createNoSlip();
+
+  CellActivityNavierStokes<dim> problem(NSparam);
+  problem.run();
+
+  newton_residuals = problem.newton_residuals;
+  solution         = problem.final_solution;
+  n_skipped_cells  = problem.n_skipped_cells;
+}
+
+void
+test()
+{
+  std::vector<double> reference_residuals;
+  std::vector<double> cell_activity_residuals;
+  Vector<double>      reference_solution;
+  Vector<double>      cell_activity_solution;
+  unsigned int        reference_n_skipped_cells;
+  unsigned int        cell_activity_n_skipped_cells;
+
+  // The output of the linear solvers is not written
+  const unsigned int previous_depth = deallog.depth_file(0);
+  solve_time_steps<2>(false,
+                      reference_residuals,
+                      reference_solution,
+                      reference_n_skipped_cells);
+  solve_time_steps<2>(true,
+                      cell_activity_residuals,
+                      cell_activity_solution,
+                      cell_activity_n_skipped_cells);
+  deallog.depth_file(previous_depth);
+
+  // The fluid of the right square stays exactly at rest, hence the cached
+  // local matrices are identical to the reassembled ones
+  const double tolerance = 1e-12;
+  bool         residuals_match =
+    reference_residuals.size() == cell_activity_residuals.size();
+  for (unsigned int i = 0; residuals_match && i < reference_residuals.size();
+       ++i)
+    residuals_match =
+      std::abs(reference_residuals[i] - cell_activity_residuals[i]) <=
+      tolerance * std::max(reference_residuals[i], 1.);
+
+  Vector<double> solution_difference(reference_solution);
+  solution_difference -= cell_activity_solution;
+  const bool solutions_match =
+    solution_difference.linfty_norm() <=
+    tolerance * std::max(reference_solution.linfty_norm(), 1.);
+
+  deallog << "Newton residuals with and without the cell activity map match: "
+          << (residuals_match ? "true" : "false") << std::endl;
+  deallog << "Solutions with and without the cell activity map match: "
+          << (solutions_match ? "true" : "false") << std::endl;
+  deallog << "Cells skipped without the cell activity map: "
+          << reference_n_skipped_cells << std::endl;
+  deallog << "Quiescent cells skipped with the cell activity map: "
+          << (cell_activity_n_skipped_cells > 0 ? "true" : "false")
+          << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}